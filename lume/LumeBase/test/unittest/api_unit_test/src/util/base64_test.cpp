@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include <base/containers/string.h>
 #include <base/containers/string_view.h>
 #include <base/containers/vector.h>
@@ -184,3 +186,44 @@ UNIT_TEST(API_UnitTest_Base64, DecodeNonPadded, testing::ext::TestSize.Level1)
         EXPECT_EQ(expected, result);
     }
 }
+
+/**
+ * @tc.name: DecodeLong
+ * @tc.desc: Inputs long enough for the vectorized path must decode the same as short ones, including the tail which
+ *           is not a multiple of the vector width.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_UnitTest_Base64, DecodeLong, testing::ext::TestSize.Level1)
+{
+    BASE_NS::vector<uint8_t> data;
+    for (size_t size = 0u; size < 300u; ++size) {
+        data.push_back(static_cast<uint8_t>(size * 7u + 3u));
+        const BASE_NS::string encoded = BASE_NS::Base64Encode(data);
+        const BASE_NS::vector<uint8_t> decoded = BASE_NS::Base64Decode(encoded);
+        ASSERT_EQ(data.size(), decoded.size());
+        EXPECT_TRUE(std::equal(data.cbegin(), data.cend(), decoded.cbegin()));
+    }
+}
+
+/**
+ * @tc.name: DecodeInvalidCharacters
+ * @tc.desc: Characters outside of the base64 alphabet decode as zero bits regardless of the input length.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_UnitTest_Base64, DecodeInvalidCharacters, testing::ext::TestSize.Level1)
+{
+    // every character value, with '=' replaced so that there's no padding.
+    BASE_NS::string encoded;
+    for (uint32_t c = 1u; c < 257u; ++c) {
+        encoded.push_back((c == '=') ? 'A' : static_cast<char>(c));
+    }
+    const BASE_NS::vector<uint8_t> decoded = BASE_NS::Base64Decode(encoded);
+    ASSERT_EQ(encoded.size() / 4u * 3u, decoded.size());
+    for (size_t i = 0u; i < encoded.size(); i += 4u) {
+        const char* src = encoded.data() + i;
+        const uint32_t bits = BASE_NS::Detail::FromBase64(src);
+        EXPECT_EQ(static_cast<uint8_t>(bits >> 16u), decoded[i / 4u * 3u]);
+        EXPECT_EQ(static_cast<uint8_t>(bits >> 8u), decoded[i / 4u * 3u + 1u]);
+        EXPECT_EQ(static_cast<uint8_t>(bits), decoded[i / 4u * 3u + 2u]);
+    }
+}
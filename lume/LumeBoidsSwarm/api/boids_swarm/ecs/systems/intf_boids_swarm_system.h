@@ -35,6 +35,14 @@ public:
     static constexpr BASE_NS::Math::IVec3 DEFAULT_AXIS_MASK{1, 0, 1};
     static constexpr float DEFAULT_VELOCITY_SMOOTHING_FACTOR = 0.5f;
 
+    /** How the neighbors within separation, alignment and cohesion distance are found. */
+    enum class NeighborSearch : uint8_t {
+        /** Test every boid against every other boid. */
+        BRUTE_FORCE = 0,
+        /** Test only the boids in the nearby cells of a uniform grid. Gives the same forces as BRUTE_FORCE. */
+        SPATIAL_HASH = 1,
+    };
+
     virtual void SetTimeStepSec(float timeStepSec) = 0;
     virtual float GetTimeStepSec() const = 0;
 
@@ -51,6 +59,9 @@ public:
     virtual void SetVelocitySmoothingFactor(float factor) = 0;
     virtual float GetVelocitySmoothingFactor() const = 0;
 
+    virtual void SetNeighborSearch(NeighborSearch neighborSearch) = 0;
+    virtual NeighborSearch GetNeighborSearch() const = 0;
+
 protected:
     IBoidsSwarmSystem() = default;
     IBoidsSwarmSystem(const IBoidsSwarmSystem&) = delete;
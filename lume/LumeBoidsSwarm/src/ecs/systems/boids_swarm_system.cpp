@@ -15,6 +15,9 @@
 
 #include "boids_swarm_system.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <random>
 #include <tuple>
 #include <utility>
@@ -28,6 +31,7 @@
 #include <core/perf/cpu_perf_scope.h>
 #include <core/property/property_types.h>
 #include <core/property_tools/property_api_impl.inl>
+#include <core/util/parallel_for.h>
 
 namespace {
 static constexpr uint32_t BOIDSSWARM_PROFILER_DEFAULT_COLOR{0xff00ff};
@@ -35,6 +39,13 @@ static constexpr uint32_t BOIDSSWARM_PROFILER_DEFAULT_COLOR{0xff00ff};
 static constexpr auto VELOCITY_COUNT{BOIDSSWARM_NS::BoidsSwarmStateComponent::VELOCITY_COUNT};
 static constexpr auto VELOCITY_CURRENT_INDEX{BOIDSSWARM_NS::BoidsSwarmStateComponent::VELOCITY_CURRENT_INDEX};
 
+// Below this the grid costs more than testing all pairs.
+static constexpr size_t MIN_SPATIAL_HASH_BOIDS{64U};
+static constexpr size_t MIN_PARALLEL_BOIDS{512U};
+static constexpr size_t MIN_TASK_SIZE{128U};
+// Keeps the cell coordinates well within int64_t when the boids are very far apart compared to the cell size.
+static constexpr double MAX_CELL_COORDINATE{1e15};
+
 struct GravityField {};
 struct RepulsionField {};
 
@@ -73,6 +84,13 @@ uint32_t GetQueryRowIndex(T IndexAsEnum)
     return static_cast<uint32_t>(IndexAsEnum);
 }
 
+uint32_t HashCell(int64_t x, int64_t y, int64_t z)
+{
+    const auto hash = (static_cast<uint64_t>(x) * 73856093ULL) ^ (static_cast<uint64_t>(y) * 19349663ULL) ^
+                      (static_cast<uint64_t>(z) * 83492791ULL);
+    return static_cast<uint32_t>(hash ^ (hash >> 32U));
+}
+
 BASE_NS::Math::Vec3 ClampMagnitude(const BASE_NS::Math::Vec3& v, float maxMagnitude)
 {
     float sqrMag = BASE_NS::Math::SqrMagnitude(v);
@@ -207,7 +225,7 @@ BoidsSwarmSystem::BoidsSwarmSystem(IEcs& ecs)
       boidsSwarmRepulsionManager_(*(GetManager<IBoidsSwarmRepulsionComponentManager>(ecs))),
       boidsSwarmStateManager_(*(GetManager<IBoidsSwarmStateComponentManager>(ecs))),
       transformManager_(*(GetManager<CORE3D_NS::ITransformComponentManager>(ecs))),
-      randomEngine_(std::random_device{}())
+      threadPool_(ecs.GetThreadPool()), randomEngine_(std::random_device{}())
 {}
 
 string_view BoidsSwarmSystem::GetName() const
@@ -409,12 +427,135 @@ void BoidsSwarmSystem::PreRun()
     }
 }
 
+bool BoidsSwarmSystem::BuildSpatialHash()
+{
+    const size_t count = frameDatas_.size();
+    if ((neighborSearch_ != NeighborSearch::SPATIAL_HASH) || (count < MIN_SPATIAL_HASH_BOIDS)) {
+        return false;
+    }
+
+    float maxDistance = 0.f;
+    constexpr float maxFloat = std::numeric_limits<float>::max();
+    Math::Vec3 minPos(maxFloat, maxFloat, maxFloat);
+    Math::Vec3 maxPos(-maxFloat, -maxFloat, -maxFloat);
+    for (size_t i = 0; i < count; ++i) {
+        const auto& frameData = frameDatas_[i];
+        maxDistance = Math::max(maxDistance, Math::max(frameData.separationDistance,
+                                                 Math::max(frameData.alignmentDistance, frameData.cohesionDistance)));
+        const Math::Vec3 position = positions_[i] * axisMaskFloat_;
+        if (!std::isfinite(position.x) || !std::isfinite(position.y) || !std::isfinite(position.z)) {
+            return false;
+        }
+        minPos = Math::min(minPos, position);
+        maxPos = Math::max(maxPos, position);
+    }
+    if (!(maxDistance > 0.f) || !std::isfinite(maxDistance)) {
+        return false;
+    }
+
+    // Cells at least as large as the largest neighbor distance keep all neighbors within the adjacent cells. The
+    // margin covers the rounding of the float distances which are compared against the thresholds.
+    const double maxCoordinate = Math::max(Math::max(Math::abs(minPos.x), Math::abs(maxPos.x)),
+        Math::max(Math::max(Math::abs(minPos.y), Math::abs(maxPos.y)),
+            Math::max(Math::abs(minPos.z), Math::abs(maxPos.z))));
+    const double cellSize = static_cast<double>(maxDistance) * 1.001 + maxCoordinate * 1e-6;
+    const double invCellSize = 1.0 / cellSize;
+    const double maxExtent = Math::max(maxPos.x - minPos.x, Math::max(maxPos.y - minPos.y, maxPos.z - minPos.z));
+    if (!(maxExtent * invCellSize < MAX_CELL_COORDINATE)) {
+        return false;
+    }
+
+    uint32_t tableSize = 1U;
+    while (tableSize < (count * 2U)) {
+        tableSize <<= 1U;
+    }
+    const uint32_t tableMask = tableSize - 1U;
+
+    cells_.resize(count);
+    buckets_.resize(count);
+    cellStarts_.clear();
+    cellStarts_.resize(tableSize + 1U, 0U);
+    for (size_t i = 0; i < count; ++i) {
+        const Math::Vec3 position = positions_[i] * axisMaskFloat_;
+        auto& cell = cells_[i];
+        cell.x = static_cast<int64_t>(std::floor((static_cast<double>(position.x) - minPos.x) * invCellSize));
+        cell.y = static_cast<int64_t>(std::floor((static_cast<double>(position.y) - minPos.y) * invCellSize));
+        cell.z = static_cast<int64_t>(std::floor((static_cast<double>(position.z) - minPos.z) * invCellSize));
+        buckets_[i] = HashCell(cell.x, cell.y, cell.z) & tableMask;
+        ++cellStarts_[buckets_[i] + 1U];
+    }
+    for (uint32_t bucket = 1U; bucket <= tableSize; ++bucket) {
+        cellStarts_[bucket] += cellStarts_[bucket - 1U];
+    }
+    // Filling in index order keeps the boids of each bucket sorted. After filling each start points to the start of
+    // the next bucket, shift them back.
+    cellItems_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        cellItems_[cellStarts_[buckets_[i]]++] = static_cast<uint32_t>(i);
+    }
+    for (uint32_t bucket = tableSize; bucket > 0U; --bucket) {
+        cellStarts_[bucket] = cellStarts_[bucket - 1U];
+    }
+    cellStarts_[0U] = 0U;
+    return true;
+}
+
+void BoidsSwarmSystem::GatherCandidates(size_t i, vector<uint32_t>& candidates) const
+{
+    candidates.clear();
+
+    const auto tableMask = static_cast<uint32_t>(cellStarts_.size() - 2U);
+    const auto& cell = cells_[i];
+    const int64_t rangeX = axisMask_.x ? 1 : 0;
+    const int64_t rangeY = axisMask_.y ? 1 : 0;
+    const int64_t rangeZ = axisMask_.z ? 1 : 0;
+    uint32_t buckets[27U];
+    size_t bucketCount = 0U;
+    for (int64_t z = cell.z - rangeZ; z <= cell.z + rangeZ; ++z) {
+        for (int64_t y = cell.y - rangeY; y <= cell.y + rangeY; ++y) {
+            for (int64_t x = cell.x - rangeX; x <= cell.x + rangeX; ++x) {
+                buckets[bucketCount++] = HashCell(x, y, z) & tableMask;
+            }
+        }
+    }
+    // Several cells can hash to the same bucket.
+    std::sort(buckets, buckets + bucketCount);
+    const auto bucketsEnd = std::unique(buckets, buckets + bucketCount);
+    for (auto bucket = buckets; bucket != bucketsEnd; ++bucket) {
+        candidates.append(cellItems_.cbegin() + cellStarts_[*bucket], cellItems_.cbegin() + cellStarts_[*bucket + 1U]);
+    }
+    // Visiting the neighbors in index order sums the forces in the same order as testing all boids.
+    std::sort(candidates.begin(), candidates.end());
+}
+
 void BoidsSwarmSystem::Run()
 {
 #if (BOIDSSWARM_DEV_ENABLED == 1)
     CORE_CPU_PERF_SCOPE("BOIDSSWARM", "BoidsSwarmSystem", "Run", BOIDSSWARM_PROFILER_DEFAULT_COLOR);
 #endif
+    useSpatialHash_ = BuildSpatialHash();
+
+    const size_t count = frameDatas_.size();
+    const auto threadCount = threadPool_ ? threadPool_->GetNumberOfThreads() : 0U;
+    if ((threadCount <= 1U) || (count < MIN_PARALLEL_BOIDS)) {
+        taskCandidates_.resize(1U);
+        ComputeForces(0U, count, taskCandidates_[0U]);
+        return;
+    }
+    // Each boid writes only its own frame data. The calling thread computes batches too, so this completes even if
+    // the pool threads are busy. Every batch has its own candidate list.
+    const auto taskSize = Math::max(MIN_TASK_SIZE, count / (threadCount + 1U));
+    const auto tasks = (count + taskSize - 1U) / taskSize;
+
+    taskCandidates_.resize(tasks);
+    ParallelFor(threadPool_.get(), tasks, [this, count, taskSize](size_t task) {
+        const auto begin = task * taskSize;
+        ComputeForces(begin, Math::min(begin + taskSize, count), taskCandidates_[task]);
+    });
+}
 
+void BoidsSwarmSystem::ComputeForces(size_t begin, size_t end, vector<uint32_t>& candidates)
+{
     auto computeNeighborForces = [&](size_t i) {
 #if (BOIDSSWARM_DEV_ENABLED == 1)
         CORE_CPU_PERF_SCOPE(
@@ -453,9 +594,9 @@ void BoidsSwarmSystem::Run()
                     processFunc(delta, distSq, j);
                 }
             } else {
-                for (size_t j = 0; j < count; ++j) {
+                auto processCandidate = [&](size_t j) {
                     if (i == j) {
-                        continue;
+                        return;
                     }
                     const Math::Vec3 otherPosProjected = positions_[j] * axisMaskFloat_;
                     const Math::Vec3 delta = otherPosProjected - myPosProjected;
@@ -463,10 +604,24 @@ void BoidsSwarmSystem::Run()
                     if (distSq <= distSqThreshold) {
                         processFunc(delta, distSq, j);
                     }
+                };
+                if (useSpatialHash_) {
+                    for (const auto j : candidates) {
+                        processCandidate(j);
+                    }
+                } else {
+                    for (size_t j = 0; j < count; ++j) {
+                        processCandidate(j);
+                    }
                 }
             }
         };
 
+        if (useSpatialHash_ && (swarmComp->separationTargets.empty() || swarmComp->alignmentTargets.empty() ||
+                                   swarmComp->cohesionTargets.empty())) {
+            GatherCandidates(i, candidates);
+        }
+
         processNeighbors(
             swarmComp->separationTargets, separationDistSq, [&](const Math::Vec3& delta, float distSq, size_t j) {
                 const float k = separationDistSq > Math::EPSILON ? 1.f - distSq / separationDistSq : 1.f;
@@ -607,9 +762,7 @@ void BoidsSwarmSystem::Run()
         return boundaryForce;
     };
 
-    size_t count = frameDatas_.size();
-
-    for (size_t i = 0; i < count; ++i) {
+    for (size_t i = begin; i < end; ++i) {
         auto& frameData = frameDatas_[i];
 
         computeNeighborForces(i);
@@ -30,8 +30,10 @@
 #include <base/containers/array_view.h>
 #include <base/containers/unordered_map.h>
 #include <base/containers/vector.h>
+#include <core/ecs/intf_ecs.h>
 #include <core/ecs/intf_system.h>
 #include <core/namespace.h>
+#include <core/threading/intf_thread_pool.h>
 
 CORE_BEGIN_NAMESPACE()
 class IEcs;
@@ -122,7 +124,23 @@ public:
         return velocitySmoothingFactor_;
     }
 
+    void SetNeighborSearch(NeighborSearch neighborSearch) override
+    {
+        neighborSearch_ = neighborSearch;
+    }
+
+    NeighborSearch GetNeighborSearch() const override
+    {
+        return neighborSearch_;
+    }
+
 private:
+    struct CellCoord {
+        int64_t x;
+        int64_t y;
+        int64_t z;
+    };
+
     void ResetBoid(
         const BoidsSwarmComponent& swarm, CORE3D_NS::TransformComponent& transform, BoidsSwarmStateComponent& state);
     void Reset();
@@ -131,6 +149,9 @@ private:
     void PreRun();
     void Run();
     void PostRun();
+    bool BuildSpatialHash();
+    void GatherCandidates(size_t i, BASE_NS::vector<uint32_t>& candidates) const;
+    void ComputeForces(size_t begin, size_t end, BASE_NS::vector<uint32_t>& candidates);
     void LimitTurnRate(BoidsSwarmFrameData& frameData, const BASE_NS::Math::Vec3& up);
 
     void OnComponentEvent(CORE_NS::IEcs::ComponentListener::EventType type,
@@ -156,6 +177,18 @@ private:
     BASE_NS::unordered_map<CORE_NS::Entity, bool> notPlayedEntities_;
     BASE_NS::unordered_map<CORE_NS::Entity, size_t> entity2indices_;
 
+    NeighborSearch neighborSearch_{NeighborSearch::SPATIAL_HASH};
+    // Spatial hash rebuilt every step. Boids are bucketed by the hash of their cell, cellItems_ holds the boid indices
+    // of bucket b in [cellStarts_[b], cellStarts_[b + 1]).
+    bool useSpatialHash_{false};
+    BASE_NS::vector<CellCoord> cells_;
+    BASE_NS::vector<uint32_t> buckets_;
+    BASE_NS::vector<uint32_t> cellStarts_;
+    BASE_NS::vector<uint32_t> cellItems_;
+
+    CORE_NS::IThreadPool::Ptr threadPool_;
+    BASE_NS::vector<BASE_NS::vector<uint32_t>> taskCandidates_;
+
     float timeStepSec_{DEFAULT_TIME_STEP_SEC};
     float playSpeed_{DEFAULT_PLAY_SPEED};
     uint64_t accumulatedTime_{0};
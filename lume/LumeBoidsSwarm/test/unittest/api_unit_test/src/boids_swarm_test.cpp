@@ -25,6 +25,7 @@
 #include <3d/intf_graphics_context.h>
 #include <base/containers/string.h>
 #include <base/containers/unique_ptr.h>
+#include <base/containers/vector.h>
 #include <base/math/vector_util.h>
 #include <core/intf_engine.h>
 #include <core/log.h>
@@ -32,6 +33,8 @@
 #include <core/property/intf_property_api.h>
 #include <render/intf_render_context.h>
 
+#include <random>
+
 #include "test_framework.h"
 #if defined(UNIT_TESTS_USE_HCPPTEST)
 #include "test_runner_ohos_system.h"
@@ -521,6 +524,90 @@ UNIT_TEST_F(API_BoidsSwarmSystemTest, IBoidsSwarmSystem23, testing::ext::TestSiz
     nodeSystem->DestroyNode(*nodeSystem->GetNode(entity));
 }
 
+/**
+ * @tc.name: IBoidsSwarmSystem24
+ * @tc.desc: Verify the spatial hash neighbor search gives exactly the same velocities and positions as brute force.
+ * @tc.type: FUNC
+ */
+UNIT_TEST_F(API_BoidsSwarmSystemTest, IBoidsSwarmSystem24, testing::ext::TestSize.Level1)
+{
+    using NeighborSearch = BOIDSSWARM_NS::IBoidsSwarmSystem::NeighborSearch;
+
+    TestContext* testContext = GetTestContext();
+    auto ecsContext = testContext->ecs;
+
+    BOIDSSWARM_NS::IBoidsSwarmSystem* system = GetBoidsSwarmSystem(*ecsContext);
+    ASSERT_TRUE(system);
+    EXPECT_EQ(system->GetNeighborSearch(), NeighborSearch::SPATIAL_HASH);
+
+    auto* transformManager = CORE_NS::GetManager<CORE3D_NS::ITransformComponentManager>(*ecsContext);
+    auto* stateManager = CORE_NS::GetManager<BOIDSSWARM_NS::IBoidsSwarmStateComponentManager>(*ecsContext);
+    ASSERT_TRUE(transformManager);
+    ASSERT_TRUE(stateManager);
+
+    // enough boids for the grid and for splitting the work between threads.
+    constexpr size_t boidCount = 1000U;
+    std::mt19937 rng(11U);
+    std::uniform_real_distribution<float> position(-25.0f, 25.0f);
+    std::uniform_real_distribution<float> velocity(-1.0f, 1.0f);
+
+    CORE3D_NS::INodeSystem* nodeSystem = nullptr;
+    CORE_NS::IComponentManager* cm = nullptr;
+    BASE_NS::vector<CORE_NS::Entity> entities;
+    BASE_NS::vector<BASE_NS::Math::Vec3> initialPositions;
+    for (size_t i = 0U; i < boidCount; ++i) {
+        const CORE_NS::Entity entity = CreateSwarmEntity(*ecsContext, nodeSystem, cm);
+        ASSERT_TRUE(nodeSystem);
+        ASSERT_TRUE(cm);
+        SetupSwarmForTick(*ecsContext, entity, cm);
+        CORE_NS::ScopedHandle<BOIDSSWARM_NS::BoidsSwarmComponent> data(cm->GetData(entity));
+        data->boundaryMinPos = {-30.0f, 0.0f, -30.0f};
+        data->boundaryMaxPos = {30.0f, 10.0f, 30.0f};
+        data->initialPosition = {position(rng), 0.0f, position(rng)};
+        data->initialVelocity = {velocity(rng), 0.0f, velocity(rng)};
+        data->initialRotation = {0.0f, 0.0f, 0.0f, 1.0f};
+        entities.push_back(entity);
+        initialPositions.push_back(data->initialPosition);
+    }
+    ecsContext->ProcessEvents();
+
+    const auto timeStepUs = static_cast<uint64_t>(system->GetTimeStepSec() * 1000000.0f);
+    constexpr auto currentIndex = BOIDSSWARM_NS::BoidsSwarmStateComponent::VELOCITY_CURRENT_INDEX;
+    auto simulate = [&](NeighborSearch neighborSearch) {
+        system->SetNeighborSearch(neighborSearch);
+        // the first update resets the boids to the initial values, the second runs one step.
+        system->Stop();
+        system->Play();
+        system->Update(false, 0U, 0U);
+        system->Update(false, 0U, timeStepUs);
+
+        BASE_NS::vector<BASE_NS::Math::Vec3> result;
+        for (const auto entity : entities) {
+            result.push_back(transformManager->Read(entity)->position);
+            result.push_back(stateManager->Read(entity)->velocities[currentIndex]);
+        }
+        return result;
+    };
+
+    const auto bruteForce = simulate(NeighborSearch::BRUTE_FORCE);
+    const auto spatialHash = simulate(NeighborSearch::SPATIAL_HASH);
+    ASSERT_EQ(bruteForce.size(), spatialHash.size());
+    size_t moved = 0U;
+    for (size_t i = 0U; i < bruteForce.size(); ++i) {
+        EXPECT_EQ(bruteForce[i].x, spatialHash[i].x);
+        EXPECT_EQ(bruteForce[i].y, spatialHash[i].y);
+        EXPECT_EQ(bruteForce[i].z, spatialHash[i].z);
+        if (((i % 2U) == 0U) && (bruteForce[i].x != initialPositions[i / 2U].x)) {
+            ++moved;
+        }
+    }
+    EXPECT_EQ(moved, boidCount);
+
+    for (const auto entity : entities) {
+        nodeSystem->DestroyNode(*nodeSystem->GetNode(entity));
+    }
+}
+
 // ============================================================================
 // BoidsSwarmComponent property read/write tests
 // ============================================================================
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include <boids_swarm/ecs/components/boids_swarm_component.h>
+#include <boids_swarm/ecs/systems/intf_boids_swarm_system.h>
+#include <boids_swarm/implementation_uids.h>
+
+#include <3d/ecs/components/transform_component.h>
+#include <3d/implementation_uids.h>
+#include <base/containers/vector.h>
+#include <core/ecs/intf_ecs.h>
+#include <core/ecs/intf_entity_manager.h>
+#include <core/engine_info.h>
+#include <core/implementation_uids.h>
+#include <core/intf_engine.h>
+#include <core/os/platform_create_info.h>
+#include <core/plugin/intf_plugin_register.h>
+#include <render/implementation_uids.h>
+
+BOIDSSWARM_BEGIN_NAMESPACE()
+namespace benchmarks {
+namespace {
+using NeighborSearch = IBoidsSwarmSystem::NeighborSearch;
+
+// The render and 3D plugins register the transform component, no render context is needed for simulating.
+struct Context {
+    Context()
+    {
+        CORE_NS::CreatePluginRegistry(CORE_NS::PlatformCreateInfo{});
+        constexpr BASE_NS::Uid uids[]{RENDER_NS::UID_RENDER_PLUGIN, CORE3D_NS::UID_3D_PLUGIN, UID_BOIDS_SWARM_PLUGIN};
+        CORE_NS::GetPluginRegister().LoadPlugins(uids);
+
+        const CORE_NS::EngineCreateInfo engineCreateInfo{{}, {"boids_swarm_benchmark", 0, 1, 0}, {}};
+        auto factory = CORE_NS::GetInstance<CORE_NS::IEngineFactory>(CORE_NS::UID_ENGINE_FACTORY);
+        engine = factory->Create(engineCreateInfo);
+        engine->Init();
+        ecs = engine->CreateEcs();
+        ecs->Initialize();
+    }
+
+    CORE_NS::IEngine::Ptr engine;
+    CORE_NS::IEcs::Ptr ecs;
+};
+
+Context& GetContext()
+{
+    static Context context;
+    return context;
+}
+
+// Boids spread over a square on the XZ plane with on average a few dozen boids within the cohesion distance.
+BASE_NS::vector<CORE_NS::Entity> CreateBoids(CORE_NS::IEcs& ecs, size_t count)
+{
+    auto* swarmManager = CORE_NS::GetManager<IBoidsSwarmComponentManager>(ecs);
+    auto* transformManager = CORE_NS::GetManager<CORE3D_NS::ITransformComponentManager>(ecs);
+
+    const float halfSize = 2.0f * BASE_NS::Math::sqrt(static_cast<float>(count));
+    std::mt19937 rng(3U);
+    std::uniform_real_distribution<float> position(-halfSize, halfSize);
+    std::uniform_real_distribution<float> velocity(-1.0f, 1.0f);
+
+    BASE_NS::vector<CORE_NS::Entity> entities;
+    entities.reserve(count);
+    for (size_t i = 0U; i < count; ++i) {
+        const CORE_NS::Entity entity = ecs.GetEntityManager().Create();
+        transformManager->Create(entity);
+        swarmManager->Create(entity);
+        auto swarm = swarmManager->Write(entity);
+        swarm->initialPosition = {position(rng), 0.0f, position(rng)};
+        swarm->initialVelocity = {velocity(rng), 0.0f, velocity(rng)};
+        swarm->boundaryMinPos = {-halfSize, -1.0f, -halfSize};
+        swarm->boundaryMaxPos = {halfSize, 1.0f, halfSize};
+        swarm->separationDistance = 1.0f;
+        swarm->alignmentDistance = 3.0f;
+        swarm->cohesionDistance = 4.0f;
+        entities.push_back(entity);
+    }
+    ecs.ProcessEvents();
+    return entities;
+}
+
+// Runs one simulation step per iteration. Arguments: boid count, NeighborSearch.
+void BoidsSwarmStep(benchmark::State& state)
+{
+    auto& ecs = *GetContext().ecs;
+    auto* system = CORE_NS::GetSystem<IBoidsSwarmSystem>(ecs);
+    if (!system) {
+        state.SkipWithError("BoidsSwarmSystem not available");
+        return;
+    }
+    const auto entities = CreateBoids(ecs, static_cast<size_t>(state.range(0)));
+    system->SetNeighborSearch(static_cast<NeighborSearch>(state.range(1)));
+    system->Play();
+    // the first update only resets the boids to their initial values.
+    system->Update(false, 0U, 0U);
+
+    const auto timeStepUs = static_cast<uint64_t>(system->GetTimeStepSec() * 1000000.0f);
+    for (auto _ : state) {
+        system->Update(false, 0U, timeStepUs);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    ecs.GetEntityManager().DestroyAllEntities();
+    ecs.ProcessEvents();
+}
+}  // namespace
+
+BENCHMARK(BoidsSwarmStep)
+    ->ArgsProduct({{1000, 10000}, {static_cast<int64_t>(NeighborSearch::BRUTE_FORCE),
+                                      static_cast<int64_t>(NeighborSearch::SPATIAL_HASH)}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+}  // namespace benchmarks
+BOIDSSWARM_END_NAMESPACE()
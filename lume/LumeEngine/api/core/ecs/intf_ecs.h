@@ -230,6 +230,30 @@ public:
      */
     virtual uint64_t GetId() const = 0;
 
+    /** Defines how systems are updated during IEcs::Update. */
+    enum class SystemUpdateMode : uint8_t {
+        /** Systems are updated one after another in the system order on the calling thread. */
+        SEQUENTIAL,
+        /** Systems are grouped by their component dependencies (SystemTypeInfo::componentDependencies and
+         * readOnlyComponentDependencies) and ordering constraints (afterSystem, beforeSystem). Systems in the same
+         * group don't conflict with each other and are updated in parallel using the ECS thread pool. Systems which
+         * don't declare dependencies, use a wild card or whose type info isn't registered to the plugin register are
+         * updated alone. Systems must not touch state shared with other systems (e.g. create entities) without
+         * declaring it through their dependencies. Systems may be updated from a thread of the ECS thread pool, so
+         * parallel work of their own must not block waiting for tasks pushed to the same pool (use ParallelFor).
+         */
+        PARALLEL,
+    };
+
+    /** Set the system update mode. Default is SystemUpdateMode::SEQUENTIAL.
+     * @param mode System update mode.
+     */
+    virtual void SetSystemUpdateMode(SystemUpdateMode mode) = 0;
+
+    /** Get the system update mode.
+     */
+    virtual SystemUpdateMode GetSystemUpdateMode() const = 0;
+
     using Ptr = BASE_NS::refcnt_ptr<IEcs>;
 
 protected:
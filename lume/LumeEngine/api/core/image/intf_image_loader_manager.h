@@ -64,6 +64,97 @@ public:
         IAnimatedImage::Ptr image;
     };
 
+    /** Order in which queued asynchronous loads are started. Loads with the same priority start in request order. */
+    enum class LoadPriority : uint8_t {
+        LOW = 0,
+        NORMAL = 1,
+        HIGH = 2,
+    };
+
+    /** Describes one image of an asynchronous load. */
+    struct AsyncLoadRequest {
+        /** Uri to image. */
+        BASE_NS::string_view uri;
+        /** Load flags. Combination of #ImageLoaderFlags */
+        uint32_t loadFlags{0U};
+        /** Priority of the load. */
+        LoadPriority priority{LoadPriority::NORMAL};
+    };
+
+    /** State of an asynchronous load. */
+    enum class AsyncLoadStatus : uint8_t {
+        /** Waiting for a thread. */
+        PENDING = 0,
+        /** Being decoded. */
+        RUNNING = 1,
+        /** Finished, successfully or not. */
+        DONE = 2,
+        /** Cancelled before it was started. */
+        CANCELLED = 3,
+    };
+
+    /** Handle to an asynchronous load of a single image. Destroying the handle cancels the load if it is still pending,
+     * a running load is finished but its result is discarded.
+     */
+    class IAsyncLoad {
+    public:
+        /** Current state of the load. */
+        virtual AsyncLoadStatus GetStatus() const = 0;
+
+        /** Block until the load is done or cancelled. */
+        virtual void Wait() = 0;
+
+        /** Cancel the load if it has not been started yet.
+         * @return True if the load was cancelled, false if it was already running or done.
+         */
+        virtual bool Cancel() = 0;
+
+        /** Result of the load. Only valid after the status is DONE or CANCELLED, e.g. after calling Wait. */
+        virtual LoadResult& GetResult() = 0;
+
+        struct Deleter {
+            constexpr Deleter() noexcept = default;
+            void operator()(IAsyncLoad* ptr) const
+            {
+                ptr->Destroy();
+            }
+        };
+        using Ptr = BASE_NS::unique_ptr<IAsyncLoad, Deleter>;
+
+    protected:
+        IAsyncLoad() = default;
+        virtual ~IAsyncLoad() = default;
+        virtual void Destroy() = 0;
+    };
+
+    /** Receives completion of asynchronous loads. Called from the decoding thread as soon as each image has been
+     * decoded, before the status of the load changes to DONE. Cancelled loads are not reported.
+     */
+    class IAsyncLoadListener {
+    public:
+        /** Called when an image has been loaded.
+         * @param index Index of the image in the requests given to LoadImagesAsync.
+         * @param result Result of the load. The image may be moved out, GetResult will then return it empty.
+         */
+        virtual void OnImageLoaded(size_t index, LoadResult& result) = 0;
+
+    protected:
+        IAsyncLoadListener() = default;
+        virtual ~IAsyncLoadListener() = default;
+    };
+
+    /** Counters of the decoded image cache. */
+    struct ImageCacheStatistics {
+        /** Loads which were served from the cache. */
+        uint64_t hits{0U};
+        /** Loads which had to decode the image. */
+        uint64_t misses{0U};
+        /** Bytes of decoded data held by the cache. Each image counts at least a small fixed amount. */
+        size_t bytes{0U};
+        /** Number of images held by the cache. */
+        size_t imageCount{0U};
+    };
+
     /** Describes supported format. */
     struct ImageType {
         /** Media type (Multipurpose Internet Mail Extensions or MIME). */
@@ -88,6 +179,17 @@ public:
         IMAGE_LOADER_PREMULTIPLY_ALPHA = 0x00000020,
         /** Only load image metadata (size and format) */
         IMAGE_LOADER_METADATA_ONLY = 0x00000040,
+        /** Decode at half the width and height. Loaders which cannot decode at a reduced size ignore the hint, e.g.
+         * the JPEG loader scales while decoding the DCT blocks, which is much cheaper than decoding at full size, and
+         * the KTX2 loader leaves out the largest mip levels without reading them. The reduced size is also reported
+         * with IMAGE_LOADER_METADATA_ONLY. */
+        IMAGE_LOADER_DOWNSCALE_2X = 0x00000080,
+        /** Decode at a quarter of the width and height, see IMAGE_LOADER_DOWNSCALE_2X. */
+        IMAGE_LOADER_DOWNSCALE_4X = 0x00000100,
+        /** Decode at an eighth of the width and height, see IMAGE_LOADER_DOWNSCALE_2X. */
+        IMAGE_LOADER_DOWNSCALE_8X = 0x00000180,
+        /** Mask of the downscale values, which are mutually exclusive. */
+        IMAGE_LOADER_DOWNSCALE_MASK = 0x00000180,
     };
 
     /** Interface for defining loaders for different image formats. */
@@ -240,6 +342,31 @@ public:
      */
     virtual BASE_NS::vector<ImageType> GetSupportedTypes() const = 0;
 
+    /** Decode images in parallel using the engine thread pool. Without a thread pool the images are loaded before
+     * returning. Loads start in priority order, and each one is reported to the listener as soon as it finishes so
+     * that e.g. GPU uploads do not have to wait for the whole batch.
+     * @param requests Images to load.
+     * @param listener Optional listener for completed loads. Must stay valid until every returned load is done or
+     * cancelled.
+     * @return Handle for each request, in the same order.
+     */
+    virtual BASE_NS::vector<IAsyncLoad::Ptr> LoadImagesAsync(
+        BASE_NS::array_view<const AsyncLoadRequest> requests, IAsyncLoadListener* listener) = 0;
+
+    /** Set the memory budget of the decoded image cache. Images loaded by uri are cached by the uri and load flags,
+     * images loaded from memory by a hash of the data and the load flags. Cache hits share the decoded data instead of
+     * decoding again. When the budget is exceeded the least recently used images are dropped. Loads from an IFile are
+     * not cached.
+     * @param bytes Budget in bytes of decoded data. Zero disables the cache, which is the default.
+     */
+    virtual void SetImageCacheBudget(size_t bytes) = 0;
+
+    /** Drop all images from the decoded image cache. Images already returned stay valid. */
+    virtual void ClearImageCache() = 0;
+
+    /** Return the counters of the decoded image cache. Also reported through the "ImageCache" performance data. */
+    virtual ImageCacheStatistics GetImageCacheStatistics() const = 0;
+
 protected:
     IImageLoaderManager() = default;
     virtual ~IImageLoaderManager() = default;
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef API_CORE_IMAGE_PIXEL_CONVERSION_H
+#define API_CORE_IMAGE_PIXEL_CONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#if defined(BASE_SIMD) && defined(_M_X64)
+#include <immintrin.h>
+#elif defined(_M_ARM64) || defined(__ARM_ARCH_ISA_A64)
+#include <arm_neon.h>
+#endif
+
+#include <base/math/mathf.h>
+#include <core/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+/** Pixel conversions shared by the image loaders.
+ * The 8 bit linear paths process 16 bytes at a time with SSE2 or NEON and give the same results as the scalar code.
+ */
+namespace PixelConversion {
+namespace Detail {
+struct SrgbPremultiplyTable {
+    /** Premultiplied sRGB value, indexed with alpha * 256 + sRGB value. */
+    uint8_t values[256U * 256U];
+    /** True if alpha 255 gives back the original values, so that opaque pixels can be skipped. */
+    bool opaqueIsIdentity;
+};
+
+inline void InitializeSrgbPremultiplyTable(SrgbPremultiplyTable& table)
+{
+    // Premultiply in linear space and reencode to sRGB. Formulas from https://en.wikipedia.org/wiki/SRGB
+    table.opaqueIsIdentity = true;
+    for (uint32_t a = 0; a < 256U; a++) {
+        const float alpha = static_cast<float>(a) / 255.f;
+        for (uint32_t sRGB = 0; sRGB < 256U; sRGB++) {
+            float color = static_cast<float>(sRGB) / 255.f;
+            if (color <= 0.04045f) {
+                color *= (1.f / 12.92f);
+            } else {
+                color = BASE_NS::Math::pow((color + 0.055f) * (1.f / 1.055f), 2.4f);
+            }
+            float premultiplied = color * alpha;
+            if (premultiplied <= 0.0031308f) {
+                premultiplied *= 12.92f;
+            } else {
+                premultiplied = 1.055f * BASE_NS::Math::pow(premultiplied, 1.f / 2.4f) - 0.055f;
+            }
+            const auto value = static_cast<uint8_t>(BASE_NS::Math::round(premultiplied * 255.f));
+            table.values[a * 256U + sRGB] = value;
+            if ((a == 255U) && (value != sRGB)) {
+                table.opaqueIsIdentity = false;
+            }
+        }
+    }
+}
+
+inline const SrgbPremultiplyTable& GetSrgbPremultiplyTable()
+{
+    static SrgbPremultiplyTable table;
+    static std::once_flag once;
+    std::call_once(once, InitializeSrgbPremultiplyTable, table);
+    return table;
+}
+
+#if defined(BASE_SIMD) && defined(_M_X64)
+#define CORE_PIXEL_CONVERSION_SIMD 1
+// color * alpha / 255 rounded down for eight 16 bit lanes. (x + 1 + (x >> 8)) >> 8 is exact for x below 65535, and
+// 255 * 255 = 65025.
+inline __m128i MultiplyDivide255(__m128i color, __m128i alpha)
+{
+    const __m128i x = _mm_mullo_epi16(color, alpha);
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+
+// Premultiply 16 bytes of pixels, alphaShuffle copies the alpha of each pixel to all of its 16 bit lanes.
+template<int alphaShuffle>
+inline __m128i PremultiplyLinear(__m128i pixels, __m128i alphaMask)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+    const __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+    const __m128i loAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, alphaShuffle), alphaShuffle);
+    const __m128i hiAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, alphaShuffle), alphaShuffle);
+    const __m128i result = _mm_packus_epi16(MultiplyDivide255(lo, loAlpha), MultiplyDivide255(hi, hiAlpha));
+    // alpha itself is kept as is.
+    return _mm_or_si128(_mm_andnot_si128(alphaMask, result), _mm_and_si128(alphaMask, pixels));
+}
+#elif defined(_M_ARM64) || defined(__ARM_ARCH_ISA_A64)
+#define CORE_PIXEL_CONVERSION_SIMD 1
+// color * alpha / 255 rounded down for 16 bytes, see the SSE2 version.
+inline uint8x16_t MultiplyDivide255(uint8x16_t color, uint8x16_t alpha)
+{
+    const uint16x8_t one = vdupq_n_u16(1U);
+    const uint16x8_t lo = vmull_u8(vget_low_u8(color), vget_low_u8(alpha));
+    const uint16x8_t hi = vmull_high_u8(color, alpha);
+    return vcombine_u8(vshrn_n_u16(vaddq_u16(vaddq_u16(lo, one), vshrq_n_u16(lo, 8)), 8),
+        vshrn_n_u16(vaddq_u16(vaddq_u16(hi, one), vshrq_n_u16(hi, 8)), 8));
+}
+#endif
+
+#if defined(CORE_PIXEL_CONVERSION_SIMD)
+// Returns the number of pixels processed, the rest are left for the scalar loop.
+inline size_t PremultiplyLinear8(uint8_t* pixels, size_t pixelCount, uint32_t channelCount)
+{
+    size_t done = 0U;
+#if defined(BASE_SIMD) && defined(_M_X64)
+    const size_t pixelsPerBlock = 16U / channelCount;
+    if (channelCount == 4U) {
+        const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xff000000U));
+        for (; (done + pixelsPerBlock) <= pixelCount; done += pixelsPerBlock) {
+            auto* block = reinterpret_cast<__m128i*>(pixels + done * 4U);
+            _mm_storeu_si128(block, PremultiplyLinear<_MM_SHUFFLE(3, 3, 3, 3)>(_mm_loadu_si128(block), alphaMask));
+        }
+    } else {
+        const __m128i alphaMask = _mm_set1_epi16(static_cast<short>(0xff00U));
+        for (; (done + pixelsPerBlock) <= pixelCount; done += pixelsPerBlock) {
+            auto* block = reinterpret_cast<__m128i*>(pixels + done * 2U);
+            _mm_storeu_si128(block, PremultiplyLinear<_MM_SHUFFLE(3, 3, 1, 1)>(_mm_loadu_si128(block), alphaMask));
+        }
+    }
+#elif defined(_M_ARM64) || defined(__ARM_ARCH_ISA_A64)
+    // 16 pixels at a time. the loads de-interleave the channels so that each register holds one channel.
+    if (channelCount == 4U) {
+        for (; (done + 16U) <= pixelCount; done += 16U) {
+            uint8_t* block = pixels + done * 4U;
+            uint8x16x4_t rgba = vld4q_u8(block);
+            rgba.val[0U] = MultiplyDivide255(rgba.val[0U], rgba.val[3U]);
+            rgba.val[1U] = MultiplyDivide255(rgba.val[1U], rgba.val[3U]);
+            rgba.val[2U] = MultiplyDivide255(rgba.val[2U], rgba.val[3U]);
+            vst4q_u8(block, rgba);
+        }
+    } else {
+        for (; (done + 16U) <= pixelCount; done += 16U) {
+            uint8_t* block = pixels + done * 2U;
+            uint8x16x2_t grayAlpha = vld2q_u8(block);
+            grayAlpha.val[0U] = MultiplyDivide255(grayAlpha.val[0U], grayAlpha.val[1U]);
+            vst2q_u8(block, grayAlpha);
+        }
+    }
+#endif
+    return done;
+}
+#endif
+}  // namespace Detail
+
+/** Premultiply the color channels with alpha in place. Only images with two (gray and alpha) or four (RGBA) channels
+ * have alpha, others are left as is.
+ * 8 bit sRGB values are premultiplied in linear space using a lookup table, other values are premultiplied as is.
+ * @param pixels Tightly packed pixels with alpha as the last channel.
+ * @param pixelCount Number of pixels.
+ * @param channelCount Number of channels per pixel.
+ * @param bytesPerChannel Size of a channel, 1 or 2.
+ * @param linear True if the values are linear, false for sRGB encoded values. Only used with 8 bit channels.
+ * @return False if the channel size is not supported.
+ */
+inline bool PremultiplyAlpha(
+    uint8_t* pixels, size_t pixelCount, uint32_t channelCount, uint32_t bytesPerChannel, bool linear)
+{
+    if ((channelCount != 4U) && (channelCount != 2U)) {
+        return true;
+    }
+    const uint32_t alphaChannel = channelCount - 1U;
+    if (bytesPerChannel == 1U) {
+        if (linear) {
+            size_t done = 0U;
+#if defined(CORE_PIXEL_CONVERSION_SIMD)
+            done = Detail::PremultiplyLinear8(pixels, pixelCount, channelCount);
+#endif
+            uint8_t* img = pixels + done * channelCount;
+            for (size_t i = done; i < pixelCount; ++i, img += channelCount) {
+                const uint32_t alpha = img[alphaChannel];
+                for (uint32_t j = 0U; j < alphaChannel; ++j) {
+                    img[j] = static_cast<uint8_t>(img[j] * alpha / 0xffU);
+                }
+            }
+        } else {
+            const Detail::SrgbPremultiplyTable& table = Detail::GetSrgbPremultiplyTable();
+            uint8_t* img = pixels;
+            for (size_t i = 0U; i < pixelCount; ++i, img += channelCount) {
+                const uint32_t alpha = img[alphaChannel];
+                if ((alpha == 255U) && table.opaqueIsIdentity) {
+                    continue;
+                }
+                const uint8_t* p = &table.values[alpha * 256U];
+                for (uint32_t j = 0U; j < alphaChannel; ++j) {
+                    img[j] = p[img[j]];
+                }
+            }
+        }
+    } else if (bytesPerChannel == 2U) {
+        auto* img = reinterpret_cast<uint16_t*>(pixels);
+        for (size_t i = 0U; i < pixelCount; ++i, img += channelCount) {
+            const uint32_t alpha = img[alphaChannel];
+            for (uint32_t j = 0U; j < alphaChannel; ++j) {
+                img[j] = static_cast<uint16_t>(img[j] * alpha / 0xffffU);
+            }
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/** Flip the rows of an image in place.
+ * @param pixels First row of the image.
+ * @param rowSize Size of a row in bytes.
+ * @param height Number of rows.
+ */
+inline void FlipVertically(uint8_t* pixels, size_t rowSize, uint32_t height)
+{
+    // rows are swapped in chunks through a small buffer, memcpy is already vectorized.
+    constexpr size_t chunkSize = 256U;
+    uint8_t chunk[chunkSize];
+    for (uint32_t y = 0U; y < (height / 2U); ++y) {
+        uint8_t* top = pixels + y * rowSize;
+        uint8_t* bottom = pixels + (height - 1U - y) * rowSize;
+        for (size_t x = 0U; x < rowSize; x += chunkSize) {
+            const size_t size = ((rowSize - x) < chunkSize) ? (rowSize - x) : chunkSize;
+            std::memcpy(chunk, top + x, size);
+            std::memcpy(top + x, bottom + x, size);
+            std::memcpy(bottom + x, chunk, size);
+        }
+    }
+}
+}  // namespace PixelConversion
+CORE_END_NAMESPACE()
+
+#endif  // API_CORE_IMAGE_PIXEL_CONVERSION_H
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 
+#include <base/containers/array_view.h>
 #include <base/containers/unique_ptr.h>
 #include <base/namespace.h>
 #include <core/namespace.h>
@@ -84,6 +85,16 @@ public:
      */
     virtual uint64_t GetPosition() const = 0;
 
+    /** Returns the whole file contents if they are directly addressable, e.g. when the file is memory mapped. The view
+     *  stays valid and unchanged until the file is closed or destroyed, which allows parsing the data in place instead
+     *  of reading it to a separate buffer.
+     *  @return Contents of the file, or an empty view if the file has to be accessed with Read.
+     */
+    virtual BASE_NS::array_view<const uint8_t> GetData() const
+    {
+        return {};
+    }
+
     struct Deleter {
         constexpr Deleter() noexcept = default;
         void operator()(IFile* ptr) const
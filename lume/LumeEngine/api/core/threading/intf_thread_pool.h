@@ -223,6 +223,15 @@ public:
 
     using Ptr = BASE_NS::refcnt_ptr<ITaskQueueFactory>;
 
+    /** Thread pool scheduling strategies. */
+    enum class ThreadPoolType : uint32_t {
+        /** All threads share a single task queue which is scanned for runnable tasks. */
+        SHARED_QUEUE = 0,
+        /** Each thread owns a task queue and idle threads steal tasks from the others. Dependencies are tracked with
+         * counters and continuation lists, which scales better with many threads and many small tasks. */
+        WORK_STEALING = 1,
+    };
+
     /** Get the number of concurrent threads supported by the device.
      * @return Number of concurrent threads supported.
      */
@@ -234,6 +243,13 @@ public:
      */
     virtual IThreadPool::Ptr CreateThreadPool(const uint32_t threadCount) const = 0;
 
+    /** Create a thread safe thread pool using the given scheduling strategy.
+     * @param threadCount number of threads created in the pool.
+     * @param type Scheduling strategy of the pool.
+     * @return Thread pool instance.
+     */
+    virtual IThreadPool::Ptr CreateThreadPool(const uint32_t threadCount, ThreadPoolType type) const = 0;
+
     /** Create a thread safe task dispatcher.
      * @param threadPool Optional thread pool.
      * @return Task dispatcher instance.
@@ -16,6 +16,9 @@
 #ifndef API_CORE_UTIL_FRUSTUM_UTIL_H
 #define API_CORE_UTIL_FRUSTUM_UTIL_H
 
+#include <cstdint>
+
+#include <base/containers/array_view.h>
 #include <base/containers/refcnt_ptr.h>
 #include <base/math/vector.h>
 #include <base/namespace.h>
@@ -57,6 +60,18 @@ struct Frustum {
     BASE_NS::Math::Vec4 planes[PLANE_COUNT];
 };
 
+/** Bounding spheres in structure-of-arrays layout. All the arrays should have the same size. */
+struct BoundingSpheres {
+    /** X coordinates of the centers */
+    BASE_NS::array_view<const float> centerX;
+    /** Y coordinates of the centers */
+    BASE_NS::array_view<const float> centerY;
+    /** Z coordinates of the centers */
+    BASE_NS::array_view<const float> centerZ;
+    /** Radii */
+    BASE_NS::array_view<const float> radius;
+};
+
 class IFrustumUtil : public IInterface {
 public:
     static constexpr auto UID = BASE_NS::Uid{"3defee25-af81-4c20-b8d0-e1c3419556b2"};
@@ -78,6 +93,18 @@ public:
     virtual bool SphereFrustumCollision(
         const Frustum& frustum, const BASE_NS::Math::Vec3 pos, const float radius) const = 0;
 
+    /** Test a batch of spheres against multiple frustums.
+     * The bitmask of each frustum takes (sphere count + 63) / 64 words. Bitmask of frustum i starts at word
+     * i * (sphere count + 63) / 64, and bit n of the bitmask tells whether sphere n is visible.
+     * @param frustums Frustums to test against.
+     * @param spheres Bounding spheres.
+     * @param visibility Bitmasks where a bit is set if the sphere is inside the frustum partially or fully.
+     * @return True if the spheres were tested. False if the sphere arrays have different sizes or visibility is too
+     * small.
+     */
+    virtual bool SphereFrustumCollision(BASE_NS::array_view<const Frustum> frustums, const BoundingSpheres& spheres,
+        BASE_NS::array_view<uint64_t> visibility) const = 0;
+
 protected:
     IFrustumUtil() = default;
     virtual ~IFrustumUtil() = default;
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef API_CORE_UTIL_PARALLEL_FOR_H
+#define API_CORE_UTIL_PARALLEL_FOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+
+#include <base/containers/shared_ptr.h>
+#include <base/namespace.h>
+#include <core/namespace.h>
+#include <core/threading/intf_thread_pool.h>
+
+CORE_BEGIN_NAMESPACE()
+namespace Detail {
+// Job indices shared by the caller of ParallelFor and its helper tasks. Helper tasks may start only after the caller
+// has returned, they then find no indices left and don't touch the job.
+template<typename Job>
+struct ParallelForJobs {
+    Job* job{nullptr};
+    size_t count{0U};
+    std::atomic<size_t> next{0U};
+    std::mutex mutex;
+    std::condition_variable allFinished;
+    size_t finished{0U};
+
+    void Run()
+    {
+        size_t ran = 0U;
+        for (size_t i = next.fetch_add(1U); i < count; i = next.fetch_add(1U)) {
+            (*job)(i);
+            ++ran;
+        }
+        if (ran > 0U) {
+            const std::lock_guard lock(mutex);
+            finished += ran;
+            if (finished == count) {
+                allFinished.notify_all();
+            }
+        }
+    }
+};
+
+template<typename Job>
+class ParallelForTask final : public IThreadPool::ITask {
+public:
+    explicit ParallelForTask(BASE_NS::shared_ptr<ParallelForJobs<Job>> jobs) : jobs_(BASE_NS::move(jobs)) {}
+
+    void operator()() override
+    {
+        jobs_->Run();
+    }
+
+protected:
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    BASE_NS::shared_ptr<ParallelForJobs<Job>> jobs_;
+};
+}  // namespace Detail
+
+/** Runs job(index) for each index in [0, count) using the calling thread and the thread pool.
+ * The calling thread claims indices itself and helper tasks pull from the same counter, so the caller only waits for
+ * jobs which are already running on other threads. Unlike pushing tasks and waiting for their results, this is safe
+ * when called from a task of the same pool, even if all the other threads of the pool are busy or waiting.
+ * @param threadPool Thread pool for the helper tasks. If null, or has less than two threads, jobs are run in order.
+ * @param count Number of jobs.
+ * @param job Callable taking the job index. Called concurrently from different threads.
+ */
+template<typename Job>
+void ParallelFor(IThreadPool* threadPool, size_t count, Job&& job)
+{
+    if (!threadPool || (threadPool->GetNumberOfThreads() < 2U) || (count < 2U)) {
+        for (size_t i = 0U; i < count; ++i) {
+            job(i);
+        }
+        return;
+    }
+    using JobType = std::remove_reference_t<Job>;
+    auto jobs = BASE_NS::make_shared<Detail::ParallelForJobs<JobType>>();
+    jobs->job = &job;
+    jobs->count = count;
+    const size_t helperCount = std::min(count, static_cast<size_t>(threadPool->GetNumberOfThreads())) - 1U;
+    for (size_t i = 0U; i < helperCount; ++i) {
+        threadPool->PushNoWait(IThreadPool::ITask::Ptr{new Detail::ParallelForTask<JobType>(jobs)});
+    }
+    jobs->Run();
+    std::unique_lock lock(jobs->mutex);
+    jobs->allFinished.wait(lock, [&jobs]() { return jobs->finished == jobs->count; });
+}
+CORE_END_NAMESPACE()
+
+#endif  // API_CORE_UTIL_PARALLEL_FOR_H
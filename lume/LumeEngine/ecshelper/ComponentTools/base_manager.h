@@ -20,7 +20,6 @@
 
 #include <base/containers/array_view.h>
 #include <base/containers/string_view.h>
-#include <base/containers/unordered_map.h>
 #include <base/containers/vector.h>
 #include <base/namespace.h>
 #include <base/util/uid.h>
@@ -31,6 +30,8 @@
 #include <core/property/intf_property_handle.h>
 #include <core/property/scoped_handle.h>
 
+#include "entity_index.h"
+
 CORE_BEGIN_NAMESPACE()
 class IEcs;
 struct Property;
@@ -134,7 +135,7 @@ protected:
     };
     uint32_t generationCounter_{0};
     uint32_t modifiedFlags_{0};
-    BASE_NS::unordered_map<Entity, ComponentId> entityComponent_;
+    EntityIndex entityComponent_;
     BASE_NS::vector<BaseComponentHandle> components_;
     BASE_NS::vector<Entity> added_;
     BASE_NS::vector<Entity> removed_;
@@ -35,13 +35,10 @@ inline auto ItemOrNull(Container&& v, IComponentManager::ComponentId index)
     return (BASE_NS::remove_reference_t<decltype(v[index])>*)(nullptr);
 }
 
-template<typename EntityMap>
-inline auto ItemId(EntityMap&& entities, Entity entity)
+inline IComponentManager::ComponentId ItemId(const EntityIndex& entities, Entity entity)
 {
     if (EntityUtil::IsValid(entity)) {
-        if (const auto it = entities.find(entity); it != entities.end()) {
-            return it->second;
-        }
+        return entities.Find(entity);
     }
     return IComponentManager::INVALID_COMPONENT_ID;
 }
@@ -139,9 +136,7 @@ template<typename ComponentType, typename BaseClass>
 IComponentManager::ComponentId BaseManager<ComponentType, BaseClass>::GetComponentId(CORE_NS::Entity entity) const
 {
     if (EntityUtil::IsValid(entity)) {
-        if (auto it = entityComponent_.find(entity); it != entityComponent_.end()) {
-            return it->second;
-        }
+        return entityComponent_.Find(entity);
     }
     return IComponentManager::INVALID_COMPONENT_ID;
 }
@@ -150,8 +145,8 @@ template<typename ComponentType, typename BaseClass>
 void BaseManager<ComponentType, BaseClass>::Create(CORE_NS::Entity entity)
 {
     if (EntityUtil::IsValid(entity)) {
-        if (auto it = entityComponent_.find(entity); it == entityComponent_.end()) {
-            entityComponent_.insert({ entity, static_cast<ComponentId>(components_.size()) });
+        if (const auto id = entityComponent_.Find(entity); id == IComponentManager::INVALID_COMPONENT_ID) {
+            entityComponent_.Insert(entity, static_cast<ComponentId>(components_.size()));
             const auto oldCapacity = components_.capacity();
             components_.emplace_back(this, entity);
             if (components_.capacity() != oldCapacity) {
@@ -165,7 +160,7 @@ void BaseManager<ComponentType, BaseClass>::Create(CORE_NS::Entity entity)
             modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_ADDED_BIT;
             ++generationCounter_;
         } else {
-            if (auto dst = ScopedHandle<ComponentType>(&components_[it->second]); dst) {
+            if (auto dst = ScopedHandle<ComponentType>(&components_[id]); dst) {
                 *dst = {};
             }
         }
@@ -176,9 +171,9 @@ template<typename ComponentType, typename BaseClass>
 bool BaseManager<ComponentType, BaseClass>::Destroy(CORE_NS::Entity entity)
 {
     if (EntityUtil::IsValid(entity)) {
-        if (auto it = entityComponent_.find(entity); it != entityComponent_.end()) {
-            components_[it->second].entity_ = {}; // invalid entity. (marks it as ready for re-use)
-            entityComponent_.erase(it);
+        if (const auto id = entityComponent_.Find(entity); id != IComponentManager::INVALID_COMPONENT_ID) {
+            components_[id].entity_ = {}; // invalid entity. (marks it as ready for re-use)
+            entityComponent_.Erase(entity);
             removed_.push_back(entity);
             modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_REMOVED_BIT;
             ++generationCounter_;
@@ -210,7 +205,7 @@ void BaseManager<ComponentType, BaseClass>::Gc()
         if ((rid > id) && EntityUtil::IsValid(components_[rid].entity_)) {
             moved_.push_back(components_[rid].entity_);
             // fix the entityComponent_ map (update the component id for the entity)
-            entityComponent_[components_[rid].entity_] = id;
+            entityComponent_.Insert(components_[rid].entity_, id);
             components_[id] = BASE_NS::move(components_[rid]);
         }
         --componentCount;
@@ -292,8 +287,8 @@ void BaseManager<ComponentType, BaseClass>::SetData(CORE_NS::Entity entity, cons
         return;
     }
     if (const auto src = ScopedHandle<const ComponentType>(&dataHandle); src) {
-        if (const auto it = entityComponent_.find(entity); it != entityComponent_.end()) {
-            if (auto dst = ScopedHandle<ComponentType>(&components_[it->second]); dst) {
+        if (const auto id = ItemId(entityComponent_, entity); id != IComponentManager::INVALID_COMPONENT_ID) {
+            if (auto dst = ScopedHandle<ComponentType>(&components_[id]); dst) {
                 *dst = *src;
             }
         }
@@ -378,8 +373,8 @@ template<typename ComponentType, typename BaseClass>
 void BaseManager<ComponentType, BaseClass>::Set(CORE_NS::Entity entity, const ComponentType& data)
 {
     if (EntityUtil::IsValid(entity)) {
-        if (const auto it = entityComponent_.find(entity); it == entityComponent_.end()) {
-            entityComponent_.insert({ entity, static_cast<ComponentId>(components_.size()) });
+        if (const auto id = entityComponent_.Find(entity); id == IComponentManager::INVALID_COMPONENT_ID) {
+            entityComponent_.Insert(entity, static_cast<ComponentId>(components_.size()));
             const auto oldCapacity = components_.capacity();
             components_.emplace_back(this, entity, data).generation_ = 1;
             if (components_.capacity() != oldCapacity) {
@@ -393,7 +388,7 @@ void BaseManager<ComponentType, BaseClass>::Set(CORE_NS::Entity entity, const Co
             modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_ADDED_BIT;
             ++generationCounter_;
         } else {
-            if (auto handle = ScopedHandle<ComponentType>(&components_[it->second]); handle) {
+            if (auto handle = ScopedHandle<ComponentType>(&components_[id]); handle) {
                 *handle = data;
             }
         }
@@ -445,7 +440,7 @@ BaseManager<ComponentType, BaseClass>::BaseManager(
 {
     if (preallocate) {
         components_.reserve(preallocate);
-        entityComponent_.reserve(preallocate);
+        entityComponent_.Reserve(preallocate);
     }
 }
 
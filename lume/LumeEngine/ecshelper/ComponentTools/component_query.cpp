@@ -15,6 +15,8 @@
 
 #include "component_query.h"
 
+#include <algorithm>
+
 #include <base/containers/array_view.h>
 #include <base/containers/iterator.h>
 #include <base/containers/type_traits.h>
@@ -51,6 +53,9 @@ void ComponentQuery::SetupQuery(
     enableLookup_ = enableEntityLookup;
 
     result_.clear();
+    mapping_.Clear();
+    pending_.clear();
+    rebuild_ = true;
     valid_ = false;
 
     // Unregistering any old listeners because the operations might not use the same managers.
@@ -82,63 +87,120 @@ bool ComponentQuery::Execute()
         // Base manager is null.
         return false;
     }
+    // Update only the rows of the entities mentioned in the ECS events, unless so many entities have changed that
+    // rebuilding is cheaper.
+    if (enableListeners_ && registered_ && !rebuild_ && (pending_.size() < (result_.size() / 2U))) {
+        UpdateRows();
+        valid_ = true;
+        return true;
+    }
+    pending_.clear();
 
     const IComponentManager& baseComponentSet = *managers_[0];
 
     const auto baseComponents = baseComponentSet.GetComponentCount();
     result_.resize(baseComponents);
 
+    // row look-up is needed for FindResultRow and for updating rows incrementally.
+    const bool trackRows = enableLookup_ || enableListeners_;
+    if (trackRows) {
+        mapping_.Clear();
+    }
+
     auto& em = baseComponentSet.GetEcs().GetEntityManager();
-    const size_t managerCount = managers_.size();
     size_t index = 0U;
     for (IComponentManager::ComponentId id = 0; id < baseComponents; ++id) {
         const Entity entity = baseComponentSet.GetEntity(id);
         if (!em.IsAlive(entity)) {
             continue;
         }
-        auto& row = result_[index];
-        row.entity = entity;
-        row.components.resize(managerCount, IComponentManager::INVALID_COMPONENT_ID);
-        row.components[0U] = id;
-
-        bool valid = true;
-
-        // NOTE: starting from index 1 that is the first manager after the base component set.
-        for (size_t i = 1; valid && (i < managerCount); ++i) {
-            const auto& manager = managers_[i];
-            const auto componentId =
-                manager ? manager->GetComponentId(entity) : IComponentManager::INVALID_COMPONENT_ID;
-            row.components[i] = componentId;
-
-            switch (operationMethods_[i]) {
-                case Operation::REQUIRE: {
-                    // for required components ID must be valid
-                    valid = (componentId != IComponentManager::INVALID_COMPONENT_ID);
-                    break;
-                }
+        if (FillRow(entity, id, result_[index])) {
+            if (trackRows) {
+                mapping_.Insert(entity, static_cast<uint32_t>(index));
+            }
+            ++index;
+        }
+    }
+    result_.resize(index);
 
-                case Operation::OPTIONAL: {
-                    // for optional ID doesn't matter
-                    break;
-                }
+    rebuild_ = !trackRows;
+    valid_ = true;
+    return true;
+}
 
-                default: {
-                    valid = false;
-                }
+bool ComponentQuery::FillRow(const Entity entity, const IComponentManager::ComponentId id, ResultRow& row) const
+{
+    const size_t managerCount = managers_.size();
+    row.entity = entity;
+    row.components.resize(managerCount, IComponentManager::INVALID_COMPONENT_ID);
+    row.components[0U] = id;
+
+    bool valid = true;
+
+    // NOTE: starting from index 1 that is the first manager after the base component set.
+    for (size_t i = 1; valid && (i < managerCount); ++i) {
+        const auto& manager = managers_[i];
+        const auto componentId = manager ? manager->GetComponentId(entity) : IComponentManager::INVALID_COMPONENT_ID;
+        row.components[i] = componentId;
+
+        switch (operationMethods_[i]) {
+            case Operation::REQUIRE: {
+                // for required components ID must be valid
+                valid = (componentId != IComponentManager::INVALID_COMPONENT_ID);
+                break;
+            }
+
+            case Operation::OPTIONAL: {
+                // for optional ID doesn't matter
+                break;
+            }
+
+            default: {
+                valid = false;
             }
         }
+    }
+    return valid;
+}
 
+void ComponentQuery::UpdateRows()
+{
+    // the same entity can be reported by several events.
+    std::sort(pending_.begin(), pending_.end());
+    pending_.erase(std::unique(pending_.begin(), pending_.end()), pending_.cend());
+
+    const IComponentManager& baseComponentSet = *managers_[0];
+    auto& em = baseComponentSet.GetEcs().GetEntityManager();
+    ResultRow row;
+    for (const Entity entity : pending_) {
+        const auto id = baseComponentSet.GetComponentId(entity);
+        const bool valid =
+            (id != IComponentManager::INVALID_COMPONENT_ID) && em.IsAlive(entity) && FillRow(entity, id, row);
+
+        auto index = mapping_.Find(entity);
+        if ((index >= result_.size()) || (result_[index].entity != entity)) {
+            index = EntityIndex::INVALID_VALUE;
+        }
         if (valid) {
-            if (enableLookup_) {
-                mapping_[entity] = index;
+            if (index != EntityIndex::INVALID_VALUE) {
+                // patch existing row, component ids may have changed.
+                result_[index].components.swap(row.components);
+            } else {
+                mapping_.Insert(entity, static_cast<uint32_t>(result_.size()));
+                result_.push_back(BASE_NS::move(row));
+                row = {};
             }
-            ++index;
+        } else if (index != EntityIndex::INVALID_VALUE) {
+            // swap-remove so that only the last row changes index.
+            if (const auto last = static_cast<uint32_t>(result_.size() - 1U); index != last) {
+                result_[index] = BASE_NS::move(result_[last]);
+                mapping_.Insert(result_[index].entity, index);
+            }
+            result_.pop_back();
+            mapping_.Erase(entity);
         }
     }
-    result_.resize(index);
-
-    valid_ = true;
-    return true;
+    pending_.clear();
 }
 
 void ComponentQuery::Execute(
@@ -150,6 +212,16 @@ void ComponentQuery::Execute(
 
 void ComponentQuery::SetEcsListenersEnabled(bool enableListeners)
 {
+    if (enableListeners && !enableListeners_) {
+        if (valid_ && !enableLookup_) {
+            // rows are needed for incremental updates.
+            mapping_.Clear();
+            for (size_t i = 0; i < result_.size(); ++i) {
+                mapping_.Insert(result_[i].entity, static_cast<uint32_t>(i));
+            }
+        }
+        rebuild_ = !valid_;
+    }
     enableListeners_ = enableListeners;
     if (enableListeners_) {
         RegisterEcsListeners();
@@ -171,9 +243,9 @@ array_view<const ComponentQuery::ResultRow> ComponentQuery::GetResults() const
 const ComponentQuery::ResultRow* ComponentQuery::FindResultRow(Entity entity) const
 {
     if (EntityUtil::IsValid(entity)) {
-        const auto it = mapping_.find(entity);
-        if (it != mapping_.end() && it->second < result_.size()) {
-            return &(result_[it->second]);
+        // mapping_ isn't cleared between executions so check that the row still belongs to the entity.
+        if (const auto index = mapping_.Find(entity); (index < result_.size()) && (result_[index].entity == entity)) {
+            return &(result_[index]);
         }
     }
 
@@ -211,11 +283,6 @@ void ComponentQuery::UnregisterEcsListeners()
 void ComponentQuery::OnEntityEvent(const IEcs::EntityListener::EventType type, const array_view<const Entity> entities)
 {
     if (type == IEcs::EntityListener::EventType::ACTIVATED || type == IEcs::EntityListener::EventType::DEACTIVATED) {
-        if (!valid_) {
-            // Listener is only used to invalidate the quety. If the query is already invalid -> no need to check
-            // anything.
-            return;
-        }
         const auto managerCount = managers_.size();
         for (const auto& entity : entities) {
             // We are only interested in entities that have all the required managers.
@@ -232,26 +299,34 @@ void ComponentQuery::OnEntityEvent(const IEcs::EntityListener::EventType type, c
             }
 
             if (isRelevantEntity) {
-                // Marking this query as invalid. No need to iterate entities further.
+                // Marking this query as invalid and the entity's row to be updated.
                 valid_ = false;
-                return;
+                if (!rebuild_) {
+                    pending_.push_back(entity);
+                }
             }
         }
     } else if (type == IEcs::EntityListener::EventType::DESTROYED) {
-        if (enableLookup_) {
-            for (const auto& entity : entities) {
-                mapping_.erase(entity);
+        for (const auto& entity : entities) {
+            if (!rebuild_ && mapping_.Contains(entity)) {
+                valid_ = false;
+                pending_.push_back(entity);
             }
         }
     }
 }
 
 void ComponentQuery::OnComponentEvent(const IEcs::ComponentListener::EventType type,
-    const IComponentManager& /* componentManager */, const array_view<const Entity> /* entities */)
+    const IComponentManager& /* componentManager */, const array_view<const Entity> entities)
 {
-    // We only get events from relevant managers. If they have new or deleted components, the query is no longer valid.
-    if (type == IEcs::ComponentListener::EventType::CREATED || type == IEcs::ComponentListener::EventType::DESTROYED) {
+    // We only get events from relevant managers. If they have new, moved or deleted components, the rows of those
+    // entities need to be updated.
+    if (type == IEcs::ComponentListener::EventType::CREATED || type == IEcs::ComponentListener::EventType::DESTROYED ||
+        type == IEcs::ComponentListener::EventType::MOVED) {
         valid_ = false;
+        if (!rebuild_) {
+            pending_.append(entities.cbegin(), entities.cend());
+        }
     }
 }
 CORE_END_NAMESPACE()
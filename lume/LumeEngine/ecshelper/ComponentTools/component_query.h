@@ -19,7 +19,6 @@
 #include <cstddef>
 #include <cstdint>
 
-#include <base/containers/unordered_map.h>
 #include <base/containers/vector.h>
 #include <base/namespace.h>
 #include <core/ecs/entity.h>
@@ -27,6 +26,8 @@
 #include <core/ecs/intf_ecs.h>
 #include <core/namespace.h>
 
+#include "entity_index.h"
+
 BASE_BEGIN_NAMESPACE()
 template<class T>
 class array_view;
@@ -73,7 +74,8 @@ public:
         BASE_NS::array_view<const Operation> operations, bool enableEntityLookup = false);
 
     /** Enable or disable listening to ECS events. Enabling listeners will automatically invalidate this query when
-     * there are changes in the relevant component managers.
+     * there are changes in the relevant component managers. While listening, Execute only adds, updates or removes the
+     * rows of the changed entities. Removing a row moves the last row in its place, other rows keep their indices.
      * @param enableListeners True to enable listening to ecs events to automatically invalidate the query.
      */
     void SetEcsListenersEnabled(bool enableListeners);
@@ -123,6 +125,10 @@ public:
     const ResultRow* FindResultRow(Entity entity) const;
 
 private:
+    // Fills the row for the entity, returns false if the entity doesn't have the required components.
+    bool FillRow(Entity entity, IComponentManager::ComponentId id, ResultRow& row) const;
+    // Adds, patches or removes the rows of pending_ entities.
+    void UpdateRows();
     void RegisterEcsListeners();
     void UnregisterEcsListeners();
 
@@ -137,7 +143,11 @@ private:
     BASE_NS::vector<ResultRow> result_;
     BASE_NS::vector<IComponentManager*> managers_;
     BASE_NS::vector<Operation::Method> operationMethods_;
-    BASE_NS::unordered_map<Entity, size_t> mapping_;
+    EntityIndex mapping_;
+    // entities whose rows need to be updated on the next Execute.
+    BASE_NS::vector<Entity> pending_;
+    // true when the rows aren't tracked and the next Execute must rebuild the whole result.
+    bool rebuild_{true};
     bool enableLookup_{false};
     bool enableListeners_{false};
     bool registered_{false};
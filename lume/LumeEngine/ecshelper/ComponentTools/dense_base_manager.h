@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CORE__ECS_HELPER__COMPONENT_TOOLS__DENSE_BASE_MANAGER_H
+#define CORE__ECS_HELPER__COMPONENT_TOOLS__DENSE_BASE_MANAGER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <base/containers/string_view.h>
+#include <base/containers/vector.h>
+#include <base/namespace.h>
+#include <base/util/uid.h>
+#include <core/ecs/entity.h>
+#include <core/ecs/intf_component_manager.h>
+#include <core/namespace.h>
+#include <core/property/intf_property_api.h>
+#include <core/property/intf_property_handle.h>
+#include <core/property/scoped_handle.h>
+
+#include "entity_index.h"
+
+CORE_BEGIN_NAMESPACE()
+class IEcs;
+struct Property;
+
+// Drop-in alternative for BaseManager which stores the components in structure-of-arrays form: component data,
+// entities, generations and dirty flags are kept in separate tightly packed arrays. Component ids map directly to
+// indices in these arrays, so systems can stream over GetComponentData() instead of locking a handle per component.
+// Property handles returned by GetData refer to a component id and are kept in their own array.
+template<typename ComponentType, typename BaseClass>
+class DenseBaseManager : public BaseClass, public IPropertyApi {
+    using ComponentId = IComponentManager::ComponentId;
+
+public:
+    // IPropertyApi
+    size_t PropertyCount() const override = 0;
+    const Property* MetaData(size_t index) const override = 0;
+    BASE_NS::array_view<const Property> MetaData() const override = 0;
+    IPropertyHandle* Create() const override;
+    IPropertyHandle* Clone(const IPropertyHandle*) const override;
+    void Release(IPropertyHandle*) const override;
+    uint64_t Type() const override;
+
+    // IComponentManager
+    BASE_NS::string_view GetName() const override;
+    BASE_NS::Uid GetUid() const override;
+    size_t GetComponentCount() const override;
+    const IPropertyApi& GetPropertyApi() const override;
+    Entity GetEntity(ComponentId index) const override;
+    uint32_t GetComponentGeneration(ComponentId index) const override;
+    bool HasComponent(Entity entity) const override;
+    IComponentManager::ComponentId GetComponentId(Entity entity) const override;
+    void Create(Entity entity) override;
+    bool Destroy(Entity entity) override;
+    void Gc() override;
+    void Destroy(BASE_NS::array_view<const Entity> gcList) override;
+    BASE_NS::vector<Entity> GetAddedComponents() override;
+    BASE_NS::vector<Entity> GetRemovedComponents() override;
+    BASE_NS::vector<Entity> GetUpdatedComponents() override;
+    BASE_NS::vector<Entity> GetMovedComponents() override;
+    CORE_NS::ComponentManagerModifiedFlags GetModifiedFlags() const override;
+    void ClearModifiedFlags() override;
+    uint32_t GetGenerationCounter() const override;
+    void SetData(Entity entity, const IPropertyHandle& dataHandle) override;
+    const IPropertyHandle* GetData(Entity entity) const override;
+    IPropertyHandle* GetData(Entity entity) override;
+    void SetData(ComponentId index, const IPropertyHandle& dataHandle) override;
+    const IPropertyHandle* GetData(ComponentId index) const override;
+    IPropertyHandle* GetData(ComponentId index) override;
+    IEcs& GetEcs() const override;
+
+    // "base class"
+    ComponentType Get(ComponentId index) const override;
+    ComponentType Get(Entity entity) const override;
+    void Set(ComponentId index, const ComponentType& aData) override;
+    void Set(Entity entity, const ComponentType& aData) override;
+    ScopedHandle<const ComponentType> Read(ComponentId index) const override;
+    ScopedHandle<const ComponentType> Read(Entity entity) const override;
+    ScopedHandle<ComponentType> Write(ComponentId index) override;
+    ScopedHandle<ComponentType> Write(Entity entity) override;
+
+    // Bulk access. Indexed with ComponentId and valid until the next call which adds or removes components (Create,
+    // Set with a new entity, Gc). Components destroyed since the last Gc are still included with an invalid entity.
+    BASE_NS::array_view<const ComponentType> GetComponentData() const;
+    BASE_NS::array_view<const Entity> GetEntities() const;
+
+    // internal, non-public
+    void Updated(Entity entity);
+
+    DenseBaseManager(const DenseBaseManager&) = delete;
+    DenseBaseManager(DenseBaseManager&&) = delete;
+    DenseBaseManager& operator=(const DenseBaseManager&) = delete;
+    DenseBaseManager& operator=(DenseBaseManager&&) = delete;
+
+protected:
+    DenseBaseManager(IEcs& ecs, BASE_NS::string_view) noexcept;
+    DenseBaseManager(IEcs& ecs, BASE_NS::string_view, size_t preallocate) noexcept;
+    virtual ~DenseBaseManager();
+    IEcs& ecs_;
+    BASE_NS::string_view name_;
+
+    bool IsMatchingHandle(const IPropertyHandle& handle);
+    ComponentId Append(Entity entity, const ComponentType& data, uint32_t generation);
+
+    // Handle to the component stored at a fixed index.
+    class DenseComponentHandle : public IPropertyHandle {
+    public:
+        DenseComponentHandle() = delete;
+        DenseComponentHandle(DenseBaseManager* owner, ComponentId index) noexcept;
+        ~DenseComponentHandle() override = default;
+        DenseComponentHandle(const DenseComponentHandle& other) = delete;
+        DenseComponentHandle(DenseComponentHandle&& other) noexcept;
+        DenseComponentHandle& operator=(const DenseComponentHandle& other) = delete;
+        DenseComponentHandle& operator=(DenseComponentHandle&& other) noexcept;
+        const IPropertyApi* Owner() const override;
+        size_t Size() const override;
+        const void* RLock() const override;
+        void RUnlock() const override;
+        void* WLock() override;
+        void WUnlock() override;
+#ifndef NDEBUG
+        mutable int32_t rLocked_{0};
+        mutable bool wLocked_{false};
+#endif
+        DenseBaseManager* manager_{nullptr};
+        ComponentId index_{0};
+    };
+
+    // Handle created with IPropertyApi::Create/Clone which isn't bound to any entity.
+    class DetachedComponentHandle : public IPropertyHandle {
+    public:
+        DetachedComponentHandle(DenseBaseManager* owner, const ComponentType& data) noexcept;
+        ~DetachedComponentHandle() override = default;
+        DetachedComponentHandle(const DetachedComponentHandle& other) = delete;
+        DetachedComponentHandle(DetachedComponentHandle&& other) = delete;
+        DetachedComponentHandle& operator=(const DetachedComponentHandle& other) = delete;
+        DetachedComponentHandle& operator=(DetachedComponentHandle&& other) = delete;
+        const IPropertyApi* Owner() const override;
+        size_t Size() const override;
+        const void* RLock() const override;
+        void RUnlock() const override;
+        void* WLock() override;
+        void WUnlock() override;
+        DenseBaseManager* manager_{nullptr};
+        ComponentType data_;
+    };
+
+    // set in modifiedFlags_ when at least one of the components has been written.
+    static constexpr uint32_t MODIFIED = 0x80000000;
+
+    uint32_t generationCounter_{0};
+    uint32_t modifiedFlags_{0};
+    EntityIndex entityComponent_;
+    // component data and per component state, all indexed with ComponentId.
+    BASE_NS::vector<ComponentType> data_;
+    BASE_NS::vector<Entity> entities_;
+    BASE_NS::vector<uint32_t> generations_;
+    BASE_NS::vector<uint8_t> dirty_;
+    BASE_NS::vector<DenseComponentHandle> handles_;
+    BASE_NS::vector<Entity> added_;
+    BASE_NS::vector<Entity> removed_;
+    BASE_NS::vector<Entity> updated_;
+    BASE_NS::vector<Entity> moved_;
+    uint64_t typeHash_;
+};
+CORE_END_NAMESPACE()
+#endif
@@ -0,0 +1,603 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <base/util/log.h>
+#ifndef NDEBUG
+#include <base/containers/atomics.h>
+#endif
+
+CORE_BEGIN_NAMESPACE()
+// IPropertyApi
+template<typename ComponentType, typename BaseClass>
+IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::Create() const
+{
+    return new DetachedComponentHandle(const_cast<DenseBaseManager<ComponentType, BaseClass>*>(this), {});
+}
+
+template<typename ComponentType, typename BaseClass>
+IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::Clone(const IPropertyHandle* src) const
+{
+    if (src->Owner() == this) {
+        if (const auto data = ScopedHandle<const ComponentType>(src); data) {
+            return new DetachedComponentHandle(const_cast<DenseBaseManager<ComponentType, BaseClass>*>(this), *data);
+        }
+    }
+    return nullptr;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Release(IPropertyHandle* dst) const
+{
+    if (dst && (dst->Owner() == this)) {
+        // handles bound to components are owned by handles_, only detached handles are deleted.
+        const auto* ptr = reinterpret_cast<const uint8_t*>(dst);
+        const auto* begin = reinterpret_cast<const uint8_t*>(handles_.data());
+        const auto* end = reinterpret_cast<const uint8_t*>(handles_.data() + handles_.size());
+        if ((ptr >= begin) && (ptr < end)) {
+            return;
+        }
+        delete static_cast<DetachedComponentHandle*>(dst);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+uint64_t DenseBaseManager<ComponentType, BaseClass>::Type() const
+{
+    return typeHash_;
+}
+
+// IComponentManager
+template<typename ComponentType, typename BaseClass>
+BASE_NS::string_view DenseBaseManager<ComponentType, BaseClass>::GetName() const
+{
+    return name_;
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::Uid DenseBaseManager<ComponentType, BaseClass>::GetUid() const
+{
+    return BaseClass::UID;
+}
+
+template<typename ComponentType, typename BaseClass>
+size_t DenseBaseManager<ComponentType, BaseClass>::GetComponentCount() const
+{
+    return data_.size();
+}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyApi& DenseBaseManager<ComponentType, BaseClass>::GetPropertyApi() const
+{
+    return *this;
+}
+
+template<typename ComponentType, typename BaseClass>
+CORE_NS::Entity DenseBaseManager<ComponentType, BaseClass>::GetEntity(ComponentId index) const
+{
+    if (index < entities_.size()) {
+        return entities_[index];
+    }
+    return CORE_NS::Entity();
+}
+
+template<typename ComponentType, typename BaseClass>
+uint32_t DenseBaseManager<ComponentType, BaseClass>::GetComponentGeneration(ComponentId index) const
+{
+    if (index < generations_.size()) {
+        return generations_[index];
+    }
+    return 0;
+}
+
+template<typename ComponentType, typename BaseClass>
+bool DenseBaseManager<ComponentType, BaseClass>::HasComponent(CORE_NS::Entity entity) const
+{
+    return GetComponentId(entity) != IComponentManager::INVALID_COMPONENT_ID;
+}
+
+template<typename ComponentType, typename BaseClass>
+IComponentManager::ComponentId DenseBaseManager<ComponentType, BaseClass>::GetComponentId(
+    CORE_NS::Entity entity) const
+{
+    if (EntityUtil::IsValid(entity)) {
+        return entityComponent_.Find(entity);
+    }
+    return IComponentManager::INVALID_COMPONENT_ID;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Create(CORE_NS::Entity entity)
+{
+    if (EntityUtil::IsValid(entity)) {
+        if (const auto id = entityComponent_.Find(entity); id == IComponentManager::INVALID_COMPONENT_ID) {
+            Append(entity, {}, 0U);
+        } else {
+            if (auto dst = ScopedHandle<ComponentType>(&handles_[id]); dst) {
+                *dst = {};
+            }
+        }
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+bool DenseBaseManager<ComponentType, BaseClass>::Destroy(CORE_NS::Entity entity)
+{
+    if (EntityUtil::IsValid(entity)) {
+        if (const auto id = entityComponent_.Find(entity); id != IComponentManager::INVALID_COMPONENT_ID) {
+            entities_[id] = {}; // invalid entity. (marks it as ready for re-use)
+            entityComponent_.Erase(entity);
+            removed_.push_back(entity);
+            modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_REMOVED_BIT;
+            ++generationCounter_;
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Gc()
+{
+    const bool hasRemovedComponents = modifiedFlags_ & CORE_COMPONENT_MANAGER_COMPONENT_REMOVED_BIT;
+    if (!hasRemovedComponents) {
+        return;
+    }
+    ComponentId componentCount = static_cast<ComponentId>(data_.size());
+    for (ComponentId id = 0; id < componentCount;) {
+        if (EntityUtil::IsValid(entities_[id])) {
+            ++id;
+            continue;
+        }
+        // invalid entity.. if so clean garbage
+        // find last valid and swap with it
+        ComponentId rid = componentCount - 1;
+        while ((rid > id) && !EntityUtil::IsValid(entities_[rid])) {
+            --rid;
+        }
+        if ((rid > id) && EntityUtil::IsValid(entities_[rid])) {
+#ifndef NDEBUG
+            BASE_ASSERT((handles_[rid].rLocked_ == 0U) && !handles_[rid].wLocked_);
+#endif
+            const Entity entity = BASE_NS::exchange(entities_[rid], {});
+            moved_.push_back(entity);
+            // fix the entityComponent_ map (update the component id for the entity)
+            entityComponent_.Insert(entity, id);
+            // handles stay bound to their index, only the data moves.
+            entities_[id] = entity;
+            data_[id] = BASE_NS::move(data_[rid]);
+            generations_[id] = generations_[rid];
+            dirty_[id] = dirty_[rid];
+        }
+        --componentCount;
+    }
+    if (!moved_.empty()) {
+        modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_MOVED_BIT;
+    }
+    if (data_.size() > componentCount) {
+        data_.resize(componentCount);
+        entities_.resize(componentCount);
+        generations_.resize(componentCount);
+        dirty_.resize(componentCount);
+        auto diff = static_cast<typename decltype(handles_)::difference_type>(componentCount);
+        handles_.erase(handles_.cbegin() + diff, handles_.cend());
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Destroy(BASE_NS::array_view<const CORE_NS::Entity> gcList)
+{
+    for (const CORE_NS::Entity e : gcList) {
+        Destroy(e);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::vector<CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetAddedComponents()
+{
+    return BASE_NS::move(added_);
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::vector<CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetRemovedComponents()
+{
+    return BASE_NS::move(removed_);
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::vector<CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetUpdatedComponents()
+{
+    BASE_NS::vector<CORE_NS::Entity> updated;
+    if (modifiedFlags_ & MODIFIED) {
+        modifiedFlags_ &= ~MODIFIED;
+        updated.reserve(dirty_.size() / 2U); // 2: approximation for vector reserve size
+        for (size_t i = 0U, count = dirty_.size(); i < count; ++i) {
+            if (dirty_[i]) {
+                dirty_[i] = 0U;
+                updated.push_back(entities_[i]);
+            }
+        }
+    }
+    return updated;
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::vector<CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetMovedComponents()
+{
+    return BASE_NS::move(moved_);
+}
+
+template<typename ComponentType, typename BaseClass>
+CORE_NS::ComponentManagerModifiedFlags DenseBaseManager<ComponentType, BaseClass>::GetModifiedFlags() const
+{
+    return modifiedFlags_ & ~MODIFIED;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::ClearModifiedFlags()
+{
+    modifiedFlags_ &= MODIFIED;
+}
+
+template<typename ComponentType, typename BaseClass>
+uint32_t DenseBaseManager<ComponentType, BaseClass>::GetGenerationCounter() const
+{
+    return generationCounter_;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::SetData(CORE_NS::Entity entity, const IPropertyHandle& dataHandle)
+{
+    if (!IsMatchingHandle(dataHandle)) {
+        return;
+    }
+    if (const auto src = ScopedHandle<const ComponentType>(&dataHandle); src) {
+        if (const auto id = GetComponentId(entity); id != IComponentManager::INVALID_COMPONENT_ID) {
+            if (auto dst = ScopedHandle<ComponentType>(&handles_[id]); dst) {
+                *dst = *src;
+            }
+        }
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::GetData(CORE_NS::Entity entity) const
+{
+    return GetData(GetComponentId(entity));
+}
+
+template<typename ComponentType, typename BaseClass>
+IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::GetData(CORE_NS::Entity entity)
+{
+    return GetData(GetComponentId(entity));
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::SetData(ComponentId index, const IPropertyHandle& dataHandle)
+{
+    if (!IsMatchingHandle(dataHandle)) {
+        return;
+    }
+    if (index < handles_.size()) {
+        if (const auto src = ScopedHandle<const ComponentType>(&dataHandle); src) {
+            if (auto dst = ScopedHandle<ComponentType>(&handles_[index]); dst) {
+                *dst = *src;
+            }
+        }
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::GetData(ComponentId index) const
+{
+    if (index < handles_.size()) {
+        return &handles_[index];
+    }
+    return nullptr;
+}
+
+template<typename ComponentType, typename BaseClass>
+IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::GetData(ComponentId index)
+{
+    if (index < handles_.size()) {
+        return &handles_[index];
+    }
+    return nullptr;
+}
+
+template<typename ComponentType, typename BaseClass>
+IEcs& DenseBaseManager<ComponentType, BaseClass>::GetEcs() const
+{
+    return ecs_;
+}
+
+// "base class"
+template<typename ComponentType, typename BaseClass>
+ComponentType DenseBaseManager<ComponentType, BaseClass>::Get(ComponentId index) const
+{
+    if (index < data_.size()) {
+        return data_[index];
+    }
+    return ComponentType {};
+}
+
+template<typename ComponentType, typename BaseClass>
+ComponentType DenseBaseManager<ComponentType, BaseClass>::Get(CORE_NS::Entity entity) const
+{
+    return Get(GetComponentId(entity));
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Set(ComponentId index, const ComponentType& data)
+{
+    if (auto handle = ScopedHandle<ComponentType>(GetData(index))) {
+        *handle = data;
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Set(CORE_NS::Entity entity, const ComponentType& data)
+{
+    if (EntityUtil::IsValid(entity)) {
+        if (const auto id = entityComponent_.Find(entity); id == IComponentManager::INVALID_COMPONENT_ID) {
+            Append(entity, data, 1U);
+        } else {
+            if (auto handle = ScopedHandle<ComponentType>(&handles_[id]); handle) {
+                *handle = data;
+            }
+        }
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+ScopedHandle<const ComponentType> DenseBaseManager<ComponentType, BaseClass>::Read(ComponentId index) const
+{
+    return ScopedHandle<const ComponentType> { GetData(index) };
+}
+
+template<typename ComponentType, typename BaseClass>
+ScopedHandle<const ComponentType> DenseBaseManager<ComponentType, BaseClass>::Read(CORE_NS::Entity entity) const
+{
+    return ScopedHandle<const ComponentType> { GetData(GetComponentId(entity)) };
+}
+
+template<typename ComponentType, typename BaseClass>
+ScopedHandle<ComponentType> DenseBaseManager<ComponentType, BaseClass>::Write(ComponentId index)
+{
+    return ScopedHandle<ComponentType> { GetData(index) };
+}
+
+template<typename ComponentType, typename BaseClass>
+ScopedHandle<ComponentType> DenseBaseManager<ComponentType, BaseClass>::Write(CORE_NS::Entity entity)
+{
+    return ScopedHandle<ComponentType> { GetData(GetComponentId(entity)) };
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::array_view<const ComponentType> DenseBaseManager<ComponentType, BaseClass>::GetComponentData() const
+{
+    return data_;
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::array_view<const CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetEntities() const
+{
+    return entities_;
+}
+
+// internal
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Updated(CORE_NS::Entity entity)
+{
+    BASE_ASSERT_MSG(EntityUtil::IsValid(entity), "Invalid ComponentId, bound to INVALID_ENTITY");
+    modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_UPDATED_BIT | MODIFIED;
+    ++generationCounter_;
+}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::DenseBaseManager(IEcs& ecs, const BASE_NS::string_view name) noexcept
+    : DenseBaseManager(ecs, name, 8U) // 8: default initial reservation, will resize as needed.
+{}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::DenseBaseManager(
+    IEcs& ecs, const BASE_NS::string_view name, const size_t preallocate) noexcept
+    : ecs_(ecs), name_(name), typeHash_(BASE_NS::FNV1aHash(name.data(), name.size()))
+{
+    if (preallocate) {
+        data_.reserve(preallocate);
+        entities_.reserve(preallocate);
+        generations_.reserve(preallocate);
+        dirty_.reserve(preallocate);
+        handles_.reserve(preallocate);
+        entityComponent_.Reserve(preallocate);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::~DenseBaseManager()
+{
+    BASE_ASSERT(GetComponentCount() == 0);
+}
+
+template<typename ComponentType, typename BaseClass>
+bool DenseBaseManager<ComponentType, BaseClass>::IsMatchingHandle(const IPropertyHandle& dataHandle)
+{
+    if (dataHandle.Owner() == this) {
+        return true;
+    }
+    if (dataHandle.Owner() && (dataHandle.Owner()->Type() == typeHash_)) {
+        return true;
+    }
+    return false;
+}
+
+template<typename ComponentType, typename BaseClass>
+IComponentManager::ComponentId DenseBaseManager<ComponentType, BaseClass>::Append(
+    CORE_NS::Entity entity, const ComponentType& data, uint32_t generation)
+{
+    const auto id = static_cast<ComponentId>(data_.size());
+    entityComponent_.Insert(entity, id);
+    data_.push_back(data);
+    entities_.push_back(entity);
+    generations_.push_back(generation);
+    dirty_.push_back(0U);
+    // handle addresses are what GetData returns, so report all components as moved if the handles were reallocated.
+    const auto oldCapacity = handles_.capacity();
+    handles_.emplace_back(this, id);
+    if (handles_.capacity() != oldCapacity) {
+        moved_.append(entities_.cbegin(), entities_.cend());
+        modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_MOVED_BIT;
+    }
+    added_.push_back(entity);
+    modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_ADDED_BIT;
+    ++generationCounter_;
+    return id;
+}
+
+// handle implementation
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::DenseComponentHandle(
+    DenseBaseManager* owner, ComponentId index) noexcept
+    : manager_(owner), index_(index)
+{}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::DenseComponentHandle(
+    DenseComponentHandle&& other) noexcept
+    :
+#ifndef NDEBUG
+      rLocked_(BASE_NS::exchange(other.rLocked_, 0U)), wLocked_(BASE_NS::exchange(other.wLocked_, false)),
+#endif
+      manager_(other.manager_), index_(other.index_)
+{
+#ifndef NDEBUG
+    BASE_ASSERT((rLocked_ == 0U) && !wLocked_);
+#endif
+}
+
+template<typename ComponentType, typename BaseClass>
+typename DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle&
+DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::operator=(DenseComponentHandle&& other) noexcept
+{
+    if (this != &other) {
+        BASE_ASSERT(manager_ == other.manager_);
+#ifndef NDEBUG
+        BASE_ASSERT((other.rLocked_ == 0U) && !other.wLocked_);
+        rLocked_ = BASE_NS::exchange(other.rLocked_, 0U);
+        wLocked_ = BASE_NS::exchange(other.wLocked_, false);
+#endif
+        index_ = other.index_;
+    }
+    return *this;
+}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyApi* DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::Owner() const
+{
+    return manager_;
+}
+
+template<typename ComponentType, typename BaseClass>
+size_t DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::Size() const
+{
+    return sizeof(ComponentType);
+}
+
+template<typename ComponentType, typename BaseClass>
+const void* DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::RLock() const
+{
+    BASE_ASSERT(manager_);
+#ifndef NDEBUG
+    BASE_ASSERT(!wLocked_);
+    BASE_NS::AtomicIncrementRelaxed(&rLocked_);
+#endif
+    return &manager_->data_[index_];
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::RUnlock() const
+{
+    BASE_ASSERT(manager_);
+#ifndef NDEBUG
+    BASE_ASSERT(rLocked_ > 0U);
+    BASE_NS::AtomicDecrementRelaxed(&rLocked_);
+#endif
+}
+
+template<typename ComponentType, typename BaseClass>
+void* DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::WLock()
+{
+    BASE_ASSERT(manager_);
+#ifndef NDEBUG
+    BASE_ASSERT(rLocked_ <= 1U && !wLocked_);
+    wLocked_ = true;
+#endif
+    return &manager_->data_[index_];
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::DenseComponentHandle::WUnlock()
+{
+    BASE_ASSERT(manager_);
+#ifndef NDEBUG
+    BASE_ASSERT(wLocked_);
+    wLocked_ = false;
+#endif
+    // update generation etc..
+    ++manager_->generations_[index_];
+    if (const Entity entity = manager_->entities_[index_]; EntityUtil::IsValid(entity)) {
+        manager_->dirty_[index_] = 1U;
+        manager_->Updated(entity);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::DetachedComponentHandle::DetachedComponentHandle(
+    DenseBaseManager* owner, const ComponentType& data) noexcept
+    : manager_(owner), data_(data)
+{}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyApi* DenseBaseManager<ComponentType, BaseClass>::DetachedComponentHandle::Owner() const
+{
+    return manager_;
+}
+
+template<typename ComponentType, typename BaseClass>
+size_t DenseBaseManager<ComponentType, BaseClass>::DetachedComponentHandle::Size() const
+{
+    return sizeof(ComponentType);
+}
+
+template<typename ComponentType, typename BaseClass>
+const void* DenseBaseManager<ComponentType, BaseClass>::DetachedComponentHandle::RLock() const
+{
+    return &data_;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::DetachedComponentHandle::RUnlock() const
+{}
+
+template<typename ComponentType, typename BaseClass>
+void* DenseBaseManager<ComponentType, BaseClass>::DetachedComponentHandle::WLock()
+{
+    return &data_;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::DetachedComponentHandle::WUnlock()
+{}
+CORE_END_NAMESPACE()
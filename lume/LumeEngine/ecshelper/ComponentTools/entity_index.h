@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CORE__ECS_HELPER__COMPONENT_TOOLS__ENTITY_INDEX_H
+#define CORE__ECS_HELPER__COMPONENT_TOOLS__ENTITY_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <base/containers/unordered_map.h>
+#include <base/containers/vector.h>
+#include <base/namespace.h>
+#include <core/ecs/entity.h>
+#include <core/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+/** Maps entities to 32 bit values (e.g. component ids or result rows).
+ * Entity ids are dense indices (low 32 bits) with a generation (high 32 bits), so the value is stored in a paged array
+ * indexed with the entity index and the generation is validated on look-up. Pages are allocated when the first entity
+ * of the page is inserted. If a slot is already taken by another generation of the same index (e.g. a stale entity),
+ * the value is kept in a small overflow map instead.
+ */
+class EntityIndex {
+public:
+    /** Value returned by Find when the entity is not in the index. */
+    static constexpr uint32_t INVALID_VALUE = ~0u;
+
+    EntityIndex() = default;
+    ~EntityIndex() = default;
+    EntityIndex(const EntityIndex&) = delete;
+    EntityIndex(EntityIndex&&) = default;
+    EntityIndex& operator=(const EntityIndex&) = delete;
+    EntityIndex& operator=(EntityIndex&&) = default;
+
+    /** Get the value of an entity.
+     * @param entity Entity to look up.
+     * @return Value of the entity or INVALID_VALUE if the entity is not in the index.
+     */
+    uint32_t Find(const Entity entity) const
+    {
+        const auto index = GetIndex(entity);
+        if (const auto page = index >> PAGE_SHIFT; page < pages_.size()) {
+            if (const auto& slots = pages_[page]; !slots.empty()) {
+                const Slot& slot = slots[index & PAGE_MASK];
+                if ((slot.value != INVALID_VALUE) && (slot.generation == GetGeneration(entity))) {
+                    return slot.value;
+                }
+            }
+        }
+        if (!overflow_.empty()) {
+            if (const auto pos = overflow_.find(entity); pos != overflow_.cend()) {
+                return pos->second;
+            }
+        }
+        return INVALID_VALUE;
+    }
+
+    /** Check if the entity is in the index. */
+    bool Contains(const Entity entity) const
+    {
+        return Find(entity) != INVALID_VALUE;
+    }
+
+    /** Set the value of an entity, adding the entity if needed.
+     * @param entity Entity to add or update. Should be valid.
+     * @param value New value. Should not be INVALID_VALUE.
+     */
+    void Insert(const Entity entity, const uint32_t value)
+    {
+        const auto index = GetIndex(entity);
+        const auto page = index >> PAGE_SHIFT;
+        if (page >= MAX_PAGE_COUNT) {
+            // not a dense entity index, don't allocate pages for it.
+            InsertOverflow(entity, value);
+            return;
+        }
+        if (page >= pages_.size()) {
+            pages_.resize(page + 1U);
+        }
+        auto& slots = pages_[page];
+        if (slots.empty()) {
+            slots.resize(PAGE_SIZE);
+        }
+        Slot& slot = slots[index & PAGE_MASK];
+        const auto generation = GetGeneration(entity);
+        if ((slot.value != INVALID_VALUE) && (slot.generation == generation)) {
+            slot.value = value;
+        } else if ((slot.value == INVALID_VALUE) && (overflow_.empty() || !overflow_.contains(entity))) {
+            slot.generation = generation;
+            slot.value = value;
+            ++size_;
+        } else {
+            // slot is taken by another generation, or the entity was added while it was.
+            InsertOverflow(entity, value);
+        }
+    }
+
+    /** Remove an entity from the index.
+     * @param entity Entity to remove.
+     * @return True if the entity was in the index.
+     */
+    bool Erase(const Entity entity)
+    {
+        const auto index = GetIndex(entity);
+        if (const auto page = index >> PAGE_SHIFT; page < pages_.size()) {
+            if (auto& slots = pages_[page]; !slots.empty()) {
+                Slot& slot = slots[index & PAGE_MASK];
+                if ((slot.value != INVALID_VALUE) && (slot.generation == GetGeneration(entity))) {
+                    slot.value = INVALID_VALUE;
+                    --size_;
+                    return true;
+                }
+            }
+        }
+        if (!overflow_.empty()) {
+            if (const auto pos = overflow_.find(entity); pos != overflow_.end()) {
+                overflow_.erase(pos);
+                --size_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Remove all entities. Allocated pages are kept. */
+    void Clear()
+    {
+        for (auto& slots : pages_) {
+            for (auto& slot : slots) {
+                slot.value = INVALID_VALUE;
+            }
+        }
+        overflow_.clear();
+        size_ = 0U;
+    }
+
+    /** Reserve pages for entity indices up to the given count. */
+    void Reserve(const size_t count)
+    {
+        pages_.reserve((count + PAGE_MASK) >> PAGE_SHIFT);
+    }
+
+    /** Number of entities in the index. */
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0U;
+    }
+
+private:
+    static constexpr uint32_t PAGE_SHIFT = 10U;
+    static constexpr uint32_t PAGE_SIZE = 1U << PAGE_SHIFT;
+    static constexpr uint32_t PAGE_MASK = PAGE_SIZE - 1U;
+    // entity indices beyond this many pages (16M entities) are kept in the overflow map.
+    static constexpr uint32_t MAX_PAGE_COUNT = 1U << 14U;
+
+    struct Slot {
+        uint32_t generation{0U};
+        uint32_t value{INVALID_VALUE};
+    };
+
+    void InsertOverflow(const Entity entity, const uint32_t value)
+    {
+        if (overflow_.insert_or_assign(entity, value).second) {
+            ++size_;
+        }
+    }
+
+    static constexpr uint32_t GetIndex(const Entity entity)
+    {
+        return static_cast<uint32_t>(entity.id & 0xFFFFFFFF);
+    }
+
+    static constexpr uint32_t GetGeneration(const Entity entity)
+    {
+        return static_cast<uint32_t>(entity.id >> 32U);
+    }
+
+    BASE_NS::vector<BASE_NS::vector<Slot>> pages_;
+    BASE_NS::unordered_map<Entity, uint32_t> overflow_;
+    size_t size_{0U};
+};
+CORE_END_NAMESPACE()
+#endif
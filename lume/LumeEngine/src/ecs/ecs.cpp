@@ -14,6 +14,7 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 
 #include <base/containers/array_view.h>
@@ -35,6 +36,7 @@
 #include <core/plugin/intf_plugin.h>
 #include <core/plugin/intf_plugin_register.h>
 #include <core/threading/intf_thread_pool.h>
+#include <core/util/parallel_for.h>
 
 #include "ecs/entity_manager.h"
 
@@ -105,6 +107,9 @@ public:
     float GetTimeScale() const override;
     void SetTimeScale(float scale) override;
 
+    void SetSystemUpdateMode(SystemUpdateMode mode) override;
+    SystemUpdateMode GetSystemUpdateMode() const override;
+
     void Ref() noexcept override;
     void Unref() noexcept override;
 
@@ -122,6 +127,10 @@ protected:
 
     void CleanupComponentManager(IComponentManager& manager);
 
+    // Groups systems into levels where systems in the same level have no conflicting dependencies.
+    void BuildSystemLevels();
+    bool UpdateSystemsParallel(bool frameRenderingQueued, uint64_t time, uint64_t delta);
+
     IThreadPool::Ptr threadPool_;
 
     // for storing systems and component managers in creation order
@@ -130,6 +139,10 @@ protected:
     // for finding systems and component managers with UID
     unordered_map<Uid, ISystem*> systems_;
     unordered_map<Uid, IComponentManager*> managers_;
+    // systems grouped in execution levels. rebuilt when systemLevelsDirty_ is set.
+    vector<vector<ISystem*>> systemLevels_;
+    bool systemLevelsDirty_{true};
+    SystemUpdateMode systemUpdateMode_{SystemUpdateMode::SEQUENTIAL};
 
     vector<EntityListener*> entityListeners_;
     vector<ComponentListener*> componentListeners_;
@@ -291,6 +304,40 @@ void OrderSystems(vector<const SystemTypeInfo*>& systemInfos)
     }
 }
 
+bool HasWildcard(const array_view<const Uid> uids)
+{
+    return std::any_of(uids.begin(), uids.end(), [](const Uid& uid) { return uid == Uid{}; });
+}
+
+bool Intersects(const array_view<const Uid> lhs, const array_view<const Uid> rhs)
+{
+    return std::any_of(lhs.begin(), lhs.end(),
+        [rhs](const Uid& uid) { return std::find(rhs.begin(), rhs.end(), uid) != rhs.end(); });
+}
+
+// Systems without declared dependencies, or with a wild card, might access anything.
+bool HasUnknownDependencies(const SystemTypeInfo* info)
+{
+    return !info || (info->componentDependencies.empty() && info->readOnlyComponentDependencies.empty()) ||
+           HasWildcard(info->componentDependencies) || HasWildcard(info->readOnlyComponentDependencies);
+}
+
+// Returns true if the systems must not be updated at the same time.
+bool SystemsConflict(const SystemTypeInfo* lhs, const SystemTypeInfo* rhs)
+{
+    if (HasUnknownDependencies(lhs) || HasUnknownDependencies(rhs)) {
+        return true;
+    }
+    if ((lhs->afterSystem == rhs->uid) || (lhs->beforeSystem == rhs->uid) || (rhs->afterSystem == lhs->uid) ||
+        (rhs->beforeSystem == lhs->uid)) {
+        return true;
+    }
+    // write-write and read-write conflicts.
+    return Intersects(lhs->componentDependencies, rhs->componentDependencies) ||
+           Intersects(lhs->componentDependencies, rhs->readOnlyComponentDependencies) ||
+           Intersects(lhs->readOnlyComponentDependencies, rhs->componentDependencies);
+}
+
 void Ecs::AddListener(EntityListener& listener)
 {
     if (Find(entityListeners_, &listener) != entityListeners_.end()) {
@@ -390,6 +437,7 @@ ISystem* Ecs::CreateSystem(const SystemTypeInfo& systemInfo)
 
     systems_.insert({systemInfo.uid, system});
     systemOrder_.emplace_back(system, systemInfo.destroySystem);
+    systemLevelsDirty_ = true;
 
     if (initialized_) {
         system->Initialize();
@@ -652,6 +700,7 @@ void Ecs::Initialize()
             systems_.insert({systemInfo->uid, system});
             systemOrder_.emplace_back(system, systemInfo->destroySystem);
         }
+        systemLevelsDirty_ = true;
     }
 
     for (auto& s : systemOrder_) {
@@ -673,10 +722,14 @@ bool Ecs::Update(uint64_t time, uint64_t delta)
 
     // Update all systems.
     delta = static_cast<uint64_t>(static_cast<double>(delta) * timeScale_);
-    for (auto& s : systemOrder_) {
-        CORE_CPU_PERF_SCOPE("CORE", "SystemUpdate", s->GetName(), CORE_PROFILER_DEFAULT_COLOR);
-        if (s->Update(frameRenderingQueued, time, delta)) {
-            frameRenderingQueued = true;
+    if ((systemUpdateMode_ == SystemUpdateMode::PARALLEL) && threadPool_ && (threadPool_->GetNumberOfThreads() > 1U)) {
+        frameRenderingQueued = UpdateSystemsParallel(frameRenderingQueued, time, delta);
+    } else {
+        for (auto& s : systemOrder_) {
+            CORE_CPU_PERF_SCOPE("CORE", "SystemUpdate", s->GetName(), CORE_PROFILER_DEFAULT_COLOR);
+            if (s->Update(frameRenderingQueued, time, delta)) {
+                frameRenderingQueued = true;
+            }
         }
     }
 
@@ -687,6 +740,59 @@ bool Ecs::Update(uint64_t time, uint64_t delta)
     return frameRenderingQueued;
 }
 
+void Ecs::BuildSystemLevels()
+{
+    systemLevels_.clear();
+    systemLevelsDirty_ = false;
+
+    // A system is placed one level after the last earlier system it conflicts with. This keeps the relative order of
+    // conflicting systems the same as in sequential mode. Systems whose type info isn't registered are updated alone.
+    const auto systemMetadata = GetPluginRegister().GetTypeInfos(SystemTypeInfo::UID);
+    vector<const SystemTypeInfo*> infos;
+    vector<size_t> levels;
+    infos.reserve(systemOrder_.size());
+    levels.reserve(systemOrder_.size());
+    for (const auto& s : systemOrder_) {
+        const auto* info = FindTypeInfo<SystemTypeInfo>(s->GetUid(), systemMetadata);
+        size_t level = 0U;
+        for (size_t i = 0U, count = infos.size(); i < count; ++i) {
+            if ((levels[i] >= level) && SystemsConflict(infos[i], info)) {
+                level = levels[i] + 1U;
+            }
+        }
+        infos.push_back(info);
+        levels.push_back(level);
+        if (level >= systemLevels_.size()) {
+            systemLevels_.resize(level + 1U);
+        }
+        systemLevels_[level].push_back(s.get());
+    }
+}
+
+bool Ecs::UpdateSystemsParallel(bool frameRenderingQueued, uint64_t time, uint64_t delta)
+{
+    if (systemLevelsDirty_) {
+        BuildSystemLevels();
+    }
+
+    for (const auto& level : systemLevels_) {
+        // systems within a level see the same frameRenderingQueued, the results are combined after the level.
+        const bool queued = frameRenderingQueued;
+        std::atomic_bool levelQueued{false};
+        // this thread updates systems too, so systems which run parallel work of their own on the same pool can't
+        // starve it.
+        ParallelFor(threadPool_.get(), level.size(), [&level, queued, time, delta, &levelQueued](size_t index) {
+            auto* s = level[index];
+            CORE_CPU_PERF_SCOPE("CORE", "SystemUpdate", s->GetName(), CORE_PROFILER_DEFAULT_COLOR);
+            if (s->Update(queued, time, delta)) {
+                levelQueued.store(true, std::memory_order_relaxed);
+            }
+        });
+        frameRenderingQueued = frameRenderingQueued || levelQueued.load(std::memory_order_relaxed);
+    }
+    return frameRenderingQueued;
+}
+
 void Ecs::Uninitialize()
 {
     // Destroy all entities from scene.
@@ -738,6 +844,16 @@ void Ecs::SetTimeScale(float scale)
     timeScale_ = scale;
 }
 
+void Ecs::SetSystemUpdateMode(SystemUpdateMode mode)
+{
+    systemUpdateMode_ = mode;
+}
+
+IEcs::SystemUpdateMode Ecs::GetSystemUpdateMode() const
+{
+    return systemUpdateMode_;
+}
+
 uint64_t Ecs::GetId() const
 {
     return ecsId_;
@@ -777,6 +893,9 @@ void Ecs::OnTypeInfoEvent(EventType type, array_view<const ITypeInfo* const> typ
                     auto token = ecsPlugin->createPlugin(*this);
                     plugins_.push_back({token, ecsPlugin});
                 }
+            } else if (info && info->typeUid == SystemTypeInfo::UID) {
+                // an existing system's dependencies may now be known.
+                systemLevelsDirty_ = true;
             }
         }
     } else if (type == EventType::REMOVED) {
@@ -792,6 +911,7 @@ void Ecs::OnTypeInfoEvent(EventType type, array_view<const ITypeInfo* const> typ
                     systems_.erase(pos);
                 }
                 RemoveUid(systemOrder_, systemInfo->uid);
+                systemLevelsDirty_ = true;
             } else if (info->typeUid == ComponentManagerTypeInfo::UID) {
                 const auto managerInfo = static_cast<const ComponentManagerTypeInfo*>(info);
                 // BaseManager expects that the component list is empty when it's destroyed. might be also
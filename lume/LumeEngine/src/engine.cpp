@@ -114,6 +114,11 @@ Engine::~Engine()
 {
     GetPluginRegister().RemoveListener(*this);
 
+    // decoding threads must not be using the image loaders while the plugins are unloaded.
+    if (imageManager_) {
+        imageManager_->CancelAsyncLoads();
+    }
+
 #if (CORE_PERF_ENABLED == 1)
     if (auto perfFactory = CORE_NS::GetInstance<IPerformanceDataManagerFactory>(UID_PERFORMANCE_FACTORY); perfFactory) {
         for (const auto& perfMan : perfFactory->GetAllCategories()) {
@@ -130,16 +135,23 @@ Engine::~Engine()
 
 CORE_NS::IEcs* IEcsInstance(IClassFactory&, const IThreadPool::Ptr&, uint64_t ecsId);
 
-IEcs::Ptr Engine::CreateEcs()
+const IThreadPool::Ptr& Engine::GetThreadPool()
 {
+    // ECS instances and asynchronous image loads may ask for the pool from different threads.
+    std::lock_guard lock(threadPoolMutex_);
     if (!threadPool_) {
         if (auto threadFactory = CORE_NS::GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY); threadFactory) {
             threadPool_ = threadFactory->CreateThreadPool(GetThreadPoolThreadCount(threadFactory->GetNumberOfCores()));
         }
     }
+    return threadPool_;
+}
+
+IEcs::Ptr Engine::CreateEcs()
+{
     // start from zero
     const int32_t counter = BASE_NS::AtomicIncrement(&ecsCounter_) - 1;
-    return IEcs::Ptr{IEcsInstance(*this, threadPool_, uint64_t(counter))};
+    return IEcs::Ptr{IEcsInstance(*this, GetThreadPool(), uint64_t(counter))};
 
     return IEcs::Ptr{};
 }
@@ -155,7 +167,9 @@ void Engine::Init()
 {
     CORE_LOG_D("Engine init.");
 
-    imageManager_ = make_unique<ImageLoaderManager>(*fileManager_);
+    // asynchronous image loads share the thread pool with the ECS instances. It's created when first needed, so engines
+    // which never load images asynchronously or create an ECS don't start any threads.
+    imageManager_ = make_unique<ImageLoaderManager>(*fileManager_, static_cast<IThreadPoolProvider&>(*this));
 
     LoadPlugins();
 
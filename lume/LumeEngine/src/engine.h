@@ -17,6 +17,7 @@
 #define CORE_ENGINE_H
 
 #include <cstdint>
+#include <mutex>
 
 #include <base/containers/array_view.h>
 #include <base/containers/string.h>
@@ -35,6 +36,8 @@
 #include <core/plugin/intf_plugin_register.h>
 #include <core/threading/intf_thread_pool.h>
 
+#include "image/image_loader_manager.h"
+
 BASE_BEGIN_NAMESPACE()
 template<class T1, class T2>
 struct pair;
@@ -46,7 +49,8 @@ class IPlatform;
 class IThreadPool;
 
 class Engine final : public IInterfaceHelper<IEngine, IClassRegister, IClassFactory>,
-                     IPluginRegister::ITypeInfoListener {
+                     IPluginRegister::ITypeInfoListener,
+                     ImageLoaderManager::IThreadPoolProvider {
 public:
     explicit Engine(EngineCreateInfo const& createInfo);
     ~Engine() override;
@@ -88,6 +92,8 @@ private:
     void RegisterDefaultPaths();
     void LoadPlugins();
     void UnloadPlugins();
+    // ImageLoaderManager::IThreadPoolProvider, default thread pool, created on first use.
+    const IThreadPool::Ptr& GetThreadPool() override;
     static bool TickFrame(IEcs& ecs, uint64_t totalTime, uint64_t deltaTime);
 
     uint64_t firstTime_{~uint64_t(0)};
@@ -98,11 +104,12 @@ private:
 
     IFileManager::Ptr fileManager_;
 
-    BASE_NS::unique_ptr<class ImageLoaderManager> imageManager_;
+    BASE_NS::unique_ptr<ImageLoaderManager> imageManager_;
 
     BASE_NS::vector<BASE_NS::pair<PluginToken, const IEnginePlugin*>> plugins_;
     BASE_NS::vector<const InterfaceTypeInfo*> interfaceTypeInfos_;
 
+    std::mutex threadPoolMutex_;
     IThreadPool::Ptr threadPool_;
 
     // unique counter for ECS objects
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "image_cache.h"
+
+#include <algorithm>
+
+#include <base/util/hash.h>
+#include <core/perf/cpu_perf_scope.h>
+
+#if (CORE_PERF_ENABLED == 1)
+#include <core/implementation_uids.h>
+#include <core/perf/intf_performance_data_manager.h>
+#endif
+
+CORE_BEGIN_NAMESPACE()
+using BASE_NS::array_view;
+using BASE_NS::make_shared;
+using BASE_NS::move;
+using BASE_NS::shared_ptr;
+using BASE_NS::string_view;
+
+// Keeps the decoded image alive for as long as the cache or any of the returned containers refer to it.
+struct ImageCache::CachedImage {
+    IImageContainer::Ptr image;
+};
+
+namespace {
+class SharedImageContainer final : public IImageContainer {
+public:
+    using CachedImage = ImageCache::CachedImage;
+
+    explicit SharedImageContainer(shared_ptr<CachedImage> cached) : cached_(move(cached)) {}
+
+    const ImageDesc& GetImageDesc() const override
+    {
+        return cached_->image->GetImageDesc();
+    }
+
+    array_view<const uint8_t> GetData() const override
+    {
+        return cached_->image->GetData();
+    }
+
+    array_view<const SubImageDesc> GetBufferImageCopies() const override
+    {
+        return cached_->image->GetBufferImageCopies();
+    }
+
+protected:
+    ~SharedImageContainer() override = default;
+
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    shared_ptr<CachedImage> cached_;
+};
+
+IImageContainer::Ptr Share(const shared_ptr<ImageCache::CachedImage>& cached)
+{
+    return IImageContainer::Ptr{new SharedImageContainer(cached)};
+}
+}  // namespace
+
+ImageCache::Key ImageCache::UriKey(const string_view uri, uint32_t loadFlags)
+{
+    Key key{BASE_NS::FNV1aHash(uri.data(), uri.size()), BASE_NS::string(uri), 0U, loadFlags};
+    BASE_NS::HashCombine(key.hash, loadFlags);
+    return key;
+}
+
+ImageCache::Key ImageCache::ContentKey(array_view<const uint8_t> imageFileBytes, uint32_t loadFlags)
+{
+    CORE_CPU_PERF_SCOPE("CORE", "ImageCache::ContentKey()", "", CORE_PROFILER_DEFAULT_COLOR);
+    // hashing the encoded data is still much cheaper than decoding it.
+    Key key{BASE_NS::FNV1aHash(imageFileBytes.data(), imageFileBytes.size()), {}, imageFileBytes.size(), loadFlags};
+    BASE_NS::HashCombine(key.hash, key.contentSize, loadFlags);
+    return key;
+}
+
+void ImageCache::SetBudget(size_t bytes)
+{
+    std::lock_guard lock(mutex_);
+    budget_ = bytes;
+    EvictOverBudget(budget_);
+}
+
+bool ImageCache::IsEnabled() const
+{
+    std::lock_guard lock(mutex_);
+    return budget_ > 0U;
+}
+
+void ImageCache::Clear()
+{
+    std::lock_guard lock(mutex_);
+    entries_.clear();
+    size_ = 0U;
+}
+
+IImageContainer::Ptr ImageCache::Find(const Key& key)
+{
+    std::lock_guard lock(mutex_);
+    if (auto pos = entries_.find(key.hash); (pos != entries_.end()) && (pos->second.key == key)) {
+        pos->second.lastUse = ++useCounter_;
+        ++hits_;
+        ReportStatistics(true);
+        return Share(pos->second.image);
+    }
+    ++misses_;
+    ReportStatistics(false);
+    return {};
+}
+
+IImageContainer::Ptr ImageCache::Add(const Key& key, IImageContainer::Ptr image)
+{
+    if (!image) {
+        return image;
+    }
+    const size_t bytes = std::max(image->GetData().size(), MIN_ENTRY_BYTES);
+    std::lock_guard lock(mutex_);
+    if (bytes > budget_) {
+        return image;
+    }
+    // a colliding entry with a different key is replaced.
+    if (auto pos = entries_.find(key.hash); pos != entries_.end()) {
+        size_ -= pos->second.bytes;
+        entries_.erase(pos);
+    }
+    EvictOverBudget(budget_ - bytes);
+    auto cached = make_shared<CachedImage>();
+    cached->image = move(image);
+    entries_.insert_or_assign(key.hash, Entry{key, cached, bytes, ++useCounter_});
+    size_ += bytes;
+    return Share(cached);
+}
+
+ImageCache::Statistics ImageCache::GetStatistics() const
+{
+    std::lock_guard lock(mutex_);
+    return Statistics{hits_, misses_, size_, entries_.size()};
+}
+
+void ImageCache::EvictOverBudget(size_t budget)
+{
+    // typically the cache holds a few hundred images (never more than budget / MIN_ENTRY_BYTES), so a linear search
+    // for the least recently used one is enough.
+    while ((size_ > budget) && !entries_.empty()) {
+        auto oldest = entries_.begin();
+        for (auto pos = entries_.begin(); pos != entries_.end(); ++pos) {
+            if (pos->second.lastUse < oldest->second.lastUse) {
+                oldest = pos;
+            }
+        }
+        size_ -= oldest->second.bytes;
+        entries_.erase(oldest);
+    }
+}
+
+void ImageCache::ReportStatistics(bool hit) const
+{
+#if (CORE_PERF_ENABLED == 1)
+    if (auto perfFactory = CORE_NS::GetInstance<IPerformanceDataManagerFactory>(UID_PERFORMANCE_FACTORY); perfFactory) {
+        if (IPerformanceDataManager* perfData = perfFactory->Get("ImageCache"); perfData) {
+            using DataType = IPerformanceDataManager::PerformanceTimingData::DataType;
+            // the total of each counter is the number of hits and misses.
+            perfData->UpdateData("ImageCache", hit ? "Hit" : "Miss", 1, DataType::COUNT);
+            perfData->UpdateData("ImageCache", "CachedBytes", static_cast<int64_t>(size_), DataType::BYTES);
+        }
+    }
+#endif
+}
+CORE_END_NAMESPACE()
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_IMAGE_IMAGE_CACHE_H
+#define CORE_IMAGE_IMAGE_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include <base/containers/array_view.h>
+#include <base/containers/shared_ptr.h>
+#include <base/containers/string.h>
+#include <base/containers/string_view.h>
+#include <base/containers/unordered_map.h>
+#include <core/image/intf_image_container.h>
+#include <core/image/intf_image_loader_manager.h>
+#include <core/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+/** LRU cache of decoded images with a memory budget.
+ * Images are shared instead of copied: Find and Add return containers referencing the cached data, so an evicted image
+ * is released only after the last returned container is destroyed. Internally synchronized.
+ */
+class ImageCache final {
+public:
+    using Statistics = IImageLoaderManager::ImageCacheStatistics;
+
+    /** Every image is charged at least this much against the budget. Images loaded with
+     * IMAGE_LOADER_METADATA_ONLY have no decoded data, so without it their count would be unbounded. */
+    static constexpr size_t MIN_ENTRY_BYTES = 4096U;
+
+    /** Identifies a decoded image, either by the uri it was loaded from or by the content of the encoded data. */
+    struct Key {
+        uint64_t hash{0U};
+        /** Uri for uri keys, empty for content keys. */
+        BASE_NS::string uri;
+        /** Size of the encoded data for content keys. */
+        uint64_t contentSize{0U};
+        uint32_t loadFlags{0U};
+
+        bool operator==(const Key& rhs) const
+        {
+            return (hash == rhs.hash) && (contentSize == rhs.contentSize) && (loadFlags == rhs.loadFlags) &&
+                   (uri == rhs.uri);
+        }
+    };
+
+    static Key UriKey(BASE_NS::string_view uri, uint32_t loadFlags);
+    static Key ContentKey(BASE_NS::array_view<const uint8_t> imageFileBytes, uint32_t loadFlags);
+
+    ImageCache() = default;
+    ~ImageCache() = default;
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+
+    /** Set the budget in bytes of decoded data. Zero disables the cache. Images over the budget are evicted. */
+    void SetBudget(size_t bytes);
+    bool IsEnabled() const;
+
+    /** Release all cached images. Statistics are kept. */
+    void Clear();
+
+    /** Returns a container sharing the cached image, or null on a miss. */
+    IImageContainer::Ptr Find(const Key& key);
+
+    /** Cache the image. Returns a container sharing the cached image, or the image itself if it was not cached. */
+    IImageContainer::Ptr Add(const Key& key, IImageContainer::Ptr image);
+
+    Statistics GetStatistics() const;
+
+    /** Decoded image shared by the cache and the containers returned from it. */
+    struct CachedImage;
+
+private:
+    struct Entry {
+        Key key;
+        BASE_NS::shared_ptr<CachedImage> image;
+        size_t bytes{0U};
+        uint64_t lastUse{0U};
+    };
+
+    void EvictOverBudget(size_t budget);
+    void ReportStatistics(bool hit) const;
+
+    mutable std::mutex mutex_;
+    BASE_NS::unordered_map<uint64_t, Entry> entries_;
+    size_t budget_{0U};
+    size_t size_{0U};
+    uint64_t useCounter_{0U};
+    uint64_t hits_{0U};
+    uint64_t misses_{0U};
+};
+CORE_END_NAMESPACE()
+
+#endif  // CORE_IMAGE_IMAGE_CACHE_H
@@ -16,8 +16,11 @@
 #include "image_loader_manager.h"
 
 #include <algorithm>
+#include <atomic>
 
 #include <base/containers/array_view.h>
+#include <base/containers/shared_ptr.h>
+#include <base/containers/string.h>
 #include <base/containers/string_view.h>
 #include <base/containers/type_traits.h>
 #include <base/containers/unique_ptr.h>
@@ -32,17 +35,104 @@
 #include <core/log.h>
 #include <core/namespace.h>
 #include <core/perf/cpu_perf_scope.h>
+#include <core/util/parallel_sort.h>
 
 CORE_BEGIN_NAMESPACE()
 using BASE_NS::array_view;
+using BASE_NS::make_shared;
 using BASE_NS::make_unique;
 using BASE_NS::move;
+using BASE_NS::shared_ptr;
 using BASE_NS::string_view;
 using BASE_NS::unique_ptr;
 using BASE_NS::vector;
 
-ImageLoaderManager::ImageLoaderManager(IFileManager& fileManager) : fileManager_(fileManager)
+struct ImageLoaderManager::AsyncLoadState {
+    AsyncLoadState(string_view uri, uint32_t loadFlags, size_t index, IAsyncLoadListener* listener)
+        : uri(uri), loadFlags(loadFlags), index(index), listener(listener),
+          // replaced when the load runs, so a cancelled load needs no write which could race with the decoding thread.
+          result(ResultFailure("Load cancelled."))
+    {}
+
+    bool Cancel()
+    {
+        {
+            std::lock_guard lock(mutex);
+            auto expected = AsyncLoadStatus::PENDING;
+            if (!status.compare_exchange_strong(expected, AsyncLoadStatus::CANCELLED)) {
+                return false;
+            }
+        }
+        done.notify_all();
+        return true;
+    }
+
+    const BASE_NS::string uri;
+    const uint32_t loadFlags;
+    const size_t index;
+    IAsyncLoadListener* const listener;
+    std::atomic<AsyncLoadStatus> status{AsyncLoadStatus::PENDING};
+    LoadResult result;
+    std::mutex mutex;
+    std::condition_variable done;
+};
+
+class ImageLoaderManager::AsyncLoad final : public IAsyncLoad {
+public:
+    explicit AsyncLoad(shared_ptr<AsyncLoadState> state) : state_(move(state)) {}
+
+    AsyncLoadStatus GetStatus() const override
+    {
+        return state_->status.load();
+    }
+
+    void Wait() override
+    {
+        std::unique_lock lock(state_->mutex);
+        state_->done.wait(lock, [state = state_.get()]() {
+            const auto status = state->status.load();
+            return (status == AsyncLoadStatus::DONE) || (status == AsyncLoadStatus::CANCELLED);
+        });
+    }
+
+    bool Cancel() override
+    {
+        return state_->Cancel();
+    }
+
+    LoadResult& GetResult() override
+    {
+        return state_->result;
+    }
+
+protected:
+    ~AsyncLoad() override = default;
+
+    void Destroy() override
+    {
+        state_->Cancel();
+        delete this;
+    }
+
+private:
+    shared_ptr<AsyncLoadState> state_;
+};
+
+ImageLoaderManager::ImageLoaderManager(IFileManager& fileManager) : ImageLoaderManager(fileManager, {}) {}
+
+ImageLoaderManager::ImageLoaderManager(IFileManager& fileManager, IThreadPoolProvider& threadPoolProvider)
+    : ImageLoaderManager(fileManager, {})
+{
+    threadPoolProvider_ = &threadPoolProvider;
+}
+
+ImageLoaderManager::ImageLoaderManager(IFileManager& fileManager, IThreadPool::Ptr threadPool)
+    : fileManager_(fileManager), threadPool_(move(threadPool))
 {
+    if (threadPool_ && (threadPool_->GetNumberOfThreads() == 0U)) {
+        // queued loads would never run.
+        threadPool_.reset();
+    }
     for (const auto* typeInfo : GetPluginRegister().GetTypeInfos(IImageLoaderManager::ImageLoaderTypeInfo::UID)) {
         if (typeInfo && (typeInfo->typeUid == IImageLoaderManager::ImageLoaderTypeInfo::UID)) {
             const auto* imageLoaderInfo = static_cast<const IImageLoaderManager::ImageLoaderTypeInfo*>(typeInfo);
@@ -59,6 +149,7 @@ ImageLoaderManager::ImageLoaderManager(IFileManager& fileManager) : fileManager_
 
 ImageLoaderManager::~ImageLoaderManager()
 {
+    CancelAsyncLoads();
     GetPluginRegister().RemoveListener(*this);
 }
 
@@ -78,13 +169,26 @@ ImageLoaderManager::LoadResult ImageLoaderManager::LoadImage(const string_view u
 {
     CORE_CPU_PERF_SCOPE("CORE", "LoadImage()", uri, CORE_PROFILER_DEFAULT_COLOR);
 
+    const bool useCache = imageCache_.IsEnabled();
+    ImageCache::Key key;
+    if (useCache) {
+        key = ImageCache::UriKey(uri, loadFlags);
+        if (auto image = imageCache_.Find(key); image) {
+            return ResultSuccess(move(image));
+        }
+    }
+
     // Load 12 bytes (maximum header size of currently implemented file types)
     IFile::Ptr file = fileManager_.OpenFile(uri);
     if (!file) {
         return ResultFailure("Can not open image.");
     }
 
-    return LoadImage(*file, loadFlags);
+    LoadResult result = LoadImage(*file, loadFlags);
+    if (useCache && result.success) {
+        result.image = imageCache_.Add(key, move(result.image));
+    }
+    return result;
 }
 
 ImageLoaderManager::LoadResult ImageLoaderManager::LoadImage(
@@ -125,6 +229,17 @@ ImageLoaderManager::LoadResult ImageLoaderManager::LoadImage(IFile& file, uint32
 {
     CORE_CPU_PERF_SCOPE("CORE", "LoadImage(file)", "", CORE_PROFILER_DEFAULT_COLOR);
 
+    // Mapped files are decoded in place. Metadata is still read through the file as some loaders copy the whole
+    // buffer when loading from memory.
+    if (const auto data = file.GetData(); !data.empty() && !(loadFlags & IMAGE_LOADER_METADATA_ONLY)) {
+        for (auto& loader : imageLoaders_) {
+            if (loader.instance && loader.instance->CanLoad(data)) {
+                return loader.instance->Load(data, loadFlags);
+            }
+        }
+        return ResultFailure("Image loader not found for this format.");
+    }
+
     const uint64_t byteLength = 12u;
 
     // Read header of the file to a buffer.
@@ -149,9 +264,22 @@ ImageLoaderManager::LoadResult ImageLoaderManager::LoadImage(
 {
     CORE_CPU_PERF_SCOPE("CORE", "LoadImage(bytes)", "", CORE_PROFILER_DEFAULT_COLOR);
 
+    const bool useCache = imageCache_.IsEnabled();
+    ImageCache::Key key;
+    if (useCache) {
+        key = ImageCache::ContentKey(imageFileBytes, loadFlags);
+        if (auto image = imageCache_.Find(key); image) {
+            return ResultSuccess(move(image));
+        }
+    }
+
     for (auto& loader : imageLoaders_) {
         if (loader.instance && loader.instance->CanLoad(imageFileBytes)) {
-            return loader.instance->Load(imageFileBytes, loadFlags);
+            LoadResult result = loader.instance->Load(imageFileBytes, loadFlags);
+            if (useCache && result.success) {
+                result.image = imageCache_.Add(key, move(result.image));
+            }
+            return result;
         }
     }
 
@@ -272,6 +400,126 @@ vector<IImageLoaderManager::ImageType> ImageLoaderManager::GetSupportedTypes() c
     return allTypes;
 }
 
+vector<IImageLoaderManager::IAsyncLoad::Ptr> ImageLoaderManager::LoadImagesAsync(
+    array_view<const AsyncLoadRequest> requests, IAsyncLoadListener* listener)
+{
+    CORE_CPU_PERF_SCOPE("CORE", "LoadImagesAsync()", "", CORE_PROFILER_DEFAULT_COLOR);
+
+    vector<IAsyncLoad::Ptr> loads;
+    loads.reserve(requests.size());
+    vector<shared_ptr<AsyncLoadState>> states;
+    states.reserve(requests.size());
+    for (size_t i = 0U; i < requests.size(); ++i) {
+        const auto& request = requests[i];
+        auto& state = states.emplace_back(make_shared<AsyncLoadState>(request.uri, request.loadFlags, i, listener));
+        loads.push_back(IAsyncLoad::Ptr{new AsyncLoad(state)});
+    }
+    auto* threadPool = GetAsyncThreadPool();
+    if (!threadPool) {
+        for (auto& state : states) {
+            state->status = AsyncLoadStatus::RUNNING;
+            RunAsyncLoad(*state);
+        }
+        return loads;
+    }
+
+    {
+        std::lock_guard lock(asyncMutex_);
+        for (size_t i = 0U; i < requests.size(); ++i) {
+            const auto priority =
+                std::min(static_cast<size_t>(requests[i].priority), BASE_NS::countof(asyncQueues_) - 1U);
+            asyncQueues_[priority].push_back(move(states[i]));
+        }
+        asyncTaskCount_ += requests.size();
+    }
+    // the tasks are not tied to a specific load, each one picks the highest priority load pending when it starts.
+    for (size_t i = 0U; i < requests.size(); ++i) {
+        threadPool->PushNoWait(CreateFunctionTask([this]() { RunNextAsyncLoad(); }));
+    }
+    return loads;
+}
+
+void ImageLoaderManager::SetImageCacheBudget(size_t bytes)
+{
+    imageCache_.SetBudget(bytes);
+}
+
+void ImageLoaderManager::ClearImageCache()
+{
+    imageCache_.Clear();
+}
+
+IImageLoaderManager::ImageCacheStatistics ImageLoaderManager::GetImageCacheStatistics() const
+{
+    return imageCache_.GetStatistics();
+}
+
+void ImageLoaderManager::CancelAsyncLoads()
+{
+    std::unique_lock lock(asyncMutex_);
+    for (auto& queue : asyncQueues_) {
+        for (const auto& state : queue) {
+            state->Cancel();
+        }
+        queue.clear();
+    }
+    asyncIdle_.wait(lock, [this]() { return asyncTaskCount_ == 0U; });
+}
+
+IThreadPool* ImageLoaderManager::GetAsyncThreadPool()
+{
+    std::lock_guard lock(asyncMutex_);
+    if (threadPoolProvider_) {
+        threadPool_ = threadPoolProvider_->GetThreadPool();
+        threadPoolProvider_ = nullptr;
+        if (threadPool_ && (threadPool_->GetNumberOfThreads() == 0U)) {
+            threadPool_.reset();
+        }
+    }
+    return threadPool_.get();
+}
+
+void ImageLoaderManager::RunNextAsyncLoad()
+{
+    shared_ptr<AsyncLoadState> state;
+    {
+        std::lock_guard lock(asyncMutex_);
+        for (auto queue = std::rbegin(asyncQueues_); !state && (queue != std::rend(asyncQueues_)); ++queue) {
+            while (!queue->empty()) {
+                auto front = move(queue->front());
+                queue->pop_front();
+                // skip loads which were cancelled while queued.
+                auto expected = AsyncLoadStatus::PENDING;
+                if (front->status.compare_exchange_strong(expected, AsyncLoadStatus::RUNNING)) {
+                    state = move(front);
+                    break;
+                }
+            }
+        }
+    }
+    if (state) {
+        RunAsyncLoad(*state);
+    }
+    std::lock_guard lock(asyncMutex_);
+    if (--asyncTaskCount_ == 0U) {
+        asyncIdle_.notify_all();
+    }
+}
+
+void ImageLoaderManager::RunAsyncLoad(AsyncLoadState& state)
+{
+    // the result is not accessed through the handle before the status is DONE.
+    state.result = LoadImage(state.uri, state.loadFlags);
+    if (state.listener) {
+        state.listener->OnImageLoaded(state.index, state.result);
+    }
+    {
+        std::lock_guard lock(state.mutex);
+        state.status = AsyncLoadStatus::DONE;
+    }
+    state.done.notify_all();
+}
+
 void ImageLoaderManager::OnTypeInfoEvent(EventType type, array_view<const ITypeInfo* const> typeInfos)
 {
     for (const auto* typeInfo : typeInfos) {
@@ -16,8 +16,12 @@
 #ifndef CORE_IMAGE_IMAGE_LOADER_MANAGER_H
 #define CORE_IMAGE_IMAGE_LOADER_MANAGER_H
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <mutex>
 
+#include <base/containers/shared_ptr.h>
 #include <base/containers/string_view.h>
 #include <base/containers/vector.h>
 #include <base/namespace.h>
@@ -26,6 +30,9 @@
 #include <core/image/intf_image_loader_manager.h>
 #include <core/namespace.h>
 #include <core/plugin/intf_plugin_register.h>
+#include <core/threading/intf_thread_pool.h>
+
+#include "image/image_cache.h"
 
 BASE_BEGIN_NAMESPACE()
 template<class T>
@@ -38,7 +45,18 @@ class IFileManager;
 
 class ImageLoaderManager final : public IImageLoaderManager, private IPluginRegister::ITypeInfoListener {
 public:
+    /** Gives the thread pool for asynchronous loads. Asked once, when the first asynchronous load is requested. */
+    class IThreadPoolProvider {
+    public:
+        virtual const IThreadPool::Ptr& GetThreadPool() = 0;
+
+    protected:
+        virtual ~IThreadPoolProvider() = default;
+    };
+
     explicit ImageLoaderManager(IFileManager& fileManager);
+    ImageLoaderManager(IFileManager& fileManager, IThreadPool::Ptr threadPool);
+    ImageLoaderManager(IFileManager& fileManager, IThreadPoolProvider& threadPoolProvider);
     ~ImageLoaderManager() override;
 
     void RegisterImageLoader(IImageLoader::Ptr imageLoader) override;
@@ -56,15 +74,46 @@ public:
 
     BASE_NS::vector<ImageType> GetSupportedTypes() const override;
 
+    BASE_NS::vector<IAsyncLoad::Ptr> LoadImagesAsync(
+        BASE_NS::array_view<const AsyncLoadRequest> requests, IAsyncLoadListener* listener) override;
+
+    void SetImageCacheBudget(size_t bytes) override;
+    void ClearImageCache() override;
+    ImageCacheStatistics GetImageCacheStatistics() const override;
+
+    /** Cancel pending asynchronous loads and wait for the running ones to finish. */
+    void CancelAsyncLoads();
+
     static LoadResult ResultFailure(BASE_NS::string_view error);
     static LoadResult ResultSuccess(IImageContainer::Ptr image);
     static LoadAnimatedResult ResultFailureAnimated(BASE_NS::string_view error);
     static LoadAnimatedResult ResultSuccessAnimated(IAnimatedImage::Ptr image);
 
 private:
+    struct AsyncLoadState;
+    class AsyncLoad;
+
     void OnTypeInfoEvent(EventType type, BASE_NS::array_view<const ITypeInfo* const> typeInfos) override;
 
+    // Runs the highest priority pending load. One call is queued to the thread pool for each requested load.
+    void RunNextAsyncLoad();
+    void RunAsyncLoad(AsyncLoadState& state);
+    // Thread pool for asynchronous loads, null if they are run synchronously.
+    IThreadPool* GetAsyncThreadPool();
+
     IFileManager& fileManager_;
+    // set until the thread pool has been asked for, guarded by asyncMutex_.
+    IThreadPoolProvider* threadPoolProvider_{nullptr};
+    IThreadPool::Ptr threadPool_;
+    ImageCache imageCache_;
+
+    std::mutex asyncMutex_;
+    std::condition_variable asyncIdle_;
+    // pending loads for each LoadPriority.
+    std::deque<BASE_NS::shared_ptr<AsyncLoadState>> asyncQueues_[3U];
+    // RunNextAsyncLoad calls queued to the thread pool but not yet finished.
+    size_t asyncTaskCount_{0U};
+
     struct RegisteredImageLoader {
         BASE_NS::Uid uid;
         IImageLoader::Ptr instance;
@@ -1026,7 +1026,7 @@ static constexpr GlImageFormatInfo GL_IMAGE_FORMATS[] = {
         0},
 };
 
-GlImageFormatInfo GetFormatInfo(const uint32_t glFormat)
+inline GlImageFormatInfo GetFormatInfo(const uint32_t glFormat)
 {
     int i = 0;
     for (;; i++) {
@@ -1037,6 +1037,19 @@ GlImageFormatInfo GetFormatInfo(const uint32_t glFormat)
     }
     return GL_IMAGE_FORMATS[i];
 }
+
+// Returns the terminator if the format is not listed.
+inline GlImageFormatInfo GetFormatInfoByCoreFormat(const BASE_NS::Format coreFormat)
+{
+    int i = 0;
+    for (;; i++) {
+        if ((GL_IMAGE_FORMATS[i].coreFormat == BASE_NS::Format::BASE_FORMAT_UNDEFINED) ||
+            (coreFormat == GL_IMAGE_FORMATS[i].coreFormat)) {
+            break;
+        }
+    }
+    return GL_IMAGE_FORMATS[i];
+}
 CORE_END_NAMESPACE()
 
 #endif  // CORE_GL_UTIL_H
@@ -0,0 +1,786 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "image/loaders/image_loader_ktx2.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+
+#include <base/containers/array_view.h>
+#include <base/containers/unique_ptr.h>
+#include <base/containers/vector.h>
+#include <base/namespace.h>
+#include <base/util/formats.h>
+#include <core/image/intf_image_container.h>
+#include <core/image/intf_image_loader_manager.h>
+#include <core/io/intf_file.h>
+#include <core/log.h>
+#include <core/namespace.h>
+
+#include "image/image_loader_manager.h"
+#include "image/loaders/gl_util.h"
+
+#if defined(USE_ZSTD) && (USE_ZSTD == 1)
+#include <zstd.h>
+#endif
+
+CORE_BEGIN_NAMESPACE()
+namespace {
+using BASE_NS::array_view;
+using BASE_NS::Format;
+using BASE_NS::make_unique;
+using BASE_NS::move;
+using BASE_NS::unique_ptr;
+using BASE_NS::vector;
+
+// KTX2 is always little endian.
+uint32_t ReadU32(const uint8_t** data)
+{
+    CORE_ASSERT(data);
+    CORE_ASSERT(*data);
+
+    uint32_t value = *(*data)++;
+    value |= static_cast<uint32_t>(*(*data)++) << 8;
+    value |= static_cast<uint32_t>(*(*data)++) << 16;
+    value |= static_cast<uint32_t>(*(*data)++) << 24;
+    return value;
+}
+
+uint64_t ReadU64(const uint8_t** data)
+{
+    const uint64_t low = ReadU32(data);
+    const uint64_t high = ReadU32(data);
+    return low | (high << 32);
+}
+
+// On desktop typical dimension limit for GPU images is 16k. On mobile even less.
+constexpr const uint32_t MAX_DIMENSIONS = 16384U;
+// On desktop typical value of maxImageArrayLayers. Vulkan requires 256.
+constexpr const uint32_t MAX_ARRAY_ELEMENTS = 2048U;
+constexpr const uint32_t MAX_LEVELS = 32U;
+
+// 12 byte ktx2 identifier.
+constexpr const size_t KTX2_IDENTIFIER_LENGTH = 12;
+constexpr const char KTX2_IDENTIFIER_REFERENCE[KTX2_IDENTIFIER_LENGTH] = {
+    '\xAB', 'K', 'T', 'X', ' ', '2', '0', '\xBB', '\r', '\n', '\x1A', '\n'};
+// Identifier, nine uint32_t fields, four index fields and two uint64_t fields.
+constexpr const size_t KTX2_HEADER_LENGTH = 80U;
+// byteOffset, byteLength and uncompressedByteLength of a level.
+constexpr const size_t KTX2_LEVEL_INDEX_ENTRY_LENGTH = 24U;
+
+// Values of supercompressionScheme.
+constexpr const uint32_t KTX2_SUPERCOMPRESSION_NONE = 0U;
+constexpr const uint32_t KTX2_SUPERCOMPRESSION_BASIS_LZ = 1U;
+constexpr const uint32_t KTX2_SUPERCOMPRESSION_ZSTD = 2U;
+constexpr const uint32_t KTX2_SUPERCOMPRESSION_ZLIB = 3U;
+
+// Size of the fixed part of a basic data format descriptor block, which is followed by the samples.
+constexpr const uint32_t KHR_DF_BASIC_BLOCK_HEADER_LENGTH = 24U;
+constexpr const uint32_t KHR_DF_VENDOR_ID_KHRONOS = 0U;
+constexpr const uint32_t KHR_DF_DESCRIPTOR_TYPE_BASIC = 0U;
+
+struct Ktx2Header {
+    uint32_t vkFormat;
+    uint32_t typeSize;
+    uint32_t pixelWidth;
+    uint32_t pixelHeight;
+    uint32_t pixelDepth;
+    uint32_t layerCount;
+    uint32_t faceCount;
+    uint32_t levelCount;
+    uint32_t supercompressionScheme;
+    uint32_t dfdByteOffset;
+    uint32_t dfdByteLength;
+    uint32_t kvdByteOffset;
+    uint32_t kvdByteLength;
+    uint64_t sgdByteOffset;
+    uint64_t sgdByteLength;
+};
+
+struct Ktx2Level {
+    uint64_t byteOffset;
+    uint64_t byteLength;
+    uint64_t uncompressedByteLength;
+};
+
+// The parts of the basic data format descriptor needed for uploading the data.
+struct Ktx2BlockInfo {
+    uint32_t blockWidth;
+    uint32_t blockHeight;
+    uint32_t blockDepth;
+    // Zero when the data is supercompressed, in which case it is derived from the level sizes.
+    uint32_t bytesPerBlock;
+};
+
+struct MipDimensions {
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+};
+
+// Reads parts of a file so that only the header and the selected levels are read.
+struct FileSource {
+    IFile& file;
+
+    bool Read(uint64_t offset, uint8_t* buffer, size_t size) const
+    {
+        return file.Seek(offset) && (file.Read(buffer, size) == size);
+    }
+};
+
+struct MemorySource {
+    array_view<const uint8_t> bytes;
+
+    bool Read(uint64_t offset, uint8_t* buffer, size_t size) const
+    {
+        if ((offset > bytes.size()) || (size > (bytes.size() - offset))) {
+            return false;
+        }
+        std::copy(bytes.begin() + static_cast<ptrdiff_t>(offset),
+            bytes.begin() + static_cast<ptrdiff_t>(offset + size), buffer);
+        return true;
+    }
+};
+
+Ktx2Header ReadHeader(const uint8_t* data)
+{
+    data += KTX2_IDENTIFIER_LENGTH;
+    Ktx2Header header;
+    header.vkFormat = ReadU32(&data);
+    header.typeSize = ReadU32(&data);
+    header.pixelWidth = ReadU32(&data);
+    header.pixelHeight = ReadU32(&data);
+    header.pixelDepth = ReadU32(&data);
+    header.layerCount = ReadU32(&data);
+    header.faceCount = ReadU32(&data);
+    header.levelCount = ReadU32(&data);
+    header.supercompressionScheme = ReadU32(&data);
+    header.dfdByteOffset = ReadU32(&data);
+    header.dfdByteLength = ReadU32(&data);
+    header.kvdByteOffset = ReadU32(&data);
+    header.kvdByteLength = ReadU32(&data);
+    header.sgdByteOffset = ReadU64(&data);
+    header.sgdByteLength = ReadU64(&data);
+    return header;
+}
+
+bool ValidateSupercompression(uint32_t scheme)
+{
+    switch (scheme) {
+        case KTX2_SUPERCOMPRESSION_NONE:
+            return true;
+        case KTX2_SUPERCOMPRESSION_ZSTD:
+#if defined(USE_ZSTD) && (USE_ZSTD == 1)
+            return true;
+#else
+            CORE_LOG_E("Ktx2 Zstandard supercompression not supported in this build.");
+            return false;
+#endif
+        case KTX2_SUPERCOMPRESSION_BASIS_LZ:
+            CORE_LOG_E("Ktx2 BasisLZ supercompression not supported.");
+            return false;
+        case KTX2_SUPERCOMPRESSION_ZLIB:
+            CORE_LOG_E("Ktx2 zlib supercompression not supported.");
+            return false;
+        default:
+            CORE_LOG_E("Ktx2 unknown supercompressionScheme %u.", scheme);
+            return false;
+    }
+}
+
+// Basis Universal data (ETC1S with BasisLZ supercompression, or UASTC) has VK_FORMAT_UNDEFINED and would need
+// transcoding to a GPU format. There is no transcoder, so these files, including all glTF KHR_texture_basisu
+// images, are rejected.
+bool IsBasisUniversal(const Ktx2Header& header)
+{
+    return (header.vkFormat == 0U) || (header.supercompressionScheme == KTX2_SUPERCOMPRESSION_BASIS_LZ);
+}
+
+bool ValidateHeader(const Ktx2Header& header, uint64_t fileLength)
+{
+    if (!ValidateSupercompression(header.supercompressionScheme)) {
+        return false;
+    }
+    if ((header.pixelWidth == 0) || (header.pixelDepth > 0 && header.pixelHeight == 0)) {
+        CORE_LOG_E("Ktx2 pixelWidth can't be 0.");
+        return false;
+    }
+    if ((header.pixelWidth > MAX_DIMENSIONS) || (header.pixelHeight > MAX_DIMENSIONS) ||
+        (header.pixelDepth > MAX_DIMENSIONS)) {
+        CORE_LOG_E("Ktx2 pixel dimensions too big.");
+        return false;
+    }
+    if (header.faceCount != 1U && header.faceCount != 6U) {  // 1 for regular, 6 for cubemaps
+        CORE_LOG_E("Ktx2 invalid faceCount.");
+        return false;
+    }
+    if (header.faceCount == 6U && (header.pixelWidth != header.pixelHeight || header.pixelDepth != 0)) {
+        CORE_LOG_E("Ktx2 cubemap faces must be square and 2d.");
+        return false;
+    }
+    if (header.layerCount > MAX_ARRAY_ELEMENTS) {
+        CORE_LOG_E("Ktx2 layerCount too large.");
+        return false;
+    }
+    if (header.levelCount) {
+        if (header.levelCount > MAX_LEVELS) {
+            CORE_LOG_E("Ktx2 levelCount suspiciously large.");
+            return false;
+        }
+        const uint32_t maxSize = std::max(std::max(header.pixelWidth, header.pixelHeight), header.pixelDepth);
+        if (maxSize < (1U << (header.levelCount - 1U))) {
+            CORE_LOG_E("Ktx2 levelCount too big for dimensions.");
+            return false;
+        }
+    }
+    if ((header.dfdByteLength < (sizeof(uint32_t) + KHR_DF_BASIC_BLOCK_HEADER_LENGTH)) ||
+        (header.dfdByteOffset > fileLength) || (header.dfdByteLength > (fileLength - header.dfdByteOffset))) {
+        CORE_LOG_E("Ktx2 invalid data format descriptor range.");
+        return false;
+    }
+    return true;
+}
+
+// Parses the basic data format descriptor block, which must be the first block of the descriptor.
+bool ParseDataFormatDescriptor(array_view<const uint8_t> dfd, Ktx2BlockInfo& blockInfo)
+{
+    const uint8_t* data = dfd.data();
+    const uint32_t totalSize = ReadU32(&data);
+    if (totalSize != dfd.size()) {
+        CORE_LOG_E("Ktx2 dfdTotalSize does not match dfdByteLength.");
+        return false;
+    }
+    const uint32_t vendorAndType = ReadU32(&data);
+    const uint32_t versionAndSize = ReadU32(&data);
+    const uint32_t vendorId = vendorAndType & 0x1FFFFU;
+    const uint32_t descriptorType = vendorAndType >> 17U;
+    const uint32_t descriptorBlockSize = versionAndSize >> 16U;
+    if (vendorId != KHR_DF_VENDOR_ID_KHRONOS || descriptorType != KHR_DF_DESCRIPTOR_TYPE_BASIC) {
+        CORE_LOG_E("Ktx2 first descriptor block is not a basic data format descriptor.");
+        return false;
+    }
+    if ((descriptorBlockSize < KHR_DF_BASIC_BLOCK_HEADER_LENGTH) ||
+        (descriptorBlockSize > (dfd.size() - sizeof(uint32_t)))) {
+        CORE_LOG_E("Ktx2 invalid descriptorBlockSize.");
+        return false;
+    }
+    // Color model, primaries, transfer function and flags are implied by vkFormat.
+    ReadU32(&data);
+    // Block dimensions are stored minus one.
+    const uint32_t texelBlockDimensions = ReadU32(&data);
+    blockInfo.blockWidth = (texelBlockDimensions & 0xFFU) + 1U;
+    blockInfo.blockHeight = ((texelBlockDimensions >> 8U) & 0xFFU) + 1U;
+    blockInfo.blockDepth = ((texelBlockDimensions >> 16U) & 0xFFU) + 1U;
+    const uint32_t bytesPlanes = ReadU32(&data);
+    blockInfo.bytesPerBlock = bytesPlanes & 0xFFU;
+    return true;
+}
+
+uint64_t GetBlockCount(const MipDimensions& dims, const Ktx2BlockInfo& blockInfo)
+{
+    const uint64_t blocksX = (static_cast<uint64_t>(dims.width) + blockInfo.blockWidth - 1U) / blockInfo.blockWidth;
+    const uint64_t blocksY = (static_cast<uint64_t>(dims.height) + blockInfo.blockHeight - 1U) / blockInfo.blockHeight;
+    const uint64_t blocksZ = (static_cast<uint64_t>(dims.depth) + blockInfo.blockDepth - 1U) / blockInfo.blockDepth;
+    return blocksX * blocksY * blocksZ;
+}
+
+MipDimensions GetLevelDimensions(const Ktx2Header& header, uint32_t level)
+{
+    // NOTE: depth here means 3D textures, not color channels.
+    // In 1D and 2D textures the height and depth might be 0.
+    return {std::max(header.pixelWidth >> level, 1U), std::max(header.pixelHeight >> level, 1U),
+        std::max(header.pixelDepth >> level, 1U)};
+}
+
+// Number of the largest levels to leave out to honor the downscale hint. At least one level is always loaded.
+uint32_t GetSkippedLevels(uint32_t loadFlags, uint32_t levelCount)
+{
+    uint32_t skip = 0U;
+    switch (loadFlags & IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_MASK) {
+        case IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_2X:
+            skip = 1U;
+            break;
+        case IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_4X:
+            skip = 2U;
+            break;
+        case IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_8X:
+            skip = 3U;
+            break;
+        default:
+            break;
+    }
+    return std::min(skip, levelCount - 1U);
+}
+
+IImageContainer::ImageType GetImageType(const Ktx2Header& header)
+{
+    if (header.pixelHeight == 0 && header.pixelDepth == 0) {
+        return IImageContainer::ImageType::TYPE_1D;
+    }
+    if (header.pixelDepth == 0) {
+        return IImageContainer::ImageType::TYPE_2D;
+    }
+    return IImageContainer::ImageType::TYPE_3D;
+}
+
+IImageContainer::ImageViewType GetImageViewType(const Ktx2Header& header, IImageContainer::ImageType imageType)
+{
+    const bool isArray = (header.layerCount != 0);
+    if (header.faceCount == 6U) {
+        // ValidateHeader already checked that cubemaps are 2d.
+        return (isArray ? IImageContainer::ImageViewType::VIEW_TYPE_CUBE_ARRAY
+                        : IImageContainer::ImageViewType::VIEW_TYPE_CUBE);
+    }
+    switch (imageType) {
+        case IImageContainer::ImageType::TYPE_1D:
+            return isArray ? IImageContainer::ImageViewType::VIEW_TYPE_1D_ARRAY
+                           : IImageContainer::ImageViewType::VIEW_TYPE_1D;
+        case IImageContainer::ImageType::TYPE_2D:
+            return isArray ? IImageContainer::ImageViewType::VIEW_TYPE_2D_ARRAY
+                           : IImageContainer::ImageViewType::VIEW_TYPE_2D;
+        case IImageContainer::ImageType::TYPE_3D:
+            // 3d arrays are not supported.
+            return isArray ? IImageContainer::ImageViewType::VIEW_TYPE_MAX_ENUM
+                           : IImageContainer::ImageViewType::VIEW_TYPE_3D;
+        case IImageContainer::ImageType::TYPE_MAX_ENUM:
+            break;
+    }
+    return IImageContainer::ImageViewType::VIEW_TYPE_MAX_ENUM;
+}
+
+Format GetFormat(const Ktx2Header& header, uint32_t loadFlags)
+{
+    // VkFormat values are used as is for BASE_NS::Format. Only the sRGB and linear variants need a lookup.
+    const auto format = static_cast<Format>(header.vkFormat);
+    const GlImageFormatInfo formatInfo = GetFormatInfoByCoreFormat(format);
+    if (formatInfo.coreFormat == Format::BASE_FORMAT_UNDEFINED) {
+        return format;
+    }
+    if ((loadFlags & IImageLoaderManager::IMAGE_LOADER_FORCE_SRGB_BIT) != 0) {
+        return formatInfo.coreFormatForceSrgb;
+    }
+    if ((loadFlags & IImageLoaderManager::IMAGE_LOADER_FORCE_LINEAR_RGB_BIT) != 0) {
+        return formatInfo.coreFormatForceLinear;
+    }
+    return format;
+}
+
+class Ktx2Image final : public IImageContainer {
+public:
+    Ktx2Image() = default;
+
+    using Ptr = BASE_NS::unique_ptr<Ktx2Image, Deleter>;
+
+    const ImageDesc& GetImageDesc() const override
+    {
+        return imageDesc_;
+    }
+
+    array_view<const uint8_t> GetData() const override
+    {
+        return {imageBytes_.get(), imageBytesLength_};
+    }
+
+    array_view<const SubImageDesc> GetBufferImageCopies() const override
+    {
+        return imageBuffers_;
+    }
+
+    // Actual ktx2 loading implementation. Only the header, the level index, the data format descriptor and the
+    // levels which are loaded are read from the source.
+    template<typename Source>
+    static ImageLoaderManager::LoadResult Load(const Source& source, uint64_t fileLength, uint32_t loadFlags)
+    {
+        if (fileLength < KTX2_HEADER_LENGTH) {
+            return ImageLoaderManager::ResultFailure("Not enough data for parsing ktx2.");
+        }
+        uint8_t headerBytes[KTX2_HEADER_LENGTH];
+        if (!source.Read(0U, headerBytes, KTX2_HEADER_LENGTH)) {
+            return ImageLoaderManager::ResultFailure("Reading file failed.");
+        }
+        if (memcmp(headerBytes, KTX2_IDENTIFIER_REFERENCE, KTX2_IDENTIFIER_LENGTH) != 0) {
+            CORE_LOG_E("Ktx2 invalid file identifier.");
+            return ImageLoaderManager::ResultFailure("Invalid ktx2 data.");
+        }
+        const Ktx2Header header = ReadHeader(headerBytes);
+        if (IsBasisUniversal(header)) {
+            CORE_LOG_E("Ktx2 Basis Universal (ETC1S/UASTC) textures can't be loaded, transcoding is not supported. "
+                       "This includes glTF KHR_texture_basisu images.");
+            return ImageLoaderManager::ResultFailure("Ktx2 Basis Universal transcoding not supported.");
+        }
+        if (!ValidateHeader(header, fileLength)) {
+            return ImageLoaderManager::ResultFailure("Invalid ktx2 data.");
+        }
+
+        // In ktx2 level count of 0 (instead of 1) means requesting generating full chain of mipmaps.
+        const uint32_t levelCount = std::max(header.levelCount, 1U);
+        vector<Ktx2Level> levels;
+        if (!ReadLevelIndex(source, fileLength, levelCount, levels)) {
+            return ImageLoaderManager::ResultFailure("Invalid ktx2 data.");
+        }
+
+        vector<uint8_t> dfd(header.dfdByteLength);
+        if (!source.Read(header.dfdByteOffset, dfd.data(), dfd.size())) {
+            return ImageLoaderManager::ResultFailure("Reading file failed.");
+        }
+        Ktx2BlockInfo blockInfo{};
+        if (!ParseDataFormatDescriptor(dfd, blockInfo) || !ResolveBytesPerBlock(header, levels[0U], blockInfo)) {
+            return ImageLoaderManager::ResultFailure("Invalid ktx2 data.");
+        }
+
+        auto image = Ktx2Image::Ptr(new Ktx2Image);
+        if (!image) {
+            return ImageLoaderManager::ResultFailure("Loading image failed.");
+        }
+        const uint32_t skippedLevels = GetSkippedLevels(loadFlags, levelCount);
+        if (!ResolveImageDesc(header, blockInfo, loadFlags, skippedLevels, image->imageDesc_)) {
+            return ImageLoaderManager::ResultFailure("Image not supported.");
+        }
+        if ((loadFlags & IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY) != 0) {
+            return ImageLoaderManager::ResultSuccess(CORE_NS::move(image));
+        }
+
+        const array_view<const Ktx2Level> loadedLevels(levels.data() + skippedLevels, levelCount - skippedLevels);
+        if (!ValidateLevels(header, blockInfo, fileLength, skippedLevels, loadedLevels)) {
+            return ImageLoaderManager::ResultFailure("Invalid ktx2 data.");
+        }
+        const bool loaded = (header.supercompressionScheme == KTX2_SUPERCOMPRESSION_NONE)
+                                ? image->ReadLevels(source, header, blockInfo, skippedLevels, loadedLevels)
+                                : image->DecompressLevels(source, header, blockInfo, skippedLevels, loadedLevels);
+        if (!loaded) {
+            return ImageLoaderManager::ResultFailure("Invalid ktx2 data.");
+        }
+        return ImageLoaderManager::ResultSuccess(CORE_NS::move(image));
+    }
+
+protected:
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    template<typename Source>
+    static bool ReadLevelIndex(
+        const Source& source, uint64_t fileLength, uint32_t levelCount, vector<Ktx2Level>& levels)
+    {
+        const size_t indexLength = levelCount * KTX2_LEVEL_INDEX_ENTRY_LENGTH;
+        if (indexLength > (fileLength - KTX2_HEADER_LENGTH)) {
+            CORE_LOG_E("Not enough data for the level index.");
+            return false;
+        }
+        uint8_t indexBytes[MAX_LEVELS * KTX2_LEVEL_INDEX_ENTRY_LENGTH];
+        if (!source.Read(KTX2_HEADER_LENGTH, indexBytes, indexLength)) {
+            CORE_LOG_E("Reading the level index failed.");
+            return false;
+        }
+        const uint8_t* data = indexBytes;
+        levels.resize(levelCount);
+        for (auto& level : levels) {
+            level.byteOffset = ReadU64(&data);
+            level.byteLength = ReadU64(&data);
+            level.uncompressedByteLength = ReadU64(&data);
+        }
+        return true;
+    }
+
+    static bool ResolveBytesPerBlock(const Ktx2Header& header, const Ktx2Level& level0, Ktx2BlockInfo& blockInfo)
+    {
+        if (blockInfo.bytesPerBlock == 0U) {
+            // Supercompressed data has no size in the descriptor, but the level sizes tell it.
+            const uint64_t blockCount = GetBlockCount(GetLevelDimensions(header, 0U), blockInfo) *
+                                        std::max(header.layerCount, 1U) * header.faceCount;
+            if ((level0.uncompressedByteLength % blockCount) == 0U) {
+                blockInfo.bytesPerBlock = static_cast<uint32_t>(
+                    std::min(level0.uncompressedByteLength / blockCount, static_cast<uint64_t>(UINT8_MAX)));
+            }
+        }
+        if (blockInfo.bytesPerBlock == 0U) {
+            CORE_LOG_E("Ktx2 unknown texel block size.");
+            return false;
+        }
+        return true;
+    }
+
+    static bool ResolveImageDesc(const Ktx2Header& header, const Ktx2BlockInfo& blockInfo, uint32_t loadFlags,
+        uint32_t skippedLevels, ImageDesc& desc)
+    {
+        desc.blockPixelWidth = blockInfo.blockWidth;
+        desc.blockPixelHeight = blockInfo.blockHeight;
+        desc.blockPixelDepth = blockInfo.blockDepth;
+        desc.bitsPerBlock = blockInfo.bytesPerBlock * 8U;
+
+        // If there are six faces this is a cube.
+        if (header.faceCount == 6U) {
+            desc.imageFlags |= ImageFlags::FLAGS_CUBEMAP_BIT;
+        }
+        const bool compressed = (blockInfo.blockWidth > 1U) || (blockInfo.blockHeight > 1U) ||
+                                (blockInfo.blockDepth > 1U);
+        if (compressed) {
+            desc.imageFlags |= ImageFlags::FLAGS_COMPRESSED_BIT;
+            if (header.typeSize != 1U) {
+                CORE_LOG_E("Invalid typeSize for a compressed image.");
+                return false;
+            }
+        }
+
+        desc.format = GetFormat(header, loadFlags);
+        desc.imageType = GetImageType(header);
+        desc.imageViewType = GetImageViewType(header, desc.imageType);
+        if (desc.imageViewType == ImageViewType::VIEW_TYPE_MAX_ENUM) {
+            CORE_LOG_E("vkFormat=%u imageType=%u imageViewType=%u", header.vkFormat, desc.imageType,
+                desc.imageViewType);
+            return false;
+        }
+
+        const MipDimensions dims = GetLevelDimensions(header, skippedLevels);
+        desc.width = dims.width;
+        desc.height = dims.height;
+        desc.depth = dims.depth;
+        desc.mipCount = std::max(header.levelCount, 1U) - skippedLevels;
+        const uint64_t totalLayers = static_cast<uint64_t>(std::max(header.layerCount, 1U)) * header.faceCount;
+        if (totalLayers > MAX_ARRAY_ELEMENTS) {
+            CORE_LOG_E("Ktx2 layerCount too large.");
+            return false;
+        }
+        desc.layerCount = static_cast<uint32_t>(totalLayers);
+
+        // Mipmap generation works only if image is not using a compressed format. Files with their own levels are
+        // used as is.
+        const bool loaderRequestingMips = (loadFlags & IImageLoaderManager::IMAGE_LOADER_GENERATE_MIPS) != 0;
+        if (!compressed && ((header.levelCount == 0) || (loaderRequestingMips && desc.mipCount == 1U))) {
+            desc.imageFlags |= ImageFlags::FLAGS_REQUESTING_MIPMAPS_BIT;
+            uint32_t mipsize = (desc.width > desc.height) ? desc.width : desc.height;
+            desc.mipCount = 0;
+            while (mipsize > 0) {
+                desc.mipCount++;
+                mipsize >>= 1;
+            }
+        }
+        return true;
+    }
+
+    static bool ValidateLevels(const Ktx2Header& header, const Ktx2BlockInfo& blockInfo, uint64_t fileLength,
+        uint32_t firstLevel, array_view<const Ktx2Level> levels)
+    {
+        const uint64_t layerCount = static_cast<uint64_t>(std::max(header.layerCount, 1U)) * header.faceCount;
+        for (size_t i = 0; i < levels.size(); ++i) {
+            const Ktx2Level& level = levels[i];
+            if ((level.byteOffset > fileLength) || (level.byteLength > (fileLength - level.byteOffset))) {
+                CORE_LOG_E("Not enough data for the level.");
+                return false;
+            }
+            // Verify level data size is consistent with declared dimensions and layers. Rows are tightly packed.
+            const MipDimensions dims = GetLevelDimensions(header, firstLevel + static_cast<uint32_t>(i));
+            const uint64_t expectedSize = GetBlockCount(dims, blockInfo) * layerCount * blockInfo.bytesPerBlock;
+            const uint64_t size = (header.supercompressionScheme == KTX2_SUPERCOMPRESSION_NONE)
+                                      ? level.byteLength
+                                      : level.uncompressedByteLength;
+            if (size != expectedSize) {
+                CORE_LOG_E("Ktx2 level data size mismatch with declared dimensions and layers.");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void AddLevel(const Ktx2Header& header, const Ktx2BlockInfo& blockInfo, uint32_t level, uint32_t mipLevel,
+        uint32_t bufferOffset)
+    {
+        const MipDimensions dims = GetLevelDimensions(header, level);
+        SubImageDesc& buffer = imageBuffers_.emplace_back();
+        buffer.bufferOffset = bufferOffset;
+        // Vulkan requires the bufferRowLength and bufferImageHeight to be multiple of block width / height.
+        buffer.bufferRowLength = (dims.width + blockInfo.blockWidth - 1U) / blockInfo.blockWidth * blockInfo.blockWidth;
+        buffer.bufferImageHeight =
+            (dims.height + blockInfo.blockHeight - 1U) / blockInfo.blockHeight * blockInfo.blockHeight;
+        buffer.mipLevel = mipLevel;
+        // NOTE: One BufferImageCopy can copy all the layers and faces in one step.
+        buffer.layerCount = imageDesc_.layerCount;
+        buffer.width = dims.width;
+        buffer.height = dims.height;
+        buffer.depth = dims.depth;
+    }
+
+    // Levels are stored smallest first, so leaving out the largest levels leaves one contiguous range to read.
+    static bool GetLevelRange(array_view<const Ktx2Level> levels, uint64_t& begin, uint64_t& end)
+    {
+        begin = UINT64_MAX;
+        end = 0U;
+        for (const auto& level : levels) {
+            begin = std::min(begin, level.byteOffset);
+            end = std::max(end, level.byteOffset + level.byteLength);
+        }
+        if ((end - begin) > UINT32_MAX) {
+            CORE_LOG_E("Ktx2 level data too large.");
+            return false;
+        }
+        return true;
+    }
+
+    template<typename Source>
+    bool ReadLevels(const Source& source, const Ktx2Header& header, const Ktx2BlockInfo& blockInfo,
+        uint32_t firstLevel, array_view<const Ktx2Level> levels)
+    {
+        uint64_t begin;
+        uint64_t end;
+        if (!GetLevelRange(levels, begin, end)) {
+            return false;
+        }
+        // Vulkan requires buffer offsets to be a multiple of the texel block size, and ktx2 aligns the levels to
+        // the least common multiple of the block size and 4.
+        const uint64_t alignment = std::lcm(blockInfo.bytesPerBlock, 4U);
+        imageBuffers_.reserve(levels.size());
+        for (size_t i = 0; i < levels.size(); ++i) {
+            const uint64_t offset = levels[i].byteOffset - begin;
+            if ((offset % alignment) != 0) {
+                CORE_LOG_E("Ktx2 level data is not aligned.");
+                return false;
+            }
+            const auto mipLevel = static_cast<uint32_t>(i);
+            AddLevel(header, blockInfo, firstLevel + mipLevel, mipLevel, static_cast<uint32_t>(offset));
+        }
+
+        imageBytesLength_ = static_cast<size_t>(end - begin);
+        imageBytes_ = make_unique<uint8_t[]>(imageBytesLength_);
+        if (!imageBytes_ || !source.Read(begin, imageBytes_.get(), imageBytesLength_)) {
+            CORE_LOG_E("Reading ktx2 level data failed.");
+            return false;
+        }
+        return true;
+    }
+
+    template<typename Source>
+    bool DecompressLevels(const Source& source, const Ktx2Header& header, const Ktx2BlockInfo& blockInfo,
+        uint32_t firstLevel, array_view<const Ktx2Level> levels)
+    {
+#if defined(USE_ZSTD) && (USE_ZSTD == 1)
+        uint64_t begin;
+        uint64_t end;
+        if (!GetLevelRange(levels, begin, end)) {
+            return false;
+        }
+        // The compressed levels are read with one read and each is decompressed to its own aligned position.
+        const auto compressedLength = static_cast<size_t>(end - begin);
+        unique_ptr<uint8_t[]> compressed = make_unique<uint8_t[]>(compressedLength);
+        if (!compressed || !source.Read(begin, compressed.get(), compressedLength)) {
+            CORE_LOG_E("Reading ktx2 level data failed.");
+            return false;
+        }
+
+        const uint64_t alignment = std::lcm(blockInfo.bytesPerBlock, 4U);
+        vector<uint64_t> offsets(levels.size());
+        uint64_t totalLength = 0U;
+        for (size_t i = 0; i < levels.size(); ++i) {
+            totalLength = (totalLength + alignment - 1U) / alignment * alignment;
+            offsets[i] = totalLength;
+            totalLength += levels[i].uncompressedByteLength;
+            if (totalLength > UINT32_MAX) {
+                CORE_LOG_E("Ktx2 level data too large.");
+                return false;
+            }
+        }
+        imageBytesLength_ = static_cast<size_t>(totalLength);
+        imageBytes_ = make_unique<uint8_t[]>(imageBytesLength_);
+        if (!imageBytes_) {
+            CORE_LOG_E("Failed to allocate memory for image");
+            return false;
+        }
+
+        imageBuffers_.reserve(levels.size());
+        for (size_t i = 0; i < levels.size(); ++i) {
+            const Ktx2Level& level = levels[i];
+            const size_t result = ZSTD_decompress(imageBytes_.get() + offsets[i],
+                static_cast<size_t>(level.uncompressedByteLength), compressed.get() + (level.byteOffset - begin),
+                static_cast<size_t>(level.byteLength));
+            if (ZSTD_isError(result) || (result != level.uncompressedByteLength)) {
+                CORE_LOG_E("Ktx2 Zstandard decompression failed: %s", ZSTD_getErrorName(result));
+                return false;
+            }
+            const auto mipLevel = static_cast<uint32_t>(i);
+            AddLevel(header, blockInfo, firstLevel + mipLevel, mipLevel, static_cast<uint32_t>(offsets[i]));
+        }
+        return true;
+#else
+        // ValidateHeader already rejects supercompressed files.
+        return false;
+#endif
+    }
+
+    unique_ptr<uint8_t[]> imageBytes_;
+    size_t imageBytesLength_{0};
+
+    ImageDesc imageDesc_;
+    vector<SubImageDesc> imageBuffers_;
+};
+
+class ImageLoaderKtx2 final : public IImageLoaderManager::IImageLoader {
+public:
+    using IImageLoaderManager::IImageLoader::Load;
+
+    // Inherited via ImageManager::IImageLoader
+    ImageLoaderManager::LoadResult Load(IFile& file, uint32_t loadFlags) const override
+    {
+        const uint64_t fileLen = file.GetLength();
+        if (fileLen > SIZE_MAX) {
+            return ImageLoaderManager::ResultFailure("File too large for this platform.");
+        }
+        return Ktx2Image::Load(FileSource{file}, fileLen, loadFlags);
+    }
+
+    ImageLoaderManager::LoadResult Load(array_view<const uint8_t> imageFileBytes, uint32_t loadFlags) const override
+    {
+        return Ktx2Image::Load(MemorySource{imageFileBytes}, imageFileBytes.size(), loadFlags);
+    }
+
+    bool CanLoad(array_view<const uint8_t> imageFileBytes) const override
+    {
+        // Check for KTX2
+        return (imageFileBytes.size() >= KTX2_IDENTIFIER_LENGTH) &&
+               (memcmp(imageFileBytes.data(), KTX2_IDENTIFIER_REFERENCE, KTX2_IDENTIFIER_LENGTH) == 0);
+    }
+
+    // No animated KTX2
+    ImageLoaderManager::LoadAnimatedResult LoadAnimatedImage(IFile& /* file */, uint32_t /* loadFlags */) override
+    {
+        return ImageLoaderManager::ResultFailureAnimated("Animated KTX2 not supported.");
+    }
+
+    ImageLoaderManager::LoadAnimatedResult LoadAnimatedImage(
+        array_view<const uint8_t> /* imageFileBytes */, uint32_t /* loadFlags */) override
+    {
+        return ImageLoaderManager::ResultFailureAnimated("Animated KTX2 not supported.");
+    }
+
+    vector<IImageLoaderManager::ImageType> GetSupportedTypes() const override
+    {
+        return {std::begin(KTX2_IMAGE_TYPES), std::end(KTX2_IMAGE_TYPES)};
+    }
+
+protected:
+    void Destroy() final
+    {
+        delete this;
+    }
+};
+}  // namespace
+
+IImageLoaderManager::IImageLoader::Ptr CreateImageLoaderKtx2(PluginToken)
+{
+    return ImageLoaderManager::IImageLoader::Ptr{new ImageLoaderKtx2()};
+}
+CORE_END_NAMESPACE()
@@ -18,7 +18,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
-#include <mutex>
 
 //
 // Enabling only formats that are actually used.
@@ -68,6 +67,7 @@
 #include <base/util/formats.h>
 #include <core/image/intf_image_container.h>
 #include <core/image/intf_image_loader_manager.h>
+#include <core/image/pixel_conversion.h>
 #include <core/io/intf_file.h>
 #include <core/log.h>
 #include <core/namespace.h>
@@ -84,8 +84,6 @@ using BASE_NS::string;
 using BASE_NS::string_view;
 using BASE_NS::unique_ptr;
 using BASE_NS::vector;
-using BASE_NS::Math::pow;
-using BASE_NS::Math::round;
 
 // NOTE: Reading the stb error code is NOT THREADSAFE.
 // Enable this if you really need to know the error message.
@@ -98,89 +96,6 @@ void FreeStbImageBytes(void* imageBytes)
     stbi_image_free(imageBytes);
 }
 
-uint8_t g_sRgbPremultiplyLookup[256u * 256u] = {0};
-
-void InitializeSRGBTable()
-{
-    // Generate lookup table to premultiply sRGB encoded image in linear space and reencoding it to sRGB
-    // Formulas from https://en.wikipedia.org/wiki/SRGB
-    for (uint32_t a = 0; a < 256u; a++) {
-        const float alpha = static_cast<float>(a) / 255.f;
-        for (uint32_t sRGB = 0; sRGB < 256u; sRGB++) {
-            float color = static_cast<float>(sRGB) / 255.f;
-            if (color <= 0.04045f) {
-                color *= (1.f / 12.92f);
-            } else {
-                color = pow((color + 0.055f) * (1.f / 1.055f), 2.4f);
-            }
-            float premultiplied = color * alpha;
-            if (premultiplied <= 0.0031308f) {
-                premultiplied *= 12.92f;
-            } else {
-                premultiplied = 1.055f * pow(premultiplied, 1.f / 2.4f) - 0.055f;
-            }
-            g_sRgbPremultiplyLookup[a * 256u + sRGB] = static_cast<uint8_t>(round(premultiplied * 255.f));
-        }
-    }
-}
-
-bool PremultiplyAlpha(
-    uint8_t* imageBytes, uint32_t width, uint32_t height, uint32_t channelCount, uint32_t bytesPerChannel, bool linear)
-{
-    // Only need to process images with color and alpha data. I.e. RGBA or grayscale + alpha.
-    if (channelCount != 4u && channelCount != 2u) {
-        return true;
-    }
-
-    if (static_cast<uint64_t>(width) * height > UINT32_MAX) {
-        return false;
-    }
-
-    const uint32_t pixelCount = width * height;
-
-    if (bytesPerChannel == 1) {
-        if (linear) {
-            uint8_t* img = imageBytes;
-            for (uint32_t i = 0; i < pixelCount; i++) {
-                // We know the alpha value is always last.
-                uint32_t alpha = img[channelCount - 1];
-                for (uint32_t j = 0; j < channelCount - 1; j++) {
-                    *img = static_cast<uint8_t>(*img * alpha / 0xff);
-                    img++;
-                }
-                img++;  // Skip over the alpha value.
-            }
-        } else {
-            static std::once_flag sRgbTableInitFlag;
-            std::call_once(sRgbTableInitFlag, InitializeSRGBTable);
-            uint8_t* img = imageBytes;
-            for (uint32_t i = 0; i < pixelCount; i++) {
-                uint8_t* p = &g_sRgbPremultiplyLookup[img[channelCount - 1] * 256u];
-                for (uint32_t j = 0; j < channelCount - 1; j++) {
-                    *img = p[*img];
-                    img++;
-                }
-                img++;
-            }
-        }
-    } else if (bytesPerChannel == 2u) {
-        // Same for 16 bits per channel images.
-        auto* img = reinterpret_cast<uint16_t*>(imageBytes);
-        for (uint32_t i = 0; i < pixelCount; i++) {
-            uint32_t alpha = img[channelCount - 1];
-            for (uint32_t j = 0; j < channelCount - 1; j++) {
-                *img = static_cast<uint16_t>(*img * alpha / 0xffff);
-                img++;
-            }
-            img++;
-        }
-    } else {
-        CORE_LOG_E("Format not supported.");
-        return false;
-    }
-    return true;
-}
-
 using StbImagePtr = unique_ptr<void, decltype(&FreeStbImageBytes)>;
 }  // namespace
 
@@ -291,12 +206,14 @@ public:
             if ((loadFlags & IImageLoaderManager::IMAGE_LOADER_PREMULTIPLY_ALPHA) != 0) {
                 const uint32_t bytesPerChannel = is16bpc ? 2u : 1u;
                 const bool forceLinear = (loadFlags & IImageLoaderManager::IMAGE_LOADER_FORCE_LINEAR_RGB_BIT) != 0;
-                isPremultiplied = PremultiplyAlpha(static_cast<uint8_t*>(imageBytes.get()),
-                    imageWidth,
-                    imageHeight,
+                isPremultiplied = PixelConversion::PremultiplyAlpha(static_cast<uint8_t*>(imageBytes.get()),
+                    static_cast<size_t>(imageWidth) * imageHeight,
                     componentCount,
                     bytesPerChannel,
                     forceLinear);
+                if (!isPremultiplied) {
+                    CORE_LOG_E("Format not supported.");
+                }
             }
         }
 
@@ -412,7 +329,10 @@ public:
                 imageBytes = LoadFromMemory(imageFileBytes, loadFlags, info);
                 // Flip vertically if requested.
                 if (imageBytes && (loadFlags & IImageLoaderManager::IMAGE_LOADER_FLIP_VERTICALLY_BIT) != 0) {
-                    stbi__vertical_flip(imageBytes.get(), info.width, info.height, info.componentCount);
+                    const size_t rowSize = static_cast<size_t>(info.width) * static_cast<size_t>(info.componentCount) *
+                                           (info.is16bpc ? 2U : 1U);
+                    PixelConversion::FlipVertically(
+                        static_cast<uint8_t*>(imageBytes.get()), rowSize, static_cast<uint32_t>(info.height));
                 }
             } else {
                 imageBytes = {nullptr, FreeStbImageBytes};
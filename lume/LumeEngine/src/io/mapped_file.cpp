@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/mapped_file.h"
+
+#include <cstdint>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <base/containers/array_view.h>
+#include <base/containers/string.h>
+#include <base/containers/string_view.h>
+#include <base/containers/type_traits.h>
+#include <core/io/intf_file.h>
+#include <core/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+using BASE_NS::array_view;
+using BASE_NS::CloneData;
+using BASE_NS::string;
+using BASE_NS::string_view;
+
+MappedFile::MappedFile(const uint8_t* data, size_t size) : data_(data), size_(size)
+{}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+IFile::Ptr MappedFile::Open(string_view path)
+{
+#if !defined(_WIN32)
+    const string pathString(path);
+    const int fd = open(pathString.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return {};
+    }
+    void* data = MAP_FAILED;
+    size_t size = 0;
+    struct stat fileStat {};
+    if ((fstat(fd, &fileStat) == 0) && S_ISREG(fileStat.st_mode) && (fileStat.st_size > 0) &&
+        (static_cast<uint64_t>(fileStat.st_size) <= SIZE_MAX)) {
+        size = static_cast<size_t>(fileStat.st_size);
+        data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // the mapping keeps its own reference to the file.
+    close(fd);
+    if (data == MAP_FAILED) {
+        return {};
+    }
+    return IFile::Ptr{new MappedFile(static_cast<const uint8_t*>(data), size)};
+#else
+    // not supported, the file is read with StdFile instead.
+    return {};
+#endif
+}
+
+IFile::Mode MappedFile::GetMode() const
+{
+    return data_ ? Mode::READ_ONLY : Mode::INVALID;
+}
+
+void MappedFile::Close()
+{
+#if !defined(_WIN32)
+    if (data_) {
+        munmap(const_cast<uint8_t*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    index_ = 0;
+}
+
+uint64_t MappedFile::Read(void* buffer, uint64_t count)
+{
+    uint64_t toRead = count;
+    if ((index_ + toRead) > size_) {
+        toRead = size_ - index_;
+    }
+    if (toRead > 0) {
+        if (CloneData(buffer, static_cast<size_t>(count), data_ + index_, static_cast<size_t>(toRead))) {
+            index_ += toRead;
+        } else {
+            toRead = 0;
+        }
+    }
+    return toRead;
+}
+
+uint64_t MappedFile::Write(const void* /* buffer */, uint64_t /* count */)
+{
+    return 0;
+}
+
+uint64_t MappedFile::Append(const void* /* buffer */, uint64_t /* count */, uint64_t /* flushSize */)
+{
+    return 0;
+}
+
+uint64_t MappedFile::GetLength() const
+{
+    return size_;
+}
+
+bool MappedFile::Seek(uint64_t offset)
+{
+    if (offset <= size_) {
+        index_ = offset;
+        return true;
+    }
+    return false;
+}
+
+uint64_t MappedFile::GetPosition() const
+{
+    return index_;
+}
+
+array_view<const uint8_t> MappedFile::GetData() const
+{
+    return {data_, size_};
+}
+CORE_END_NAMESPACE()
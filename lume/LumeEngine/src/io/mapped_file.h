@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_IO_MAPPED_FILE_H
+#define CORE_IO_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <base/containers/string_view.h>
+#include <core/io/intf_file.h>
+#include <core/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+/** Memory mapped file.
+ * Read-only IFile implementation which maps the whole file to memory. Reads copy from the mapping and GetData gives
+ * direct access to it, so the contents can be parsed straight from the page cache.
+ */
+class MappedFile final : public IFile {
+public:
+    ~MappedFile() override;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    // Map an existing non-empty regular file. The size is taken from the same descriptor that is mapped. Returns null
+    // if the file cannot be mapped, in which case it should be opened as a StdFile instead. Truncating the file while
+    // it's mapped is not supported.
+    static IFile::Ptr Open(BASE_NS::string_view path);
+
+    Mode GetMode() const override;
+
+    // Unmap file.
+    void Close() override;
+
+    uint64_t Read(void* buffer, uint64_t count) override;
+
+    uint64_t Write(const void* buffer, uint64_t count) override;
+
+    uint64_t Append(const void* buffer, uint64_t count, uint64_t flushSize) override;
+
+    uint64_t GetLength() const override;
+
+    bool Seek(uint64_t offset) override;
+
+    uint64_t GetPosition() const override;
+
+    BASE_NS::array_view<const uint8_t> GetData() const override;
+
+protected:
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    MappedFile(const uint8_t* data, size_t size);
+
+    const uint8_t* data_{nullptr};
+    size_t size_{0};
+    uint64_t index_{0};
+};
+CORE_END_NAMESPACE()
+
+#endif  // CORE_IO_MAPPED_FILE_H
@@ -117,6 +117,12 @@ public:
         return index_;
     }
 
+    array_view<const uint8_t> GetData() const override
+    {
+        // the data is embedded in the binary and never changes.
+        return {data_, size_};
+    }
+
 protected:
     void Destroy() override
     {
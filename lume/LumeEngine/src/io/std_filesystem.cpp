@@ -44,6 +44,7 @@
 #include <core/log.h>
 #include <core/namespace.h>
 
+#include "io/mapped_file.h"
 #include "io/path_tools.h"
 #include "std_directory.h"
 #include "std_file.h"
@@ -55,6 +56,9 @@ using BASE_NS::string_view;
 using BASE_NS::vector;
 
 namespace {
+// Read-only files of at least this size are memory mapped, smaller ones are cheaper to read than to map.
+constexpr uint64_t MAPPED_FILE_MIN_SIZE = 64U * 1024U;
+
 #if defined(HAS_FILESYSTEM)
 std::filesystem::path U8Path(string_view str)
 {
@@ -62,6 +66,25 @@ std::filesystem::path U8Path(string_view str)
 }
 #endif
 
+// Size of a regular file, or zero if the path is not one. Only stats the path so that small files are opened once.
+uint64_t GetRegularFileSize(const string& path)
+{
+#if defined(HAS_FILESYSTEM)
+    std::error_code ec;
+    const auto fsPath = U8Path(path);
+    if (!std::filesystem::is_regular_file(fsPath, ec) || ec) {
+        return 0U;
+    }
+    const auto size = std::filesystem::file_size(fsPath, ec);
+    return ec ? 0U : static_cast<uint64_t>(size);
+#else
+    struct stat fileStat {};
+    if ((stat(path.c_str(), &fileStat) != 0) || !S_ISREG(fileStat.st_mode) || (fileStat.st_size < 0)) {
+        return 0U;
+    }
+    return static_cast<uint64_t>(fileStat.st_size);
+#endif
+}
 }  // namespace
 
 string StdFilesystem::ValidatePath(const string_view pathIn) const
@@ -94,6 +117,13 @@ IFile::Ptr StdFilesystem::OpenFile(const string_view pathIn, const IFile::Mode m
 {
     auto path = ValidatePath(pathIn);
     if (!path.empty()) {
+        if (mode == IFile::Mode::READ_ONLY) {
+            if (GetRegularFileSize(path) >= MAPPED_FILE_MIN_SIZE) {
+                if (auto file = MappedFile::Open(path); file) {
+                    return file;
+                }
+            }
+        }
         return StdFile::Open(path, mode);
     }
     return {};
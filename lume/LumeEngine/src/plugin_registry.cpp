@@ -27,6 +27,7 @@
 
 #include "image/loaders/image_loader_astc.h"
 #include "image/loaders/image_loader_ktx.h"
+#include "image/loaders/image_loader_ktx2.h"
 #include "image/loaders/image_loader_stb_image.h"
 #include "io/file_manager.h"
 #include "io/std_filesystem.h"
@@ -377,6 +378,14 @@ constexpr CORE_NS::IImageLoaderManager::ImageLoaderTypeInfo KTX_LOADER{
     KTX_IMAGE_TYPES,
 };
 
+constexpr CORE_NS::IImageLoaderManager::ImageLoaderTypeInfo KTX2_LOADER{
+    {CORE_NS::IImageLoaderManager::ImageLoaderTypeInfo::UID},
+    nullptr,
+    BASE_NS::Uid{"b0d5e3c2-7f41-4a6e-9c58-2e1f6a9d4b73"},
+    CreateImageLoaderKtx2,
+    KTX2_IMAGE_TYPES,
+};
+
 #if defined(USE_STB_IMAGE) && (USE_STB_IMAGE == 1)
 constexpr CORE_NS::IImageLoaderManager::ImageLoaderTypeInfo STB_LOADER{
     {CORE_NS::IImageLoaderManager::ImageLoaderTypeInfo::UID},
@@ -459,6 +468,7 @@ vector<InterfaceTypeInfo> PluginRegistry::RegisterGlobalInterfaces(PluginRegistr
 
     registry.RegisterTypeInfo(ASTC_LOADER);
     registry.RegisterTypeInfo(KTX_LOADER);
+    registry.RegisterTypeInfo(KTX2_LOADER);
 #if defined(USE_STB_IMAGE) && (USE_STB_IMAGE == 1)
     registry.RegisterTypeInfo(STB_LOADER);
 #endif
@@ -471,6 +481,7 @@ void PluginRegistry::UnregisterGlobalInterfaces()
 #if defined(USE_STB_IMAGE) && (USE_STB_IMAGE == 1)
     UnregisterTypeInfo(STB_LOADER);
 #endif
+    UnregisterTypeInfo(KTX2_LOADER);
     UnregisterTypeInfo(KTX_LOADER);
     UnregisterTypeInfo(ASTC_LOADER);
 
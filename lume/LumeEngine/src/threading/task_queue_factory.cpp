@@ -16,6 +16,7 @@
 #include "threading/task_queue_factory.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <deque>
@@ -35,6 +36,7 @@
 #include <base/containers/shared_ptr.h>
 #include <base/containers/type_traits.h>
 #include <base/containers/unique_ptr.h>
+#include <base/containers/unordered_map.h>
 #include <base/math/mathf.h>
 #include <base/util/uid.h>
 #include <core/log.h>
@@ -89,6 +91,39 @@ public:
 };
 #endif  // PLATFORM_HAS_JAVA
 
+#if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
+/** RAII class for raising the worker thread QoS and reporting the thread to the resource scheduler. */
+class EngineThreadQos final {
+public:
+    EngineThreadQos()
+    {
+        int ret = OHOS::QOS::SetThreadQos(OHOS::QOS::QosLevel::QOS_USER_INTERACTIVE);
+        CORE_LOG_I("set engine child thread qos %s", ret == 0 ? "success" : "failed");
+        tid_ = syscall(SYS_gettid);
+        if (tid_ > 0) {
+            Report(1);
+        }
+    }
+
+    ~EngineThreadQos()
+    {
+        Report(0);
+    }
+
+private:
+    void Report(int64_t value) const
+    {
+        std::unordered_map<std::string, std::string> mapPayload{
+            {"pid", std::to_string(getpid())}, {"tid", std::to_string(tid_)}};
+        CORE_LOG_I("ReportEngineResType %s %s", mapPayload["pid"].c_str(), mapPayload["tid"].c_str());
+        OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
+            RES_TYPE_EXT_ENGINE_SET_QOS, value, mapPayload);
+    }
+
+    long tid_{0};
+};
+#endif
+
 // -- TaskResult, returned by ThreadPool::Push and can be waited on.
 class TaskResult final : public IThreadPool::IResult {
 public:
@@ -421,16 +456,8 @@ private:
 #endif
 
 #if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
-        int ret = OHOS::QOS::SetThreadQos(OHOS::QOS::QosLevel::QOS_USER_INTERACTIVE);
-        CORE_LOG_I("set engine child thread qos %s", ret == 0 ? "success" : "failed");
-        auto tid = syscall(SYS_gettid);
-        if (tid > 0) {
-            std::unordered_map<std::string, std::string> mapPayload{
-                {"pid", std::to_string(getpid())}, {"tid", std::to_string(tid)}};
-            CORE_LOG_I("ReportEngineResType %s %s", mapPayload["pid"].c_str(), mapPayload["tid"].c_str());
-            OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
-                RES_TYPE_EXT_ENGINE_SET_QOS, 1, mapPayload);
-        }
+        // RAII class for thread QoS setup/release.
+        EngineThreadQos threadQos;
 #endif
 
         while (true) {
@@ -447,13 +474,6 @@ private:
             }
             // If there was no task it means we are stopping and thread can exit.
             if (!task) {
-#if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
-                std::unordered_map<std::string, std::string> mapPayload{
-                    {"pid", std::to_string(getpid())}, {"tid", std::to_string(tid)}};
-                CORE_LOG_I("ReportEngineResType %s %s", mapPayload["pid"].c_str(), mapPayload["tid"].c_str());
-                OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
-                    RES_TYPE_EXT_ENGINE_SET_QOS, 0, mapPayload);
-#endif
                 return;
             }
 
@@ -506,6 +526,342 @@ private:
     std::condition_variable cv_;
     int32_t refcnt_{0};
 };
+
+// Set for the worker threads of a WorkStealingThreadPool, used to keep readied tasks on the current worker.
+thread_local const void* g_currentPool = nullptr;
+thread_local size_t g_currentWorker = 0U;
+
+// -- WorkStealingThreadPool
+// Each worker owns a deque of ready tasks. A worker pops the newest task from its own deque and when that runs dry
+// steals the oldest task from the other workers. Tasks with dependencies count their unfinished dependencies and are
+// linked as continuations to them, so finishing a task readies its dependents without scanning any queue.
+class WorkStealingThreadPool final : public IThreadPool {
+public:
+    explicit WorkStealingThreadPool(size_t threadCount)
+        : threadCount_(max(size_t(1), threadCount)), workers_(make_unique<Worker[]>(threadCount_))
+    {
+        CORE_ASSERT(workers_);
+
+        if (threadCount == 0U) {
+            CORE_LOG_W("Threadpool minimum thread count is 1");
+        }
+        for (size_t i = 0U; i < threadCount_; ++i) {
+            workers_[i].thread = std::thread(&WorkStealingThreadPool::ThreadProc, this, i);
+        }
+    }
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool(WorkStealingThreadPool&&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(WorkStealingThreadPool&&) = delete;
+
+    IResult::Ptr Push(ITask::Ptr task) override
+    {
+        return Push(BASE_NS::move(task), {});
+    }
+
+    IResult::Ptr Push(ITask::Ptr task, BASE_NS::array_view<const ITask* const> dependencies) override
+    {
+        auto taskState = BASE_NS::make_shared<TaskResult::State>();
+        if (taskState) {
+            if (task) {
+                Schedule(BASE_NS::make_shared<Task>(BASE_NS::move(task), taskState), dependencies);
+            } else {
+                // mark as done if the there was no function.
+                taskState->Done();
+            }
+        }
+        return IResult::Ptr{new TaskResult(BASE_NS::move(taskState))};
+    }
+
+    void PushNoWait(ITask::Ptr task) override
+    {
+        PushNoWait(BASE_NS::move(task), {});
+    }
+
+    void PushNoWait(ITask::Ptr task, BASE_NS::array_view<const ITask* const> dependencies) override
+    {
+        if (task) {
+            Schedule(BASE_NS::make_shared<Task>(BASE_NS::move(task), nullptr), dependencies);
+        }
+    }
+
+    uint32_t GetNumberOfThreads() const override
+    {
+        return static_cast<uint32_t>(threadCount_);
+    }
+
+    // IInterface
+    const IInterface* GetInterface(const BASE_NS::Uid& uid) const override
+    {
+        if ((uid == IThreadPool::UID) || (uid == IInterface::UID)) {
+            return this;
+        }
+        return nullptr;
+    }
+
+    IInterface* GetInterface(const BASE_NS::Uid& uid) override
+    {
+        if ((uid == IThreadPool::UID) || (uid == IInterface::UID)) {
+            return this;
+        }
+        return nullptr;
+    }
+
+    void Ref() override
+    {
+        BASE_NS::AtomicIncrementRelaxed(&refcnt_);
+    }
+
+    void Unref() override
+    {
+        if (BASE_NS::AtomicDecrementRelease(&refcnt_) == 0) {
+            BASE_NS::AtomicFenceAcquire();
+            delete this;
+        }
+    }
+
+protected:
+    ~WorkStealingThreadPool() final
+    {
+        Stop();
+    }
+
+private:
+    struct Task {
+        ITask::Ptr function_;
+        BASE_NS::shared_ptr<TaskResult::State> state_;
+        // Number of unfinished dependencies, plus one which is held while the task is being pushed.
+        std::atomic<uint32_t> pending_{1U};
+        // Protects done_ and continuations_.
+        BASE_NS::SpinLock lock_;
+        bool done_{false};
+        // Tasks waiting for this task to finish.
+        BASE_NS::vector<BASE_NS::shared_ptr<Task>> continuations_;
+
+        Task(ITask::Ptr&& function, BASE_NS::shared_ptr<TaskResult::State> state)
+            : function_(BASE_NS::move(function)), state_(BASE_NS::move(state))
+        {
+            CORE_ASSERT(this->function_);
+        }
+        ~Task() = default;
+
+        Task(Task&&) = delete;
+        Task& operator=(Task&&) = delete;
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+    };
+
+    struct Worker {
+        std::thread thread;
+        BASE_NS::SpinLock lock;
+        std::deque<BASE_NS::shared_ptr<Task>> tasks;
+    };
+
+    // Unfinished tasks by ITask pointer, used for resolving the dependencies of new tasks. The map is split in shards
+    // to keep the lock contention low when many threads push at the same time.
+    static constexpr size_t TASK_SHARD_COUNT = 16U;
+    static constexpr uintptr_t TASK_SHARD_SHIFT = 4U;
+    struct TaskShard {
+        BASE_NS::SpinLock lock;
+        BASE_NS::unordered_map<const ITask*, BASE_NS::shared_ptr<Task>> tasks;
+    };
+
+    TaskShard& GetShard(const ITask* key)
+    {
+        return shards_[(reinterpret_cast<uintptr_t>(key) >> TASK_SHARD_SHIFT) % TASK_SHARD_COUNT];
+    }
+
+    BASE_NS::shared_ptr<Task> Find(const ITask* key)
+    {
+        auto& shard = GetShard(key);
+        BASE_NS::ScopedSpinLock lock(shard.lock);
+        if (auto pos = shard.tasks.find(key); pos != shard.tasks.end()) {
+            return pos->second;
+        }
+        return {};
+    }
+
+    void Schedule(BASE_NS::shared_ptr<Task>&& task, BASE_NS::array_view<const ITask* const> dependencies)
+    {
+        const ITask* key = task->function_.get();
+        {
+            auto& shard = GetShard(key);
+            BASE_NS::ScopedSpinLock lock(shard.lock);
+            shard.tasks.insert_or_assign(key, task);
+        }
+        for (const ITask* dependency : dependencies) {
+            // Dependencies which already finished, or were never pushed to this pool, are ignored.
+            if (auto dependencyTask = Find(dependency); dependencyTask && (dependencyTask != task)) {
+                BASE_NS::ScopedSpinLock lock(dependencyTask->lock_);
+                if (!dependencyTask->done_) {
+                    task->pending_.fetch_add(1U, std::memory_order_relaxed);
+                    dependencyTask->continuations_.push_back(task);
+                }
+            }
+        }
+        // Drop the reference held during the push. If the dependencies were already done the task is ready.
+        if (task->pending_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+            Enqueue(BASE_NS::move(task));
+        }
+    }
+
+    void Enqueue(BASE_NS::shared_ptr<Task>&& task)
+    {
+        // Tasks readied by a worker stay in its own queue, others are distributed between the workers.
+        const size_t index = (g_currentPool == this)
+                                 ? g_currentWorker
+                                 : (nextWorker_.fetch_add(1U, std::memory_order_relaxed) % threadCount_);
+        {
+            auto& worker = workers_[index];
+            BASE_NS::ScopedSpinLock lock(worker.lock);
+            worker.tasks.push_back(BASE_NS::move(task));
+        }
+        // queued_ and sleeping_ are sequentially consistent so that either this thread sees a sleeping worker or the
+        // worker sees the queued task before it goes to sleep.
+        queued_.fetch_add(1U);
+        if (sleeping_.load() > 0U) {
+            {
+                std::lock_guard lock(mutex_);
+            }
+            cv_.notify_one();
+        }
+    }
+
+    // Takes the newest task from the worker's own queue, or steals the oldest task from another worker.
+    BASE_NS::shared_ptr<Task> TakeTask(size_t index)
+    {
+        BASE_NS::shared_ptr<Task> task;
+        {
+            auto& worker = workers_[index];
+            BASE_NS::ScopedSpinLock lock(worker.lock);
+            if (!worker.tasks.empty()) {
+                task = BASE_NS::move(worker.tasks.back());
+                worker.tasks.pop_back();
+            }
+        }
+        for (size_t i = 1U; !task && (i < threadCount_); ++i) {
+            auto& victim = workers_[(index + i) % threadCount_];
+            BASE_NS::ScopedSpinLock lock(victim.lock);
+            if (!victim.tasks.empty()) {
+                task = BASE_NS::move(victim.tasks.front());
+                victim.tasks.pop_front();
+            }
+        }
+        if (task) {
+            queued_.fetch_sub(1U);
+        }
+        return task;
+    }
+
+    void Run(Task& task)
+    {
+        {
+            CORE_CPU_PERF_SCOPE("CORE", "ThreadPoolTask", "", CORE_PROFILER_DEFAULT_COLOR);
+            (*task.function_)();
+        }
+
+        BASE_NS::vector<BASE_NS::shared_ptr<Task>> continuations;
+        {
+            BASE_NS::ScopedSpinLock lock(task.lock_);
+            task.done_ = true;
+            continuations.swap(task.continuations_);
+        }
+        {
+            // The caller still holds a reference so the task isn't destroyed while the shard is locked.
+            auto& shard = GetShard(task.function_.get());
+            BASE_NS::ScopedSpinLock lock(shard.lock);
+            if (auto pos = shard.tasks.find(task.function_.get());
+                (pos != shard.tasks.end()) && (pos->second.get() == &task)) {
+                shard.tasks.erase(pos);
+            }
+        }
+        if (task.state_) {
+            task.state_->Done();
+        }
+        for (auto& continuation : continuations) {
+            if (continuation->pending_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+                Enqueue(BASE_NS::move(continuation));
+            }
+        }
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard lock(mutex_);
+            if (isDone_) {
+                return;
+            }
+            isDone_ = true;
+        }
+
+        // Trigger all waiting threads.
+        cv_.notify_all();
+
+        // Wait for all threads to finish. Threads keep running until all queued tasks have been processed.
+        auto workers = array_view(workers_.get(), threadCount_);
+        for (auto& worker : workers) {
+            if (worker.thread.joinable()) {
+                worker.thread.join();
+            }
+        }
+
+        for (auto& shard : shards_) {
+            BASE_NS::ScopedSpinLock lock(shard.lock);
+            shard.tasks.clear();
+        }
+    }
+
+    void ThreadProc(size_t index)
+    {
+#ifdef PLATFORM_HAS_JAVA
+        // RAII class for handling thread setup/release.
+        JavaThreadContext javaContext;
+#endif
+
+#if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
+        // RAII class for thread QoS setup/release.
+        EngineThreadQos threadQos;
+#endif
+        g_currentPool = this;
+        g_currentWorker = index;
+
+        while (true) {
+            if (auto task = TakeTask(index); task) {
+                Run(*task);
+                continue;
+            }
+
+            std::unique_lock lock(mutex_);
+            sleeping_.fetch_add(1U);
+            cv_.wait(lock, [this]() { return (queued_.load() > 0U) || isDone_; });
+            sleeping_.fetch_sub(1U);
+            // When stopping, keep going until the queues are empty.
+            if (isDone_ && (queued_.load() == 0U)) {
+                break;
+            }
+        }
+
+        g_currentPool = nullptr;
+    }
+
+    size_t threadCount_{0};
+    unique_ptr<Worker[]> workers_;
+    TaskShard shards_[TASK_SHARD_COUNT];
+
+    // Number of tasks in the worker queues.
+    std::atomic<uint32_t> queued_{0U};
+    // Number of workers waiting for tasks.
+    std::atomic<uint32_t> sleeping_{0U};
+    std::atomic<uint32_t> nextWorker_{0U};
+
+    bool isDone_{false};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int32_t refcnt_{0};
+};
 }  // namespace
 
 uint32_t TaskQueueFactory::GetNumberOfCores() const
@@ -524,6 +880,14 @@ IThreadPool::Ptr TaskQueueFactory::CreateThreadPool(const uint32_t threadCount)
     return IThreadPool::Ptr{new ThreadPool(threadCount)};
 }
 
+IThreadPool::Ptr TaskQueueFactory::CreateThreadPool(const uint32_t threadCount, const ThreadPoolType type) const
+{
+    if (type == ThreadPoolType::WORK_STEALING) {
+        return IThreadPool::Ptr{new WorkStealingThreadPool(threadCount)};
+    }
+    return IThreadPool::Ptr{new ThreadPool(threadCount)};
+}
+
 IDispatcherTaskQueue::Ptr TaskQueueFactory::CreateDispatcherTaskQueue(const IThreadPool::Ptr& threadPool) const
 {
     return IDispatcherTaskQueue::Ptr{make_unique<DispatcherImpl>(threadPool).release()};
@@ -26,6 +26,7 @@ public:
     uint32_t GetNumberOfCores() const override;
 
     IThreadPool::Ptr CreateThreadPool(uint32_t threadCountconst) const override;
+    IThreadPool::Ptr CreateThreadPool(uint32_t threadCount, ThreadPoolType type) const override;
 
     IDispatcherTaskQueue::Ptr CreateDispatcherTaskQueue(const IThreadPool::Ptr& threadPool) const override;
     IParallelTaskQueue::Ptr CreateParallelTaskQueue(const IThreadPool::Ptr& threadPool) const override;
@@ -15,7 +15,16 @@
 
 #include "frustum_util.h"
 
+#include <cstdint>
+#if defined(BASE_SIMD) && defined(_M_X64)
+#include <immintrin.h>
+#elif defined(BASE_SIMD) && (defined(_M_ARM64) || defined(__ARM_ARCH_ISA_A64))
+#include <arm_neon.h>
+#endif
+
+#include <base/containers/array_view.h>
 #include <base/containers/string_view.h>
+#include <base/math/mathf.h>
 #include <base/math/matrix.h>
 #include <base/math/vector.h>
 #include <base/math/vector_util.h>
@@ -24,11 +33,68 @@
 #include <core/namespace.h>
 
 CORE_BEGIN_NAMESPACE()
+using BASE_NS::array_view;
 using BASE_NS::string_view;
 using BASE_NS::Uid;
 using BASE_NS::Math::Mat4X4;
 using BASE_NS::Math::Vec3;
 
+namespace {
+constexpr size_t BITS_PER_WORD = 64U;
+
+inline bool SphereInside(const Frustum& frustum, const float x, const float y, const float z, const float radius)
+{
+    for (auto const& plane : frustum.planes) {
+        const float d = (plane.x * x) + (plane.y * y) + (plane.z * z) + plane.w;
+        if (d <= -radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if defined(BASE_SIMD) && defined(_M_X64)
+#define CORE_FRUSTUM_SIMD 1
+// Returns a bit for each of the four spheres starting from the given index.
+inline uint32_t SpheresInside4(const Frustum& frustum, const BoundingSpheres& spheres, const size_t index)
+{
+    const __m128 x = _mm_loadu_ps(spheres.centerX.data() + index);
+    const __m128 y = _mm_loadu_ps(spheres.centerY.data() + index);
+    const __m128 z = _mm_loadu_ps(spheres.centerZ.data() + index);
+    const __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(spheres.radius.data() + index));
+    __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (auto const& plane : frustum.planes) {
+        __m128 d = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_set1_ps(plane.w));
+        d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(plane.y), y));
+        d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(plane.z), z));
+        // same as the scalar version: outside only if d <= -radius.
+        inside = _mm_and_ps(inside, _mm_cmpnle_ps(d, negRadius));
+    }
+    return static_cast<uint32_t>(_mm_movemask_ps(inside));
+}
+#elif defined(BASE_SIMD) && (defined(_M_ARM64) || defined(__ARM_ARCH_ISA_A64))
+#define CORE_FRUSTUM_SIMD 1
+// Returns a bit for each of the four spheres starting from the given index.
+inline uint32_t SpheresInside4(const Frustum& frustum, const BoundingSpheres& spheres, const size_t index)
+{
+    const float32x4_t x = vld1q_f32(spheres.centerX.data() + index);
+    const float32x4_t y = vld1q_f32(spheres.centerY.data() + index);
+    const float32x4_t z = vld1q_f32(spheres.centerZ.data() + index);
+    const float32x4_t negRadius = vnegq_f32(vld1q_f32(spheres.radius.data() + index));
+    uint32x4_t inside = vdupq_n_u32(~0U);
+    for (auto const& plane : frustum.planes) {
+        float32x4_t d = vmlaq_n_f32(vdupq_n_f32(plane.w), x, plane.x);
+        d = vmlaq_n_f32(d, y, plane.y);
+        d = vmlaq_n_f32(d, z, plane.z);
+        // same as the scalar version: outside only if d <= -radius.
+        inside = vbicq_u32(inside, vcleq_f32(d, negRadius));
+    }
+    static constexpr uint32_t BITS[] = {1U, 2U, 4U, 8U};
+    return vaddvq_u32(vandq_u32(inside, vld1q_u32(BITS)));
+}
+#endif
+}  // namespace
+
 Frustum FrustumUtil::CreateFrustum(const Mat4X4& matrix) const
 {
     Frustum frustum;
@@ -78,10 +144,39 @@ Frustum FrustumUtil::CreateFrustum(const Mat4X4& matrix) const
 
 bool FrustumUtil::SphereFrustumCollision(const Frustum& frustum, const Vec3 pos, const float radius) const
 {
-    for (auto const& plane : frustum.planes) {
-        const float d = (plane.x * pos.x) + (plane.y * pos.y) + (plane.z * pos.z) + plane.w;
-        if (d <= -radius) {
-            return false;
+    return SphereInside(frustum, pos.x, pos.y, pos.z, radius);
+}
+
+bool FrustumUtil::SphereFrustumCollision(
+    const array_view<const Frustum> frustums, const BoundingSpheres& spheres, array_view<uint64_t> visibility) const
+{
+    const size_t count = spheres.centerX.size();
+    if ((spheres.centerY.size() != count) || (spheres.centerZ.size() != count) || (spheres.radius.size() != count)) {
+        return false;
+    }
+    const size_t wordCount = (count + BITS_PER_WORD - 1U) / BITS_PER_WORD;
+    if (visibility.size() < (frustums.size() * wordCount)) {
+        return false;
+    }
+    uint64_t* words = visibility.data();
+    for (const auto& frustum : frustums) {
+        for (size_t word = 0U; word < wordCount; ++word) {
+            const size_t begin = word * BITS_PER_WORD;
+            const size_t end = BASE_NS::Math::min(begin + BITS_PER_WORD, count);
+            uint64_t bits = 0U;
+            size_t i = begin;
+#if defined(CORE_FRUSTUM_SIMD)
+            for (; (i + 4U) <= end; i += 4U) {
+                bits |= static_cast<uint64_t>(SpheresInside4(frustum, spheres, i)) << (i - begin);
+            }
+#endif
+            for (; i < end; ++i) {
+                if (SphereInside(frustum, spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i],
+                    spheres.radius[i])) {
+                    bits |= (uint64_t(1U) << (i - begin));
+                }
+            }
+            *words++ = bits;
         }
     }
     return true;
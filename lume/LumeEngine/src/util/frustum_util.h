@@ -33,6 +33,8 @@ class FrustumUtil final : public IFrustumUtil {
 public:
     Frustum CreateFrustum(const BASE_NS::Math::Mat4X4& matrix) const override;
     bool SphereFrustumCollision(const Frustum& frustum, BASE_NS::Math::Vec3 pos, float radius) const override;
+    bool SphereFrustumCollision(BASE_NS::array_view<const Frustum> frustums, const BoundingSpheres& spheres,
+        BASE_NS::array_view<uint64_t> visibility) const override;
 
     const IInterface* GetInterface(const BASE_NS::Uid& uid) const override;
     IInterface* GetInterface(const BASE_NS::Uid& uid) override;
@@ -16,8 +16,13 @@
 #include <ComponentTools/base_manager.h>
 #include <ComponentTools/base_manager.inl>
 #include <ComponentTools/component_query.h>
+#include <ComponentTools/dense_base_manager.h>
+#include <ComponentTools/dense_base_manager.inl>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 #include <base/containers/shared_ptr.h>
@@ -32,6 +37,7 @@
 #include <core/property/property_types.h>
 #include <core/property_tools/property_api_impl.h>
 #include <core/property_tools/property_api_impl.inl>
+#include <core/util/parallel_for.h>
 
 #include "test_framework.h"
 
@@ -124,6 +130,40 @@ private:
     const array_view<const Property> ComponentMetaData{ComponentMetadata, countof(ComponentMetadata)};
 };
 
+// Same component as TestComponentManager but using the structure-of-arrays storage.
+class DenseTestComponentManager final : public DenseBaseManager<TestComponent, ITestComponentManager> {
+public:
+    DenseTestComponentManager(IEcs& ecs)
+        : DenseBaseManager<TestComponent, ITestComponentManager>(ecs, CORE_NS::GetName<TestComponent>())
+    {}
+
+    ~DenseTestComponentManager() = default;
+
+    size_t PropertyCount() const override
+    {
+        return ComponentMetaData.size();
+    }
+
+    const Property* MetaData(size_t index) const override
+    {
+        if (index < ComponentMetaData.size()) {
+            return &ComponentMetaData[index];
+        }
+        return nullptr;
+    }
+
+    array_view<const Property> MetaData() const override
+    {
+        return ComponentMetaData;
+    }
+
+private:
+    BEGIN_PROPERTY(TestComponent, ComponentMetadata)
+    DEFINE_PROPERTY(uint32_t, value, "Value", 0, )
+    END_PROPERTY();
+    const array_view<const Property> ComponentMetaData{ComponentMetadata, countof(ComponentMetadata)};
+};
+
 constexpr ComponentManagerTypeInfo testComponentInfo{
     {ComponentManagerTypeInfo::UID},
     ITestComponentManager::UID,
@@ -140,6 +180,14 @@ constexpr ComponentManagerTypeInfo testComponent2Info{
     [](IComponentManager* instance) { delete static_cast<TestComponent2Manager*>(instance); },
 };
 
+constexpr ComponentManagerTypeInfo denseTestComponentInfo{
+    {ComponentManagerTypeInfo::UID},
+    ITestComponentManager::UID,
+    CORE_NS::GetName<ITestComponentManager>().data(),
+    [](IEcs& ecs) -> IComponentManager* { return new DenseTestComponentManager(ecs); },
+    [](IComponentManager* instance) { delete static_cast<DenseTestComponentManager*>(instance); },
+};
+
 constexpr ComponentManagerTypeInfo duplicatedTestComponentInfo{
     {ComponentManagerTypeInfo::UID},
     ITestComponentManager::UID,
@@ -497,6 +545,229 @@ constexpr SystemTypeInfo duplicateTestSystemInfo{
     testSystemDependencies,
 };
 
+// Lets a number of systems wait until all of them are updating.
+class UpdateRendezvous final {
+public:
+    explicit UpdateRendezvous(uint32_t count) : count_(count) {}
+
+    // Returns true if all the systems arrived before the timeout.
+    bool ArriveAndWait()
+    {
+        std::unique_lock lock(mutex_);
+        if (++arrived_ >= count_) {
+            allArrived_.notify_all();
+            return true;
+        }
+        return allArrived_.wait_for(lock, std::chrono::seconds(5), [this]() { return arrived_ >= count_; });
+    }
+
+    void Reset()
+    {
+        const std::lock_guard lock(mutex_);
+        arrived_ = 0U;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable allArrived_;
+    uint32_t count_{0U};
+    uint32_t arrived_{0U};
+};
+
+// System which records when its update started and finished. Used for checking system update ordering.
+class OrderTestSystem final : public ISystem {
+public:
+    OrderTestSystem(IEcs& ecs, Uid uid, std::atomic_uint32_t& clock) : ecs_(ecs), uid_(uid), clock_(clock) {}
+
+    string_view GetName() const override
+    {
+        return "OrderTestSystem";
+    }
+
+    Uid GetUid() const override
+    {
+        return uid_;
+    }
+
+    IPropertyHandle* GetProperties() override
+    {
+        return nullptr;
+    }
+
+    const IPropertyHandle* GetProperties() const override
+    {
+        return nullptr;
+    }
+
+    void SetProperties(const IPropertyHandle&) override {}
+
+    bool IsActive() const override
+    {
+        return true;
+    }
+
+    void SetActive(bool) override {}
+
+    void Initialize() override {}
+
+    bool Update(bool frameRenderingQueued, uint64_t, uint64_t) override
+    {
+        start_ = clock_.fetch_add(1U);
+        if (rendezvous_) {
+            metOthers_ = rendezvous_->ArriveAndWait();
+        }
+        ++updates_;
+        end_ = clock_.fetch_add(1U);
+        return false;
+    }
+
+    void Uninitialize() override {}
+
+    const IEcs& GetECS() const override
+    {
+        return ecs_;
+    }
+
+    IEcs& ecs_;
+    Uid uid_;
+    std::atomic_uint32_t& clock_;
+    UpdateRendezvous* rendezvous_{nullptr};
+    bool metOthers_{false};
+    uint32_t start_{0U};
+    uint32_t end_{0U};
+    uint32_t updates_{0U};
+};
+
+std::atomic_uint32_t g_orderTestClock{0U};
+
+constexpr Uid orderTestWriterUid{"9c6f1b1e-5d0a-4d8e-9e49-2f6d0d3c7a01"};
+constexpr Uid orderTestWriter2Uid{"9c6f1b1e-5d0a-4d8e-9e49-2f6d0d3c7a02"};
+constexpr Uid orderTestReaderUid{"9c6f1b1e-5d0a-4d8e-9e49-2f6d0d3c7a03"};
+constexpr Uid orderTestComponent2Dependencies[] = {ITestComponent2Manager::UID};
+
+constexpr SystemTypeInfo orderTestWriterInfo{
+    {SystemTypeInfo::UID},
+    orderTestWriterUid,
+    "OrderTestWriter",
+    [](IEcs& ecs) -> ISystem* { return new OrderTestSystem(ecs, orderTestWriterUid, g_orderTestClock); },
+    [](ISystem* instance) { delete static_cast<OrderTestSystem*>(instance); },
+    testSystemDependencies,
+};
+
+constexpr SystemTypeInfo orderTestWriter2Info{
+    {SystemTypeInfo::UID},
+    orderTestWriter2Uid,
+    "OrderTestWriter2",
+    [](IEcs& ecs) -> ISystem* { return new OrderTestSystem(ecs, orderTestWriter2Uid, g_orderTestClock); },
+    [](ISystem* instance) { delete static_cast<OrderTestSystem*>(instance); },
+    orderTestComponent2Dependencies,
+};
+
+constexpr SystemTypeInfo orderTestReaderInfo{
+    {SystemTypeInfo::UID},
+    orderTestReaderUid,
+    "OrderTestReader",
+    [](IEcs& ecs) -> ISystem* { return new OrderTestSystem(ecs, orderTestReaderUid, g_orderTestClock); },
+    [](ISystem* instance) { delete static_cast<OrderTestSystem*>(instance); },
+    {},
+    testSystemDependencies,
+};
+
+// System which runs parallel work of its own on the ECS thread pool and waits for it to finish.
+class NestedWorkSystem final : public ISystem {
+public:
+    static constexpr uint32_t JOB_COUNT = 64U;
+
+    NestedWorkSystem(IEcs& ecs, Uid uid) : ecs_(ecs), uid_(uid) {}
+
+    string_view GetName() const override
+    {
+        return "NestedWorkSystem";
+    }
+
+    Uid GetUid() const override
+    {
+        return uid_;
+    }
+
+    IPropertyHandle* GetProperties() override
+    {
+        return nullptr;
+    }
+
+    const IPropertyHandle* GetProperties() const override
+    {
+        return nullptr;
+    }
+
+    void SetProperties(const IPropertyHandle&) override {}
+
+    bool IsActive() const override
+    {
+        return true;
+    }
+
+    void SetActive(bool) override {}
+
+    void Initialize() override {}
+
+    bool Update(bool frameRenderingQueued, uint64_t, uint64_t) override
+    {
+        std::atomic_uint32_t jobs{0U};
+        ParallelFor(ecs_.GetThreadPool().get(), JOB_COUNT, [&jobs](size_t) {
+            // keep the job running long enough for the other systems to occupy the pool threads.
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            jobs.fetch_add(1U);
+        });
+        jobsDone_ += jobs.load();
+        return false;
+    }
+
+    void Uninitialize() override {}
+
+    const IEcs& GetECS() const override
+    {
+        return ecs_;
+    }
+
+    IEcs& ecs_;
+    Uid uid_;
+    uint32_t jobsDone_{0U};
+};
+
+constexpr Uid nestedWorkUids[] = {
+    Uid{"3f0e4c52-7a8b-4f21-9d6c-1b2e3a4c5d01"},
+    Uid{"3f0e4c52-7a8b-4f21-9d6c-1b2e3a4c5d02"},
+    Uid{"3f0e4c52-7a8b-4f21-9d6c-1b2e3a4c5d03"},
+    Uid{"3f0e4c52-7a8b-4f21-9d6c-1b2e3a4c5d04"},
+    Uid{"3f0e4c52-7a8b-4f21-9d6c-1b2e3a4c5d05"},
+};
+
+template<size_t Index>
+ISystem* CreateNestedWorkSystem(IEcs& ecs)
+{
+    return new NestedWorkSystem(ecs, nestedWorkUids[Index]);
+}
+
+void DestroyNestedWorkSystem(ISystem* instance)
+{
+    delete static_cast<NestedWorkSystem*>(instance);
+}
+
+// all only read the same component, so they are updated in one level.
+constexpr SystemTypeInfo nestedWorkInfos[] = {
+    {{SystemTypeInfo::UID}, nestedWorkUids[0U], "NestedWork0", CreateNestedWorkSystem<0U>, DestroyNestedWorkSystem,
+        {}, testSystemDependencies},
+    {{SystemTypeInfo::UID}, nestedWorkUids[1U], "NestedWork1", CreateNestedWorkSystem<1U>, DestroyNestedWorkSystem,
+        {}, testSystemDependencies},
+    {{SystemTypeInfo::UID}, nestedWorkUids[2U], "NestedWork2", CreateNestedWorkSystem<2U>, DestroyNestedWorkSystem,
+        {}, testSystemDependencies},
+    {{SystemTypeInfo::UID}, nestedWorkUids[3U], "NestedWork3", CreateNestedWorkSystem<3U>, DestroyNestedWorkSystem,
+        {}, testSystemDependencies},
+    {{SystemTypeInfo::UID}, nestedWorkUids[4U], "NestedWork4", CreateNestedWorkSystem<4U>, DestroyNestedWorkSystem,
+        {}, testSystemDependencies},
+};
+
 class EntityListener final : IEcs::EntityListener {
 public:
     EntityListener(IEcs& ecs) : ecs_{ecs}
@@ -1129,6 +1400,187 @@ UNIT_TEST(API_EcsTest, timeScale, testing::ext::TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: parallelSystemUpdate
+ * @tc.desc: Tests that systems with disjoint component dependencies are updated in parallel and conflicting systems
+ * keep their order.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsTest, parallelSystemUpdate, testing::ext::TestSize.Level1)
+{
+    IEngine::Ptr engine = UTest::CreateEngine();
+    const auto factory = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    ASSERT_TRUE(factory);
+    auto threadPool = factory->CreateThreadPool(4);
+    IEcs::Ptr ecs = engine->CreateEcs(*threadPool);
+    ASSERT_TRUE(ecs);
+    EXPECT_EQ(ecs->GetSystemUpdateMode(), IEcs::SystemUpdateMode::SEQUENTIAL);
+
+    // dependencies are looked up from the registered type infos.
+    GetPluginRegister().RegisterTypeInfo(orderTestWriterInfo);
+    GetPluginRegister().RegisterTypeInfo(orderTestWriter2Info);
+    GetPluginRegister().RegisterTypeInfo(orderTestReaderInfo);
+
+    EXPECT_TRUE(ecs->CreateComponentManager(testComponentInfo) != nullptr);
+    EXPECT_TRUE(ecs->CreateComponentManager(testComponent2Info) != nullptr);
+    auto* writer = static_cast<OrderTestSystem*>(ecs->CreateSystem(orderTestWriterInfo));
+    auto* writer2 = static_cast<OrderTestSystem*>(ecs->CreateSystem(orderTestWriter2Info));
+    auto* reader = static_cast<OrderTestSystem*>(ecs->CreateSystem(orderTestReaderInfo));
+    ASSERT_TRUE(writer && writer2 && reader);
+    ecs->Initialize();
+
+    IEcs* ecsArr[] = {ecs.get()};
+    // sequential: each system finishes before the next one starts.
+    engine->TickFrame(ecsArr);
+    EXPECT_LT(writer->end_, writer2->start_);
+    EXPECT_LT(writer2->end_, reader->start_);
+
+    ecs->SetSystemUpdateMode(IEcs::SystemUpdateMode::PARALLEL);
+    EXPECT_EQ(ecs->GetSystemUpdateMode(), IEcs::SystemUpdateMode::PARALLEL);
+    UpdateRendezvous rendezvous(2U);
+    writer->rendezvous_ = &rendezvous;
+    writer2->rendezvous_ = &rendezvous;
+    for (uint32_t frame = 0U; frame < 3U; ++frame) {
+        rendezvous.Reset();
+        engine->TickFrame(ecsArr);
+        // writers don't conflict so each one waits until the other one is also updating.
+        EXPECT_TRUE(writer->metOthers_);
+        EXPECT_TRUE(writer2->metOthers_);
+        // reader reads what the first writer writes so it must start only after the writer has finished.
+        EXPECT_GT(reader->start_, writer->end_);
+    }
+    EXPECT_EQ(writer->updates_, 4U);
+    EXPECT_EQ(writer2->updates_, 4U);
+    EXPECT_EQ(reader->updates_, 4U);
+
+    ecs->Uninitialize();
+    GetPluginRegister().UnregisterTypeInfo(orderTestWriterInfo);
+    GetPluginRegister().UnregisterTypeInfo(orderTestWriter2Info);
+    GetPluginRegister().UnregisterTypeInfo(orderTestReaderInfo);
+}
+
+/**
+ * @tc.name: parallelSystemUpdateNestedWork
+ * @tc.desc: Tests that a level with more systems than pool threads, each running parallel work on the same pool, is
+ * updated without the pool starving.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsTest, parallelSystemUpdateNestedWork, testing::ext::TestSize.Level1)
+{
+    IEngine::Ptr engine = UTest::CreateEngine();
+    const auto factory = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    ASSERT_TRUE(factory);
+    auto threadPool = factory->CreateThreadPool(2);
+    IEcs::Ptr ecs = engine->CreateEcs(*threadPool);
+    ASSERT_TRUE(ecs);
+    ecs->SetSystemUpdateMode(IEcs::SystemUpdateMode::PARALLEL);
+
+    for (const auto& info : nestedWorkInfos) {
+        GetPluginRegister().RegisterTypeInfo(info);
+    }
+    EXPECT_TRUE(ecs->CreateComponentManager(testComponentInfo) != nullptr);
+    vector<NestedWorkSystem*> systems;
+    for (const auto& info : nestedWorkInfos) {
+        systems.push_back(static_cast<NestedWorkSystem*>(ecs->CreateSystem(info)));
+        ASSERT_TRUE(systems.back());
+    }
+    ASSERT_GT(systems.size(), threadPool->GetNumberOfThreads());
+    ecs->Initialize();
+
+    IEcs* ecsArr[] = {ecs.get()};
+    constexpr uint32_t frameCount = 4U;
+    for (uint32_t frame = 0U; frame < frameCount; ++frame) {
+        engine->TickFrame(ecsArr);
+    }
+    for (const auto* system : systems) {
+        EXPECT_EQ(system->jobsDone_, frameCount * NestedWorkSystem::JOB_COUNT);
+    }
+
+    ecs->Uninitialize();
+    for (const auto& info : nestedWorkInfos) {
+        GetPluginRegister().UnregisterTypeInfo(info);
+    }
+}
+
+/**
+ * @tc.name: denseBaseManager
+ * @tc.desc: Tests that DenseBaseManager keeps the component data packed and in sync with entities through writes and
+ * garbage collection.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsTest, denseBaseManager, testing::ext::TestSize.Level1)
+{
+    IEngine::Ptr engine = UTest::CreateEngine();
+    IEcs::Ptr ecs = engine->CreateEcs();
+    auto* manager = static_cast<DenseTestComponentManager*>(ecs->CreateComponentManager(denseTestComponentInfo));
+    ASSERT_TRUE(manager);
+    ecs->Initialize();
+
+    IEntityManager& entityManager = ecs->GetEntityManager();
+    constexpr uint32_t count = 100U;
+    vector<Entity> entities;
+    for (uint32_t i = 0U; i < count; ++i) {
+        const Entity entity = entityManager.Create();
+        manager->Set(entity, {i});
+        entities.push_back(entity);
+    }
+    ASSERT_EQ(manager->GetComponentCount(), count);
+    {
+        const auto data = manager->GetComponentData();
+        const auto dataEntities = manager->GetEntities();
+        ASSERT_EQ(data.size(), count);
+        ASSERT_EQ(dataEntities.size(), count);
+        for (uint32_t i = 0U; i < count; ++i) {
+            EXPECT_EQ(data[i].value, i);
+            EXPECT_EQ(dataEntities[i], entities[i]);
+            EXPECT_EQ(manager->GetComponentId(entities[i]), i);
+        }
+    }
+
+    // writes go to the packed array and update generation and dirty state.
+    const auto generation = manager->GetComponentGeneration(1U);
+    if (auto handle = manager->Write(entities[1U])) {
+        handle->value = 1000U;
+    }
+    EXPECT_EQ(manager->GetComponentData()[1U].value, 1000U);
+    EXPECT_EQ(manager->GetComponentGeneration(1U), generation + 1U);
+    const auto updated = manager->GetUpdatedComponents();
+    ASSERT_EQ(updated.size(), 1U);
+    EXPECT_EQ(updated[0U], entities[1U]);
+
+    // detached handles keep their own copy.
+    IPropertyHandle* clone = manager->Clone(manager->GetData(entities[1U]));
+    ASSERT_TRUE(clone);
+    if (auto handle = ScopedHandle<TestComponent>(clone)) {
+        handle->value = 2000U;
+    }
+    EXPECT_EQ(manager->Get(entities[1U]).value, 1000U);
+    manager->SetData(entities[2U], *clone);
+    EXPECT_EQ(manager->Get(entities[2U]).value, 2000U);
+    manager->Release(clone);
+    manager->Release(manager->GetData(entities[2U]));
+    EXPECT_EQ(manager->Get(entities[2U]).value, 2000U);
+
+    // destroy every other entity and check that the remaining data is compacted.
+    for (uint32_t i = 0U; i < count; i += 2U) {
+        entityManager.Destroy(entities[i]);
+    }
+    ecs->ProcessEvents();
+    ASSERT_EQ(manager->GetComponentCount(), count / 2U);
+    const auto data = manager->GetComponentData();
+    const auto dataEntities = manager->GetEntities();
+    ASSERT_EQ(data.size(), count / 2U);
+    for (uint32_t i = 1U; i < count; i += 2U) {
+        const auto id = manager->GetComponentId(entities[i]);
+        ASSERT_LT(id, data.size());
+        EXPECT_EQ(dataEntities[id], entities[i]);
+        EXPECT_EQ(data[id].value, (i == 1U) ? 1000U : i);
+        EXPECT_EQ(manager->Read(entities[i])->value, data[id].value);
+    }
+
+    ecs->Uninitialize();
+}
+
 /**
  * @tc.name: createAndDestroyEntityReference
  * @tc.desc: Tests for Create And Destroy Entity Reference. [AUTO-GENERATED]
@@ -1525,6 +1977,105 @@ UNIT_TEST(API_EcsTest, componentQuery, testing::ext::TestSize.Level1)
     GetPluginRegister().UnregisterTypeInfo(testComponent2Info);
 }
 
+/**
+ * @tc.name: componentQueryIncremental
+ * @tc.desc: Tests that Component Query updates only the rows of changed entities when listeners are enabled.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsTest, componentQueryIncremental, testing::ext::TestSize.Level1)
+{
+    IEngine::Ptr engine = UTest::CreateEngine();
+    IEcs::Ptr ecs = engine->CreateEcs();
+
+    GetPluginRegister().RegisterTypeInfo(testComponentInfo);
+    GetPluginRegister().RegisterTypeInfo(testComponent2Info);
+    ecs->CreateComponentManager(testComponentInfo);
+    ecs->CreateComponentManager(testComponent2Info);
+    ecs->Initialize();
+
+    auto* testManager = GetManager<ITestComponentManager>(*ecs);
+    ASSERT_TRUE(testManager);
+    auto* test2Manager = GetManager<ITestComponent2Manager>(*ecs);
+    ASSERT_TRUE(test2Manager);
+
+    constexpr size_t entityCount = 16U;
+    vector<Entity> entities;
+    for (size_t i = 0; i < entityCount; ++i) {
+        auto entity = ecs->GetEntityManager().Create();
+        testManager->Create(entity);
+        test2Manager->Create(entity);
+        entities.push_back(entity);
+    }
+    IEcs* ecsArr[] = {ecs.get()};
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+
+    ComponentQuery query;
+    const ComponentQuery::Operation operations[] = {{*test2Manager, ComponentQuery::Operation::Method::REQUIRE}};
+    query.SetupQuery(*testManager, operations);
+    query.SetEcsListenersEnabled(true);
+    EXPECT_TRUE(query.Execute());
+    ASSERT_EQ(query.GetResults().size(), entityCount);
+
+    auto checkRows = [&]() {
+        for (const auto& row : query.GetResults()) {
+            ASSERT_EQ(query.FindResultRow(row.entity), &row);
+            EXPECT_EQ(row.components[0U], testManager->GetComponentId(row.entity));
+            EXPECT_EQ(row.components[1U], test2Manager->GetComponentId(row.entity));
+        }
+    };
+
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+    EXPECT_TRUE(query.IsValid());
+    EXPECT_FALSE(query.Execute());
+
+    // removing a required component of one entity removes only that row.
+    test2Manager->Destroy(entities[1U]);
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+    EXPECT_FALSE(query.IsValid());
+    EXPECT_TRUE(query.Execute());
+    ASSERT_EQ(query.GetResults().size(), entityCount - 1U);
+    EXPECT_EQ(query.FindResultRow(entities[1U]), nullptr);
+    checkRows();
+
+    // adding the component back adds the row.
+    test2Manager->Create(entities[1U]);
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+    EXPECT_TRUE(query.Execute());
+    ASSERT_EQ(query.GetResults().size(), entityCount);
+    EXPECT_NE(query.FindResultRow(entities[1U]), nullptr);
+    checkRows();
+
+    // destroying entities removes their rows and the remaining rows still point to the right components.
+    ecs->GetEntityManager().Destroy(entities[0U]);
+    ecs->GetEntityManager().Destroy(entities[7U]);
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+    EXPECT_TRUE(query.Execute());
+    ASSERT_EQ(query.GetResults().size(), entityCount - 2U);
+    EXPECT_EQ(query.FindResultRow(entities[0U]), nullptr);
+    EXPECT_EQ(query.FindResultRow(entities[7U]), nullptr);
+    checkRows();
+
+    // deactivated entities aren't included.
+    ecs->GetEntityManager().SetActive(entities[3U], false);
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+    EXPECT_TRUE(query.Execute());
+    ASSERT_EQ(query.GetResults().size(), entityCount - 3U);
+    EXPECT_EQ(query.FindResultRow(entities[3U]), nullptr);
+    checkRows();
+
+    ecs->GetEntityManager().SetActive(entities[3U], true);
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+    EXPECT_TRUE(query.Execute());
+    ASSERT_EQ(query.GetResults().size(), entityCount - 2U);
+    EXPECT_NE(query.FindResultRow(entities[3U]), nullptr);
+    checkRows();
+
+    query.SetEcsListenersEnabled(false);
+    ecs->Uninitialize();
+    GetPluginRegister().UnregisterTypeInfo(testComponentInfo);
+    GetPluginRegister().UnregisterTypeInfo(testComponent2Info);
+}
+
 /**
  * @tc.name: entityComparison
  * @tc.desc: Tests for Entity Comparison. [AUTO-GENERATED]
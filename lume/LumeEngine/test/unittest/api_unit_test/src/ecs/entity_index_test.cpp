@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ComponentTools/entity_index.h>
+#include <chrono>
+
+#include <base/containers/unordered_map.h>
+#include <base/containers/vector.h>
+#include <core/ecs/entity.h>
+
+#include "test_framework.h"
+
+using namespace BASE_NS;
+using namespace CORE_NS;
+
+namespace {
+constexpr Entity MakeEntity(uint32_t generation, uint32_t index)
+{
+    return Entity{(static_cast<uint64_t>(generation) << 32U) | index};
+}
+} // namespace
+
+/**
+ * @tc.name: insertFindErase
+ * @tc.desc: Tests that EntityIndex stores values per entity and validates the generation.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsEntityIndexTest, insertFindErase, testing::ext::TestSize.Level1)
+{
+    EntityIndex index;
+    EXPECT_TRUE(index.Empty());
+    EXPECT_EQ(index.Find(MakeEntity(1U, 0U)), EntityIndex::INVALID_VALUE);
+
+    index.Insert(MakeEntity(1U, 0U), 10U);
+    index.Insert(MakeEntity(1U, 5000U), 20U);
+    EXPECT_EQ(index.Size(), 2U);
+    EXPECT_EQ(index.Find(MakeEntity(1U, 0U)), 10U);
+    EXPECT_EQ(index.Find(MakeEntity(1U, 5000U)), 20U);
+    // same index, different generation.
+    EXPECT_EQ(index.Find(MakeEntity(2U, 0U)), EntityIndex::INVALID_VALUE);
+    EXPECT_FALSE(index.Erase(MakeEntity(2U, 0U)));
+
+    // updating keeps the size.
+    index.Insert(MakeEntity(1U, 0U), 11U);
+    EXPECT_EQ(index.Size(), 2U);
+    EXPECT_EQ(index.Find(MakeEntity(1U, 0U)), 11U);
+
+    EXPECT_TRUE(index.Erase(MakeEntity(1U, 0U)));
+    EXPECT_FALSE(index.Contains(MakeEntity(1U, 0U)));
+    EXPECT_EQ(index.Size(), 1U);
+
+    index.Clear();
+    EXPECT_TRUE(index.Empty());
+    EXPECT_EQ(index.Find(MakeEntity(1U, 5000U)), EntityIndex::INVALID_VALUE);
+}
+
+/**
+ * @tc.name: generationCollision
+ * @tc.desc: Tests that two generations of the same entity index can be stored at the same time.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsEntityIndexTest, generationCollision, testing::ext::TestSize.Level1)
+{
+    EntityIndex index;
+    const Entity stale = MakeEntity(1U, 7U);
+    const Entity current = MakeEntity(2U, 7U);
+    index.Insert(stale, 1U);
+    index.Insert(current, 2U);
+    EXPECT_EQ(index.Size(), 2U);
+    EXPECT_EQ(index.Find(stale), 1U);
+    EXPECT_EQ(index.Find(current), 2U);
+
+    EXPECT_TRUE(index.Erase(stale));
+    EXPECT_EQ(index.Find(current), 2U);
+    // updating after the slot was freed must not leave an old value behind.
+    index.Insert(current, 3U);
+    EXPECT_EQ(index.Size(), 1U);
+    EXPECT_EQ(index.Find(current), 3U);
+    EXPECT_TRUE(index.Erase(current));
+    EXPECT_FALSE(index.Contains(current));
+    EXPECT_TRUE(index.Empty());
+
+    // indices far outside the dense range work as well.
+    const Entity sparse = MakeEntity(1U, 0xFFFFFFF0U);
+    index.Insert(sparse, 4U);
+    EXPECT_EQ(index.Find(sparse), 4U);
+    EXPECT_TRUE(index.Erase(sparse));
+}
+
+/**
+ * @tc.name: lookupPerformance
+ * @tc.desc: Compares entity look-ups from EntityIndex and unordered_map with 100k entities.
+ * @tc.type: PERF
+ */
+UNIT_TEST(API_EcsEntityIndexTest, lookupPerformance, testing::ext::TestSize.Level1)
+{
+    constexpr uint32_t count = 100000U;
+    constexpr uint32_t rounds = 20U;
+    vector<Entity> entities;
+    entities.reserve(count);
+    EntityIndex index;
+    unordered_map<Entity, uint32_t> map;
+    map.reserve(count);
+    for (uint32_t i = 0U; i < count; ++i) {
+        // every other entity has been recycled once.
+        entities.push_back(MakeEntity(1U + (i & 1U), i));
+        index.Insert(entities.back(), i);
+        map.insert({entities.back(), i});
+    }
+
+    using Clock = std::chrono::steady_clock;
+    uint64_t indexSum = 0U;
+    const auto indexStart = Clock::now();
+    for (uint32_t round = 0U; round < rounds; ++round) {
+        for (const auto& entity : entities) {
+            indexSum += index.Find(entity);
+        }
+    }
+    const auto indexTime = Clock::now() - indexStart;
+
+    uint64_t mapSum = 0U;
+    const auto mapStart = Clock::now();
+    for (uint32_t round = 0U; round < rounds; ++round) {
+        for (const auto& entity : entities) {
+            if (const auto pos = map.find(entity); pos != map.cend()) {
+                mapSum += pos->second;
+            }
+        }
+    }
+    const auto mapTime = Clock::now() - mapStart;
+
+    EXPECT_EQ(indexSum, mapSum);
+    const auto toUs = [](auto duration) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+    RecordProperty("EntityIndexUs", static_cast<int>(toUs(indexTime)));
+    RecordProperty("UnorderedMapUs", static_cast<int>(toUs(mapTime)));
+}
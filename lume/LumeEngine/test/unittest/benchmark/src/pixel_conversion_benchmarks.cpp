@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include <core/image/pixel_conversion.h>
+
+CORE_BEGIN_NAMESPACE()
+namespace benchmarks {
+namespace {
+// 4K RGBA8 image.
+constexpr uint32_t WIDTH = 3840U;
+constexpr uint32_t HEIGHT = 2160U;
+constexpr uint32_t CHANNELS = 4U;
+constexpr size_t PIXEL_COUNT = static_cast<size_t>(WIDTH) * HEIGHT;
+
+// the image is converted in place over and over again, which does not change the amount of work as alpha is kept.
+std::vector<uint8_t> CreateImage()
+{
+    // mostly opaque with an alpha gradient at the bottom, like a typical UI texture.
+    std::vector<uint8_t> pixels(PIXEL_COUNT * CHANNELS);
+    for (size_t i = 0U; i < PIXEL_COUNT; ++i) {
+        uint8_t* pixel = pixels.data() + i * CHANNELS;
+        pixel[0U] = static_cast<uint8_t>(i);
+        pixel[1U] = static_cast<uint8_t>(i >> 4U);
+        pixel[2U] = static_cast<uint8_t>(i >> 8U);
+        const size_t y = i / WIDTH;
+        pixel[3U] = (y < (HEIGHT * 3U / 4U)) ? 255U : static_cast<uint8_t>(i % WIDTH);
+    }
+    return pixels;
+}
+
+// The byte at a time loop the loaders used before, for comparison.
+void PremultiplyLinearByteAtATime(uint8_t* img, size_t pixelCount)
+{
+    for (size_t i = 0U; i < pixelCount; i++) {
+        const uint32_t alpha = img[CHANNELS - 1U];
+        for (uint32_t j = 0U; j < CHANNELS - 1U; j++) {
+            *img = static_cast<uint8_t>(*img * alpha / 0xff);
+            img++;
+        }
+        img++;
+    }
+}
+}  // namespace
+
+void PremultiplyLinearReference(benchmark::State& state)
+{
+    std::vector<uint8_t> pixels = CreateImage();
+    for (auto _ : state) {
+        PremultiplyLinearByteAtATime(pixels.data(), PIXEL_COUNT);
+        benchmark::DoNotOptimize(pixels.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * pixels.size()));
+}
+
+// Argument selects linear (1) or sRGB (0) values.
+void PremultiplyAlpha(benchmark::State& state)
+{
+    std::vector<uint8_t> pixels = CreateImage();
+    const bool linear = state.range(0) != 0;
+    for (auto _ : state) {
+        PixelConversion::PremultiplyAlpha(pixels.data(), PIXEL_COUNT, CHANNELS, 1U, linear);
+        benchmark::DoNotOptimize(pixels.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * pixels.size()));
+}
+
+void FlipVertically(benchmark::State& state)
+{
+    std::vector<uint8_t> pixels = CreateImage();
+    for (auto _ : state) {
+        PixelConversion::FlipVertically(pixels.data(), static_cast<size_t>(WIDTH) * CHANNELS, HEIGHT);
+        benchmark::DoNotOptimize(pixels.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * pixels.size()));
+}
+
+BENCHMARK(PremultiplyLinearReference)->Unit(benchmark::kMillisecond);
+BENCHMARK(PremultiplyAlpha)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(FlipVertically)->Unit(benchmark::kMillisecond);
+}  // namespace benchmarks
+CORE_END_NAMESPACE()
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <benchmark/benchmark.h>
+
+#include <base/containers/array_view.h>
+#include <core/implementation_uids.h>
+#include <core/plugin/intf_class_register.h>
+#include <core/threading/intf_thread_pool.h>
+
+CORE_BEGIN_NAMESPACE()
+namespace benchmarks {
+namespace {
+constexpr int TASK_COUNT = 100000;
+// Every CHAIN_LENGTH tasks form a chain where each task depends on the previous one.
+constexpr int CHAIN_LENGTH = 8;
+
+class CounterTask final : public IThreadPool::ITask {
+public:
+    explicit CounterTask(std::atomic<int>& counter) : counter_(counter) {}
+
+    void operator()() override
+    {
+        counter_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+protected:
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    std::atomic<int>& counter_;
+};
+
+IThreadPool::Ptr CreatePool(const benchmark::State& state)
+{
+    auto factory = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    return factory->CreateThreadPool(
+        factory->GetNumberOfCores(), static_cast<ITaskQueueFactory::ThreadPoolType>(state.range(0)));
+}
+
+void WaitFor(const std::atomic<int>& counter, int value)
+{
+    while (counter.load(std::memory_order_acquire) < value) {
+    }
+}
+}  // namespace
+
+void PushTinyTasks(benchmark::State& state)
+{
+    auto pool = CreatePool(state);
+    std::atomic<int> counter{};
+    for (auto _ : state) {
+        counter = 0;
+        for (int i = 0; i < TASK_COUNT; ++i) {
+            pool->PushNoWait(IThreadPool::ITask::Ptr{new CounterTask(counter)});
+        }
+        WaitFor(counter, TASK_COUNT);
+    }
+    state.SetItemsProcessed(state.iterations() * TASK_COUNT);
+}
+
+void PushTinyTasksWithDependencies(benchmark::State& state)
+{
+    auto pool = CreatePool(state);
+    std::atomic<int> counter{};
+    for (auto _ : state) {
+        counter = 0;
+        const IThreadPool::ITask* previous = nullptr;
+        for (int i = 0; i < TASK_COUNT; ++i) {
+            auto task = IThreadPool::ITask::Ptr{new CounterTask(counter)};
+            const IThreadPool::ITask* current = task.get();
+            if (previous && (i % CHAIN_LENGTH) != 0) {
+                const IThreadPool::ITask* dependencies[] = {previous};
+                pool->PushNoWait(BASE_NS::move(task), dependencies);
+            } else {
+                pool->PushNoWait(BASE_NS::move(task));
+            }
+            previous = current;
+        }
+        WaitFor(counter, TASK_COUNT);
+    }
+    state.SetItemsProcessed(state.iterations() * TASK_COUNT);
+}
+
+// Argument selects ITaskQueueFactory::ThreadPoolType.
+BENCHMARK(PushTinyTasks)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(PushTinyTasksWithDependencies)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+}  // namespace benchmarks
+CORE_END_NAMESPACE()
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include <base/util/formats.h>
+#include <core/image/intf_image_container.h>
+#include <core/image/intf_image_loader_manager.h>
+
+#include "test_framework.h"
+
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+#include "image/loaders/image_loader_ktx2.h"
+
+#if defined(USE_ZSTD) && (USE_ZSTD == 1)
+#include <zstd.h>
+#endif
+
+using namespace CORE_NS;
+using BASE_NS::array_view;
+using BASE_NS::Format;
+
+namespace {
+constexpr uint32_t SUPERCOMPRESSION_NONE = 0U;
+constexpr uint32_t SUPERCOMPRESSION_BASIS_LZ = 1U;
+constexpr uint32_t SUPERCOMPRESSION_ZSTD = 2U;
+
+struct Ktx2Desc {
+    uint32_t vkFormat{Format::BASE_FORMAT_R8G8B8A8_SRGB};
+    uint32_t width{4U};
+    uint32_t height{4U};
+    uint32_t levelCount{3U};
+    uint32_t supercompressionScheme{SUPERCOMPRESSION_NONE};
+    uint32_t bytesPerBlock{4U};
+};
+
+void WriteU32(std::vector<uint8_t>& bytes, size_t offset, uint32_t value)
+{
+    for (size_t i = 0U; i < sizeof(value); ++i) {
+        bytes[offset + i] = static_cast<uint8_t>(value >> (i * 8U));
+    }
+}
+
+void WriteU64(std::vector<uint8_t>& bytes, size_t offset, uint64_t value)
+{
+    WriteU32(bytes, offset, static_cast<uint32_t>(value));
+    WriteU32(bytes, offset + sizeof(uint32_t), static_cast<uint32_t>(value >> 32U));
+}
+
+// Uncompressed data of each level, level i filled with the value i + 1.
+std::vector<std::vector<uint8_t>> CreateLevels(const Ktx2Desc& desc)
+{
+    std::vector<std::vector<uint8_t>> levels;
+    for (uint32_t level = 0U; level < std::max(desc.levelCount, 1U); ++level) {
+        const size_t width = std::max(desc.width >> level, 1U);
+        const size_t height = std::max(desc.height >> level, 1U);
+        levels.emplace_back(width * height * desc.bytesPerBlock, static_cast<uint8_t>(level + 1U));
+    }
+    return levels;
+}
+
+// Builds a ktx2 file of a 2d image with 1x1 blocks. Levels are stored smallest first as in files written by toktx.
+std::vector<uint8_t> CreateKtx2(const Ktx2Desc& desc, const std::vector<std::vector<uint8_t>>& levels,
+    const std::vector<std::vector<uint8_t>>& storedLevels)
+{
+    constexpr uint8_t identifier[] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+    constexpr size_t headerLength = 80U;
+    constexpr size_t indexEntryLength = 24U;
+    // Total size, basic block header and one sample.
+    constexpr uint32_t dfdLength = 4U + 24U + 16U;
+    const size_t dfdOffset = headerLength + indexEntryLength * levels.size();
+
+    std::vector<uint8_t> bytes(dfdOffset + dfdLength);
+    std::memcpy(bytes.data(), identifier, sizeof(identifier));
+    WriteU32(bytes, 12U, desc.vkFormat);
+    WriteU32(bytes, 16U, 1U);
+    WriteU32(bytes, 20U, desc.width);
+    WriteU32(bytes, 24U, desc.height);
+    WriteU32(bytes, 36U, 1U);
+    WriteU32(bytes, 40U, desc.levelCount);
+    WriteU32(bytes, 44U, desc.supercompressionScheme);
+    WriteU32(bytes, 48U, static_cast<uint32_t>(dfdOffset));
+    WriteU32(bytes, 52U, dfdLength);
+
+    WriteU32(bytes, dfdOffset, dfdLength);
+    // Version 2 and block size.
+    WriteU32(bytes, dfdOffset + 8U, 2U | ((dfdLength - 4U) << 16U));
+    // RGBSDA color model, BT709 primaries and sRGB transfer function.
+    WriteU32(bytes, dfdOffset + 12U, 1U | (1U << 8U) | (2U << 16U));
+    // Block dimensions minus one are all zero.
+    WriteU32(bytes, dfdOffset + 20U, (desc.supercompressionScheme == SUPERCOMPRESSION_NONE) ? desc.bytesPerBlock : 0U);
+
+    for (size_t level = storedLevels.size(); level-- > 0U;) {
+        bytes.resize((bytes.size() + 3U) & ~size_t(3U));
+        const size_t entry = headerLength + indexEntryLength * level;
+        WriteU64(bytes, entry, bytes.size());
+        WriteU64(bytes, entry + 8U, storedLevels[level].size());
+        WriteU64(bytes, entry + 16U, levels[level].size());
+        bytes.insert(bytes.end(), storedLevels[level].begin(), storedLevels[level].end());
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> CreateKtx2(const Ktx2Desc& desc)
+{
+    const auto levels = CreateLevels(desc);
+    return CreateKtx2(desc, levels, levels);
+}
+
+void ExpectLevels(const IImageContainer& image, const std::vector<std::vector<uint8_t>>& levels, uint32_t firstLevel)
+{
+    const auto data = image.GetData();
+    const auto buffers = image.GetBufferImageCopies();
+    ASSERT_EQ(buffers.size(), levels.size() - firstLevel);
+    for (size_t i = 0U; i < buffers.size(); ++i) {
+        const auto& buffer = buffers[i];
+        const auto& level = levels[firstLevel + i];
+        EXPECT_EQ(buffer.mipLevel, i);
+        EXPECT_EQ(buffer.width, std::max(4U >> (firstLevel + i), 1U));
+        EXPECT_EQ(buffer.bufferRowLength, buffer.width);
+        EXPECT_EQ(buffer.layerCount, 1U);
+        EXPECT_EQ(buffer.bufferOffset % 4U, 0U);
+        ASSERT_LE(buffer.bufferOffset + level.size(), data.size());
+        EXPECT_EQ(std::memcmp(data.data() + buffer.bufferOffset, level.data(), level.size()), 0);
+    }
+}
+}  // namespace
+
+/**
+ * @tc.name: loadMipmapped
+ * @tc.desc: Tests loading a ktx2 file with all of its mip levels
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageLoaderKtx2Test, loadMipmapped, testing::ext::TestSize.Level1)
+{
+    auto loader = CreateImageLoaderKtx2(nullptr);
+    ASSERT_TRUE(loader);
+    const Ktx2Desc desc;
+    const auto levels = CreateLevels(desc);
+    const auto bytes = CreateKtx2(desc);
+    EXPECT_TRUE(loader->CanLoad(bytes));
+
+    auto result = loader->Load(bytes, 0U);
+    ASSERT_TRUE(result.success) << result.error;
+    const auto& imageDesc = result.image->GetImageDesc();
+    EXPECT_EQ(imageDesc.format, Format::BASE_FORMAT_R8G8B8A8_SRGB);
+    EXPECT_EQ(imageDesc.imageType, IImageContainer::ImageType::TYPE_2D);
+    EXPECT_EQ(imageDesc.imageViewType, IImageContainer::ImageViewType::VIEW_TYPE_2D);
+    EXPECT_EQ(imageDesc.width, 4U);
+    EXPECT_EQ(imageDesc.height, 4U);
+    EXPECT_EQ(imageDesc.depth, 1U);
+    EXPECT_EQ(imageDesc.mipCount, 3U);
+    EXPECT_EQ(imageDesc.layerCount, 1U);
+    EXPECT_EQ(imageDesc.bitsPerBlock, 32U);
+    EXPECT_EQ(imageDesc.imageFlags & IImageContainer::FLAGS_REQUESTING_MIPMAPS_BIT, 0U);
+    ExpectLevels(*result.image, levels, 0U);
+
+    // The file has its own levels, so none are generated.
+    result = loader->Load(bytes,
+        IImageLoaderManager::IMAGE_LOADER_GENERATE_MIPS | IImageLoaderManager::IMAGE_LOADER_FORCE_LINEAR_RGB_BIT);
+    ASSERT_TRUE(result.success) << result.error;
+    EXPECT_EQ(result.image->GetImageDesc().format, Format::BASE_FORMAT_R8G8B8A8_UNORM);
+    EXPECT_EQ(result.image->GetImageDesc().mipCount, 3U);
+    EXPECT_EQ(result.image->GetImageDesc().imageFlags & IImageContainer::FLAGS_REQUESTING_MIPMAPS_BIT, 0U);
+}
+
+/**
+ * @tc.name: loadDownscaled
+ * @tc.desc: Tests that the downscale hints leave out the largest mip levels without reading them
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageLoaderKtx2Test, loadDownscaled, testing::ext::TestSize.Level1)
+{
+    auto loader = CreateImageLoaderKtx2(nullptr);
+    ASSERT_TRUE(loader);
+    const Ktx2Desc desc;
+    const auto levels = CreateLevels(desc);
+    const auto bytes = CreateKtx2(desc);
+
+    auto result = loader->Load(bytes, IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_2X);
+    ASSERT_TRUE(result.success) << result.error;
+    EXPECT_EQ(result.image->GetImageDesc().width, 2U);
+    EXPECT_EQ(result.image->GetImageDesc().mipCount, 2U);
+    EXPECT_EQ(result.image->GetData().size(), levels[1U].size() + levels[2U].size());
+    ExpectLevels(*result.image, levels, 1U);
+
+    // At least the smallest level is kept.
+    result = loader->Load(bytes, IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_8X);
+    ASSERT_TRUE(result.success) << result.error;
+    EXPECT_EQ(result.image->GetImageDesc().width, 1U);
+    EXPECT_EQ(result.image->GetImageDesc().mipCount, 1U);
+    ExpectLevels(*result.image, levels, 2U);
+
+    result = loader->Load(
+        bytes, IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_4X | IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY);
+    ASSERT_TRUE(result.success) << result.error;
+    EXPECT_EQ(result.image->GetImageDesc().width, 1U);
+    EXPECT_EQ(result.image->GetImageDesc().height, 1U);
+    EXPECT_TRUE(result.image->GetData().empty());
+}
+
+/**
+ * @tc.name: generateMips
+ * @tc.desc: Tests that a level count of zero requests generating the mip levels
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageLoaderKtx2Test, generateMips, testing::ext::TestSize.Level1)
+{
+    auto loader = CreateImageLoaderKtx2(nullptr);
+    ASSERT_TRUE(loader);
+    Ktx2Desc desc;
+    desc.levelCount = 0U;
+    const auto levels = CreateLevels(desc);
+    const auto bytes = CreateKtx2(desc);
+
+    auto result = loader->Load(bytes, 0U);
+    ASSERT_TRUE(result.success) << result.error;
+    EXPECT_EQ(result.image->GetImageDesc().mipCount, 3U);
+    EXPECT_NE(result.image->GetImageDesc().imageFlags & IImageContainer::FLAGS_REQUESTING_MIPMAPS_BIT, 0U);
+    ExpectLevels(*result.image, levels, 0U);
+}
+
+/**
+ * @tc.name: invalidData
+ * @tc.desc: Tests that unsupported and inconsistent ktx2 files are rejected
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageLoaderKtx2Test, invalidData, testing::ext::TestSize.Level1)
+{
+    auto loader = CreateImageLoaderKtx2(nullptr);
+    ASSERT_TRUE(loader);
+    const Ktx2Desc desc;
+    const auto bytes = CreateKtx2(desc);
+
+    auto invalid = bytes;
+    invalid[5U] = '1';
+    EXPECT_FALSE(loader->CanLoad(invalid));
+    EXPECT_FALSE(loader->Load(invalid, 0U).success);
+
+    for (const size_t size : {size_t(0U), size_t(79U), size_t(100U), bytes.size() - 1U}) {
+        EXPECT_FALSE(loader->Load(array_view<const uint8_t>(bytes.data(), size), 0U).success) << size;
+    }
+
+    // Basis Universal (e.g. glTF KHR_texture_basisu) needs transcoding, which is not supported.
+    Ktx2Desc basis = desc;
+    basis.vkFormat = Format::BASE_FORMAT_UNDEFINED;
+    basis.supercompressionScheme = SUPERCOMPRESSION_BASIS_LZ;
+    auto result = loader->Load(CreateKtx2(basis), 0U);
+    EXPECT_FALSE(result.success);
+    EXPECT_STREQ("Ktx2 Basis Universal transcoding not supported.", result.error);
+    // UASTC without supercompression.
+    basis.supercompressionScheme = 0U;
+    result = loader->Load(CreateKtx2(basis), 0U);
+    EXPECT_FALSE(result.success);
+    EXPECT_STREQ("Ktx2 Basis Universal transcoding not supported.", result.error);
+
+    // Level sizes must match the dimensions.
+    auto levels = CreateLevels(desc);
+    levels[1U].pop_back();
+    EXPECT_FALSE(loader->Load(CreateKtx2(desc, levels, levels), 0U).success);
+
+    // More levels than the dimensions allow.
+    Ktx2Desc tooManyLevels = desc;
+    tooManyLevels.levelCount = 4U;
+    EXPECT_FALSE(loader->Load(CreateKtx2(tooManyLevels), 0U).success);
+}
+
+#if defined(USE_ZSTD) && (USE_ZSTD == 1)
+/**
+ * @tc.name: loadZstd
+ * @tc.desc: Tests loading a ktx2 file with Zstandard supercompressed levels
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageLoaderKtx2Test, loadZstd, testing::ext::TestSize.Level1)
+{
+    auto loader = CreateImageLoaderKtx2(nullptr);
+    ASSERT_TRUE(loader);
+    Ktx2Desc desc;
+    desc.supercompressionScheme = SUPERCOMPRESSION_ZSTD;
+    const auto levels = CreateLevels(desc);
+    std::vector<std::vector<uint8_t>> compressed;
+    for (const auto& level : levels) {
+        std::vector<uint8_t> data(ZSTD_compressBound(level.size()));
+        const size_t size = ZSTD_compress(data.data(), data.size(), level.data(), level.size(), 1);
+        ASSERT_FALSE(ZSTD_isError(size));
+        data.resize(size);
+        compressed.push_back(data);
+    }
+    const auto bytes = CreateKtx2(desc, levels, compressed);
+
+    auto result = loader->Load(bytes, 0U);
+    ASSERT_TRUE(result.success) << result.error;
+    EXPECT_EQ(result.image->GetImageDesc().bitsPerBlock, 32U);
+    EXPECT_EQ(result.image->GetImageDesc().mipCount, 3U);
+    ExpectLevels(*result.image, levels, 0U);
+
+    result = loader->Load(bytes, IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_2X);
+    ASSERT_TRUE(result.success) << result.error;
+    ExpectLevels(*result.image, levels, 1U);
+
+    // Level 0 is stored last, break the magic number of its frame.
+    auto corrupted = bytes;
+    corrupted[bytes.size() - compressed[0U].size()] ^= 0xFFU;
+    EXPECT_FALSE(loader->Load(corrupted, 0U).success);
+}
+#endif
@@ -14,10 +14,15 @@
  */
 
 #include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <string_view>
+#include <vector>
 
 #include <base/util/formats.h>
+#include <core/implementation_uids.h>
 #include <core/io/intf_file_manager.h>
+#include <core/threading/intf_thread_pool.h>
 
 #include "test_framework.h"
 
@@ -26,6 +31,7 @@
 #else
 #include "test_runner.h"
 #endif
+#include "image/image_cache.h"
 #include "image/image_loader_manager.h"
 #include "image/loaders/image_loader_ktx.h"
 #if (USE_STB_IMAGE == 1)
@@ -177,6 +183,57 @@ UNIT_TEST(SRC_ImageManagerTest, basicLoadImage, testing::ext::TestSize.Level1)
 }
 #endif
 
+/**
+ * @tc.name: loadMappedImage
+ * @tc.desc: Tests that an image loaded from a memory mapped file matches the same image loaded from a buffer.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageManagerTest, loadMappedImage, testing::ext::TestSize.Level1)
+{
+    auto& files = CORE_NS::UTest::GetTestEnv()->fileManager;
+    ASSERT_TRUE(files != nullptr);
+    auto imageManager = CreateImageLoaderManager();
+    ASSERT_TRUE(imageManager != nullptr);
+
+    // Large enough to be mapped when opened read-only.
+    auto file = files->OpenFile("test://image/cubemap_yokohama_RGBA8.ktx", IFile::Mode::READ_ONLY);
+    ASSERT_TRUE(file != nullptr);
+    const auto data = file->GetData();
+    ASSERT_FALSE(data.empty());
+    ASSERT_EQ(data.size(), file->GetLength());
+    const std::vector<uint8_t> bytes(data.begin(), data.end());
+
+    auto mapped = imageManager->LoadImage(*file, 0);
+    ASSERT_TRUE(mapped.success) << mapped.error;
+    ASSERT_TRUE(mapped.image != nullptr);
+
+    auto copied = imageManager->LoadImage(array_view<const uint8_t>(bytes.data(), bytes.size()), 0);
+    ASSERT_TRUE(copied.success) << copied.error;
+    ASSERT_TRUE(copied.image != nullptr);
+
+    const auto& mappedDesc = mapped.image->GetImageDesc();
+    const auto& copiedDesc = copied.image->GetImageDesc();
+    EXPECT_EQ(mappedDesc.format, copiedDesc.format);
+    EXPECT_EQ(mappedDesc.width, copiedDesc.width);
+    EXPECT_EQ(mappedDesc.height, copiedDesc.height);
+    EXPECT_EQ(mappedDesc.layerCount, copiedDesc.layerCount);
+    EXPECT_EQ(mappedDesc.mipCount, copiedDesc.mipCount);
+    ASSERT_EQ(mapped.image->GetData().size(), copied.image->GetData().size());
+    EXPECT_TRUE(std::equal(
+        mapped.image->GetData().begin(), mapped.image->GetData().end(), copied.image->GetData().begin()));
+
+    // The image owns its pixels, closing the mapping must not invalidate them.
+    const std::vector<uint8_t> pixels(mapped.image->GetData().begin(), mapped.image->GetData().end());
+    file->Close();
+    EXPECT_TRUE(std::equal(pixels.begin(), pixels.end(), mapped.image->GetData().begin()));
+
+    // Going through the uri takes the same path.
+    auto byUri = imageManager->LoadImage("test://image/cubemap_yokohama_RGBA8.ktx", 0);
+    ASSERT_TRUE(byUri.success) << byUri.error;
+    ASSERT_TRUE(byUri.image != nullptr);
+    EXPECT_EQ(byUri.image->GetData().size(), pixels.size());
+}
+
 /**
  * @tc.name: loadAnimatedImage
  * @tc.desc: Tests for Load Animated Image. [AUTO-GENERATED]
@@ -2223,3 +2280,276 @@ UNIT_TEST(SRC_ImageManagerTest, imageNotLoaded, testing::ext::TestSize.Level1)
         ASSERT_FALSE(result.success);
     }
 }
+
+namespace {
+using AsyncLoadStatus = IImageLoaderManager::AsyncLoadStatus;
+using LoadPriority = IImageLoaderManager::LoadPriority;
+constexpr string_view ASYNC_TEST_IMAGE = "test://image/cubemap_yokohama_RGBA8.ktx";
+
+// Records the order of completed loads. Optionally blocks the decoding thread until released.
+class RecordingListener final : public IImageLoaderManager::IAsyncLoadListener {
+public:
+    explicit RecordingListener(bool block = false) : blocked_(block) {}
+    ~RecordingListener() override = default;
+
+    void OnImageLoaded(size_t index, IImageLoaderManager::LoadResult& result) override
+    {
+        std::unique_lock lock(mutex_);
+        loaded_.push_back(index);
+        started_ = true;
+        changed_.notify_all();
+        changed_.wait(lock, [this]() { return !blocked_; });
+    }
+
+    void WaitStarted()
+    {
+        std::unique_lock lock(mutex_);
+        changed_.wait(lock, [this]() { return started_; });
+    }
+
+    void Release()
+    {
+        std::lock_guard lock(mutex_);
+        blocked_ = false;
+        changed_.notify_all();
+    }
+
+    std::vector<size_t> GetLoaded()
+    {
+        std::lock_guard lock(mutex_);
+        return loaded_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::vector<size_t> loaded_;
+    bool blocked_{false};
+    bool started_{false};
+};
+
+IThreadPool::Ptr CreateThreadPool(uint32_t threadCount)
+{
+    const auto factory = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    return factory ? factory->CreateThreadPool(threadCount) : IThreadPool::Ptr{};
+}
+
+// Creates the pool only when asked for it and counts how many times that happened.
+class CountingThreadPoolProvider final : public ImageLoaderManager::IThreadPoolProvider {
+public:
+    const IThreadPool::Ptr& GetThreadPool() override
+    {
+        ++calls_;
+        if (!threadPool_) {
+            threadPool_ = CreateThreadPool(1U);
+        }
+        return threadPool_;
+    }
+
+    uint32_t calls_{0U};
+    IThreadPool::Ptr threadPool_;
+};
+}  // namespace
+
+/**
+ * @tc.name: loadImagesAsync
+ * @tc.desc: Tests that LoadImagesAsync decodes every request and reports each one to the listener.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageManagerTest, loadImagesAsync, testing::ext::TestSize.Level1)
+{
+    auto threadPool = CreateThreadPool(2U);
+    ASSERT_TRUE(threadPool);
+    ImageLoaderManager imageManager(*CORE_NS::UTest::GetTestEnv()->fileManager, threadPool);
+
+    RecordingListener listener;
+    const IImageLoaderManager::AsyncLoadRequest requests[] = {
+        {ASYNC_TEST_IMAGE, 0U, LoadPriority::LOW},
+        {"test://image/notExisting.ktx", 0U, LoadPriority::NORMAL},
+        {ASYNC_TEST_IMAGE, IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY, LoadPriority::HIGH},
+    };
+    auto loads = imageManager.LoadImagesAsync(requests, &listener);
+    ASSERT_EQ(loads.size(), 3U);
+    for (auto& load : loads) {
+        load->Wait();
+        EXPECT_EQ(load->GetStatus(), AsyncLoadStatus::DONE);
+    }
+    EXPECT_TRUE(loads[0U]->GetResult().success);
+    EXPECT_TRUE(loads[0U]->GetResult().image);
+    EXPECT_FALSE(loads[1U]->GetResult().success);
+    EXPECT_TRUE(loads[2U]->GetResult().success);
+
+    auto loaded = listener.GetLoaded();
+    std::sort(loaded.begin(), loaded.end());
+    EXPECT_EQ(loaded, (std::vector<size_t>{0U, 1U, 2U}));
+
+    // without a thread pool the images are loaded before returning.
+    ImageLoaderManager syncManager(*CORE_NS::UTest::GetTestEnv()->fileManager);
+    auto syncLoads = syncManager.LoadImagesAsync(requests, nullptr);
+    ASSERT_EQ(syncLoads.size(), 3U);
+    EXPECT_EQ(syncLoads[0U]->GetStatus(), AsyncLoadStatus::DONE);
+    EXPECT_TRUE(syncLoads[0U]->GetResult().success);
+}
+
+/**
+ * @tc.name: loadImagesAsyncLazyThreadPool
+ * @tc.desc: Tests that the thread pool is asked for only when the first asynchronous load is requested.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageManagerTest, loadImagesAsyncLazyThreadPool, testing::ext::TestSize.Level1)
+{
+    CountingThreadPoolProvider provider;
+    ImageLoaderManager imageManager(*CORE_NS::UTest::GetTestEnv()->fileManager, provider);
+    auto result = imageManager.LoadImage(ASYNC_TEST_IMAGE, 0U);
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(provider.calls_, 0U);
+    EXPECT_FALSE(provider.threadPool_);
+
+    const IImageLoaderManager::AsyncLoadRequest request{ASYNC_TEST_IMAGE, 0U, LoadPriority::NORMAL};
+    for (uint32_t i = 0U; i < 2U; ++i) {
+        auto loads = imageManager.LoadImagesAsync({&request, 1U}, nullptr);
+        ASSERT_EQ(loads.size(), 1U);
+        loads[0U]->Wait();
+        EXPECT_EQ(loads[0U]->GetStatus(), AsyncLoadStatus::DONE);
+        EXPECT_TRUE(loads[0U]->GetResult().success);
+    }
+    EXPECT_EQ(provider.calls_, 1U);
+    EXPECT_TRUE(provider.threadPool_);
+}
+
+/**
+ * @tc.name: loadImagesAsyncPriorityAndCancel
+ * @tc.desc: Tests that queued loads start in priority order and that pending loads can be cancelled.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageManagerTest, loadImagesAsyncPriorityAndCancel, testing::ext::TestSize.Level1)
+{
+    auto threadPool = CreateThreadPool(1U);
+    ASSERT_TRUE(threadPool);
+    ImageLoaderManager imageManager(*CORE_NS::UTest::GetTestEnv()->fileManager, threadPool);
+
+    // keep the only thread busy so that the following loads stay queued.
+    RecordingListener blocker(true);
+    const IImageLoaderManager::AsyncLoadRequest blockingRequest{ASYNC_TEST_IMAGE, 0U, LoadPriority::NORMAL};
+    auto blocking = imageManager.LoadImagesAsync({&blockingRequest, 1U}, &blocker);
+    blocker.WaitStarted();
+
+    RecordingListener listener;
+    const IImageLoaderManager::AsyncLoadRequest requests[] = {
+        {ASYNC_TEST_IMAGE, 0U, LoadPriority::LOW},
+        {ASYNC_TEST_IMAGE, 0U, LoadPriority::NORMAL},
+        {ASYNC_TEST_IMAGE, 0U, LoadPriority::HIGH},
+    };
+    auto loads = imageManager.LoadImagesAsync(requests, &listener);
+    ASSERT_EQ(loads.size(), 3U);
+    EXPECT_EQ(loads[1U]->GetStatus(), AsyncLoadStatus::PENDING);
+    EXPECT_TRUE(loads[1U]->Cancel());
+    EXPECT_EQ(loads[1U]->GetStatus(), AsyncLoadStatus::CANCELLED);
+    EXPECT_FALSE(loads[1U]->GetResult().success);
+    // the running load cannot be cancelled.
+    EXPECT_FALSE(blocking[0U]->Cancel());
+
+    blocker.Release();
+    for (auto& load : loads) {
+        load->Wait();
+    }
+    EXPECT_EQ(blocking[0U]->GetStatus(), AsyncLoadStatus::DONE);
+    EXPECT_EQ(loads[0U]->GetStatus(), AsyncLoadStatus::DONE);
+    EXPECT_EQ(loads[2U]->GetStatus(), AsyncLoadStatus::DONE);
+    EXPECT_EQ(listener.GetLoaded(), (std::vector<size_t>{2U, 0U}));
+}
+
+/**
+ * @tc.name: imageCache
+ * @tc.desc: Tests that repeated loads of the same image are served from the decoded image cache.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageManagerTest, imageCache, testing::ext::TestSize.Level1)
+{
+    auto imageManager = CreateImageLoaderManager();
+    ASSERT_TRUE(imageManager != nullptr);
+
+    // disabled by default.
+    {
+        auto first = imageManager->LoadImage(ASYNC_TEST_IMAGE, 0U);
+        auto second = imageManager->LoadImage(ASYNC_TEST_IMAGE, 0U);
+        ASSERT_TRUE(first.success && second.success);
+        EXPECT_NE(first.image->GetData().data(), second.image->GetData().data());
+        EXPECT_EQ(imageManager->GetImageCacheStatistics().misses, 0U);
+    }
+
+    imageManager->SetImageCacheBudget(64U * 1024U * 1024U);
+    auto first = imageManager->LoadImage(ASYNC_TEST_IMAGE, 0U);
+    auto second = imageManager->LoadImage(ASYNC_TEST_IMAGE, 0U);
+    ASSERT_TRUE(first.success && second.success);
+    // the decoded data is shared.
+    EXPECT_EQ(first.image->GetData().data(), second.image->GetData().data());
+    EXPECT_EQ(first.image->GetImageDesc().width, second.image->GetImageDesc().width);
+
+    // different flags are cached separately.
+    auto metadata = imageManager->LoadImage(ASYNC_TEST_IMAGE, IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY);
+    ASSERT_TRUE(metadata.success);
+
+    // loads from memory are cached by content.
+    auto file = CORE_NS::UTest::GetTestEnv()->fileManager->OpenFile(ASYNC_TEST_IMAGE);
+    ASSERT_TRUE(file);
+    std::vector<uint8_t> bytes(static_cast<size_t>(file->GetLength()));
+    file->Read(bytes.data(), bytes.size());
+    auto fromMemory = imageManager->LoadImage({bytes.data(), bytes.size()}, 0U);
+    auto fromMemoryAgain = imageManager->LoadImage({bytes.data(), bytes.size()}, 0U);
+    ASSERT_TRUE(fromMemory.success && fromMemoryAgain.success);
+    EXPECT_EQ(fromMemory.image->GetData().data(), fromMemoryAgain.image->GetData().data());
+
+    auto statistics = imageManager->GetImageCacheStatistics();
+    EXPECT_EQ(statistics.hits, 2U);
+    EXPECT_EQ(statistics.misses, 3U);
+    EXPECT_EQ(statistics.imageCount, 3U);
+    EXPECT_GE(statistics.bytes, first.image->GetData().size());
+
+    // cleared images stay valid for their users.
+    imageManager->ClearImageCache();
+    EXPECT_EQ(imageManager->GetImageCacheStatistics().imageCount, 0U);
+    EXPECT_EQ(first.image->GetData().size(), second.image->GetData().size());
+    auto third = imageManager->LoadImage(ASYNC_TEST_IMAGE, 0U);
+    ASSERT_TRUE(third.success);
+    EXPECT_NE(first.image->GetData().data(), third.image->GetData().data());
+
+    // a budget smaller than the image disables caching it.
+    imageManager->ClearImageCache();
+    imageManager->SetImageCacheBudget(1U);
+    imageManager->LoadImage(ASYNC_TEST_IMAGE, 0U);
+    EXPECT_EQ(imageManager->GetImageCacheStatistics().imageCount, 0U);
+}
+
+/**
+ * @tc.name: imageCacheMetadataOnly
+ * @tc.desc: Tests that images without decoded data are charged against the cache budget, so their number is bounded.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ImageManagerTest, imageCacheMetadataOnly, testing::ext::TestSize.Level1)
+{
+    auto imageManager = CreateImageLoaderManager();
+    ASSERT_TRUE(imageManager != nullptr);
+
+    constexpr size_t maxImageCount = 4U;
+    constexpr uint32_t loadFlags = IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY;
+    ImageCache cache;
+    cache.SetBudget(maxImageCount * ImageCache::MIN_ENTRY_BYTES);
+    constexpr uint32_t imageCount = 3U * maxImageCount;
+    for (uint32_t idx = 0U; idx < imageCount; ++idx) {
+        auto result = imageManager->LoadImage(ASYNC_TEST_IMAGE, loadFlags);
+        ASSERT_TRUE(result.success);
+        ASSERT_TRUE(result.image->GetData().empty());
+        auto cached = cache.Add(ImageCache::UriKey("test://metadata" + BASE_NS::to_string(idx), loadFlags),
+            BASE_NS::move(result.image));
+        ASSERT_TRUE(cached);
+        EXPECT_LE(cache.GetStatistics().imageCount, maxImageCount);
+    }
+    const auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.imageCount, maxImageCount);
+    EXPECT_EQ(statistics.bytes, maxImageCount * ImageCache::MIN_ENTRY_BYTES);
+
+    // the least recently used ones were evicted.
+    EXPECT_FALSE(cache.Find(ImageCache::UriKey("test://metadata0", loadFlags)));
+    EXPECT_TRUE(cache.Find(ImageCache::UriKey("test://metadata" + BASE_NS::to_string(imageCount - 1U), loadFlags)));
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include <base/math/mathf.h>
+#include <core/image/pixel_conversion.h>
+
+#include "test_framework.h"
+
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace CORE_NS;
+
+namespace {
+// Every combination of an 8 bit value and alpha, plus a few pixels so that the SIMD loops also leave a tail.
+constexpr size_t PIXEL_COUNT = 256U * 256U + 13U;
+
+// The byte at a time lookup table the loaders used before.
+std::vector<uint8_t> CreateReferenceTable()
+{
+    std::vector<uint8_t> table(256U * 256U);
+    for (uint32_t a = 0; a < 256U; a++) {
+        const float alpha = static_cast<float>(a) / 255.f;
+        for (uint32_t sRGB = 0; sRGB < 256U; sRGB++) {
+            float color = static_cast<float>(sRGB) / 255.f;
+            if (color <= 0.04045f) {
+                color *= (1.f / 12.92f);
+            } else {
+                color = BASE_NS::Math::pow((color + 0.055f) * (1.f / 1.055f), 2.4f);
+            }
+            float premultiplied = color * alpha;
+            if (premultiplied <= 0.0031308f) {
+                premultiplied *= 12.92f;
+            } else {
+                premultiplied = 1.055f * BASE_NS::Math::pow(premultiplied, 1.f / 2.4f) - 0.055f;
+            }
+            table[a * 256U + sRGB] = static_cast<uint8_t>(BASE_NS::Math::round(premultiplied * 255.f));
+        }
+    }
+    return table;
+}
+
+void ReferencePremultiply(
+    std::vector<uint8_t>& pixels, uint32_t channelCount, bool linear, const std::vector<uint8_t>& table)
+{
+    for (size_t i = 0U; i < pixels.size(); i += channelCount) {
+        const uint32_t alpha = pixels[i + channelCount - 1U];
+        for (uint32_t j = 0U; j < channelCount - 1U; j++) {
+            uint8_t& value = pixels[i + j];
+            value = linear ? static_cast<uint8_t>(value * alpha / 0xff) : table[alpha * 256U + value];
+        }
+    }
+}
+
+// Pixel i has the color i % 256 in the first channel and alpha i / 256, the other channels get other patterns.
+std::vector<uint8_t> CreatePixels(uint32_t channelCount)
+{
+    std::vector<uint8_t> pixels(PIXEL_COUNT * channelCount);
+    for (size_t i = 0U; i < PIXEL_COUNT; ++i) {
+        uint8_t* pixel = pixels.data() + i * channelCount;
+        for (uint32_t j = 0U; j < channelCount - 1U; j++) {
+            pixel[j] = static_cast<uint8_t>(i * (j * 2U + 1U));
+        }
+        pixel[channelCount - 1U] = static_cast<uint8_t>(i >> 8U);
+    }
+    return pixels;
+}
+}  // namespace
+
+/**
+ * @tc.name: premultiplyAlphaParity
+ * @tc.desc: Tests that premultiplying 8 bit linear and sRGB pixels matches the byte at a time lookup table path
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_PixelConversionTest, premultiplyAlphaParity, testing::ext::TestSize.Level1)
+{
+    const std::vector<uint8_t> table = CreateReferenceTable();
+    for (const uint32_t channelCount : {2U, 4U}) {
+        for (const bool linear : {true, false}) {
+            std::vector<uint8_t> expected = CreatePixels(channelCount);
+            std::vector<uint8_t> pixels = expected;
+            ReferencePremultiply(expected, channelCount, linear, table);
+            EXPECT_TRUE(PixelConversion::PremultiplyAlpha(pixels.data(), PIXEL_COUNT, channelCount, 1U, linear));
+            EXPECT_TRUE(pixels == expected) << "channels " << channelCount << " linear " << linear;
+        }
+    }
+}
+
+/**
+ * @tc.name: premultiplyAlphaFormats
+ * @tc.desc: Tests 16 bit premultiplication, formats without alpha and unsupported channel sizes
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_PixelConversionTest, premultiplyAlphaFormats, testing::ext::TestSize.Level1)
+{
+    uint16_t rgba16[] = {0xffff, 0x8000, 0x1234, 0x8000, 0x4000, 0xffff, 0x0000, 0xffff};
+    EXPECT_TRUE(PixelConversion::PremultiplyAlpha(reinterpret_cast<uint8_t*>(rgba16), 2U, 4U, 2U, true));
+    EXPECT_EQ(rgba16[0], 0x8000);
+    EXPECT_EQ(rgba16[1], 0x4000);
+    EXPECT_EQ(rgba16[2], 0x1234 * 0x8000 / 0xffff);
+    EXPECT_EQ(rgba16[3], 0x8000);
+    EXPECT_EQ(rgba16[4], 0x4000);
+    EXPECT_EQ(rgba16[5], 0xffff);
+
+    // without alpha nothing is changed.
+    uint8_t rgb[] = {10, 20, 30, 40, 50, 60};
+    EXPECT_TRUE(PixelConversion::PremultiplyAlpha(rgb, 2U, 3U, 1U, false));
+    EXPECT_EQ(rgb[3], 40);
+
+    uint8_t rgba32[16] = {};
+    EXPECT_FALSE(PixelConversion::PremultiplyAlpha(rgba32, 1U, 4U, 4U, true));
+}
+
+/**
+ * @tc.name: flipVertically
+ * @tc.desc: Tests flipping images with row sizes below, at and above the SIMD block size and odd and even heights
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_PixelConversionTest, flipVertically, testing::ext::TestSize.Level1)
+{
+    for (const size_t rowSize : {3U, 16U, 37U}) {
+        for (const uint32_t height : {0U, 1U, 2U, 5U, 6U}) {
+            std::vector<uint8_t> original(rowSize * height);
+            for (size_t i = 0U; i < original.size(); ++i) {
+                original[i] = static_cast<uint8_t>(i * 7U + (i >> 8U));
+            }
+            std::vector<uint8_t> flipped = original;
+            PixelConversion::FlipVertically(flipped.data(), rowSize, height);
+            for (uint32_t y = 0U; y < height; ++y) {
+                EXPECT_EQ(
+                    std::memcmp(original.data() + y * rowSize, flipped.data() + (height - 1U - y) * rowSize, rowSize),
+                    0);
+            }
+        }
+    }
+}
@@ -14,6 +14,7 @@
  */
 
 #include <chrono>
+#include <cstring>
 #include <filesystem>
 #include <thread>
 
@@ -33,6 +34,7 @@
 #endif
 #include "io/dev/file_monitor.h"
 #include "io/file_manager.h"
+#include "io/mapped_file.h"
 #include "io/memory_file.h"
 #include "io/path_tools.h"
 #include "io/std_directory.h"
@@ -1259,4 +1261,81 @@ UNIT_TEST(SRC_IoTest, fileModeTest, testing::ext::TestSize.Level1)
     files->DeleteFile(fileName);
 
     EXPECT_FALSE(StdFile::Create("", IFile::Mode::READ_WRITE));
-}
\ No newline at end of file
+}
+/**
+ * @tc.name: mappedFileTest
+ * @tc.desc: Tests that large read-only files are memory mapped and give the same data as reading them.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_IoTest, mappedFileTest, testing::ext::TestSize.Level1)
+{
+    auto& files = CORE_NS::UTest::GetTestEnv()->fileManager;
+    ASSERT_TRUE(files != nullptr);
+
+    constexpr const string_view largeName = "app:///testMappedLarge.dat";
+    constexpr const string_view smallName = "app:///testMappedSmall.dat";
+    vector<uint8_t> contents(256U * 1024U);
+    for (size_t i = 0U; i < contents.size(); ++i) {
+        contents[i] = static_cast<uint8_t>(i * 7U + (i >> 8U));
+    }
+    string path;
+    {
+        auto file = files->CreateFile(largeName);
+        ASSERT_TRUE(file);
+        ASSERT_EQ(file->Write(contents.data(), contents.size()), contents.size());
+        path = files->GetEntry(largeName).name;
+        file->Close();
+    }
+    {
+        auto file = files->CreateFile(smallName);
+        ASSERT_TRUE(file);
+        ASSERT_EQ(file->Write(contents.data(), 16U), 16U);
+    }
+    {
+        // read-only files above the threshold are mapped, small and writable ones are not.
+        auto file = files->OpenFile(largeName, IFile::Mode::READ_ONLY);
+        ASSERT_TRUE(file);
+        const auto data = file->GetData();
+        ASSERT_EQ(data.size(), contents.size());
+        EXPECT_EQ(memcmp(data.data(), contents.data(), contents.size()), 0);
+
+        auto small = files->OpenFile(smallName, IFile::Mode::READ_ONLY);
+        ASSERT_TRUE(small);
+        EXPECT_TRUE(small->GetData().empty());
+
+        auto writable = files->OpenFile(largeName, IFile::Mode::READ_WRITE);
+        ASSERT_TRUE(writable);
+        EXPECT_TRUE(writable->GetData().empty());
+    }
+    {
+        EXPECT_FALSE(MappedFile::Open(path + ".missing"));
+
+        auto file = MappedFile::Open(path);
+        ASSERT_TRUE(file);
+        EXPECT_EQ(file->GetMode(), IFile::Mode::READ_ONLY);
+        EXPECT_EQ(file->GetLength(), contents.size());
+
+        uint8_t buffer[64U];
+        ASSERT_TRUE(file->Seek(1000U));
+        ASSERT_EQ(file->Read(buffer, sizeof(buffer)), sizeof(buffer));
+        EXPECT_EQ(memcmp(buffer, contents.data() + 1000U, sizeof(buffer)), 0);
+        EXPECT_EQ(file->GetPosition(), 1000U + sizeof(buffer));
+
+        // reads are clamped to the end of the file.
+        ASSERT_TRUE(file->Seek(contents.size() - 10U));
+        EXPECT_EQ(file->Read(buffer, sizeof(buffer)), 10U);
+        EXPECT_EQ(memcmp(buffer, contents.data() + contents.size() - 10U, 10U), 0);
+        EXPECT_EQ(file->Read(buffer, sizeof(buffer)), 0U);
+        EXPECT_FALSE(file->Seek(contents.size() + 1U));
+
+        EXPECT_EQ(file->Write(buffer, sizeof(buffer)), 0U);
+        EXPECT_EQ(file->Append(buffer, sizeof(buffer), 0U), 0U);
+
+        file->Close();
+        EXPECT_EQ(file->GetMode(), IFile::Mode::INVALID);
+        EXPECT_TRUE(file->GetData().empty());
+        EXPECT_EQ(file->Read(buffer, sizeof(buffer)), 0U);
+    }
+    files->DeleteFile(largeName);
+    files->DeleteFile(smallName);
+}
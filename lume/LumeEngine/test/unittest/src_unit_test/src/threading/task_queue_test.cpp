@@ -610,3 +610,80 @@ UNIT_TEST(SRC_TaskQueueTest, testThreadPool, testing::ext::TestSize.Level1)
         EXPECT_EQ(gStorage.data[2], 3);
     }
 }
+
+/**
+ * @tc.name: testWorkStealingThreadPool
+ * @tc.desc: Tests dependency handling of the work stealing thread pool.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_TaskQueueTest, testWorkStealingThreadPool, testing::ext::TestSize.Level1)
+{
+    const auto factory = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    auto threadPool = factory->CreateThreadPool(4U, ITaskQueueFactory::ThreadPoolType::WORK_STEALING);
+    ASSERT_TRUE(threadPool);
+    EXPECT_EQ(threadPool->GetNumberOfThreads(), 4U);
+    {
+        auto resetTask = FunctionTask::Create([]() {
+            wait(100);
+            gStorage.reset();
+        });
+        auto task1 = FunctionTask::Create([]() {
+            gStorage.store(1);
+            wait(50);
+        });
+        auto task2 = FunctionTask::Create([]() {
+            wait(50);
+            gStorage.store(2);
+        });
+        auto task3 = FunctionTask::Create([]() { gStorage.store(3); });
+
+        const auto* resetTaskPtr = resetTask.get();
+        threadPool->PushNoWait(BASE_NS::move(resetTask));
+
+        // two tasks which should wait for the reset task.
+        const CORE_NS::IThreadPool::ITask* deps0[] = {resetTaskPtr};
+        const CORE_NS::IThreadPool::ITask* deps12[] = {task1.get(), task2.get()};
+        threadPool->PushNoWait(BASE_NS::move(task1), deps0);
+        threadPool->PushNoWait(BASE_NS::move(task2), deps0);
+
+        // one more task which should start after the above tasks.
+        auto result = threadPool->Push(BASE_NS::move(task3), deps12);
+        EXPECT_FALSE(result->IsDone());
+        result->Wait();
+        EXPECT_TRUE(result->IsDone());
+
+        ASSERT_EQ(gStorage.data.size(), 3);
+        EXPECT_EQ(gStorage.data[2], 3);
+    }
+    // a long dependency chain must execute in order.
+    {
+        gStorage.reset();
+        constexpr int chainLength = 1000;
+        const CORE_NS::IThreadPool::ITask* previous = nullptr;
+        CORE_NS::IThreadPool::IResult::Ptr result;
+        for (int i = 0; i < chainLength; ++i) {
+            auto task = FunctionTask::Create([i]() { gStorage.store(i); });
+            const auto* taskPtr = task.get();
+            if (previous) {
+                const CORE_NS::IThreadPool::ITask* deps[] = {previous};
+                result = threadPool->Push(BASE_NS::move(task), deps);
+            } else {
+                result = threadPool->Push(BASE_NS::move(task));
+            }
+            previous = taskPtr;
+        }
+        result->Wait();
+        gStorage.checkValidity(chainLength);
+    }
+    // parallel queues on top of the pool.
+    {
+        ParallelTaskQueue queue(threadPool);
+        queue.Submit(0, FunctionTask::Create([]() { gStorage.reset(); }));
+        queue.SubmitAfter(0, 1, FunctionTask::Create([]() { gStorage.store(1); }));
+        queue.SubmitAfter(1, 2, FunctionTask::Create([]() { gStorage.store(2); }));
+        constexpr const uint64_t afterIds[] = {2, 0};
+        queue.SubmitAfter(afterIds, 3, FunctionTask::Create([]() { gStorage.store(3); }));
+        queue.Execute();
+        gStorage.checkValidity(3);
+    }
+}
@@ -547,3 +547,57 @@ UNIT_TEST(SRC_FrustumUtilTest, FrustumUtil_SphereFrustumAllPlaneTests, testing::
         EXPECT_TRUE(result) << "Sphere should be inside " << test.planeName << " plane";
     }
 }
+
+/**
+ * @tc.name: FrustumUtil_SphereFrustumCollision_Batch
+ * @tc.desc: Tests that batched sphere culling matches testing the spheres one by one
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_FrustumUtilTest, FrustumUtil_SphereFrustumCollision_Batch, testing::ext::TestSize.Level1)
+{
+    FrustumUtil frustumUtil;
+
+    const Frustum frustums[] = {
+        frustumUtil.CreateFrustum(Math::PerspectiveRhNo(1.57f, 16.0f / 9.0f, 0.1f, 100.0f)),
+        frustumUtil.CreateFrustum(Math::OrthoRhNo(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 50.0f)),
+    };
+
+    // count which isn't a multiple of the SIMD width or the bitmask word size.
+    constexpr size_t count = 203U;
+    BASE_NS::vector<float> centerX(count);
+    BASE_NS::vector<float> centerY(count);
+    BASE_NS::vector<float> centerZ(count);
+    BASE_NS::vector<float> radius(count);
+    for (size_t i = 0; i < count; ++i) {
+        centerX[i] = static_cast<float>(i % 41U) - 20.0f;
+        centerY[i] = static_cast<float>(i % 23U) - 11.0f;
+        centerZ[i] = -static_cast<float>(i % 131U);
+        radius[i] = static_cast<float>(i % 5U) * 0.5f;
+    }
+    const BoundingSpheres spheres{centerX, centerY, centerZ, radius};
+
+    constexpr size_t wordCount = (count + 63U) / 64U;
+    BASE_NS::vector<uint64_t> visibility(countof(frustums) * wordCount, ~0ULL);
+    ASSERT_TRUE(frustumUtil.SphereFrustumCollision(frustums, spheres, visibility));
+
+    size_t visible = 0U;
+    for (size_t f = 0; f < countof(frustums); ++f) {
+        for (size_t i = 0; i < count; ++i) {
+            const bool expected =
+                frustumUtil.SphereFrustumCollision(frustums[f], Vec3(centerX[i], centerY[i], centerZ[i]), radius[i]);
+            const bool result = (visibility[f * wordCount + i / 64U] >> (i % 64U)) & 1U;
+            EXPECT_EQ(expected, result) << "frustum " << f << " sphere " << i;
+            visible += expected ? 1U : 0U;
+        }
+        // unused bits of the last word are cleared.
+        EXPECT_EQ(visibility[f * wordCount + wordCount - 1U] >> (count % 64U), 0U);
+    }
+    EXPECT_GT(visible, 0U);
+    EXPECT_LT(visible, countof(frustums) * count);
+
+    // too small output or mismatching arrays are rejected.
+    EXPECT_FALSE(frustumUtil.SphereFrustumCollision(
+        frustums, spheres, BASE_NS::array_view<uint64_t>(visibility.data(), visibility.size() - 1U)));
+    const BoundingSpheres mismatch{centerX, centerY, centerZ, {radius.data(), count - 1U}};
+    EXPECT_FALSE(frustumUtil.SphereFrustumCollision(frustums, mismatch, visibility));
+}
@@ -20,9 +20,9 @@
 #include <jpeglib.h>
 #include <limits>
 #include <memory>
-#include <mutex>
 
 #include <base/math/mathf.h>
+#include <core/image/pixel_conversion.h>
 #include <core/io/intf_file_manager.h>
 #include <core/log.h>
 #include <core/namespace.h>
@@ -35,85 +35,21 @@ namespace {
 constexpr uint32_t MAX_IMAGE_EXTENT{32767U};
 constexpr int IMG_SIZE_LIMIT_2GB = std::numeric_limits<int>::max();
 
-uint8_t g_sRgbPremultiplyLookup[256u * 256u] = {0};
-std::once_flag g_sRgbPremultiplyLookupOnce;
-
-void InitializeSRGBTable()
+// libjpeg scales by scale_num / scale_denom while running the inverse DCT, so 1/2, 1/4 and 1/8 skip most of the work.
+uint32_t GetScaleDenominator(uint32_t loadFlags)
 {
-    // Generate lookup table to premultiply sRGB encoded image in linear space and reencoding it to sRGB
-    // Formulas from https://en.wikipedia.org/wiki/SRGB
-    for (uint32_t a = 0; a < 256u; a++) {
-        const float alpha = static_cast<float>(a) / 255.f;
-        for (uint32_t sRGB = 0; sRGB < 256u; sRGB++) {
-            float color = static_cast<float>(sRGB) / 255.f;
-            if (color <= 0.04045f) {
-                color *= (1.f / 12.92f);
-            } else {
-                color = pow((color + 0.055f) * (1.f / 1.055f), 2.4f);
-            }
-            float premultiplied = color * alpha;
-            if (premultiplied <= 0.0031308f) {
-                premultiplied *= 12.92f;
-            } else {
-                premultiplied = 1.055f * pow(premultiplied, 1.f / 2.4f) - 0.055f;
-            }
-            g_sRgbPremultiplyLookup[a * 256u + sRGB] = static_cast<uint8_t>(round(premultiplied * 255.f));
-        }
+    switch (loadFlags & IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_MASK) {
+        case IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_2X:
+            return 2U;
+        case IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_4X:
+            return 4U;
+        case IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_8X:
+            return 8U;
+        default:
+            return 1U;
     }
 }
 
-bool PremultiplyAlpha(
-    uint8_t* imageBytes, uint32_t width, uint32_t height, uint32_t channelCount, uint32_t bytesPerChannel, bool linear)
-{
-    // Only need to process images with color and alpha data. I.e. RGBA or grayscale + alpha.
-    if (channelCount != 4u && channelCount != 2u) {
-        return true;
-    }
-
-    const uint32_t pixelCount = width * height;
-
-    if (bytesPerChannel == 1) {
-        if (linear) {
-            uint8_t* img = imageBytes;
-            for (uint32_t i = 0; i < pixelCount; i++) {
-                // We know the alpha value is always last.
-                uint32_t alpha = img[channelCount - 1];
-                for (uint32_t j = 0; j < channelCount - 1; j++) {
-                    *img = static_cast<uint8_t>(*img * alpha / 0xff);
-                    img++;
-                }
-                img++;  // Skip over the alpha value.
-            }
-        } else {
-            std::call_once(g_sRgbPremultiplyLookupOnce, InitializeSRGBTable);
-            uint8_t* img = imageBytes;
-            for (uint32_t i = 0; i < pixelCount; i++) {
-                uint8_t* p = &g_sRgbPremultiplyLookup[img[channelCount - 1] * 256u];
-                for (uint32_t j = 0; j < channelCount - 1; j++) {
-                    *img = p[*img];
-                    img++;
-                }
-                img++;
-            }
-        }
-    } else if (bytesPerChannel == 2u) {
-        // Same for 16 bits per channel images.
-        uint16_t* img = reinterpret_cast<uint16_t*>(imageBytes);
-        for (uint32_t i = 0; i < pixelCount; i++) {
-            uint32_t alpha = img[channelCount - 1];
-            for (uint32_t j = 0; j < channelCount - 1; j++) {
-                *img = static_cast<uint16_t>(*img * alpha / 0xffff);
-                img++;
-            }
-            img++;
-        }
-    } else {
-        CORE_LOG_E("Format not supported.");
-        return false;
-    }
-    return true;
-}
-
 IImageLoaderManager::LoadResult ResultFailure(const string_view error)
 {
     IImageLoaderManager::LoadResult result{
@@ -264,12 +200,14 @@ public:
         if ((loadFlags & IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY) == 0) {
             if ((loadFlags & IImageLoaderManager::IMAGE_LOADER_PREMULTIPLY_ALPHA) != 0) {
                 const bool forceLinear = (loadFlags & IImageLoaderManager::IMAGE_LOADER_FORCE_LINEAR_RGB_BIT) != 0;
-                isPremultiplied = PremultiplyAlpha(static_cast<uint8_t*>(imageBytes.get()),
-                    imageWidth,
-                    imageHeight,
+                isPremultiplied = PixelConversion::PremultiplyAlpha(static_cast<uint8_t*>(imageBytes.get()),
+                    static_cast<size_t>(imageWidth) * imageHeight,
                     componentCount,
                     bytesPerComponent,
                     forceLinear);
+                if (!isPremultiplied) {
+                    CORE_LOG_E("Format not supported.");
+                }
             }
         }
 
@@ -416,8 +354,13 @@ public:
             return ResultFailure("Failed to load.");
         }
 
-        auto width = cinfo.image_width;
-        auto height = cinfo.image_height;
+        cinfo.scale_num = 1U;
+        cinfo.scale_denom = GetScaleDenominator(loadFlags);
+        // computes output_width and output_height for the scale without decoding anything.
+        jpeg_calc_output_dimensions(&cinfo);
+
+        auto width = cinfo.output_width;
+        auto height = cinfo.output_height;
         auto channels = static_cast<uint32_t>(cinfo.num_components);
         auto is16bpc = cinfo.data_precision > 8;
 
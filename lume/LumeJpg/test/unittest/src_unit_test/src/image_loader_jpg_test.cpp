@@ -1908,3 +1908,53 @@ HWTEST_F(ImageLoaderJPGTest, LoadFromBytes_MetadataOnly_GenerateMips_001, testin
     EXPECT_NE(desc.mipCount, 1u);
     EXPECT_TRUE(desc.imageFlags & IImageContainer::ImageFlags::FLAGS_REQUESTING_MIPMAPS_BIT);
 }
+
+// ==================== Reduced Resolution Decode ====================
+
+/**
+ * @tc.name: LoadFromBytes_Downscale_001
+ * @tc.desc: Verify the DOWNSCALE flags decode the 16x16 image at 1/2, 1/4 and 1/8 of its size
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageLoaderJPGTest, LoadFromBytes_Downscale_001, testing::ext::TestSize.Level1)
+{
+    auto view = array_view<const uint8_t>(VALID_JPEG_DATA, VALID_JPEG_SIZE);
+    const uint32_t scales[][2] = {
+        {IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_2X, 8u},
+        {IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_4X, 4u},
+        {IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_8X, 2u},
+    };
+    for (const auto& scale : scales) {
+        auto result = loader_->Load(view, scale[0]);
+        ASSERT_TRUE(result.success);
+        ASSERT_NE(result.image, nullptr);
+        const auto& desc = result.image->GetImageDesc();
+        EXPECT_EQ(desc.width, scale[1]);
+        EXPECT_EQ(desc.height, scale[1]);
+        const uint32_t bytesPerPixel = desc.bitsPerBlock / 8u;
+        EXPECT_EQ(result.image->GetData().size(), static_cast<size_t>(scale[1] * scale[1] * bytesPerPixel));
+        auto copies = result.image->GetBufferImageCopies();
+        ASSERT_EQ(copies.size(), 1u);
+        EXPECT_EQ(copies[0].width, scale[1]);
+        EXPECT_EQ(copies[0].height, scale[1]);
+    }
+}
+
+/**
+ * @tc.name: LoadFromBytes_Downscale_002
+ * @tc.desc: Verify METADATA_ONLY reports the reduced size and mip count of a downscaled decode
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageLoaderJPGTest, LoadFromBytes_Downscale_002, testing::ext::TestSize.Level1)
+{
+    auto view = array_view<const uint8_t>(VALID_JPEG_DATA, VALID_JPEG_SIZE);
+    uint32_t flags = IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY | IImageLoaderManager::IMAGE_LOADER_DOWNSCALE_4X |
+                     IImageLoaderManager::IMAGE_LOADER_GENERATE_MIPS;
+    auto result = loader_->Load(view, flags);
+    EXPECT_TRUE(result.success);
+    ASSERT_NE(result.image, nullptr);
+    auto desc = result.image->GetImageDesc();
+    EXPECT_EQ(desc.width, 4u);
+    EXPECT_EQ(desc.height, 4u);
+    EXPECT_EQ(desc.mipCount, 3u);
+}
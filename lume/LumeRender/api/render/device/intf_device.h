@@ -111,7 +111,9 @@ enum class DeviceBackendType {
     /** OpenGL backend */
     OPENGL,
     /** Maleoon backend */
-    MALEOON
+    MALEOON,
+    /** Null backend without GPU work, for measuring the CPU side of rendering */
+    NULL_BACKEND
 };
 
 /** @ingroup group_idevice */
@@ -524,6 +524,28 @@ public:
      */
     virtual uint32_t GetSamplerCount() const = 0;
 
+    /** Staging upload statistics of a frame. */
+    struct StagingStatistics {
+        /** Bytes copied through staging buffers in the frame. */
+        uint64_t uploadedByteSize{0U};
+        /** Bytes left for later frames because of the upload budget. */
+        uint64_t deferredByteSize{0U};
+        /** Byte size of the persistent staging ring buffer. */
+        uint32_t ringByteSize{0U};
+    };
+
+    /** Set the maximum number of bytes uploaded through staging per frame. Uploads over the budget are deferred to
+     * the next frames in the order they were created, and the contents of their resources are undefined until then.
+     * At least one upload is done every frame, and uploads which are scaled to the image size are never deferred.
+     * @param byteSize Upload budget in bytes. With zero there is no budget (default).
+     */
+    virtual void SetStagingUploadBudget(uint32_t byteSize) = 0;
+
+    /** Get staging upload statistics of the latest rendered frame.
+     * @return Staging statistics.
+     */
+    virtual StagingStatistics GetStagingStatistics() const = 0;
+
 protected:
     IGpuResourceManager() = default;
     virtual ~IGpuResourceManager() = default;
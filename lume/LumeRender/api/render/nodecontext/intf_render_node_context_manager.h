@@ -107,6 +107,8 @@ public:
     virtual IRenderContext& GetRenderContext() const = 0;
 
     /** Get render node context specific render node interface by UID.
+     * CORE_NS::IThreadPool::UID returns the renderer thread pool, if the renderer has one. Render nodes may use it
+     * with CORE_NS::ParallelFor during ExecuteFrame.
      */
     virtual CORE_NS::IInterface* GetRenderNodeContextInterface(const BASE_NS::Uid& uid) const = 0;
 
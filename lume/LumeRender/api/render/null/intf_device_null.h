@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef API_RENDER_NULL_IDEVICE_NULL_H
+#define API_RENDER_NULL_IDEVICE_NULL_H
+
+#include <cstdint>
+
+#include <render/device/intf_device.h>
+#include <render/namespace.h>
+
+RENDER_BEGIN_NAMESPACE()
+/** \addtogroup group_gfx_null_idevicenull
+ *  @{
+ */
+#if RENDER_HAS_NULL_BACKEND || (defined(DOXYGEN) && DOXYGEN)
+/** Statistics of the last frame processed by the null backend. */
+struct FrameStatisticsNull {
+    /** Number of processed command lists */
+    uint32_t commandListCount{0U};
+    /** Number of processed render commands */
+    uint32_t commandCount{0U};
+    /** Number of render passes */
+    uint32_t renderPassCount{0U};
+    /** Number of draw calls */
+    uint32_t drawCount{0U};
+    /** Number of indirect draw calls */
+    uint32_t drawIndirectCount{0U};
+    /** Number of dispatches */
+    uint32_t dispatchCount{0U};
+    /** Number of indirect dispatches */
+    uint32_t dispatchIndirectCount{0U};
+    /** Number of instances in direct draw calls */
+    uint32_t instanceCount{0U};
+    /** Number of vertices or indices in direct draw calls, multiplied with the instance count */
+    uint64_t vertexCount{0U};
+    /** Number of pipeline binds */
+    uint32_t pipelineBindCount{0U};
+    /** Number of descriptor set binds */
+    uint32_t descriptorSetBindCount{0U};
+    /** Number of descriptor set updates */
+    uint32_t descriptorSetUpdateCount{0U};
+    /** Number of buffer and image copies, blits and clears */
+    uint32_t copyCount{0U};
+    /** Number of commands which failed validation */
+    uint32_t validationErrorCount{0U};
+};
+
+/** Provides access to the null backend. The null backend allocates the resources in host memory and processes the
+ * render commands without issuing any GPU work. It is meant for measuring the CPU side of rendering.
+ */
+class ILowLevelDeviceNull : public ILowLevelDevice {
+public:
+    /** Returns the statistics of the last processed frame.
+     * Should be called from the rendering thread after IRenderer::RenderFrame.
+     */
+    virtual FrameStatisticsNull GetFrameStatistics() const = 0;
+
+protected:
+    ILowLevelDeviceNull() = default;
+    ~ILowLevelDeviceNull() = default;
+};
+#endif
+/** @} */
+RENDER_END_NAMESPACE()
+
+#endif  // API_RENDER_NULL_IDEVICE_NULL_H
@@ -23,6 +23,10 @@
 #endif
 
 #include <base/math/mathf.h>
+#if (RENDER_PERF_ENABLED == 1)
+#include <core/implementation_uids.h>
+#include <core/perf/intf_performance_data_manager.h>
+#endif
 #include <render/namespace.h>
 
 #include "device/device.h"
@@ -58,6 +62,14 @@ constexpr MemoryPropertyFlags ADD_STAGING_MEM_OPT_FLAGS{
 
 constexpr uint32_t BUFFER_ALIGNMENT{256U};
 
+// staging ring sizes, the ring grows in powers of two between these
+constexpr uint32_t STAGING_RING_MIN_BYTE_SIZE{1024U * 1024U};
+constexpr uint32_t STAGING_RING_MAX_BYTE_SIZE{64U * 1024U * 1024U};
+// larger uploads get a dedicated staging buffer for the frame
+constexpr uint32_t STAGING_RING_MAX_ALLOCATION_BYTE_SIZE{STAGING_RING_MAX_BYTE_SIZE / 4U};
+// frames after which the staging ring may shrink and unused staging scaling images are destroyed
+constexpr uint32_t STAGING_IDLE_FRAME_COUNT{120U};
+
 // make sure that generation is valid
 EngineResourceHandle InvalidateWithGeneration(const EngineResourceHandle handle)
 {
@@ -256,6 +268,58 @@ inline constexpr GpuBufferDesc GetMapBufferDesc(const uint32_t byteSize)
     };
 }
 
+inline constexpr GpuBufferDesc GetStagingRingDesc(const uint32_t byteSize)
+{
+    // not single shot staging, the ring is written every frame
+    return {
+        BufferUsageFlagBits::CORE_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        MemoryPropertyFlagBits::CORE_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+            MemoryPropertyFlagBits::CORE_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+        0U,
+        byteSize,
+    };
+}
+
+uint32_t GetStagingRingByteSize(const uint64_t neededByteSize)
+{
+    uint32_t byteSize = STAGING_RING_MIN_BYTE_SIZE;
+    while ((byteSize < neededByteSize) && (byteSize < STAGING_RING_MAX_BYTE_SIZE)) {
+        byteSize *= 2U;
+    }
+    return byteSize;
+}
+
+// staged through a staging buffer, i.e. needs space from the staging ring
+inline bool IsStagedOperation(const StagingCopyStruct& op)
+{
+    return (!op.invalidOperation) && (op.stagingBufferByteSize > 0U) &&
+           (op.dataType != StagingCopyStruct::DataType::DATA_TYPE_DIRECT_SRC_COPY);
+}
+
+// moves the operation to dstOps and appends its copies to dstCopies
+template<typename CopyType>
+void MoveStagingOperation(StagingCopyStruct& op, const vector<CopyType>& srcCopies, vector<StagingCopyStruct>& dstOps,
+    vector<CopyType>& dstCopies)
+{
+    const size_t beginIndex = Math::min(srcCopies.size(), size_t(op.beginIndex));
+    const size_t endIndex = Math::min(srcCopies.size(), beginIndex + op.count);
+    op.beginIndex = static_cast<uint32_t>(dstCopies.size());
+    op.count = static_cast<uint32_t>(endIndex - beginIndex);
+    dstCopies.append(srcCopies.cbegin() + static_cast<ptrdiff_t>(beginIndex),
+        srcCopies.cbegin() + static_cast<ptrdiff_t>(endIndex));
+    dstOps.push_back(move(op));
+}
+
+inline void RebaseStagingCopy(BufferCopy& copy, const uint32_t oldOffset, const uint32_t newOffset)
+{
+    copy.srcOffset = copy.srcOffset - oldOffset + newOffset;
+}
+
+inline void RebaseStagingCopy(BufferImageCopy& copy, const uint32_t oldOffset, const uint32_t newOffset)
+{
+    copy.bufferOffset = copy.bufferOffset - oldOffset + newOffset;
+}
+
 inline constexpr void CheckAndEnableMemoryOptimizations(const uint32_t gpuResourceMgrFlags, GpuBufferDesc& desc)
 {
     if (gpuResourceMgrFlags & GpuResourceManager::GPU_RESOURCE_MANAGER_OPTIMIZE_STAGING_MEMORY) {
@@ -2242,13 +2306,47 @@ void GpuResourceManager::InvalidateGpuImageHandle(const RenderHandle& clientHand
 
 void GpuResourceManager::LockFrameStagingData()
 {
+    uint32_t uploadBudget = 0U;
     {
         std::lock_guard lock(stagingMutex_);
         perFrameStagingData_ = move(stagingOperations_);
         stagingOperations_ = {};
+        uploadBudget = stagingUploadBudget_;
+    }
+
+    // uploads deferred in the previous frames go first. uploads to resources which have been replaced or destroyed
+    // meanwhile are dropped.
+    if ((!deferredStagingData_.bufferToImage.empty()) || (!deferredStagingData_.bufferToBuffer.empty())) {
+        StagingConsumeStruct deferred = move(deferredStagingData_);
+        deferredStagingData_ = {};
+        const auto mergeDeferred = [](const PerManagerStore& store, auto& deferredOps, const auto& deferredCopies,
+                                       vector<StagingCopyStruct>& frameOps, auto& frameCopies) {
+            const auto lock = std::shared_lock(store.clientMutex);
+            vector<StagingCopyStruct> ops;
+            ops.reserve(deferredOps.size() + frameOps.size());
+            for (auto& op : deferredOps) {
+                const RenderHandle handle = op.dstHandle.GetHandle();
+                const uint32_t arrayIndex = RenderHandleUtil::GetIndexPart(handle);
+                if ((arrayIndex < static_cast<uint32_t>(store.clientHandles.size())) &&
+                    (store.clientHandles[arrayIndex].GetHandle().id == handle.id)) {
+                    MoveStagingOperation(op, deferredCopies, ops, frameCopies);
+                }
+            }
+            for (auto& op : frameOps) {
+                ops.push_back(move(op));
+            }
+            frameOps = move(ops);
+        };
+        mergeDeferred(imageStore_, deferred.bufferToImage, deferred.bufferImageCopies,
+            perFrameStagingData_.bufferToImage, perFrameStagingData_.bufferImageCopies);
+        mergeDeferred(bufferStore_, deferred.bufferToBuffer, deferred.bufferCopies,
+            perFrameStagingData_.bufferToBuffer, perFrameStagingData_.bufferCopies);
+    }
+    if (uploadBudget > 0U) {
+        DeferStagingOverBudget(uploadBudget);
     }
 
-    // create frame staging buffers and set handles for staging
+    // place the staged data and set handles for staging
     {
         std::lock_guard lock(bufferStore_.clientMutex);
 
@@ -2272,42 +2370,219 @@ void GpuResourceManager::LockFrameStagingData()
             }
         }
 
-        for (uint32_t size : perFrameStagingData_.stagingByteSizes) {
-            perFrameStagingBuffers_.push_back(CreateStagingBuffer(GetStagingBufferDesc(size)));
-            perFrameStagingData_.stagingBuffers.push_back(perFrameStagingBuffers_.back().GetHandle());
+        PlaceFrameStaging();
+    }
+    {
+        auto const clientLock = std::lock_guard(imageStore_.clientMutex);
+        // re-use image scaling targets of the same format if large enough and set handles
+        for (auto& image : stagingScalingImages_) {
+            image.idleFrameCount++;
+        }
+        for (auto& scalingImageRef : perFrameStagingData_.scalingImageData.scalingImages) {
+            auto iter = std::find_if(stagingScalingImages_.begin(), stagingScalingImages_.end(),
+                [format = scalingImageRef.format](const StagingScalingImage& image) { return image.format == format; });
+            if (iter == stagingScalingImages_.end()) {
+                stagingScalingImages_.push_back({{}, scalingImageRef.format});
+                iter = stagingScalingImages_.end() - 1;
+            }
+            if ((iter->width < scalingImageRef.maxWidth) || (iter->height < scalingImageRef.maxHeight)) {
+                iter->width = Math::max(iter->width, scalingImageRef.maxWidth);
+                iter->height = Math::max(iter->height, scalingImageRef.maxHeight);
+                iter->handle = CreateImage({}, iter->handle.GetHandle(),
+                    GetStagingScalingImageDesc(iter->format, iter->width, iter->height))
+                                   .handle;
+            }
+            iter->idleFrameCount = 0U;
+            scalingImageRef.handle = iter->handle;
         }
+        for (auto iter = stagingScalingImages_.begin(); iter != stagingScalingImages_.end();) {
+            if (iter->idleFrameCount >= STAGING_IDLE_FRAME_COUNT) {
+                Destroy(imageStore_, iter->handle.GetHandle());
+                iter = stagingScalingImages_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+}
 
-        perFrameStagingBuffers_.reserve(
-            perFrameStagingData_.bufferToBuffer.size() + perFrameStagingData_.bufferToImage.size());
-        for (auto& ref : perFrameStagingData_.bufferToBuffer) {
-            if ((!ref.invalidOperation) && (ref.stagingBufferByteSize > 0)) {
-                ref.srcHandle = perFrameStagingBuffers_[ref.stagingBufferIndex];
+void GpuResourceManager::DeferStagingOverBudget(const uint32_t uploadBudget)
+{
+    // uploads are admitted in order until the budget is used, the rest waits for the next frames. at least one
+    // upload is always admitted so that a single large upload cannot stall the queue. uploads with scaling use the
+    // frame's scaling images and are never deferred.
+    uint64_t byteSize = 0U;
+    bool overBudget = false;
+    const auto defer = [&byteSize, &overBudget, uploadBudget](vector<StagingCopyStruct>& ops, const auto& copies,
+                           vector<StagingCopyStruct>& deferredOps, auto& deferredCopies) {
+        size_t keptCount = 0U;
+        for (size_t idx = 0U; idx < ops.size(); ++idx) {
+            auto& op = ops[idx];
+            if (IsStagedOperation(op)) {
+                if (op.format == Format::BASE_FORMAT_UNDEFINED) {
+                    overBudget =
+                        overBudget || ((byteSize > 0U) && ((byteSize + op.stagingBufferByteSize) > uploadBudget));
+                    if (overBudget) {
+                        MoveStagingOperation(op, copies, deferredOps, deferredCopies);
+                        continue;
+                    }
+                }
+                byteSize += op.stagingBufferByteSize;
+            }
+            if (keptCount != idx) {
+                ops[keptCount] = move(op);
             }
+            keptCount++;
         }
-        for (auto& ref : perFrameStagingData_.bufferToImage) {
-            if ((!ref.invalidOperation) && (ref.stagingBufferByteSize > 0)) {
-                ref.srcHandle = perFrameStagingBuffers_[ref.stagingBufferIndex];
+        ops.erase(ops.begin() + static_cast<ptrdiff_t>(keptCount), ops.end());
+    };
+    // images are copied first
+    defer(perFrameStagingData_.bufferToImage, perFrameStagingData_.bufferImageCopies,
+        deferredStagingData_.bufferToImage, deferredStagingData_.bufferImageCopies);
+    defer(perFrameStagingData_.bufferToBuffer, perFrameStagingData_.bufferCopies, deferredStagingData_.bufferToBuffer,
+        deferredStagingData_.bufferCopies);
+}
+
+void GpuResourceManager::PlaceFrameStaging()
+{
+    auto& staging = perFrameStagingData_;
+    auto& ring = stagingRing_;
+    const uint32_t frameFenceCount = device_.GetCommandBufferingCount() + 1U;
+
+    const auto resizeRing = [this, &ring](const uint32_t byteSize) {
+        if (byteSize > 0U) {
+            ring.handle = CreateBuffer({}, ring.handle.GetHandle(), GetStagingRingDesc(byteSize)).handle;
+        } else if (ring.handle) {
+            Destroy(bufferStore_, ring.handle.GetHandle());
+            ring.handle = {};
+        }
+        // the replaced buffer is destroyed when the GPU is done with it
+        ring.allocator.Reset(byteSize);
+    };
+
+    // shrink to fit the in flight frames at the peak usage of the last frames. not done mid-frame.
+    if (++ring.frameCount >= STAGING_IDLE_FRAME_COUNT) {
+        const uint32_t byteSize = (ring.maxFrameByteSize > 0U)
+                                      ? GetStagingRingByteSize(uint64_t(ring.maxFrameByteSize) * frameFenceCount)
+                                      : 0U;
+        if (byteSize < ring.allocator.GetByteSize()) {
+            resizeRing(byteSize);
+        }
+        ring.frameCount = 0U;
+        ring.maxFrameByteSize = 0U;
+    }
+    ring.allocator.BeginFrame(frameFenceCount);
+
+    // staged operations in copy order, images first
+    vector<StagingCopyStruct*> ops;
+    ops.reserve(staging.bufferToImage.size() + staging.bufferToBuffer.size());
+    size_t imageOpCount = 0U;
+    uint64_t ringByteSize = 0U;
+    for (auto* opList : {&staging.bufferToImage, &staging.bufferToBuffer}) {
+        for (auto& op : *opList) {
+            if (IsStagedOperation(op)) {
+                ops.push_back(&op);
+                if (op.stagingBufferByteSize <= STAGING_RING_MAX_ALLOCATION_BYTE_SIZE) {
+                    ringByteSize += Align(op.stagingBufferByteSize, BUFFER_ALIGNMENT);
+                }
             }
         }
+        if (opList == &staging.bufferToImage) {
+            imageOpCount = ops.size();
+        }
+    }
+    const auto allocate = [&ring](const StagingCopyStruct& op) {
+        return (op.stagingBufferByteSize <= STAGING_RING_MAX_ALLOCATION_BYTE_SIZE)
+                   ? ring.allocator.Allocate(op.stagingBufferByteSize, BUFFER_ALIGNMENT)
+                   : FrameRingAllocator::INVALID_OFFSET;
+    };
+    vector<uint32_t> offsets(ops.size(), FrameRingAllocator::INVALID_OFFSET);
+    size_t placedCount = 0U;
+    for (; placedCount < ops.size(); ++placedCount) {
+        offsets[placedCount] = allocate(*ops[placedCount]);
+        if ((offsets[placedCount] == FrameRingAllocator::INVALID_OFFSET) &&
+            (ops[placedCount]->stagingBufferByteSize <= STAGING_RING_MAX_ALLOCATION_BYTE_SIZE)) {
+            break;
+        }
+    }
+    if (placedCount < ops.size()) {
+        // grow geometrically and start over in the new ring, the rest get dedicated buffers if still not fitting
+        const uint32_t byteSize =
+            GetStagingRingByteSize(Math::max(uint64_t(ring.allocator.GetByteSize()) * 2U, ringByteSize));
+        if (byteSize > ring.allocator.GetByteSize()) {
+            resizeRing(byteSize);
+            placedCount = 0U;
+        }
+        for (; placedCount < ops.size(); ++placedCount) {
+            offsets[placedCount] = allocate(*ops[placedCount]);
+        }
+    }
+
+    staging.stagingBuffers.clear();
+    staging.stagingByteSizes.clear();
+    if (ring.handle) {
+        staging.stagingBuffers.push_back(ring.handle.GetHandle());
+        staging.stagingByteSizes.push_back(ring.allocator.GetByteSize());
+    }
+    uint64_t uploadedByteSize = 0U;
+    for (size_t idx = 0U; idx < ops.size(); ++idx) {
+        StagingCopyStruct& op = *ops[idx];
+        uint32_t offset = offsets[idx];
+        if (offset != FrameRingAllocator::INVALID_OFFSET) {
+            op.stagingBufferIndex = 0U;
+            op.srcHandle = ring.handle;
+        } else {
+            offset = 0U;
+            const uint32_t byteSize = Align(op.stagingBufferByteSize, BUFFER_ALIGNMENT);
+            perFrameStagingBuffers_.push_back(CreateStagingBuffer(GetStagingBufferDesc(byteSize)));
+            op.stagingBufferIndex = static_cast<uint32_t>(staging.stagingBuffers.size());
+            op.srcHandle = perFrameStagingBuffers_.back();
+            staging.stagingBuffers.push_back(op.srcHandle.GetHandle());
+            staging.stagingByteSizes.push_back(byteSize);
+        }
+        const auto rebase = [&op, offset](auto& copies) {
+            const size_t beginIndex = Math::min(copies.size(), size_t(op.beginIndex));
+            const size_t endIndex = Math::min(copies.size(), beginIndex + op.count);
+            for (size_t copyIdx = beginIndex; copyIdx < endIndex; ++copyIdx) {
+                RebaseStagingCopy(copies[copyIdx], op.stagingBufferByteOffset, offset);
+            }
+        };
+        if (idx < imageOpCount) {
+            rebase(staging.bufferImageCopies);
+        } else {
+            rebase(staging.bufferCopies);
+        }
+        op.stagingBufferByteOffset = offset;
+        uploadedByteSize += op.stagingBufferByteSize;
+    }
+    ring.maxFrameByteSize =
+        Math::max(ring.maxFrameByteSize, static_cast<uint32_t>(ring.allocator.GetFrameByteSize()));
+
+    uint64_t deferredByteSize = 0U;
+    for (const auto* opList : {&deferredStagingData_.bufferToImage, &deferredStagingData_.bufferToBuffer}) {
+        for (const auto& op : *opList) {
+            deferredByteSize += op.stagingBufferByteSize;
+        }
     }
     {
-        auto const clientLock = std::lock_guard(imageStore_.clientMutex);
-        // create image scaling targets and set handles
-        perFrameStagingScalingImages_.resize(perFrameStagingData_.scalingImageData.scalingImages.size());
-        for (size_t idx = 0; idx < perFrameStagingData_.scalingImageData.scalingImages.size(); ++idx) {
-            auto& scalingImageRef = perFrameStagingData_.scalingImageData.scalingImages[idx];
-            perFrameStagingScalingImages_[idx] = CreateImage({},
-                {},
-                GetStagingScalingImageDesc(scalingImageRef.format, scalingImageRef.maxWidth, scalingImageRef.maxHeight))
-                                                     .handle;
-            scalingImageRef.handle = perFrameStagingScalingImages_[idx];
+        std::lock_guard lock(stagingMutex_);
+        stagingStatistics_ = {uploadedByteSize, deferredByteSize, ring.allocator.GetByteSize()};
+    }
+#if (RENDER_PERF_ENABLED == 1)
+    if (auto* inst = GetInstance<IPerformanceDataManagerFactory>(UID_PERFORMANCE_FACTORY); inst) {
+        if (IPerformanceDataManager* pdm = inst->Get("Memory"); pdm) {
+            pdm->UpdateData("Staging", "UPLOADED", static_cast<int64_t>(uploadedByteSize),
+                IPerformanceDataManager::PerformanceTimingData::DataType::BYTES);
+            pdm->UpdateData("Staging", "DEFERRED", static_cast<int64_t>(deferredByteSize),
+                IPerformanceDataManager::PerformanceTimingData::DataType::BYTES);
         }
     }
+#endif
 }
 
 void GpuResourceManager::DestroyFrameStaging()
 {
-    // explicit destruction of staging resources
+    // explicit destruction of dedicated staging buffers, the ring and scaling images are kept
     {
         PerManagerStore& store = bufferStore_;
         auto const clientLock = std::lock_guard(store.clientMutex);
@@ -2316,14 +2591,27 @@ void GpuResourceManager::DestroyFrameStaging()
         }
         perFrameStagingBuffers_.clear();
     }
+}
+
+void GpuResourceManager::DestroyPersistentStaging()
+{
+    {
+        PerManagerStore& store = bufferStore_;
+        auto const clientLock = std::lock_guard(store.clientMutex);
+        if (stagingRing_.handle) {
+            Destroy(store, stagingRing_.handle.GetHandle());
+        }
+        stagingRing_ = {};
+    }
     {
         PerManagerStore& store = imageStore_;
         auto const clientLock = std::lock_guard(store.clientMutex);
-        for (const auto& handleRef : perFrameStagingScalingImages_) {
-            Destroy(store, handleRef.GetHandle());
+        for (const auto& image : stagingScalingImages_) {
+            Destroy(store, image.handle.GetHandle());
         }
-        perFrameStagingScalingImages_.clear();
+        stagingScalingImages_.clear();
     }
+    deferredStagingData_ = {};
 }
 
 bool GpuResourceManager::HasStagingData() const
@@ -2516,6 +2804,7 @@ void GpuResourceManager::WaitForIdleAndDestroyGpuResources()
     LockFrameStagingData();
     ConsumeStagingData();  // consume cpu data
     DestroyFrameStaging();
+    DestroyPersistentStaging();
 
     {
         // additional possible staging buffer clean-up
@@ -3060,6 +3349,18 @@ uint32_t GpuResourceManager::GetSamplerCount() const
     return static_cast<uint32_t>(store.clientHandles.size());
 }
 
+void GpuResourceManager::SetStagingUploadBudget(const uint32_t byteSize)
+{
+    const auto lock = std::lock_guard(stagingMutex_);
+    stagingUploadBudget_ = byteSize;
+}
+
+IGpuResourceManager::StagingStatistics GpuResourceManager::GetStagingStatistics() const
+{
+    const auto lock = std::lock_guard(stagingMutex_);
+    return stagingStatistics_;
+}
+
 GpuImageDesc GpuResourceManager::CreateGpuImageDesc(const CORE_NS::IImageContainer::ImageDesc& desc) const
 {
     GpuImageDesc gpuImageDesc;
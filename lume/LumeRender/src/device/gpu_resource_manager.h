@@ -32,6 +32,7 @@
 #include "device/gpu_buffer.h"
 #include "device/gpu_image.h"
 #include "device/gpu_resource_handle_util.h"  // for EngineResourceHandle
+#include "util/frame_ring_allocator.h"
 
 RENDER_BEGIN_NAMESPACE()
 class Device;
@@ -438,6 +439,9 @@ public:
     uint32_t GetImageCount() const override;
     uint32_t GetSamplerCount() const override;
 
+    void SetStagingUploadBudget(uint32_t byteSize) override;
+    StagingStatistics GetStagingStatistics() const override;
+
 private:
     Device& device_;
 
@@ -574,6 +578,12 @@ private:
     void Destroy(const RenderHandle& handle);
     // Destroy staging buffers. Not thread safe. Called from gpu resource manager
     void DestroyFrameStaging();
+    // Destroy the persistent staging ring and scaling images, and drop deferred uploads. Not thread safe.
+    void DestroyPersistentStaging();
+    // Moves staged uploads over the upload budget to deferredStagingData_. Not thread safe.
+    void DeferStagingOverBudget(uint32_t uploadBudget);
+    // Places the frame's staged uploads to the staging ring or to dedicated buffers, bufferStore_ needs to be locked.
+    void PlaceFrameStaging();
 
     // needs to be locked when called
     StoreAllocationData CreateBuffer(
@@ -640,7 +650,32 @@ private:
     StagingConsumeStruct stagingOperations_;    // needs to be locked
     StagingConsumeStruct perFrameStagingData_;  // per frame data after LockFrameStagingData()
     BASE_NS::vector<RenderHandleReference> perFrameStagingBuffers_;
-    BASE_NS::vector<RenderHandleReference> perFrameStagingScalingImages_;
+
+    // staged uploads are sub-allocated from a persistent ring which is fenced with the command buffering count.
+    // the ring grows when a frame does not fit and shrinks after a while of lower usage.
+    struct StagingRing {
+        RenderHandleReference handle;
+        FrameRingAllocator allocator;
+        // frames since the last resize check, and the largest frame usage during them
+        uint32_t frameCount{0U};
+        uint32_t maxFrameByteSize{0U};
+    };
+    StagingRing stagingRing_;
+
+    // image scaling targets are kept over frames per format and destroyed when unused for a while
+    struct StagingScalingImage {
+        RenderHandleReference handle;
+        BASE_NS::Format format{BASE_NS::Format::BASE_FORMAT_UNDEFINED};
+        uint32_t width{0U};
+        uint32_t height{0U};
+        uint32_t idleFrameCount{0U};
+    };
+    BASE_NS::vector<StagingScalingImage> stagingScalingImages_;
+
+    // uploads over the budget, staged in the following frames. not thread safe, used in LockFrameStagingData()
+    StagingConsumeStruct deferredStagingData_;
+    uint32_t stagingUploadBudget_{0U};     // needs to be locked with stagingMutex_
+    StagingStatistics stagingStatistics_;  // needs to be locked with stagingMutex_
 
     // combined with bitwise OR buffer usage flags
     BufferUsageFlags defaultBufferUsageFlags_{0u};
@@ -79,7 +79,8 @@ ShaderDataFileType GetShaderDataFileType(const string_view fullFilename)
     return ShaderDataFileType::UNDEFINED;
 }
 
-vector<uint8_t> ReadFile(IFile& file, const string_view uri)
+// Returns the contents of the file. Mapped and in-memory files are used as is, others are read to fileData.
+array_view<const uint8_t> ReadFile(IFile& file, const string_view uri, vector<uint8_t>& fileData)
 {
     const uint64_t fileLength = file.GetLength();
     if (fileLength > MAX_SHADER_FILE_BYTE_SIZE) {
@@ -90,11 +91,15 @@ vector<uint8_t> ReadFile(IFile& file, const string_view uri)
             MAX_SHADER_FILE_BYTE_SIZE);
         return {};
     }
+    if (const auto data = file.GetData(); !data.empty()) {
+        return data;
+    }
 
-    auto fileData = vector<uint8_t>(static_cast<std::size_t>(fileLength));
+    fileData.resize(static_cast<std::size_t>(fileLength));
     const auto bytesRead = file.Read(fileData.data(), fileData.size());
     if (bytesRead != fileLength) {
         PLUGIN_LOG_E("failed to read shader file (%.*s)", static_cast<int>(uri.size()), uri.data());
+        fileData.clear();
         return {};
     }
     return fileData;
@@ -334,6 +339,8 @@ ShaderLoader::ShaderFile ShaderLoader::LoadShaderFile(const string_view shader,
     switch (type_) {
         case DeviceBackendType::VULKAN:
         case DeviceBackendType::MALEOON:
+        case DeviceBackendType::NULL_BACKEND:
+            // the null backend only needs the reflection data
             shaderFile = fileManager_.OpenFile(shader);
             break;
         case DeviceBackendType::OPENGLES:
@@ -346,12 +353,15 @@ ShaderLoader::ShaderFile ShaderLoader::LoadShaderFile(const string_view shader,
             break;
     }
     if (shaderFile) {
-        info.data = ReadFile(*shaderFile, shader);
+        const auto data = ReadFile(*shaderFile, shader, info.data);
+        info.file = move(shaderFile);
 
+        array_view<const uint8_t> reflectionData;
         if (IFile::Ptr reflectionFile = fileManager_.OpenFile(shader + ".lsb"); reflectionFile) {
-            info.reflectionData = ReadFile(*reflectionFile, shader + ".lsb");
+            reflectionData = ReadFile(*reflectionFile, shader + ".lsb", info.reflectionData);
+            info.reflectionFile = move(reflectionFile);
         }
-        info.info = {stageBits, info.data, ShaderReflectionData{info.reflectionData}};
+        info.info = {stageBits, data, ShaderReflectionData{reflectionData}};
     } else {
         PLUGIN_LOG_E("shader file not found (%.*s)", static_cast<int>(shader.size()), shader.data());
     }
@@ -382,7 +392,7 @@ RenderHandleReference ShaderLoader::CreateComputeShader(const ShaderDataLoader&
         }
         if (index == INVALID_SM_INDEX) {
             const auto shaderFile = LoadShaderFile(computeShader, ShaderStageFlagBits::CORE_SHADER_STAGE_COMPUTE_BIT);
-            if (!shaderFile.data.empty()) {
+            if (!shaderFile.info.spvData.empty()) {
                 index = shaderMgr_.CreateShaderModule(computeShader, shaderFile.info);
             } else {
                 PLUGIN_LOG_E(
@@ -459,14 +469,14 @@ RenderHandleReference ShaderLoader::CreateGraphicsShader(const ShaderDataLoader&
         uint32_t vertIndex = (forceReload) ? INVALID_SM_INDEX : shaderMgr_.GetShaderModuleIndex(vertexShader);
         if (vertIndex == INVALID_SM_INDEX) {
             const auto shaderFile = LoadShaderFile(vertexShader, ShaderStageFlagBits::CORE_SHADER_STAGE_VERTEX_BIT);
-            if (!shaderFile.data.empty()) {
+            if (!shaderFile.info.spvData.empty()) {
                 vertIndex = shaderMgr_.CreateShaderModule(vertexShader, shaderFile.info);
             }
         }
         uint32_t fragIndex = (forceReload) ? INVALID_SM_INDEX : shaderMgr_.GetShaderModuleIndex(fragmentShader);
         if (fragIndex == INVALID_SM_INDEX) {
             const auto shaderFile = LoadShaderFile(fragmentShader, ShaderStageFlagBits::CORE_SHADER_STAGE_FRAGMENT_BIT);
-            if (!shaderFile.data.empty()) {
+            if (!shaderFile.info.spvData.empty()) {
                 fragIndex = shaderMgr_.CreateShaderModule(fragmentShader, shaderFile.info);
             }
         }
@@ -22,6 +22,7 @@
 #include <base/containers/unordered_map.h>
 #include <base/containers/vector.h>
 #include <core/io/intf_directory.h>
+#include <core/io/intf_file.h>
 #include <core/namespace.h>
 #include <render/device/intf_device.h>
 #include <render/device/pipeline_state_desc.h>
@@ -68,6 +69,9 @@ private:
     void HandleVertexInputDeclarationFile(BASE_NS::string_view currentPath, const CORE_NS::IDirectory::Entry& entry);
     void RecurseDirectory(BASE_NS::string_view currentPath, const CORE_NS::IDirectory& directory);
     struct ShaderFile {
+        // info points either into the data vectors or directly into the files, if they are mapped.
+        CORE_NS::IFile::Ptr file;
+        CORE_NS::IFile::Ptr reflectionFile;
         BASE_NS::vector<uint8_t> data;
         BASE_NS::vector<uint8_t> reflectionData;
         ShaderModuleCreateInfo info;
@@ -17,6 +17,7 @@
 
 #include <cstdint>
 
+#include <core/threading/intf_thread_pool.h>
 #include <render/intf_render_context.h>
 #include <render/namespace.h>
 #include <render/nodecontext/intf_node_context_descriptor_set_manager.h>
@@ -63,6 +64,9 @@ RenderNodeContextManager::RenderNodeContextManager(const CreateInfo& createInfo)
     contextInterfaces_.push_back({RenderCommandList::UID, &renderCommandList_});
     contextInterfaces_.push_back({RenderNodeGraphShareManager::UID, renderNodeGraphShareMgr_.get()});
     contextInterfaces_.push_back({RenderNodeParserUtil::UID, renderNodeParserUtil_.get()});
+    if (createInfo.threadPool) {
+        contextInterfaces_.push_back({CORE_NS::IThreadPool::UID, createInfo.threadPool});
+    }
 }
 
 RenderNodeContextManager::~RenderNodeContextManager() = default;
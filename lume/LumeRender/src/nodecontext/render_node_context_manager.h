@@ -20,12 +20,17 @@
 
 #include <base/containers/unique_ptr.h>
 #include <base/containers/vector.h>
+#include <core/namespace.h>
 #include <render/namespace.h>
 #include <render/nodecontext/intf_render_node_context_manager.h>
 
 #include "datastore/render_data_store_manager.h"
 #include "nodecontext/render_node_util.h"
 
+CORE_BEGIN_NAMESPACE()
+class IThreadPool;
+CORE_END_NAMESPACE()
+
 RENDER_BEGIN_NAMESPACE()
 class Device;
 class INodeContextDescriptorSetManager;
@@ -60,6 +65,8 @@ public:
         NodeContextPsoManager& psoMgr;
         RenderCommandList& cmdList;
         RenderNodeGraphShareDataManager& renderNodeGraphShareDataMgr;
+        // renderer thread pool, available to render nodes through GetRenderNodeContextInterface.
+        CORE_NS::IThreadPool* threadPool{nullptr};
     };
     struct PerFrameTimings {
         uint64_t totalTimeUs{0};
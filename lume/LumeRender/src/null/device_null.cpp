@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "device_null.h"
+
+#include <base/containers/unique_ptr.h>
+#include <render/namespace.h>
+
+#include "device/gpu_program_util.h"
+#include "device/gpu_resource_manager.h"
+#include "device/shader_manager.h"
+#include "null/gpu_program_null.h"
+#include "null/gpu_resources_null.h"
+#include "null/node_context_descriptor_set_manager_null.h"
+#include "null/node_context_pool_manager_null.h"
+#include "null/render_backend_null.h"
+#include "util/log.h"
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+namespace {
+constexpr uint32_t FORMAT_PROPERTY_COUNT =
+    DeviceFormatSupportConstants::LINEAR_FORMAT_MAX_COUNT + DeviceFormatSupportConstants::ADDITIONAL_FORMAT_MAX_COUNT;
+
+constexpr bool IsDepthStencilFormat(const uint32_t format)
+{
+    return (format >= BASE_FORMAT_D16_UNORM) && (format <= BASE_FORMAT_D32_SFLOAT_S8_UINT);
+}
+
+FormatProperties GetSupportedFormatProperties(const uint32_t format)
+{
+    // nothing is ever sampled or rendered, so everything that could be asked for is supported
+    constexpr FormatFeatureFlags commonFeatures =
+        CORE_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | CORE_FORMAT_FEATURE_STORAGE_IMAGE_BIT |
+        CORE_FORMAT_FEATURE_BLIT_SRC_BIT | CORE_FORMAT_FEATURE_BLIT_DST_BIT |
+        CORE_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT | CORE_FORMAT_FEATURE_TRANSFER_SRC_BIT |
+        CORE_FORMAT_FEATURE_TRANSFER_DST_BIT;
+    constexpr FormatFeatureFlags colorFeatures =
+        CORE_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT | CORE_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT;
+    constexpr FormatFeatureFlags bufferFeatures = CORE_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT |
+                                                  CORE_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT |
+                                                  CORE_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+    FormatProperties props;
+    props.optimalTilingFeatures = commonFeatures | (IsDepthStencilFormat(format)
+                                                           ? CORE_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
+                                                           : colorFeatures);
+    props.linearTilingFeatures = props.optimalTilingFeatures;
+    props.bufferFeatures = IsDepthStencilFormat(format) ? 0U : bufferFeatures;
+    props.bytesPerPixel = GpuProgramUtil::FormatByteSize(static_cast<Format>(format));
+    return props;
+}
+}  // namespace
+
+DeviceNull::DeviceNull(RenderContext& renderContext) : Device(renderContext)
+{
+    // all memory is host memory
+    deviceSharedMemoryPropertyFlags_ =
+        CORE_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | CORE_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+        CORE_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    InitFormatProperties();
+
+    SetDeviceStatus(true);
+
+    const GpuResourceManager::CreateInfo grmCreateInfo{
+        GpuResourceManager::GPU_RESOURCE_MANAGER_OPTIMIZE_STAGING_MEMORY,
+    };
+    gpuResourceMgr_ = make_unique<GpuResourceManager>(*this, grmCreateInfo);
+    shaderMgr_ = make_unique<ShaderManager>(*this);
+    globalDescriptorSetMgr_ = make_unique<DescriptorSetManagerNull>(*this);
+    lowLevelDevice_ = make_unique<LowLevelDeviceNull>(*this);
+}
+
+DeviceNull::~DeviceNull()
+{
+    WaitForIdle();
+    SetDeviceStatus(false);
+
+    // must release handles before taking down gpu resource manager.
+    globalDescriptorSetMgr_.reset();
+    swapchains_.clear();
+    gpuResourceMgr_.reset();
+    shaderMgr_.reset();
+    renderBackendNull_ = nullptr;
+}
+
+void DeviceNull::InitFormatProperties()
+{
+    formatProperties_.resize(FORMAT_PROPERTY_COUNT);
+    // index 0 is BASE_FORMAT_UNDEFINED which stays unsupported
+    for (uint32_t i = 1U; i <= DeviceFormatSupportConstants::LINEAR_FORMAT_MAX_IDX; ++i) {
+        formatProperties_[i] = GetSupportedFormatProperties(i);
+    }
+    for (uint32_t i = DeviceFormatSupportConstants::ADDITIONAL_FORMAT_START_NUMBER;
+         i <= DeviceFormatSupportConstants::ADDITIONAL_FORMAT_END_NUMBER; ++i) {
+        const uint32_t idx = DeviceFormatSupportConstants::ADDITIONAL_FORMAT_BASE_IDX +
+                             (i - DeviceFormatSupportConstants::ADDITIONAL_FORMAT_START_NUMBER);
+        formatProperties_[idx] = GetSupportedFormatProperties(i);
+    }
+}
+
+DeviceBackendType DeviceNull::GetBackendType() const
+{
+    return DeviceBackendType::NULL_BACKEND;
+}
+
+const DevicePlatformData& DeviceNull::GetPlatformData() const
+{
+    return platData_;
+}
+
+FormatProperties DeviceNull::GetFormatProperties(const Format format) const
+{
+    const auto formatIdx = static_cast<uint32_t>(format);
+    if (formatIdx <= DeviceFormatSupportConstants::LINEAR_FORMAT_MAX_IDX) {
+        return formatProperties_[formatIdx];
+    }
+    if ((formatIdx >= DeviceFormatSupportConstants::ADDITIONAL_FORMAT_START_NUMBER) &&
+        (formatIdx <= DeviceFormatSupportConstants::ADDITIONAL_FORMAT_END_NUMBER)) {
+        return formatProperties_[DeviceFormatSupportConstants::ADDITIONAL_FORMAT_BASE_IDX +
+                                 (formatIdx - DeviceFormatSupportConstants::ADDITIONAL_FORMAT_START_NUMBER)];
+    }
+    return {};
+}
+
+AsBuildSizes DeviceNull::GetAccelerationStructureBuildSizes(const AsBuildGeometryInfo& geometry,
+    array_view<const AsGeometryTrianglesInfo> triangles, array_view<const AsGeometryAabbsInfo> aabbs,
+    array_view<const AsGeometryInstancesInfo> instances) const
+{
+    return {};
+}
+
+ILowLevelDevice& DeviceNull::GetLowLevelDevice() const
+{
+    return *lowLevelDevice_;
+}
+
+void DeviceNull::WaitForIdle()
+{}
+
+PlatformGpuMemoryAllocator* DeviceNull::GetPlatformGpuMemoryAllocator()
+{
+    return nullptr;
+}
+
+unique_ptr<Swapchain> DeviceNull::CreateDeviceSwapchain(const SwapchainCreateInfo& swapchainCreateInfo)
+{
+    PLUGIN_LOG_W("null backend does not support swapchains");
+    return nullptr;
+}
+
+void DeviceNull::DestroyDeviceSwapchain()
+{}
+
+void DeviceNull::Activate()
+{}
+
+void DeviceNull::Deactivate()
+{}
+
+bool DeviceNull::AllowThreadedProcessing() const
+{
+    return true;
+}
+
+GpuQueue DeviceNull::GetValidGpuQueue(const GpuQueue& gpuQueue) const
+{
+    return {GpuQueue::QueueType::GRAPHICS, 0};
+}
+
+uint32_t DeviceNull::GetGpuQueueCount() const
+{
+    return 1U;
+}
+
+void DeviceNull::InitializePipelineCache(array_view<const uint8_t> initialData)
+{}
+
+vector<uint8_t> DeviceNull::GetPipelineCache() const
+{
+    return {};
+}
+
+unique_ptr<GpuBuffer> DeviceNull::CreateGpuBuffer(const GpuBufferDesc& desc)
+{
+    return make_unique<GpuBufferNull>(*this, desc);
+}
+
+unique_ptr<GpuBuffer> DeviceNull::CreateGpuBuffer(const GpuAccelerationStructureDesc& desc)
+{
+    return make_unique<GpuBufferNull>(*this, desc);
+}
+
+unique_ptr<GpuBuffer> DeviceNull::CreateGpuBuffer(const BackendSpecificBufferDesc& desc)
+{
+    return nullptr;
+}
+
+unique_ptr<GpuImage> DeviceNull::CreateGpuImage(const GpuImageDesc& desc)
+{
+    return make_unique<GpuImageNull>(desc);
+}
+
+unique_ptr<GpuImage> DeviceNull::CreateGpuImageView(const GpuImageDesc& desc, const GpuImagePlatformData& platformData)
+{
+    return make_unique<GpuImageNull>(desc);
+}
+
+unique_ptr<GpuImage> DeviceNull::CreateGpuImageView(
+    const GpuImageDesc& desc, const BackendSpecificImageDesc& platformData)
+{
+    return nullptr;
+}
+
+vector<unique_ptr<GpuImage>> DeviceNull::CreateGpuImageViews(const Swapchain& swapchain)
+{
+    return {};
+}
+
+unique_ptr<GpuSampler> DeviceNull::CreateGpuSampler(const GpuSamplerDesc& desc)
+{
+    return make_unique<GpuSamplerNull>(desc);
+}
+
+unique_ptr<RenderFrameSync> DeviceNull::CreateRenderFrameSync()
+{
+    return make_unique<RenderFrameSyncNull>();
+}
+
+unique_ptr<RenderBackend> DeviceNull::CreateRenderBackend(GpuResourceManager& gpuResourceMgr, CORE_NS::ITaskQueue*)
+{
+    auto backend = make_unique<RenderBackendNull>(*this, gpuResourceMgr);
+    renderBackendNull_ = backend.get();
+    return backend;
+}
+
+void DeviceNull::ReleaseRenderBackend(const RenderBackendNull& renderBackend)
+{
+    if (renderBackendNull_ == &renderBackend) {
+        renderBackendNull_ = nullptr;
+    }
+}
+
+unique_ptr<ShaderModule> DeviceNull::CreateShaderModule(const ShaderModuleCreateInfo& data)
+{
+    return make_unique<ShaderModuleNull>(data);
+}
+
+unique_ptr<ShaderModule> DeviceNull::CreateComputeShaderModule(const ShaderModuleCreateInfo& data)
+{
+    return make_unique<ShaderModuleNull>(data);
+}
+
+unique_ptr<GpuShaderProgram> DeviceNull::CreateGpuShaderProgram(const GpuShaderProgramCreateData& data)
+{
+    return make_unique<GpuShaderProgramNull>(data);
+}
+
+unique_ptr<GpuComputeProgram> DeviceNull::CreateGpuComputeProgram(const GpuComputeProgramCreateData& data)
+{
+    return make_unique<GpuComputeProgramNull>(data);
+}
+
+unique_ptr<NodeContextDescriptorSetManager> DeviceNull::CreateNodeContextDescriptorSetManager()
+{
+    return make_unique<NodeContextDescriptorSetManagerNull>(*this);
+}
+
+unique_ptr<NodeContextPoolManager> DeviceNull::CreateNodeContextPoolManager(
+    GpuResourceManager& gpuResourceMgr, const GpuQueue& gpuQueue)
+{
+    return make_unique<NodeContextPoolManagerNull>(*this);
+}
+
+unique_ptr<GraphicsPipelineStateObject> DeviceNull::CreateGraphicsPipelineStateObject(
+    const GpuShaderProgram& gpuProgram, const GraphicsState& graphicsState, const PipelineLayout& pipelineLayout,
+    const VertexInputDeclarationView& vertexInputDeclaration,
+    const ShaderSpecializationConstantDataView& specializationConstants,
+    array_view<const DynamicStateEnum> dynamicStates, const RenderPassDesc& renderPassDesc,
+    const array_view<const RenderPassSubpassDesc>& renderPassSubpassDescs, uint32_t subpassIndex,
+    const LowLevelRenderPassData* renderPassData, const LowLevelPipelineLayoutData* pipelineLayoutData)
+{
+    return make_unique<GraphicsPipelineStateObjectNull>();
+}
+
+unique_ptr<ComputePipelineStateObject> DeviceNull::CreateComputePipelineStateObject(
+    const GpuComputeProgram& gpuProgram, const PipelineLayout& pipelineLayout,
+    const ShaderSpecializationConstantDataView& specializationConstants,
+    const LowLevelPipelineLayoutData* pipelineLayoutData)
+{
+    return make_unique<ComputePipelineStateObjectNull>();
+}
+
+unique_ptr<GpuSemaphore> DeviceNull::CreateGpuSemaphore()
+{
+    return make_unique<GpuSemaphoreNull>();
+}
+
+unique_ptr<GpuSemaphore> DeviceNull::CreateGpuSemaphoreView(uint64_t handle)
+{
+    return make_unique<GpuSemaphoreNull>(handle);
+}
+
+FrameStatisticsNull DeviceNull::GetFrameStatistics() const
+{
+    return renderBackendNull_ ? renderBackendNull_->GetFrameStatistics() : FrameStatisticsNull{};
+}
+
+unique_ptr<Device> CreateDeviceNull(RenderContext& renderContext)
+{
+    return make_unique<DeviceNull>(renderContext);
+}
+
+LowLevelDeviceNull::LowLevelDeviceNull(DeviceNull& deviceNull) : deviceNull_(deviceNull)
+{}
+
+DeviceBackendType LowLevelDeviceNull::GetBackendType() const
+{
+    return DeviceBackendType::NULL_BACKEND;
+}
+
+FrameStatisticsNull LowLevelDeviceNull::GetFrameStatistics() const
+{
+    return deviceNull_.GetFrameStatistics();
+}
+RENDER_END_NAMESPACE()
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NULL_DEVICE_NULL_H
+#define NULL_DEVICE_NULL_H
+
+#include <base/containers/unique_ptr.h>
+#include <base/containers/vector.h>
+#include <base/util/formats.h>
+#include <render/device/intf_device.h>
+#include <render/device/pipeline_state_desc.h>
+#include <render/namespace.h>
+#include <render/null/intf_device_null.h>
+
+#include "device/device.h"
+
+RENDER_BEGIN_NAMESPACE()
+class ComputePipelineStateObject;
+class GraphicsPipelineStateObject;
+class GpuBuffer;
+class GpuComputeProgram;
+class GpuImage;
+class GpuResourceManager;
+class GpuSemaphore;
+class GpuSampler;
+class GpuShaderProgram;
+class NodeContextDescriptorSetManager;
+class NodeContextPoolManager;
+class PlatformGpuMemoryAllocator;
+class RenderFrameSync;
+class RenderBackend;
+class RenderContext;
+class ShaderModule;
+class Swapchain;
+
+struct GpuImagePlatformData;
+struct SwapchainCreateInfo;
+struct BackendSpecificImageDesc;
+struct GpuAccelerationStructureDesc;
+struct GpuBufferDesc;
+struct GpuComputeProgramCreateData;
+struct GpuImageDesc;
+struct GpuSamplerDesc;
+struct GpuShaderProgramCreateData;
+struct PipelineLayout;
+struct ShaderModuleCreateInfo;
+
+class LowLevelDeviceNull;
+class RenderBackendNull;
+
+/** Device without a GPU. Resources live in host memory (or nowhere) and the render backend only walks the command
+ * lists. Every format is reported as supported and there is no swapchain.
+ */
+class DeviceNull final : public Device {
+public:
+    explicit DeviceNull(RenderContext& renderContext);
+    ~DeviceNull() override;
+
+    // From IDevice
+    DeviceBackendType GetBackendType() const override;
+    const DevicePlatformData& GetPlatformData() const override;
+    FormatProperties GetFormatProperties(BASE_NS::Format format) const override;
+    AsBuildSizes GetAccelerationStructureBuildSizes(const AsBuildGeometryInfo& geometry,
+        BASE_NS::array_view<const AsGeometryTrianglesInfo> triangles,
+        BASE_NS::array_view<const AsGeometryAabbsInfo> aabbs,
+        BASE_NS::array_view<const AsGeometryInstancesInfo> instances) const override;
+    ILowLevelDevice& GetLowLevelDevice() const override;
+    void WaitForIdle() override;
+
+    PlatformGpuMemoryAllocator* GetPlatformGpuMemoryAllocator() override;
+
+    BASE_NS::unique_ptr<Swapchain> CreateDeviceSwapchain(const SwapchainCreateInfo& swapchainCreateInfo) override;
+    void DestroyDeviceSwapchain() override;
+
+    void Activate() override;
+    void Deactivate() override;
+
+    bool AllowThreadedProcessing() const override;
+
+    GpuQueue GetValidGpuQueue(const GpuQueue& gpuQueue) const override;
+    uint32_t GetGpuQueueCount() const override;
+
+    void InitializePipelineCache(BASE_NS::array_view<const uint8_t> initialData) override;
+    BASE_NS::vector<uint8_t> GetPipelineCache() const override;
+
+    BASE_NS::unique_ptr<GpuBuffer> CreateGpuBuffer(const GpuBufferDesc& desc) override;
+    BASE_NS::unique_ptr<GpuBuffer> CreateGpuBuffer(const GpuAccelerationStructureDesc& desc) override;
+    BASE_NS::unique_ptr<GpuBuffer> CreateGpuBuffer(const BackendSpecificBufferDesc& desc) override;
+
+    BASE_NS::unique_ptr<GpuImage> CreateGpuImage(const GpuImageDesc& desc) override;
+    BASE_NS::unique_ptr<GpuImage> CreateGpuImageView(
+        const GpuImageDesc& desc, const GpuImagePlatformData& platformData) override;
+    BASE_NS::unique_ptr<GpuImage> CreateGpuImageView(
+        const GpuImageDesc& desc, const BackendSpecificImageDesc& platformData) override;
+    BASE_NS::vector<BASE_NS::unique_ptr<GpuImage>> CreateGpuImageViews(const Swapchain& platformData) override;
+
+    BASE_NS::unique_ptr<GpuSampler> CreateGpuSampler(const GpuSamplerDesc& desc) override;
+
+    BASE_NS::unique_ptr<RenderFrameSync> CreateRenderFrameSync() override;
+
+    BASE_NS::unique_ptr<RenderBackend> CreateRenderBackend(
+        GpuResourceManager& gpuResourceMgr, CORE_NS::ITaskQueue* queue) override;
+
+    BASE_NS::unique_ptr<ShaderModule> CreateShaderModule(const ShaderModuleCreateInfo& data) override;
+    BASE_NS::unique_ptr<ShaderModule> CreateComputeShaderModule(const ShaderModuleCreateInfo& data) override;
+    BASE_NS::unique_ptr<GpuShaderProgram> CreateGpuShaderProgram(const GpuShaderProgramCreateData& data) override;
+    BASE_NS::unique_ptr<GpuComputeProgram> CreateGpuComputeProgram(const GpuComputeProgramCreateData& data) override;
+
+    BASE_NS::unique_ptr<NodeContextDescriptorSetManager> CreateNodeContextDescriptorSetManager() override;
+    BASE_NS::unique_ptr<NodeContextPoolManager> CreateNodeContextPoolManager(
+        class GpuResourceManager& gpuResourceMgr, const GpuQueue& gpuQueue) override;
+
+    BASE_NS::unique_ptr<GraphicsPipelineStateObject> CreateGraphicsPipelineStateObject(
+        const GpuShaderProgram& gpuProgram, const GraphicsState& graphicsState, const PipelineLayout& pipelineLayout,
+        const VertexInputDeclarationView& vertexInputDeclaration,
+        const ShaderSpecializationConstantDataView& specializationConstants,
+        BASE_NS::array_view<const DynamicStateEnum> dynamicStates, const RenderPassDesc& renderPassDesc,
+        const BASE_NS::array_view<const RenderPassSubpassDesc>& renderPassSubpassDescs, uint32_t subpassIndex,
+        const LowLevelRenderPassData* renderPassData, const LowLevelPipelineLayoutData* pipelineLayoutData) override;
+
+    BASE_NS::unique_ptr<ComputePipelineStateObject> CreateComputePipelineStateObject(
+        const GpuComputeProgram& gpuProgram, const PipelineLayout& pipelineLayout,
+        const ShaderSpecializationConstantDataView& specializationConstants,
+        const LowLevelPipelineLayoutData* pipelineLayoutData) override;
+
+    BASE_NS::unique_ptr<GpuSemaphore> CreateGpuSemaphore() override;
+    BASE_NS::unique_ptr<GpuSemaphore> CreateGpuSemaphoreView(uint64_t handle) override;
+
+    FrameStatisticsNull GetFrameStatistics() const;
+    // Called by the render backend when it is destroyed so the statistics are not read through a stale pointer.
+    void ReleaseRenderBackend(const RenderBackendNull& renderBackend);
+
+private:
+    void InitFormatProperties();
+
+    DevicePlatformData platData_;
+    BASE_NS::unique_ptr<LowLevelDeviceNull> lowLevelDevice_;
+    BASE_NS::vector<FormatProperties> formatProperties_;
+    RenderBackendNull* renderBackendNull_{nullptr};
+};
+
+BASE_NS::unique_ptr<Device> CreateDeviceNull(RenderContext& renderContext);
+
+// Wrapper for low level device access
+class LowLevelDeviceNull final : public ILowLevelDeviceNull {
+public:
+    explicit LowLevelDeviceNull(DeviceNull& deviceNull);
+    ~LowLevelDeviceNull() override = default;
+
+    DeviceBackendType GetBackendType() const override;
+    FrameStatisticsNull GetFrameStatistics() const override;
+
+private:
+    DeviceNull& deviceNull_;
+};
+RENDER_END_NAMESPACE()
+
+#endif  // NULL_DEVICE_NULL_H
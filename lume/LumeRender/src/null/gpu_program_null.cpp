@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_program_null.h"
+
+#include <base/math/mathf.h>
+#include <render/namespace.h>
+
+#include "device/gpu_program_util.h"
+#include "device/shader_manager.h"
+#include "util/log.h"
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+ShaderModuleNull::ShaderModuleNull(const ShaderModuleCreateInfo& createInfo)
+    : shaderStageFlags_(createInfo.shaderStageFlags)
+{
+    if (!createInfo.reflectionData.IsValid()) {
+        PLUGIN_LOG_E("invalid shader module reflection");
+        return;
+    }
+    pipelineLayout_ = createInfo.reflectionData.GetPipelineLayout();
+
+    constants_ = createInfo.reflectionData.GetSpecializationConstants();
+    sscv_.constants = constants_;
+
+    if (shaderStageFlags_ == ShaderStageFlagBits::CORE_SHADER_STAGE_VERTEX_BIT) {
+        vertexInputAttributeDescriptions_ = createInfo.reflectionData.GetInputDescriptions();
+        for (const auto& attrib : vertexInputAttributeDescriptions_) {
+            VertexInputDeclaration::VertexInputBindingDescription bindingDesc;
+            bindingDesc.binding = attrib.binding;
+            bindingDesc.stride = GpuProgramUtil::FormatByteSize(attrib.format);
+            bindingDesc.vertexInputRate = VertexInputRate::CORE_VERTEX_INPUT_RATE_VERTEX;
+            vertexInputBindingDescriptions_.push_back(bindingDesc);
+        }
+        vidv_.bindingDescriptions = vertexInputBindingDescriptions_;
+        vidv_.attributeDescriptions = vertexInputAttributeDescriptions_;
+    } else if (shaderStageFlags_ == ShaderStageFlagBits::CORE_SHADER_STAGE_COMPUTE_BIT) {
+        const Math::UVec3 tgs = createInfo.reflectionData.GetLocalSize();
+        stg_.x = tgs[0U];
+        stg_.y = tgs[1U];
+        stg_.z = tgs[2U];
+    }
+}
+
+ShaderStageFlags ShaderModuleNull::GetShaderStageFlags() const
+{
+    return shaderStageFlags_;
+}
+
+const ShaderModulePlatformData& ShaderModuleNull::GetPlatformData() const
+{
+    return plat_;
+}
+
+const PipelineLayout& ShaderModuleNull::GetPipelineLayout() const
+{
+    return pipelineLayout_;
+}
+
+ShaderSpecializationConstantView ShaderModuleNull::GetSpecilization() const
+{
+    return sscv_;
+}
+
+VertexInputDeclarationView ShaderModuleNull::GetVertexInputDeclaration() const
+{
+    return vidv_;
+}
+
+ShaderThreadGroup ShaderModuleNull::GetThreadGroupSize() const
+{
+    return stg_;
+}
+
+GpuShaderProgramNull::GpuShaderProgramNull(const GpuShaderProgramCreateData& createData)
+{
+    PLUGIN_ASSERT(createData.vertShaderModule);
+    PLUGIN_ASSERT(createData.fragShaderModule);
+    if (createData.vertShaderModule && createData.fragShaderModule) {
+        const ShaderModule& vert = *createData.vertShaderModule;
+        const ShaderModule& frag = *createData.fragShaderModule;
+        reflection_.pipelineLayout = vert.GetPipelineLayout();
+        // has sort inside
+        GpuProgramUtil::CombineSpecializationConstants(vert.GetSpecilization().constants, constants_);
+        GpuProgramUtil::CombineSpecializationConstants(frag.GetSpecilization().constants, constants_);
+        const auto& fragPl = frag.GetPipelineLayout();
+        GpuProgramUtil::CombinePipelineLayouts({&fragPl, 1U}, reflection_.pipelineLayout);
+
+        // not owned, directly reflected from vertex shader module
+        reflection_.vertexInputDeclarationView = vert.GetVertexInputDeclaration();
+        reflection_.shaderSpecializationConstantView.constants = constants_;
+    }
+}
+
+const ShaderReflection& GpuShaderProgramNull::GetReflection() const
+{
+    return reflection_;
+}
+
+GpuComputeProgramNull::GpuComputeProgramNull(const GpuComputeProgramCreateData& createData)
+{
+    PLUGIN_ASSERT(createData.compShaderModule);
+    if (createData.compShaderModule) {
+        const ShaderModule& comp = *createData.compShaderModule;
+        reflection_.pipelineLayout = comp.GetPipelineLayout();
+        const ShaderThreadGroup tgs = comp.GetThreadGroupSize();
+        reflection_.threadGroupSizeX = Math::max(1U, tgs.x);
+        reflection_.threadGroupSizeY = Math::max(1U, tgs.y);
+        reflection_.threadGroupSizeZ = Math::max(1U, tgs.z);
+        const auto sscv = comp.GetSpecilization();
+        constants_.append(sscv.constants.cbegin(), sscv.constants.cend());
+        reflection_.shaderSpecializationConstantView.constants = constants_;
+    }
+}
+
+const ComputeShaderReflection& GpuComputeProgramNull::GetReflection() const
+{
+    return reflection_;
+}
+RENDER_END_NAMESPACE()
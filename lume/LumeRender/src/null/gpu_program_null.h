@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NULL_GPU_PROGRAM_NULL_H
+#define NULL_GPU_PROGRAM_NULL_H
+
+#include <base/containers/vector.h>
+#include <render/device/pipeline_layout_desc.h>
+#include <render/device/pipeline_state_desc.h>
+#include <render/namespace.h>
+
+#include "device/gpu_program.h"
+#include "device/pipeline_state_object.h"
+#include "device/shader_module.h"
+
+RENDER_BEGIN_NAMESPACE()
+struct ShaderModuleCreateInfo;
+
+// Keeps only the reflection, there is nothing to compile.
+class ShaderModuleNull final : public ShaderModule {
+public:
+    explicit ShaderModuleNull(const ShaderModuleCreateInfo& createInfo);
+    ~ShaderModuleNull() override = default;
+
+    ShaderStageFlags GetShaderStageFlags() const override;
+    const ShaderModulePlatformData& GetPlatformData() const override;
+    const PipelineLayout& GetPipelineLayout() const override;
+    ShaderSpecializationConstantView GetSpecilization() const override;
+    VertexInputDeclarationView GetVertexInputDeclaration() const override;
+    ShaderThreadGroup GetThreadGroupSize() const override;
+
+private:
+    ShaderStageFlags shaderStageFlags_{0U};
+    ShaderModulePlatformData plat_;
+    PipelineLayout pipelineLayout_;
+    BASE_NS::vector<ShaderSpecialization::Constant> constants_;
+    ShaderSpecializationConstantView sscv_;
+    BASE_NS::vector<VertexInputDeclaration::VertexInputBindingDescription> vertexInputBindingDescriptions_;
+    BASE_NS::vector<VertexInputDeclaration::VertexInputAttributeDescription> vertexInputAttributeDescriptions_;
+    VertexInputDeclarationView vidv_;
+    ShaderThreadGroup stg_{0U, 0U, 0U};
+};
+
+class GpuShaderProgramNull final : public GpuShaderProgram {
+public:
+    explicit GpuShaderProgramNull(const GpuShaderProgramCreateData& createData);
+    ~GpuShaderProgramNull() override = default;
+
+    const ShaderReflection& GetReflection() const override;
+
+private:
+    ShaderReflection reflection_;
+    BASE_NS::vector<ShaderSpecialization::Constant> constants_;
+};
+
+class GpuComputeProgramNull final : public GpuComputeProgram {
+public:
+    explicit GpuComputeProgramNull(const GpuComputeProgramCreateData& createData);
+    ~GpuComputeProgramNull() override = default;
+
+    const ComputeShaderReflection& GetReflection() const override;
+
+private:
+    ComputeShaderReflection reflection_;
+    BASE_NS::vector<ShaderSpecialization::Constant> constants_;
+};
+
+class GraphicsPipelineStateObjectNull final : public GraphicsPipelineStateObject {
+public:
+    GraphicsPipelineStateObjectNull() = default;
+    ~GraphicsPipelineStateObjectNull() override = default;
+};
+
+class ComputePipelineStateObjectNull final : public ComputePipelineStateObject {
+public:
+    ComputePipelineStateObjectNull() = default;
+    ~ComputePipelineStateObjectNull() override = default;
+};
+RENDER_END_NAMESPACE()
+
+#endif  // NULL_GPU_PROGRAM_NULL_H
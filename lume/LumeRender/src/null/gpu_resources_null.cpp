@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_resources_null.h"
+
+#include <render/namespace.h>
+
+#include "device/device.h"
+#include "util/align_util.h"
+#include "util/log.h"
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+namespace {
+// matches the strictest uniform buffer offset alignment of the real backends
+constexpr uint32_t BUFFER_ALIGNMENT{256U};
+}  // namespace
+
+GpuBufferNull::GpuBufferNull(Device& device, const GpuBufferDesc& desc)
+    : desc_(desc), isMappable_((desc.memoryPropertyFlags & CORE_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0)
+{
+    plat_.alignedBindByteSize = Align(desc_.byteSize, BUFFER_ALIGNMENT);
+    plat_.alignedByteSize = plat_.alignedBindByteSize;
+    if (desc_.engineCreationFlags & CORE_ENGINE_BUFFER_CREATION_DYNAMIC_RING_BUFFER) {
+        isRingBuffer_ = true;
+        const uint64_t ringSize = static_cast<uint64_t>(plat_.alignedByteSize) * device.GetCommandBufferingCount();
+        plat_.alignedByteSize = (ringSize <= UINT32_MAX) ? static_cast<uint32_t>(ringSize) : plat_.alignedByteSize;
+    }
+    // only host visible buffers can be written by the CPU, others do not need any memory
+    if (isMappable_ && (plat_.alignedByteSize > 0U)) {
+        memory_.reset(new uint8_t[plat_.alignedByteSize]);
+        plat_.data = memory_.get();
+    }
+}
+
+GpuBufferNull::GpuBufferNull(Device& device, const GpuAccelerationStructureDesc& desc)
+    : GpuBufferNull(device, desc.bufferDesc)
+{}
+
+const GpuBufferDesc& GpuBufferNull::GetDesc() const
+{
+    return desc_;
+}
+
+const GpuBufferPlatformDataNull& GpuBufferNull::GetPlatformData() const
+{
+    return plat_;
+}
+
+void* GpuBufferNull::Map()
+{
+    if (!isMappable_) {
+        PLUGIN_LOG_E("trying to map non-mappable gpu buffer");
+        return nullptr;
+    }
+    if (isMapped_) {
+        PLUGIN_LOG_E("gpu buffer already mapped");
+        Unmap();
+    }
+    isMapped_ = true;
+
+    if (isRingBuffer_) {
+        plat_.currentByteOffset += plat_.alignedBindByteSize;
+        if (plat_.currentByteOffset >= plat_.alignedByteSize) {
+            plat_.currentByteOffset = 0U;
+        }
+    }
+    return plat_.data ? (plat_.data + plat_.currentByteOffset) : nullptr;
+}
+
+void* GpuBufferNull::MapMemory()
+{
+    if (!isMappable_) {
+        PLUGIN_LOG_E("trying to map non-mappable gpu buffer");
+        return nullptr;
+    }
+    if (isMapped_) {
+        PLUGIN_LOG_E("gpu buffer already mapped");
+        Unmap();
+    }
+    isMapped_ = true;
+    return plat_.data;
+}
+
+void GpuBufferNull::Unmap() const
+{
+    if (!isMappable_) {
+        PLUGIN_LOG_E("trying to unmap non-mappable gpu buffer");
+    }
+    if (!isMapped_) {
+        PLUGIN_LOG_E("gpu buffer not mapped");
+    }
+    isMapped_ = false;
+}
+
+GpuImageNull::GpuImageNull(const GpuImageDesc& desc) : desc_(desc)
+{}
+
+const GpuImageDesc& GpuImageNull::GetDesc() const
+{
+    return desc_;
+}
+
+const GpuImagePlatformData& GpuImageNull::GetBasePlatformData() const
+{
+    return plat_;
+}
+
+GpuImage::AdditionalFlags GpuImageNull::GetAdditionalFlags() const
+{
+    return 0U;
+}
+
+GpuSamplerNull::GpuSamplerNull(const GpuSamplerDesc& desc) : desc_(desc)
+{}
+
+const GpuSamplerDesc& GpuSamplerNull::GetDesc() const
+{
+    return desc_;
+}
+
+GpuSemaphoreNull::GpuSemaphoreNull(uint64_t handle) : handle_(handle)
+{}
+
+uint64_t GpuSemaphoreNull::GetHandle() const
+{
+    return handle_;
+}
+
+void RenderFrameSyncNull::BeginFrame()
+{}
+
+void RenderFrameSyncNull::WaitForFrameFence()
+{}
+RENDER_END_NAMESPACE()
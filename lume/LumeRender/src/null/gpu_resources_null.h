@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NULL_GPU_RESOURCES_NULL_H
+#define NULL_GPU_RESOURCES_NULL_H
+
+#include <cstdint>
+
+#include <base/containers/unique_ptr.h>
+#include <render/device/gpu_resource_desc.h>
+#include <render/device/intf_device.h>
+#include <render/namespace.h>
+
+#include "device/gpu_buffer.h"
+#include "device/gpu_image.h"
+#include "device/gpu_sampler.h"
+#include "device/gpu_semaphore.h"
+#include "device/render_frame_sync.h"
+
+RENDER_BEGIN_NAMESPACE()
+class Device;
+
+struct GpuBufferPlatformDataNull final : public GpuBufferPlatformData {
+    // host memory backing the buffer, only for mappable buffers
+    uint8_t* data{nullptr};
+    uint32_t alignedBindByteSize{0U};
+    uint32_t alignedByteSize{0U};
+    // map changes offset if buffered
+    uint32_t currentByteOffset{0U};
+};
+
+class GpuBufferNull final : public GpuBuffer {
+public:
+    GpuBufferNull(Device& device, const GpuBufferDesc& desc);
+    GpuBufferNull(Device& device, const GpuAccelerationStructureDesc& desc);
+    ~GpuBufferNull() override = default;
+
+    const GpuBufferDesc& GetDesc() const override;
+    const GpuBufferPlatformDataNull& GetPlatformData() const;
+
+    void* Map() override;
+    void* MapMemory() override;
+    void Unmap() const override;
+
+private:
+    GpuBufferPlatformDataNull plat_;
+    GpuBufferDesc desc_;
+    BASE_NS::unique_ptr<uint8_t[]> memory_;
+
+    bool isRingBuffer_{false};
+    bool isMappable_{false};
+    mutable bool isMapped_{false};
+};
+
+class GpuImageNull final : public GpuImage {
+public:
+    explicit GpuImageNull(const GpuImageDesc& desc);
+    ~GpuImageNull() override = default;
+
+    const GpuImageDesc& GetDesc() const override;
+    const GpuImagePlatformData& GetBasePlatformData() const override;
+    AdditionalFlags GetAdditionalFlags() const override;
+
+private:
+    GpuImagePlatformData plat_;
+    GpuImageDesc desc_;
+};
+
+class GpuSamplerNull final : public GpuSampler {
+public:
+    explicit GpuSamplerNull(const GpuSamplerDesc& desc);
+    ~GpuSamplerNull() override = default;
+
+    const GpuSamplerDesc& GetDesc() const override;
+
+private:
+    GpuSamplerDesc desc_;
+};
+
+class GpuSemaphoreNull final : public GpuSemaphore {
+public:
+    GpuSemaphoreNull() = default;
+    explicit GpuSemaphoreNull(uint64_t handle);
+    ~GpuSemaphoreNull() override = default;
+
+    uint64_t GetHandle() const override;
+
+private:
+    uint64_t handle_{0U};
+};
+
+class RenderFrameSyncNull final : public RenderFrameSync {
+public:
+    RenderFrameSyncNull() = default;
+    ~RenderFrameSyncNull() override = default;
+
+    // there is no GPU work to wait for
+    void BeginFrame() override;
+    void WaitForFrameFence() override;
+};
+RENDER_END_NAMESPACE()
+
+#endif  // NULL_GPU_RESOURCES_NULL_H
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "node_context_descriptor_set_manager_null.h"
+
+#include <render/namespace.h>
+
+#include "device/device.h"
+#include "device/gpu_resource_handle_util.h"
+#include "device/gpu_resource_manager.h"
+#include "util/log.h"
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+namespace {
+CpuDescriptorSet CreateCpuDescriptorSetData(
+    const array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings)
+{
+    uint32_t dynamicOffsetCount = 0;
+    CpuDescriptorSet newSet;
+    newSet.bindings.reserve(descriptorSetLayoutBindings.size());
+    LowLevelDescriptorCounts descriptorCounts;
+    for (const auto& refBinding : descriptorSetLayoutBindings) {
+        // NOTE: sort from 0 to n
+        newSet.bindings.push_back({refBinding, {}});
+        NodeContextDescriptorSetManager::IncreaseDescriptorSetCounts(refBinding, descriptorCounts, dynamicOffsetCount);
+    }
+    newSet.buffers.resize(descriptorCounts.bufferCount);
+    newSet.images.resize(descriptorCounts.imageCount);
+    newSet.samplers.resize(descriptorCounts.samplerCount);
+
+    newSet.dynamicOffsetDescriptors.resize(dynamicOffsetCount);
+    return newSet;
+}
+
+// Bound resources which do not resolve would be skipped or crash when writing the real descriptor sets.
+template<typename Getter>
+bool IsValidOrUnbound(const RenderHandle handle, Getter&& getter)
+{
+    return (!RenderHandleUtil::IsValid(handle)) || (getter(handle) != nullptr);
+}
+
+bool HasValidResources(const GpuResourceManager& gpuResourceMgr, const CpuDescriptorSet& set)
+{
+    const auto getBuffer = [&gpuResourceMgr](const RenderHandle handle) { return gpuResourceMgr.GetBuffer(handle); };
+    const auto getImage = [&gpuResourceMgr](const RenderHandle handle) { return gpuResourceMgr.GetImage(handle); };
+    const auto getSampler = [&gpuResourceMgr](const RenderHandle handle) { return gpuResourceMgr.GetSampler(handle); };
+    for (const auto& ref : set.buffers) {
+        if (!IsValidOrUnbound(ref.desc.resource.handle, getBuffer)) {
+            return false;
+        }
+    }
+    for (const auto& ref : set.images) {
+        if ((!IsValidOrUnbound(ref.desc.resource.handle, getImage)) ||
+            (!IsValidOrUnbound(ref.desc.resource.samplerHandle, getSampler))) {
+            return false;
+        }
+    }
+    for (const auto& ref : set.samplers) {
+        if (!IsValidOrUnbound(ref.desc.resource.handle, getSampler)) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+DescriptorSetManagerNull::DescriptorSetManagerNull(Device& device) : DescriptorSetManager(device)
+{}
+
+void DescriptorSetManagerNull::BeginFrame()
+{
+    DescriptorSetManager::BeginFrame();
+}
+
+void DescriptorSetManagerNull::BeginBackendFrame()
+{
+    // handle write locking
+    // handle possible destruction
+    for (const auto& descriptorSet : descriptorSets_) {
+        if (GlobalDescriptorSetBase* descriptorSetBase = descriptorSet.get(); descriptorSetBase) {
+            bool destroyDescriptorSets = true;
+            // if we have any descriptor sets in use we do not destroy the pool
+            for (auto& ref : descriptorSetBase->data) {
+                if (ref.renderHandleReference.GetRefCount() > 1) {
+                    destroyDescriptorSets = false;
+                }
+                ref.frameWriteLocked = false;
+            }
+
+            if (destroyDescriptorSets) {
+                if (!descriptorSetBase->data.empty()) {
+                    const RenderHandle handle = descriptorSetBase->data[0U].renderHandleReference.GetHandle();
+                    // set handle (index location) to be available
+                    availableHandles_.push_back(handle);
+                }
+                nameToIndex_.erase(descriptorSetBase->name);
+                *descriptorSetBase = {};
+            }
+        }
+    }
+}
+
+void DescriptorSetManagerNull::CreateDescriptorSets(const uint32_t arrayIndex, const uint32_t descriptorSetCount,
+    const array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings)
+{
+    PLUGIN_ASSERT((arrayIndex < descriptorSets_.size()) && (descriptorSets_[arrayIndex]));
+    PLUGIN_ASSERT(descriptorSets_[arrayIndex]->data.size() == descriptorSetCount);
+    if ((arrayIndex < descriptorSets_.size()) && (descriptorSets_[arrayIndex])) {
+        GlobalDescriptorSetBase* cpuData = descriptorSets_[arrayIndex].get();
+        for (uint32_t idx = 0; idx < descriptorSetCount; ++idx) {
+            cpuData->data[idx].cpuDescriptorSet = CreateCpuDescriptorSetData(descriptorSetLayoutBindings);
+        }
+    }
+}
+
+bool DescriptorSetManagerNull::UpdateDescriptorSetGpuHandle(const RenderHandle& handle)
+{
+    const uint32_t arrayIndex = RenderHandleUtil::GetIndexPart(handle);
+    const uint32_t additionalIndex = RenderHandleUtil::GetAdditionalIndexPart(handle);
+    if ((arrayIndex >= descriptorSets_.size()) || (!descriptorSets_[arrayIndex]) ||
+        (additionalIndex >= descriptorSets_[arrayIndex]->data.size())) {
+        PLUGIN_LOG_E("invalid handle in descriptor set management");
+        return false;
+    }
+    const auto& gpuResourceMgr = static_cast<const GpuResourceManager&>(device_.GetGpuResourceManager());
+    return HasValidResources(gpuResourceMgr, descriptorSets_[arrayIndex]->data[additionalIndex].cpuDescriptorSet);
+}
+
+void DescriptorSetManagerNull::UpdateCpuDescriptorSetPlatform(
+    const DescriptorSetLayoutBindingResources& bindingResources)
+{}
+
+NodeContextDescriptorSetManagerNull::NodeContextDescriptorSetManagerNull(Device& device)
+    : NodeContextDescriptorSetManager(device)
+{}
+
+void NodeContextDescriptorSetManagerNull::BeginFrame()
+{
+    NodeContextDescriptorSetManager::BeginFrame();
+
+    oneFrameDescSetGeneration_ = (oneFrameDescSetGeneration_ + 1U) % MAX_ONE_FRAME_GENERATION_IDX;
+}
+
+RenderHandle NodeContextDescriptorSetManagerNull::CreateDescriptorSet(
+    const array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings)
+{
+    RenderHandle clientHandle;
+    auto& cpuDescriptorSets = cpuDescriptorSets_[DESCRIPTOR_SET_INDEX_TYPE_STATIC];
+    if (cpuDescriptorSets.size() < maxSets_) {
+        const auto arrayIndex = static_cast<uint32_t>(cpuDescriptorSets.size());
+        cpuDescriptorSets.push_back(CreateCpuDescriptorSetData(descriptorSetLayoutBindings));
+        // NOTE: can be used directly to index
+        clientHandle = RenderHandleUtil::CreateHandle(RenderHandleType::DESCRIPTOR_SET, arrayIndex, 0);
+    } else {
+        PLUGIN_LOG_E("RENDER_VALIDATION: No more descriptor sets available");
+    }
+    return clientHandle;
+}
+
+RenderHandle NodeContextDescriptorSetManagerNull::CreateOneFrameDescriptorSet(
+    const array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings)
+{
+    auto& cpuDescriptorSets = cpuDescriptorSets_[DESCRIPTOR_SET_INDEX_TYPE_ONE_FRAME];
+    const auto arrayIndex = static_cast<uint32_t>(cpuDescriptorSets.size());
+    cpuDescriptorSets.push_back(CreateCpuDescriptorSetData(descriptorSetLayoutBindings));
+    // NOTE: can be used directly to index
+    return RenderHandleUtil::CreateHandle(
+        RenderHandleType::DESCRIPTOR_SET, arrayIndex, oneFrameDescSetGeneration_, ONE_FRAME_DESC_SET_BIT);
+}
+
+bool NodeContextDescriptorSetManagerNull::UpdateDescriptorSetGpuHandle(const RenderHandle handle)
+{
+    const uint32_t arrayIndex = RenderHandleUtil::GetIndexPart(handle);
+    const uint32_t oneFrameDescBit = RenderHandleUtil::GetAdditionalData(handle);
+    const uint32_t descSetIdx = (oneFrameDescBit & ONE_FRAME_DESC_SET_BIT) ? DESCRIPTOR_SET_INDEX_TYPE_ONE_FRAME
+                                                                           : DESCRIPTOR_SET_INDEX_TYPE_STATIC;
+    const auto& cpuDescriptorSets = cpuDescriptorSets_[descSetIdx];
+    if (arrayIndex >= static_cast<uint32_t>(cpuDescriptorSets.size())) {
+        PLUGIN_LOG_E("invalid handle in descriptor set management");
+        return false;
+    }
+    if ((oneFrameDescBit & ONE_FRAME_DESC_SET_BIT) &&
+        (RenderHandleUtil::GetGenerationIndexPart(handle) != oneFrameDescSetGeneration_)) {
+        PLUGIN_LOG_E("RENDER_VALIDATION: invalid one frame descriptor set handle generation. One frame descriptor "
+                     "sets can only be used once.");
+        return false;
+    }
+    const auto& gpuResourceMgr = static_cast<const GpuResourceManager&>(device_.GetGpuResourceManager());
+    return HasValidResources(gpuResourceMgr, cpuDescriptorSets[arrayIndex]);
+}
+
+void NodeContextDescriptorSetManagerNull::UpdateCpuDescriptorSetPlatform(
+    const DescriptorSetLayoutBindingResources& bindingResources)
+{}
+RENDER_END_NAMESPACE()
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NULL_NODE_CONTEXT_DESCRIPTOR_SET_MANAGER_NULL_H
+#define NULL_NODE_CONTEXT_DESCRIPTOR_SET_MANAGER_NULL_H
+
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <render/device/pipeline_layout_desc.h>
+#include <render/namespace.h>
+
+#include "nodecontext/node_context_descriptor_set_manager.h"
+
+RENDER_BEGIN_NAMESPACE()
+class Device;
+
+// The null backend has no GPU descriptor sets. Updates only check that the bound resources still exist.
+class DescriptorSetManagerNull final : public DescriptorSetManager {
+public:
+    explicit DescriptorSetManagerNull(Device& device);
+    ~DescriptorSetManagerNull() override = default;
+
+    void BeginFrame() override;
+    void BeginBackendFrame();
+
+    bool UpdateDescriptorSetGpuHandle(const RenderHandle& handle) override;
+    void UpdateCpuDescriptorSetPlatform(const DescriptorSetLayoutBindingResources& bindingResources) override;
+
+protected:
+    void CreateDescriptorSets(const uint32_t arrayIndex, const uint32_t descriptorSetCount,
+        const BASE_NS::array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings) override;
+};
+
+class NodeContextDescriptorSetManagerNull final : public NodeContextDescriptorSetManager {
+public:
+    explicit NodeContextDescriptorSetManagerNull(Device& device);
+    ~NodeContextDescriptorSetManagerNull() override = default;
+
+    void BeginFrame() override;
+
+    RenderHandle CreateDescriptorSet(
+        const BASE_NS::array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings) override;
+    RenderHandle CreateOneFrameDescriptorSet(
+        const BASE_NS::array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings) override;
+
+    bool UpdateDescriptorSetGpuHandle(const RenderHandle handle) override;
+    void UpdateCpuDescriptorSetPlatform(const DescriptorSetLayoutBindingResources& bindingResources) override;
+
+private:
+    uint32_t oneFrameDescSetGeneration_{0U};
+    static constexpr uint32_t MAX_ONE_FRAME_GENERATION_IDX{16U};
+};
+RENDER_END_NAMESPACE()
+
+#endif  // NULL_NODE_CONTEXT_DESCRIPTOR_SET_MANAGER_NULL_H
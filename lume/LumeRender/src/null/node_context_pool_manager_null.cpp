@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "node_context_pool_manager_null.h"
+
+#include <render/namespace.h>
+
+#include "device/device.h"
+
+RENDER_BEGIN_NAMESPACE()
+NodeContextPoolManagerNull::NodeContextPoolManagerNull(Device& device) : device_(device)
+{}
+
+void NodeContextPoolManagerNull::BeginFrame()
+{
+    const uint32_t bufferingCount = device_.GetCommandBufferingCount();
+    if (bufferingCount > 0U) {
+        bufferingIndex_ = (bufferingIndex_ + 1U) % bufferingCount;
+    }
+}
+
+void NodeContextPoolManagerNull::BeginBackendFrame()
+{
+    // no command pools or framebuffers to recycle
+}
+
+#if ((RENDER_VALIDATION_ENABLED == 1) || (RENDER_VULKAN_VALIDATION_ENABLED == 1))
+void NodeContextPoolManagerNull::SetValidationDebugName(BASE_NS::string_view debugName)
+{}
+#endif
+RENDER_END_NAMESPACE()
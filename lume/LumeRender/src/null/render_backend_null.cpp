@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "render_backend_null.h"
+
+#include <core/perf/intf_performance_data_manager.h>
+#include <render/namespace.h>
+
+#include "device/device.h"
+#include "device/gpu_resource_handle_util.h"
+#include "device/gpu_resource_manager.h"
+#include "nodecontext/node_context_descriptor_set_manager.h"
+#include "nodecontext/node_context_pool_manager.h"
+#include "nodecontext/node_context_pso_manager.h"
+#include "nodecontext/render_node_graph_node_store.h"  // RenderCommandFrameData
+#include "null/device_null.h"
+#include "null/gpu_resources_null.h"
+#include "null/node_context_descriptor_set_manager_null.h"
+#include "util/log.h"
+#include "util/render_frame_util.h"
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+namespace {
+uint64_t GetVertexCount(const RenderCommandDraw& renderCmd)
+{
+    const uint32_t count = (renderCmd.indexCount > 0U) ? renderCmd.indexCount : renderCmd.vertexCount;
+    return static_cast<uint64_t>(count) * renderCmd.instanceCount;
+}
+}  // namespace
+
+RenderBackendNull::RenderBackendNull(DeviceNull& device, GpuResourceManager& gpuResourceMgr)
+    : device_(device), gpuResourceMgr_(gpuResourceMgr)
+{}
+
+RenderBackendNull::~RenderBackendNull()
+{
+    device_.ReleaseRenderBackend(*this);
+}
+
+void RenderBackendNull::Render(RenderCommandFrameData& renderCommandFrameData,
+    [[maybe_unused]] const RenderBackendBackBufferConfiguration& backBufferConfig)
+{
+    // NOTE: all command lists are validated before entering here
+    // NOTE: the null device has no swapchains, so there are no back buffers to acquire or present
+#if (RENDER_PERF_ENABLED == 1)
+    commonCpuTimers_.full.Begin();
+    // nothing to acquire without a swapchain
+    commonCpuTimers_.acquire.Begin();
+    commonCpuTimers_.acquire.End();
+    commonCpuTimers_.execute.Begin();
+#endif
+    frameStatistics_ = {};
+
+    // global begin backend frame
+    auto& descriptorSetMgr = static_cast<DescriptorSetManagerNull&>(device_.GetDescriptorSetManager());
+    descriptorSetMgr.BeginBackendFrame();
+    UpdateGlobalDescriptorSets();
+
+    for (const auto& ref : renderCommandFrameData.renderCommandContexts) {
+        RenderSingleCommandList(ref);
+    }
+#if (RENDER_PERF_ENABLED == 1)
+    commonCpuTimers_.execute.End();
+    commonCpuTimers_.submit.Begin();
+#endif
+    SignalGpuSignals(renderCommandFrameData);
+    lastFrameStatistics_ = frameStatistics_;
+#if (RENDER_PERF_ENABLED == 1)
+    commonCpuTimers_.submit.End();
+    commonCpuTimers_.full.End();
+    EndFrameTimers();
+#endif
+}
+
+void RenderBackendNull::Present([[maybe_unused]] const RenderBackendBackBufferConfiguration& backBufferConfig)
+{
+#if (RENDER_PERF_ENABLED == 1)
+    commonCpuTimers_.present.Begin();
+    commonCpuTimers_.present.End();
+#endif
+}
+
+FrameStatisticsNull RenderBackendNull::GetFrameStatistics() const
+{
+    return lastFrameStatistics_;
+}
+
+void RenderBackendNull::RenderSingleCommandList(const RenderCommandContext& renderCommandCtx)
+{
+    // these are validated in render graph
+    renderCommandCtx.nodeContextPoolMgr->BeginBackendFrame();
+    renderCommandCtx.nodeContextPsoMgr->BeginBackendFrame();
+
+    // update cmd list context descriptor sets
+    UpdateCommandListDescriptorSets(*renderCommandCtx.renderCommandList, *renderCommandCtx.nodeContextDescriptorSetMgr);
+
+#if (RENDER_PERF_ENABLED == 1)
+    CpuTimer& cpuTimer = timers_[renderCommandCtx.debugName];
+    cpuTimer.Begin();
+#endif
+    // NOTE: backend specific render nodes (renderBackendNode) need a real backend and are skipped
+    CommandListState state;
+    state.psoMgr = renderCommandCtx.nodeContextPsoMgr;
+    const auto renderCommands = renderCommandCtx.renderCommandList->GetRenderCommands();
+    for (const auto& ref : renderCommands) {
+        PLUGIN_ASSERT(ref.rc);
+        ProcessCommand(ref, state);
+    }
+    frameStatistics_.commandListCount++;
+    frameStatistics_.commandCount += static_cast<uint32_t>(renderCommands.size());
+#if (RENDER_PERF_ENABLED == 1)
+    cpuTimer.End();
+    if (CORE_NS::IPerformanceDataManagerFactory* globalPerfData =
+            RENDER_NS::GetInstance<CORE_NS::IPerformanceDataManagerFactory>(CORE_NS::UID_PERFORMANCE_FACTORY);
+        globalPerfData) {
+        if (CORE_NS::IPerformanceDataManager* perfData = globalPerfData->Get("RenderNode"); perfData) {
+            perfData->UpdateData(renderCommandCtx.debugName, "Backend_Cpu", cpuTimer.GetMicroseconds());
+        }
+    }
+#endif
+}
+
+void RenderBackendNull::ProcessCommand(const RenderCommandWithType& ref, CommandListState& state)
+{
+    switch (ref.type) {
+        case RenderCommandType::DRAW:
+        case RenderCommandType::DRAW_INDIRECT:
+            ProcessDraw(ref, state);
+            break;
+        case RenderCommandType::DISPATCH:
+        case RenderCommandType::DISPATCH_INDIRECT:
+            ProcessDispatch(ref, state);
+            break;
+        case RenderCommandType::BIND_PIPELINE:
+            ProcessBindPipeline(*static_cast<const RenderCommandBindPipeline*>(ref.rc), state);
+            break;
+        case RenderCommandType::BEGIN_RENDER_PASS: {
+            const auto& renderCmd = *static_cast<const RenderCommandBeginRenderPass*>(ref.rc);
+            Validate(!state.inRenderPass, "render pass begun inside a render pass");
+            for (uint32_t idx = 0U; idx < renderCmd.renderPassDesc.attachmentCount; ++idx) {
+                Validate(IsValidImage(renderCmd.renderPassDesc.attachmentHandles[idx]), "invalid attachment");
+            }
+            state.inRenderPass = true;
+            state.renderPass = &renderCmd;
+            state.subpassIndex = renderCmd.subpassStartIndex;
+            // patched multi command list render passes are counted once
+            if (renderCmd.beginType == RenderPassBeginType::RENDER_PASS_BEGIN) {
+                frameStatistics_.renderPassCount++;
+            }
+            break;
+        }
+        case RenderCommandType::NEXT_SUBPASS:
+            Validate(state.inRenderPass, "next subpass outside of a render pass");
+            if (state.renderPass) {
+                ++state.subpassIndex;
+                Validate(state.subpassIndex < state.renderPass->renderPassDesc.subpassCount, "invalid subpass index");
+            }
+            break;
+        case RenderCommandType::END_RENDER_PASS:
+            Validate(state.inRenderPass, "render pass ended outside of a render pass");
+            state.inRenderPass = false;
+            state.renderPass = nullptr;
+            state.subpassIndex = 0U;
+            break;
+        case RenderCommandType::BIND_VERTEX_BUFFERS: {
+            const auto& renderCmd = *static_cast<const RenderCommandBindVertexBuffers*>(ref.rc);
+            for (uint32_t idx = 0U; idx < renderCmd.vertexBufferCount; ++idx) {
+                Validate(IsValidBuffer(renderCmd.vertexBuffers[idx].bufferHandle), "invalid vertex buffer");
+            }
+            break;
+        }
+        case RenderCommandType::BIND_INDEX_BUFFER: {
+            const auto& renderCmd = *static_cast<const RenderCommandBindIndexBuffer*>(ref.rc);
+            Validate(IsValidBuffer(renderCmd.indexBuffer.bufferHandle), "invalid index buffer");
+            break;
+        }
+        case RenderCommandType::BIND_DESCRIPTOR_SETS: {
+            const auto& renderCmd = *static_cast<const RenderCommandBindDescriptorSets*>(ref.rc);
+            Validate(state.pipelineBound && (renderCmd.psoHandle == state.psoHandle), "psoHandle mismatch");
+            Validate((renderCmd.firstSet + renderCmd.setCount) <= PipelineLayoutConstants::MAX_DESCRIPTOR_SET_COUNT,
+                "invalid descriptor set range");
+            frameStatistics_.descriptorSetBindCount += renderCmd.setCount;
+            break;
+        }
+        case RenderCommandType::PUSH_CONSTANT: {
+            const auto& renderCmd = *static_cast<const RenderCommandPushConstant*>(ref.rc);
+            Validate(state.pipelineBound && (renderCmd.psoHandle == state.psoHandle), "psoHandle mismatch");
+            break;
+        }
+        case RenderCommandType::COPY_BUFFER:
+        case RenderCommandType::COPY_BUFFER_IMAGE:
+        case RenderCommandType::COPY_IMAGE:
+        case RenderCommandType::BLIT_IMAGE:
+        case RenderCommandType::CLEAR_COLOR_IMAGE:
+            ProcessTransfer(ref);
+            break;
+        case RenderCommandType::UNDEFINED:
+        case RenderCommandType::COUNT:
+            Validate(false, "non-valid render command");
+            break;
+        default:
+            // barriers, dynamic states, markers, queries and acceleration structures have nothing to validate
+            break;
+    }
+}
+
+void RenderBackendNull::ProcessDraw(const RenderCommandWithType& ref, const CommandListState& state)
+{
+    Validate(state.inRenderPass, "draw outside of a render pass");
+    Validate(state.pipelineBound && (state.bindPoint == PipelineBindPoint::CORE_PIPELINE_BIND_POINT_GRAPHICS),
+        "draw without a graphics pipeline");
+    if (ref.type == RenderCommandType::DRAW) {
+        const auto& renderCmd = *static_cast<const RenderCommandDraw*>(ref.rc);
+        frameStatistics_.drawCount++;
+        frameStatistics_.instanceCount += renderCmd.instanceCount;
+        frameStatistics_.vertexCount += GetVertexCount(renderCmd);
+    } else {
+        const auto& renderCmd = *static_cast<const RenderCommandDrawIndirect*>(ref.rc);
+        Validate(IsValidBuffer(renderCmd.argsHandle), "invalid indirect args buffer");
+        frameStatistics_.drawIndirectCount++;
+    }
+}
+
+void RenderBackendNull::ProcessDispatch(const RenderCommandWithType& ref, const CommandListState& state)
+{
+    Validate(!state.inRenderPass, "dispatch inside a render pass");
+    Validate(state.pipelineBound && (state.bindPoint == PipelineBindPoint::CORE_PIPELINE_BIND_POINT_COMPUTE),
+        "dispatch without a compute pipeline");
+    if (ref.type == RenderCommandType::DISPATCH) {
+        frameStatistics_.dispatchCount++;
+    } else {
+        const auto& renderCmd = *static_cast<const RenderCommandDispatchIndirect*>(ref.rc);
+        Validate(IsValidBuffer(renderCmd.argsHandle), "invalid indirect args buffer");
+        frameStatistics_.dispatchIndirectCount++;
+    }
+}
+
+void RenderBackendNull::ProcessBindPipeline(const RenderCommandBindPipeline& renderCmd, CommandListState& state)
+{
+    // fetching the pso creates the shader programs and pipeline state objects like with the real backends
+    bool valid = false;
+    if (renderCmd.pipelineBindPoint == PipelineBindPoint::CORE_PIPELINE_BIND_POINT_COMPUTE) {
+        Validate(!state.inRenderPass, "compute pipeline bound inside a render pass");
+        valid = state.psoMgr->GetComputePso(renderCmd.psoHandle, nullptr) != nullptr;
+    } else if (renderCmd.pipelineBindPoint == PipelineBindPoint::CORE_PIPELINE_BIND_POINT_GRAPHICS) {
+        Validate(state.renderPass != nullptr, "graphics pipeline bound outside of a render pass");
+        if (state.renderPass) {
+            valid = state.psoMgr->GetGraphicsPso(renderCmd.psoHandle, state.renderPass->renderPassDesc,
+                        state.renderPass->subpasses, state.subpassIndex, 0, nullptr, nullptr) != nullptr;
+        }
+    }
+    Validate(valid, "invalid pipeline");
+    state.psoHandle = renderCmd.psoHandle;
+    state.bindPoint = renderCmd.pipelineBindPoint;
+    state.pipelineBound = valid;
+    frameStatistics_.pipelineBindCount++;
+}
+
+void RenderBackendNull::ProcessTransfer(const RenderCommandWithType& ref)
+{
+    bool valid = true;
+    switch (ref.type) {
+        case RenderCommandType::COPY_BUFFER: {
+            const auto& renderCmd = *static_cast<const RenderCommandCopyBuffer*>(ref.rc);
+            valid = IsValidBuffer(renderCmd.srcHandle) && IsValidBuffer(renderCmd.dstHandle);
+            break;
+        }
+        case RenderCommandType::COPY_BUFFER_IMAGE: {
+            const auto& renderCmd = *static_cast<const RenderCommandCopyBufferImage*>(ref.rc);
+            if (renderCmd.copyType == RenderCommandCopyBufferImage::CopyType::BUFFER_TO_IMAGE) {
+                valid = IsValidBuffer(renderCmd.srcHandle) && IsValidImage(renderCmd.dstHandle);
+            } else {
+                valid = IsValidImage(renderCmd.srcHandle) && IsValidBuffer(renderCmd.dstHandle);
+            }
+            break;
+        }
+        case RenderCommandType::COPY_IMAGE: {
+            const auto& renderCmd = *static_cast<const RenderCommandCopyImage*>(ref.rc);
+            valid = IsValidImage(renderCmd.srcHandle) && IsValidImage(renderCmd.dstHandle);
+            break;
+        }
+        case RenderCommandType::BLIT_IMAGE: {
+            const auto& renderCmd = *static_cast<const RenderCommandBlitImage*>(ref.rc);
+            valid = IsValidImage(renderCmd.srcHandle) && IsValidImage(renderCmd.dstHandle);
+            break;
+        }
+        case RenderCommandType::CLEAR_COLOR_IMAGE: {
+            const auto& renderCmd = *static_cast<const RenderCommandClearColorImage*>(ref.rc);
+            valid = IsValidImage(renderCmd.handle);
+            break;
+        }
+        default:
+            break;
+    }
+    Validate(valid, "invalid transfer resource");
+    frameStatistics_.copyCount++;
+}
+
+void RenderBackendNull::UpdateGlobalDescriptorSets()
+{
+    auto& descriptorSetMgr = static_cast<DescriptorSetManagerNull&>(device_.GetDescriptorSetManager());
+    for (const auto& descHandle : descriptorSetMgr.GetUpdateDescriptorSetHandles()) {
+        if (RenderHandleUtil::GetHandleType(descHandle) != RenderHandleType::DESCRIPTOR_SET) {
+            continue;
+        }
+        Validate(descriptorSetMgr.UpdateDescriptorSetGpuHandle(descHandle), "invalid global descriptor set");
+        frameStatistics_.descriptorSetUpdateCount++;
+    }
+}
+
+void RenderBackendNull::UpdateCommandListDescriptorSets(
+    const RenderCommandList& renderCommandList, NodeContextDescriptorSetManager& ncdsm)
+{
+    for (const auto& descHandle : renderCommandList.GetUpdateDescriptorSetHandles()) {
+        if (RenderHandleUtil::GetHandleType(descHandle) != RenderHandleType::DESCRIPTOR_SET) {
+            continue;
+        }
+        Validate(ncdsm.UpdateDescriptorSetGpuHandle(descHandle), "invalid descriptor set");
+        frameStatistics_.descriptorSetUpdateCount++;
+    }
+}
+
+void RenderBackendNull::SignalGpuSignals(RenderCommandFrameData& renderCommandFrameData)
+{
+    // there is no GPU work to wait for, external signals are signaled right away
+    if (renderCommandFrameData.renderFrameUtil && renderCommandFrameData.renderFrameUtil->HasGpuSignals()) {
+        auto externalSignals = renderCommandFrameData.renderFrameUtil->GetFrameGpuSignalData();
+        const auto externalSemaphores = renderCommandFrameData.renderFrameUtil->GetGpuSemaphores();
+        PLUGIN_ASSERT(externalSignals.size() == externalSemaphores.size());
+        if (externalSignals.size() == externalSemaphores.size()) {
+            for (size_t sigIdx = 0; sigIdx < externalSignals.size(); ++sigIdx) {
+                if (!externalSignals[sigIdx].signaled && (externalSemaphores[sigIdx])) {
+                    externalSignals[sigIdx].gpuSignalResourceHandle = externalSemaphores[sigIdx]->GetHandle();
+                    externalSignals[sigIdx].signaled = true;
+                }
+            }
+        }
+    }
+}
+
+bool RenderBackendNull::IsValidBuffer(const RenderHandle handle) const
+{
+    return gpuResourceMgr_.GetBuffer(handle) != nullptr;
+}
+
+bool RenderBackendNull::IsValidImage(const RenderHandle handle) const
+{
+    return gpuResourceMgr_.GetImage(handle) != nullptr;
+}
+
+void RenderBackendNull::Validate(const bool valid, const char* message)
+{
+    if (!valid) {
+        frameStatistics_.validationErrorCount++;
+#if (RENDER_VALIDATION_ENABLED == 1)
+        PLUGIN_LOG_ONCE_E(message, "RENDER_VALIDATION: null backend: %s", message);
+#endif
+    }
+}
+
+#if (RENDER_PERF_ENABLED == 1)
+void RenderBackendNull::EndFrameTimers()
+{
+    if (CORE_NS::IPerformanceDataManagerFactory* globalPerfData =
+            RENDER_NS::GetInstance<CORE_NS::IPerformanceDataManagerFactory>(CORE_NS::UID_PERFORMANCE_FACTORY);
+        globalPerfData) {
+        CORE_NS::IPerformanceDataManager* perfData = globalPerfData->Get("RENDER");
+        if (!perfData) {
+            return;
+        }
+        perfData->UpdateData("RenderBackend", "Full_Cpu", commonCpuTimers_.full.GetMicroseconds());
+        perfData->UpdateData("RenderBackend", "Acquire_Cpu", commonCpuTimers_.acquire.GetMicroseconds());
+        perfData->UpdateData("RenderBackend", "Execute_Cpu", commonCpuTimers_.execute.GetMicroseconds());
+        perfData->UpdateData("RenderBackend", "Submit_Cpu", commonCpuTimers_.submit.GetMicroseconds());
+        perfData->UpdateData("RenderBackend", "Present_Cpu", commonCpuTimers_.present.GetMicroseconds());
+    }
+}
+#endif
+RENDER_END_NAMESPACE()
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NULL_RENDER_BACKEND_NULL_H
+#define NULL_RENDER_BACKEND_NULL_H
+
+#include <base/containers/string.h>
+#include <base/containers/unordered_map.h>
+#include <render/namespace.h>
+#include <render/null/intf_device_null.h>
+
+#include "nodecontext/render_command_list.h"
+#include "render_backend.h"
+#if (RENDER_PERF_ENABLED == 1)
+#include "perf/cpu_timer.h"
+#endif
+
+RENDER_BEGIN_NAMESPACE()
+class DeviceNull;
+class GpuResourceManager;
+class NodeContextDescriptorSetManager;
+class NodeContextPsoManager;
+struct RenderCommandContext;
+
+/** Walks the render command lists like the real backends do, validating the commands and collecting statistics, but
+ * does not record or submit any GPU work.
+ */
+class RenderBackendNull final : public RenderBackend {
+public:
+    RenderBackendNull(DeviceNull& device, GpuResourceManager& gpuResourceMgr);
+    ~RenderBackendNull() override;
+
+    void Render(RenderCommandFrameData& renderCommandFrameData,
+        const RenderBackendBackBufferConfiguration& backBufferConfig) override;
+    void Present(const RenderBackendBackBufferConfiguration& backBufferConfig) override;
+
+    FrameStatisticsNull GetFrameStatistics() const;
+
+private:
+    struct CommandListState {
+        NodeContextPsoManager* psoMgr{nullptr};
+        RenderHandle psoHandle;
+        PipelineBindPoint bindPoint{PipelineBindPoint::CORE_PIPELINE_BIND_POINT_MAX_ENUM};
+        bool pipelineBound{false};
+        bool inRenderPass{false};
+        const RenderCommandBeginRenderPass* renderPass{nullptr};
+        // advanced by next subpass commands like with the GLES backend
+        uint32_t subpassIndex{0U};
+    };
+
+    void RenderSingleCommandList(const RenderCommandContext& renderCommandCtx);
+    void ProcessCommand(const RenderCommandWithType& ref, CommandListState& state);
+    void ProcessDraw(const RenderCommandWithType& ref, const CommandListState& state);
+    void ProcessDispatch(const RenderCommandWithType& ref, const CommandListState& state);
+    void ProcessBindPipeline(const RenderCommandBindPipeline& renderCmd, CommandListState& state);
+    void ProcessTransfer(const RenderCommandWithType& ref);
+    void UpdateGlobalDescriptorSets();
+    void UpdateCommandListDescriptorSets(
+        const RenderCommandList& renderCommandList, NodeContextDescriptorSetManager& ncdsm);
+    void SignalGpuSignals(RenderCommandFrameData& renderCommandFrameData);
+
+    bool IsValidBuffer(RenderHandle handle) const;
+    bool IsValidImage(RenderHandle handle) const;
+    void Validate(bool valid, const char* message);
+
+    DeviceNull& device_;
+    GpuResourceManager& gpuResourceMgr_;
+
+    // the frame being processed and the last completed one
+    FrameStatisticsNull frameStatistics_;
+    FrameStatisticsNull lastFrameStatistics_;
+
+#if (RENDER_PERF_ENABLED == 1)
+    BASE_NS::unordered_map<BASE_NS::string, CpuTimer> timers_;
+
+    struct CommonBackendCpuTimers {
+        CpuTimer full;
+        CpuTimer acquire;
+        CpuTimer execute;
+        CpuTimer submit;
+        CpuTimer present;
+    };
+    CommonBackendCpuTimers commonCpuTimers_;
+
+    void EndFrameTimers();
+#endif
+};
+RENDER_END_NAMESPACE()
+
+#endif  // NULL_RENDER_BACKEND_NULL_H
@@ -58,6 +58,10 @@
 #include "maleoon/device_mln.h"
 #endif
 
+#if RENDER_HAS_NULL_BACKEND
+#include "null/device_null.h"
+#endif
+
 #include <algorithm>
 
 using namespace BASE_NS;
@@ -683,6 +687,12 @@ unique_ptr<Device> RenderContext::CreateDevice(const RenderCreateInfo& createInf
             return CreateDeviceMln(*this);
 #else
             return nullptr;
+#endif
+        case DeviceBackendType::NULL_BACKEND:
+#if (RENDER_HAS_NULL_BACKEND)
+            return CreateDeviceNull(*this);
+#else
+            return nullptr;
 #endif
         default:
             break;
@@ -128,7 +128,8 @@ inline uint32_t GetThreadPoolThreadCount(
 
 // Helper for Renderer::InitNodeGraph
 unordered_map<string, uint32_t> InitializeRenderNodeContextData(IRenderContext& renderContext,
-    RenderNodeGraphNodeStore& nodeStore, const bool enableMultiQueue, const RenderingConfiguration& renderConfig)
+    RenderNodeGraphNodeStore& nodeStore, const bool enableMultiQueue, const RenderingConfiguration& renderConfig,
+    IThreadPool* threadPool)
 {
     unordered_map<string, uint32_t> renderNodeNameToIndex(nodeStore.renderNodeData.size());
     vector<ContextInitDescription> contextInitDescs(nodeStore.renderNodeData.size());
@@ -181,7 +182,8 @@ unordered_map<string, uint32_t> InitializeRenderNodeContextData(IRenderContext&
             *nodeContextData.nodeContextDescriptorSetMgr,
             *nodeContextData.nodeContextPsoMgr,
             *nodeContextData.renderCommandList,
-            *nodeStore.renderNodeGraphShareDataMgr};
+            *nodeStore.renderNodeGraphShareDataMgr,
+            threadPool};
         nodeContextData.renderNodeContextManager = make_unique<RenderNodeContextManager>(rncmci);
 #if ((RENDER_VALIDATION_ENABLED == 1) || (RENDER_VULKAN_VALIDATION_ENABLED == 1))
         nodeContextData.nodeContextDescriptorSetMgr->SetValidationDebugName(renderNodeData.fullName);
@@ -590,8 +592,8 @@ void Renderer::InitNodeGraphs(const array_view<const RenderHandle> renderNodeGra
         const bool enableMultiQueue = (device_.GetGpuQueueCount() > 1);
 
         // serial, initialize render node context data
-        auto renderNodeNameToIndex =
-            InitializeRenderNodeContextData(renderContext_, nodeStore, enableMultiQueue, renderConfig_);
+        auto renderNodeNameToIndex = InitializeRenderNodeContextData(
+            renderContext_, nodeStore, enableMultiQueue, renderConfig_, threadPool_.get());
 
         if (enableMultiQueue) {
             // patch gpu queue signaling
@@ -739,6 +741,8 @@ void Renderer::RenderFrameImpl(const array_view<const RenderHandle> renderNodeGr
 
     FillRngNodeStores(renderNodeGraphInputs, renderNodeGraphMgr_, rngNodeStores);
     if (std::any_of(rngNodeStores.begin(), rngNodeStores.end(), IsNull<RenderNodeGraphNodeStore>)) {
+        // data stores are always paired with PostRender(), they may wait for the end of the frame
+        renderDataStoreMgr_.PostRender();
         ProcessTimeStampEnd();
         PLUGIN_LOG_W("invalid render node graphs for rendering");
         return;
@@ -756,6 +760,7 @@ void Renderer::RenderFrameImpl(const array_view<const RenderHandle> renderNodeGr
     // synchronize, needed for persistantly mapped gpu buffer writing
     if (!WaitForFence(device_, *renderFrameSync_)) {
         device_.Deactivate();
+        renderDataStoreMgr_.PostRender();
         return;  // possible lost device with frame fence
     }
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_FRAME_RING_ALLOCATOR_H
+#define UTIL_FRAME_RING_ALLOCATOR_H
+
+#include <cstdint>
+
+#include <base/containers/vector.h>
+#include <render/namespace.h>
+
+RENDER_BEGIN_NAMESPACE()
+/** Sub-allocates byte ranges from a ring, e.g. a persistently mapped staging buffer. Only offsets are handled, the
+ * memory is owned by the caller.
+ * Allocations are freed a frame at a time, once the GPU can no longer be using them.
+ */
+class FrameRingAllocator {
+public:
+    static constexpr uint32_t INVALID_OFFSET{~0U};
+
+    /** Forget all allocations and start over with a ring of the given size. */
+    void Reset(uint32_t byteSize)
+    {
+        byteSize_ = byteSize;
+        head_ = 0U;
+        usedByteSize_ = 0U;
+        frameByteSize_ = 0U;
+        frames_.clear();
+    }
+
+    /** Start a new frame. Allocations of the previous frames are kept for frameFenceCount frames, older ones are
+     * freed.
+     */
+    void BeginFrame(uint32_t frameFenceCount)
+    {
+        frames_.push_back(frameByteSize_);
+        frameByteSize_ = 0U;
+        size_t releasedCount = 0U;
+        while ((frames_.size() - releasedCount) > frameFenceCount) {
+            usedByteSize_ -= frames_[releasedCount++];
+        }
+        frames_.erase(frames_.begin(), frames_.begin() + static_cast<ptrdiff_t>(releasedCount));
+    }
+
+    /** Allocate a range for the current frame.
+     * @param byteSize Size of the range.
+     * @param alignment Alignment of the returned offset.
+     * @return Offset of the range, or INVALID_OFFSET if the ring does not have enough free space.
+     */
+    uint32_t Allocate(uint32_t byteSize, uint32_t alignment)
+    {
+        if (usedByteSize_ == 0U) {
+            // nothing in flight, start from the beginning instead of wrapping around later.
+            head_ = 0U;
+        }
+        uint64_t offset = ((static_cast<uint64_t>(head_) + alignment - 1U) / alignment) * alignment;
+        uint64_t padding = offset - head_;
+        if ((offset + byteSize) > byteSize_) {
+            // wrap around, the end of the ring is wasted until this frame is freed.
+            offset = 0U;
+            padding = byteSize_ - head_;
+        }
+        const uint64_t consumed = padding + byteSize;
+        if ((usedByteSize_ + consumed) > byteSize_) {
+            return INVALID_OFFSET;
+        }
+        head_ = static_cast<uint32_t>(offset + byteSize);
+        usedByteSize_ += consumed;
+        frameByteSize_ += consumed;
+        return static_cast<uint32_t>(offset);
+    }
+
+    /** Size of the ring. */
+    uint32_t GetByteSize() const
+    {
+        return byteSize_;
+    }
+
+    /** Bytes in use by the current and the previous frames, including alignment and wrap around padding. */
+    uint64_t GetUsedByteSize() const
+    {
+        return usedByteSize_;
+    }
+
+    /** Bytes used by the current frame, including padding. */
+    uint64_t GetFrameByteSize() const
+    {
+        return frameByteSize_;
+    }
+
+private:
+    uint32_t byteSize_{0U};
+    uint32_t head_{0U};
+    uint64_t usedByteSize_{0U};
+    uint64_t frameByteSize_{0U};
+    // bytes used by each of the frames which are still in flight, oldest first.
+    BASE_NS::vector<uint64_t> frames_;
+};
+RENDER_END_NAMESPACE()
+
+#endif  // UTIL_FRAME_RING_ALLOCATOR_H
@@ -275,6 +275,12 @@ void CreateEngineSetup(EngineResources& er)
         }
 #endif
 
+#if RENDER_HAS_NULL_BACKEND
+        if (er.backend == DeviceBackendType::NULL_BACKEND) {
+            deviceCreateInfo.backendType = DeviceBackendType::NULL_BACKEND;
+        }
+#endif
+
         const RenderCreateInfo info{
             {
                 "lume_test",  // name
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nodecontext/render_node_graph_manager.h>
+#include <nodecontext/render_node_manager.h>
+
+#include <render/device/intf_gpu_resource_manager.h>
+#include <render/intf_render_context.h>
+#include <render/intf_renderer.h>
+#include <render/nodecontext/intf_render_node_graph_manager.h>
+#include <render/null/intf_device_null.h>
+
+#include "node/nodes/render_node_draw.h"
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace BASE_NS;
+using namespace RENDER_NS;
+
+#if RENDER_HAS_NULL_BACKEND
+namespace {
+static constexpr string_view OUTPUT_IMAGE_NAME{"OutputImage"};
+static constexpr string_view VERTEX_BUFFER_NAME{"VertexBuffer"};
+static constexpr uint32_t WIDTH = 15u;
+static constexpr uint32_t HEIGHT = 15u;
+static constexpr uint32_t FRAME_COUNT = 4u;
+
+static constexpr float VERTEX_BUFFER_DATA[] = {-0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f};
+
+struct TestData {
+    UTest::EngineResources engine;
+    RenderHandleReference renderNodeGraph;
+    RenderHandleReference outputImageHandle;
+    RenderHandleReference vertexBufferHandle;
+};
+
+void CreateTestResources(TestData& td)
+{
+    RenderNodeGraphManager& renderNodeGraphMgr =
+        static_cast<RenderNodeGraphManager&>(td.engine.context->GetRenderNodeGraphManager());
+    {
+        RenderNodeTypeInfo info{{RenderNodeDraw::UID},
+            RenderNodeDraw::UID,
+            RenderNodeDraw::TYPE_NAME,
+            RenderNodeDraw::Create,
+            RenderNodeDraw::Destroy,
+            RenderNodeDraw::BACKEND_FLAGS,
+            RenderNodeDraw::CLASS_TYPE};
+        renderNodeGraphMgr.GetRenderNodeManager().AddRenderNodeFactory(info);
+    }
+    td.renderNodeGraph = renderNodeGraphMgr.LoadAndCreate(
+        IRenderNodeGraphManager::RenderNodeGraphUsageType::RENDER_NODE_GRAPH_STATIC,
+        "test://renderNodeGraphRenderNodeDrawTest.rng");
+
+    IGpuResourceManager& gpuResourceMgr = td.engine.device->GetGpuResourceManager();
+    {
+        GpuImageDesc imageDesc;
+        imageDesc.width = WIDTH;
+        imageDesc.height = HEIGHT;
+        imageDesc.depth = 1;
+        imageDesc.engineCreationFlags = CORE_ENGINE_IMAGE_CREATION_DYNAMIC_BARRIERS;
+        imageDesc.format = BASE_FORMAT_R32G32B32A32_SFLOAT;
+        imageDesc.imageTiling = CORE_IMAGE_TILING_OPTIMAL;
+        imageDesc.imageType = CORE_IMAGE_TYPE_2D;
+        imageDesc.imageViewType = CORE_IMAGE_VIEW_TYPE_2D;
+        imageDesc.memoryPropertyFlags = CORE_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        imageDesc.usageFlags = CORE_IMAGE_USAGE_TRANSFER_SRC_BIT | CORE_IMAGE_USAGE_SAMPLED_BIT |
+                               CORE_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        td.outputImageHandle = gpuResourceMgr.Create(OUTPUT_IMAGE_NAME, imageDesc);
+    }
+    {
+        GpuBufferDesc bufferDesc;
+        bufferDesc.byteSize = sizeof(VERTEX_BUFFER_DATA);
+        bufferDesc.engineCreationFlags =
+            CORE_ENGINE_BUFFER_CREATION_DYNAMIC_BARRIERS | CORE_ENGINE_BUFFER_CREATION_CREATE_IMMEDIATE;
+        bufferDesc.usageFlags = CORE_BUFFER_USAGE_VERTEX_BUFFER_BIT | CORE_BUFFER_USAGE_TRANSFER_DST_BIT;
+        bufferDesc.memoryPropertyFlags = CORE_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        td.vertexBufferHandle = gpuResourceMgr.Create(VERTEX_BUFFER_NAME, bufferDesc,
+            {reinterpret_cast<const uint8_t*>(VERTEX_BUFFER_DATA), sizeof(VERTEX_BUFFER_DATA)});
+    }
+}
+
+void DestroyTestResources(TestData& td)
+{
+    td.renderNodeGraph = {};
+    td.outputImageHandle = {};
+    td.vertexBufferHandle = {};
+}
+}  // namespace
+
+/**
+ * @tc.name: RenderFramesTest
+ * @tc.desc: Renders a few frames with a custom draw render node on the null backend and checks that the backend
+ * processed the draws without validation errors.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_RenderBackendNull, RenderFramesTest, testing::ext::TestSize.Level1)
+{
+    TestData testData;
+    testData.engine.backend = DeviceBackendType::NULL_BACKEND;
+    UTest::CreateEngineSetup(testData.engine);
+    ASSERT_EQ(DeviceBackendType::NULL_BACKEND, testData.engine.device->GetBackendType());
+    CreateTestResources(testData);
+
+    const auto& lowLevelDevice =
+        static_cast<const ILowLevelDeviceNull&>(testData.engine.device->GetLowLevelDevice());
+    for (uint32_t idx = 0u; idx < FRAME_COUNT; ++idx) {
+        testData.engine.engine->TickFrame();
+        testData.engine.context->GetRenderer().RenderFrame({&testData.renderNodeGraph, 1});
+
+        const FrameStatisticsNull stats = lowLevelDevice.GetFrameStatistics();
+        EXPECT_GT(stats.commandListCount, 0u);
+        EXPECT_GT(stats.renderPassCount, 0u);
+        EXPECT_GT(stats.pipelineBindCount, 0u);
+        EXPECT_GT(stats.drawCount, 0u);
+        EXPECT_GT(stats.vertexCount, 0u);
+        EXPECT_EQ(0u, stats.validationErrorCount);
+    }
+
+    DestroyTestResources(testData);
+    UTest::DestroyEngine(testData.engine);
+}
+#endif  // RENDER_HAS_NULL_BACKEND
@@ -894,3 +894,136 @@ UNIT_TEST(SRC_GpuResourceManager, GpuResourceManagerTestOpenGL, testing::ext::Te
     TestGpuResourceManager(UTest::GetOpenGLBackend());
 }
 #endif  // RENDER_HAS_GL_BACKEND || RENDER_HAS_GLES_BACKEND
+
+namespace {
+constexpr uint32_t STAGING_TEST_BUFFER_BYTE_SIZE = 64U * 1024U;
+
+RenderHandleReference CreateStagedBuffer(IGpuResourceManager& gpuResourceMgr, const string_view name, uint8_t value)
+{
+    GpuBufferDesc desc;
+    desc.byteSize = STAGING_TEST_BUFFER_BYTE_SIZE;
+    desc.usageFlags = CORE_BUFFER_USAGE_TRANSFER_DST_BIT | CORE_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    desc.memoryPropertyFlags = CORE_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    desc.engineCreationFlags = CORE_ENGINE_BUFFER_CREATION_DYNAMIC_BARRIERS;
+    const vector<uint8_t> data(STAGING_TEST_BUFFER_BYTE_SIZE, value);
+    return gpuResourceMgr.Create(name, desc, data);
+}
+}  // namespace
+
+/**
+ * @tc.name: StagingUploadBudget
+ * @tc.desc: Tests that staging uploads over the upload budget are deferred to the following frames in creation order,
+ * and that the staging statistics report the uploaded and deferred bytes.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_GpuResourceManager, StagingUploadBudget, testing::ext::TestSize.Level1)
+{
+    UTest::EngineResources er;
+    UTest::CreateEngineSetup(er);
+    ASSERT_TRUE(er.device != nullptr);
+    IGpuResourceManager& gpuResourceMgr = er.device->GetGpuResourceManager();
+    IRenderer& renderer = er.context->GetRenderer();
+
+    // no budget by default, everything is uploaded in the same frame
+    constexpr uint32_t bufferCount = 4U;
+    vector<RenderHandleReference> buffers;
+    for (uint32_t idx = 0U; idx < bufferCount; ++idx) {
+        buffers.push_back(CreateStagedBuffer(gpuResourceMgr, "StagingBudgetBuffer" + to_string(idx), 1U));
+    }
+    renderer.RenderFrame({});
+    {
+        const auto statistics = gpuResourceMgr.GetStagingStatistics();
+        EXPECT_EQ(bufferCount * STAGING_TEST_BUFFER_BYTE_SIZE, statistics.uploadedByteSize);
+        EXPECT_EQ(0U, statistics.deferredByteSize);
+        EXPECT_GE(statistics.ringByteSize, bufferCount * STAGING_TEST_BUFFER_BYTE_SIZE);
+    }
+
+    // a budget of one buffer per frame
+    gpuResourceMgr.SetStagingUploadBudget(STAGING_TEST_BUFFER_BYTE_SIZE);
+    for (uint32_t idx = 0U; idx < bufferCount; ++idx) {
+        buffers[idx] = CreateStagedBuffer(gpuResourceMgr, "StagingBudgetBuffer" + to_string(idx), 2U);
+    }
+    for (uint32_t frame = 0U; frame < bufferCount; ++frame) {
+        renderer.RenderFrame({});
+        const auto statistics = gpuResourceMgr.GetStagingStatistics();
+        EXPECT_EQ(STAGING_TEST_BUFFER_BYTE_SIZE, statistics.uploadedByteSize);
+        EXPECT_EQ((bufferCount - frame - 1U) * STAGING_TEST_BUFFER_BYTE_SIZE, statistics.deferredByteSize);
+    }
+    renderer.RenderFrame({});
+    {
+        const auto statistics = gpuResourceMgr.GetStagingStatistics();
+        EXPECT_EQ(0U, statistics.uploadedByteSize);
+        EXPECT_EQ(0U, statistics.deferredByteSize);
+    }
+
+    // at least one upload is done every frame, even if it is over the budget
+    gpuResourceMgr.SetStagingUploadBudget(1U);
+    buffers[0U] = CreateStagedBuffer(gpuResourceMgr, "StagingBudgetBuffer0", 3U);
+    buffers[1U] = CreateStagedBuffer(gpuResourceMgr, "StagingBudgetBuffer1", 3U);
+    renderer.RenderFrame({});
+    {
+        const auto statistics = gpuResourceMgr.GetStagingStatistics();
+        EXPECT_EQ(STAGING_TEST_BUFFER_BYTE_SIZE, statistics.uploadedByteSize);
+        EXPECT_EQ(STAGING_TEST_BUFFER_BYTE_SIZE, statistics.deferredByteSize);
+    }
+    // without a budget the deferred uploads are done in the next frame
+    gpuResourceMgr.SetStagingUploadBudget(0U);
+    renderer.RenderFrame({});
+    {
+        const auto statistics = gpuResourceMgr.GetStagingStatistics();
+        EXPECT_EQ(STAGING_TEST_BUFFER_BYTE_SIZE, statistics.uploadedByteSize);
+        EXPECT_EQ(0U, statistics.deferredByteSize);
+    }
+
+    buffers.clear();
+    gpuResourceMgr.WaitForIdleAndDestroyGpuResources();
+    UTest::DestroyEngine(er);
+}
+
+/**
+ * @tc.name: StagingUploadBudgetSuperseded
+ * @tc.desc: Tests that a deferred staging upload is dropped when its resource is replaced before the upload is done.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_GpuResourceManager, StagingUploadBudgetSuperseded, testing::ext::TestSize.Level1)
+{
+    UTest::EngineResources er;
+    UTest::CreateEngineSetup(er);
+    ASSERT_TRUE(er.device != nullptr);
+    IGpuResourceManager& gpuResourceMgr = er.device->GetGpuResourceManager();
+    IRenderer& renderer = er.context->GetRenderer();
+
+    gpuResourceMgr.SetStagingUploadBudget(STAGING_TEST_BUFFER_BYTE_SIZE);
+    RenderHandleReference buffer0 = CreateStagedBuffer(gpuResourceMgr, "SupersededBuffer0", 1U);
+    RenderHandleReference buffer1 = CreateStagedBuffer(gpuResourceMgr, "SupersededBuffer1", 1U);
+    RenderHandleReference buffer2 = CreateStagedBuffer(gpuResourceMgr, "SupersededBuffer2", 1U);
+    renderer.RenderFrame({});
+    {
+        const auto statistics = gpuResourceMgr.GetStagingStatistics();
+        EXPECT_EQ(STAGING_TEST_BUFFER_BYTE_SIZE, statistics.uploadedByteSize);
+        EXPECT_EQ(2U * STAGING_TEST_BUFFER_BYTE_SIZE, statistics.deferredByteSize);
+    }
+
+    // replacing the resource drops its deferred upload, the new upload is queued after the older deferred ones
+    const RenderHandle oldHandle = buffer1.GetHandle();
+    buffer1 = CreateStagedBuffer(gpuResourceMgr, "SupersededBuffer1", 2U);
+    EXPECT_NE(oldHandle.id, buffer1.GetHandle().id);
+    renderer.RenderFrame({});
+    {
+        const auto statistics = gpuResourceMgr.GetStagingStatistics();
+        EXPECT_EQ(STAGING_TEST_BUFFER_BYTE_SIZE, statistics.uploadedByteSize);
+        EXPECT_EQ(STAGING_TEST_BUFFER_BYTE_SIZE, statistics.deferredByteSize);
+    }
+    renderer.RenderFrame({});
+    {
+        const auto statistics = gpuResourceMgr.GetStagingStatistics();
+        EXPECT_EQ(STAGING_TEST_BUFFER_BYTE_SIZE, statistics.uploadedByteSize);
+        EXPECT_EQ(0U, statistics.deferredByteSize);
+    }
+
+    buffer0 = {};
+    buffer1 = {};
+    buffer2 = {};
+    gpuResourceMgr.WaitForIdleAndDestroyGpuResources();
+    UTest::DestroyEngine(er);
+}
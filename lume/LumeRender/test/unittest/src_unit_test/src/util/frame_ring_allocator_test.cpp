@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <util/frame_ring_allocator.h>
+
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace RENDER_NS;
+using namespace BASE_NS;
+
+/**
+ * @tc.name: AllocateAndAlign
+ * @tc.desc: Tests that allocations are aligned and fail when the ring is full.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_FrameRingAllocator, AllocateAndAlign, testing::ext::TestSize.Level1)
+{
+    FrameRingAllocator allocator;
+    EXPECT_EQ(FrameRingAllocator::INVALID_OFFSET, allocator.Allocate(1U, 256U));
+
+    allocator.Reset(1024U);
+    allocator.BeginFrame(2U);
+    EXPECT_EQ(1024U, allocator.GetByteSize());
+    EXPECT_EQ(0U, allocator.Allocate(100U, 256U));
+    EXPECT_EQ(256U, allocator.Allocate(300U, 256U));
+    EXPECT_EQ(768U, allocator.Allocate(256U, 256U));
+    EXPECT_EQ(1024U, allocator.GetUsedByteSize());
+    EXPECT_EQ(1024U, allocator.GetFrameByteSize());
+    EXPECT_EQ(FrameRingAllocator::INVALID_OFFSET, allocator.Allocate(1U, 256U));
+    EXPECT_EQ(FrameRingAllocator::INVALID_OFFSET, allocator.Allocate(2048U, 256U));
+}
+
+/**
+ * @tc.name: FrameFencing
+ * @tc.desc: Tests that allocations are freed after the given number of frames and that the ring wraps around.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_FrameRingAllocator, FrameFencing, testing::ext::TestSize.Level1)
+{
+    constexpr uint32_t frameFenceCount = 2U;
+    FrameRingAllocator allocator;
+    allocator.Reset(1024U);
+
+    // frame 0
+    allocator.BeginFrame(frameFenceCount);
+    EXPECT_EQ(0U, allocator.Allocate(512U, 256U));
+    // frame 1
+    allocator.BeginFrame(frameFenceCount);
+    EXPECT_EQ(0U, allocator.GetFrameByteSize());
+    EXPECT_EQ(512U, allocator.Allocate(256U, 256U));
+    // frame 2, frame 0 is still in flight
+    allocator.BeginFrame(frameFenceCount);
+    EXPECT_EQ(768U, allocator.Allocate(256U, 256U));
+    EXPECT_EQ(FrameRingAllocator::INVALID_OFFSET, allocator.Allocate(256U, 256U));
+    // frame 3, frame 0 is freed and the allocation wraps around
+    allocator.BeginFrame(frameFenceCount);
+    EXPECT_EQ(512U, allocator.GetUsedByteSize());
+    EXPECT_EQ(0U, allocator.Allocate(512U, 256U));
+    EXPECT_EQ(1024U, allocator.GetUsedByteSize());
+    // frame 4, frame 1 is freed but frame 2 still uses the end of the ring
+    allocator.BeginFrame(frameFenceCount);
+    EXPECT_EQ(768U, allocator.GetUsedByteSize());
+    EXPECT_EQ(FrameRingAllocator::INVALID_OFFSET, allocator.Allocate(512U, 256U));
+    EXPECT_EQ(512U, allocator.Allocate(256U, 256U));
+    // all frames are freed after the fence count of empty frames
+    allocator.BeginFrame(frameFenceCount);
+    allocator.BeginFrame(frameFenceCount);
+    allocator.BeginFrame(frameFenceCount);
+    EXPECT_EQ(0U, allocator.GetUsedByteSize());
+
+    allocator.Reset(4096U);
+    EXPECT_EQ(0U, allocator.GetUsedByteSize());
+    EXPECT_EQ(0U, allocator.Allocate(4096U, 256U));
+}
+
+/**
+ * @tc.name: RestartWhenEmpty
+ * @tc.desc: Tests that allocations start from the beginning of the ring when all the frames have been freed.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_FrameRingAllocator, RestartWhenEmpty, testing::ext::TestSize.Level1)
+{
+    constexpr uint32_t frameFenceCount = 1U;
+    FrameRingAllocator allocator;
+    allocator.Reset(1024U);
+
+    allocator.BeginFrame(frameFenceCount);
+    EXPECT_EQ(0U, allocator.Allocate(768U, 256U));
+    allocator.BeginFrame(frameFenceCount);
+    allocator.BeginFrame(frameFenceCount);
+    EXPECT_EQ(0U, allocator.GetUsedByteSize());
+    // without a restart the allocation would wrap around and waste the end of the ring as padding.
+    EXPECT_EQ(0U, allocator.Allocate(512U, 256U));
+    EXPECT_EQ(512U, allocator.GetUsedByteSize());
+    EXPECT_EQ(512U, allocator.Allocate(512U, 256U));
+    EXPECT_EQ(1024U, allocator.GetUsedByteSize());
+}
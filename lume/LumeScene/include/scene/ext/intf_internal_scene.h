@@ -189,6 +189,9 @@ public:
 
     virtual bool SetRenderMode(RenderMode) = 0;
     virtual RenderMode GetRenderMode() const = 0;
+    /// Frames the render data may lag behind the ECS, 1 lets the next update overlap rendering of the previous one.
+    virtual bool SetFrameLatency(uint32_t latency) = 0;
+    virtual uint32_t GetFrameLatency() const = 0;
 
     virtual void ModifyCustomRenderNodeGraph(
         const RenderNodeGraphModificationMode mode, const BASE_NS::vector<RENDER_NS::RenderHandleReference>& rng) = 0;
@@ -58,7 +58,7 @@ public:
     }
 
     /**
-     * @brief Start loading an image asynchronously on a shared worker pool.
+     * @brief Start loading an image asynchronously on the engine thread pool.
      * Returns a shell IImage immediately; the render handle is populated later
      * when the decode + GPU create finishes. The caller MUST call
      * WaitAllPendingLoads() before any consumer reads GetRenderHandle() on the
@@ -72,7 +72,8 @@ public:
 
     /**
      * @brief Block until all LoadImageDeferred calls issued by any
-     * RenderResourceManager have completed. Drains the shared worker pool.
+     * RenderResourceManager have completed. GPU resources are created as
+     * soon as each decode finishes.
      */
     virtual void WaitAllPendingLoads() = 0;
 
@@ -30,6 +30,7 @@
 #include <scene/interface/intf_mesh.h>
 #include <scene/interface/intf_scene.h>
 
+#include <3d/ecs/systems/intf_render_system.h>
 #include <3d/implementation_uids.h>
 #include <render/intf_render_context.h>
 #include <render/intf_renderer.h>
@@ -1236,6 +1237,28 @@ RenderMode InternalScene::GetRenderMode() const
 {
     return mode_;
 }
+bool InternalScene::SetFrameLatency(uint32_t latency)
+{
+    auto* renderSystem = CORE_NS::GetSystem<CORE3D_NS::IRenderSystem>(*ecs_->ecs);
+    if (!renderSystem) {
+        return false;
+    }
+    auto* handle = renderSystem->GetProperties();
+    if (!handle) {
+        return false;
+    }
+    if (auto props = CORE_NS::ScopedHandle<CORE3D_NS::IRenderSystem::Properties>(handle)) {
+        props->frameLatency = latency;
+    }
+    // applying the properties switches the render data stores to buffered or direct access
+    renderSystem->SetProperties(*handle);
+    frameLatency_ = latency;
+    return true;
+}
+uint32_t InternalScene::GetFrameLatency() const
+{
+    return frameLatency_;
+}
 void InternalScene::RenderFrame()
 {
     std::unique_lock lock{mutex_};
@@ -133,6 +133,8 @@ public:
 
     bool SetRenderMode(RenderMode) override;
     RenderMode GetRenderMode() const override;
+    bool SetFrameLatency(uint32_t latency) override;
+    uint32_t GetFrameLatency() const override;
     void RenderFrame() override;
     bool HasPendingRender() const override;
 
@@ -246,6 +248,7 @@ private:
     uint64_t deltaTime_{1u};
 
     RenderMode mode_{RenderMode::ALWAYS};
+    uint32_t frameLatency_{};
     size_t nodeListening_{};
 
     size_t deferedRenderCount_{6u};  // resource clean is deferred 6 non-rendering frames
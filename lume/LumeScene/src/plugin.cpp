@@ -301,9 +301,8 @@ static PluginToken RegisterInterfaces(IPluginRegister& pluginRegistry)
 }
 static void UnregisterInterfaces(PluginToken)
 {
-    // Tear down the deferred-load thread pool while LumeEngine is still
-    // loaded — the pool's worker join uses ITaskQueueFactory code paths
-    // owned by that plugin.
+    // Finish the deferred image loads while LumeEngine is still loaded —
+    // the decodes run engine image loaders on the engine thread pool.
     RenderResourceManager::Shutdown();
 
     META_NS::UnregisterObjectType<SceneManager>();
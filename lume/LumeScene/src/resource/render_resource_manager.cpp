@@ -19,11 +19,7 @@
 #include <vector>
 
 #include <core/image/intf_image_loader_manager.h>
-#include <core/implementation_uids.h>
 #include <core/intf_engine.h>
-#include <core/plugin/intf_class_register.h>
-#include <core/threading/intf_thread_pool.h>
-#include <core/util/parallel_sort.h>
 #include <render/device/intf_gpu_resource_manager.h>
 
 #include <meta/interface/resource/intf_resource.h>
@@ -39,38 +35,9 @@ struct DeferredLoad {
     BASE_NS::string path;
     ImageLoadInfo info;
     IRenderContext::WeakPtr context;
-    CORE_NS::IImageLoaderManager::LoadResult loadResult;
-    CORE_NS::IThreadPool::IResult::Ptr decodeTask;
+    CORE_NS::IImageLoaderManager::IAsyncLoad::Ptr load;
 };
 
-std::mutex& SharedDeferredLoadPoolMutex()
-{
-    static std::mutex m;
-    return m;
-}
-
-// Storage accessor: never creates the pool. Used by Shutdown to release
-// without forcing lazy init when no resources were ever loaded.
-CORE_NS::IThreadPool::Ptr& SharedDeferredLoadPoolStorage()
-{
-    static CORE_NS::IThreadPool::Ptr pool;
-    return pool;
-}
-
-CORE_NS::IThreadPool::Ptr SharedDeferredLoadPool()
-{
-    std::lock_guard<std::mutex> lk(SharedDeferredLoadPoolMutex());
-    auto& pool = SharedDeferredLoadPoolStorage();
-    if (!pool) {
-        if (auto factory = CORE_NS::GetInstance<CORE_NS::ITaskQueueFactory>(CORE_NS::UID_TASK_QUEUE_FACTORY)) {
-            // Use core count / 2 threads for resource loading.
-            auto size = BASE_NS::Math::max(1u, factory->GetNumberOfCores() / 2u);
-            pool = factory->CreateThreadPool(size);
-        }
-    }
-    return pool;
-}
-
 std::mutex& PendingMutex()
 {
     static std::mutex m;
@@ -185,12 +152,6 @@ static IShader::Ptr ConstructShader(const IRenderContext::Ptr& context, RENDER_N
 
 IImage::Ptr RenderResourceManager::LoadImageDeferred(BASE_NS::string_view uri, const ImageLoadInfo& info)
 {
-    auto pool = SharedDeferredLoadPool();
-    if (!pool) {
-        // Fallback if the engine has no task-queue factory: synchronous load.
-        return LoadImage(uri, info).GetResult();
-    }
-
     // Construct the shell synchronously. Its render handle is filled in by
     // WaitAllPendingLoads once the CPU decode completes and GPU create runs.
     auto image = META_NS::GetObjectRegistry().Create<IImage>(ClassId::Image, CreateRenderContextArg(context_));
@@ -204,17 +165,16 @@ IImage::Ptr RenderResourceManager::LoadImageDeferred(BASE_NS::string_view uri, c
     entry->info = info;
     entry->context = context_;
 
-    auto task = CORE_NS::CreateFunctionTask([entry]() {
-        SCENE_CPU_PERF_SCOPE("LoadImage", entry->path);
-        auto ctx = entry->context.lock();
-        if (!ctx) {
-            return;
-        }
-        auto& loader = ctx->GetRenderer()->GetEngine().GetImageLoaderManager();
-        entry->loadResult = loader.LoadImage(entry->path, static_cast<uint32_t>(entry->info.loadFlags));
-    });
-
-    entry->decodeTask = pool->Push(BASE_NS::move(task));
+    // The decode runs on the engine thread pool, or synchronously if the
+    // engine has none.
+    auto& loader = context_->GetRenderer()->GetEngine().GetImageLoaderManager();
+    const CORE_NS::IImageLoaderManager::AsyncLoadRequest request{
+        entry->path, static_cast<uint32_t>(info.loadFlags), CORE_NS::IImageLoaderManager::LoadPriority::NORMAL};
+    auto loads = loader.LoadImagesAsync({&request, 1U}, nullptr);
+    if (loads.empty()) {
+        return nullptr;
+    }
+    entry->load = BASE_NS::move(loads[0U]);
     {
         std::lock_guard<std::mutex> lk(PendingMutex());
         PendingLoads().push_back(entry);
@@ -232,22 +192,18 @@ void RenderResourceManager::WaitAllPendingLoads()
         local.swap(PendingLoads());
     }
 
-    // Phase 1: wait for all parallel CPU decodes (this is the ~90% work).
-    for (auto& e : local) {
-        if (e && e->decodeTask) {
-            e->decodeTask->Wait();
-        }
-    }
-
-    // Phase 2: do GPU-side create on the caller's thread. Scene-load drains
-    // are called from the render queue, so gpuResMan.Create runs where it
-    // always used to. No thread-safety assumption needed.
+    // Do the GPU-side create on the caller's thread as soon as each decode
+    // is done, while the remaining decodes keep running in parallel.
+    // Scene-load drains are called from the render queue, so gpuResMan.Create
+    // runs where it always used to. No thread-safety assumption needed.
     for (auto& e : local) {
-        if (!e) {
+        if (!e || !e->load) {
             continue;
         }
-        if (!e->loadResult.success) {
-            CORE_LOG_E("Failed to load image (%s): %s", e->path.c_str(), e->loadResult.error);
+        e->load->Wait();
+        auto& loadResult = e->load->GetResult();
+        if (!loadResult.success) {
+            CORE_LOG_E("Failed to load image (%s): %s", e->path.c_str(), loadResult.error);
             continue;
         }
         auto ctx = e->context.lock();
@@ -255,9 +211,9 @@ void RenderResourceManager::WaitAllPendingLoads()
             continue;
         }
         auto& gpuResMan = ctx->GetRenderer()->GetDevice().GetGpuResourceManager();
-        auto gpuDesc = gpuResMan.CreateGpuImageDesc(e->loadResult.image->GetImageDesc());
+        auto gpuDesc = gpuResMan.CreateGpuImageDesc(loadResult.image->GetImageDesc());
         SetImageInfoFlags(e->info.info, gpuDesc);
-        auto handle = gpuResMan.Create(e->path, gpuDesc, std::move(e->loadResult.image));
+        auto handle = gpuResMan.Create(e->path, gpuDesc, std::move(loadResult.image));
         if (auto i = interface_cast<IRenderResource>(e->image)) {
             i->SetRenderHandle(BASE_NS::move(handle));
         }
@@ -266,29 +222,22 @@ void RenderResourceManager::WaitAllPendingLoads()
 
 void RenderResourceManager::Shutdown()
 {
-    // Drop any still-pending decode entries first. Their decode tasks are
-    // running on the pool we're about to release, so wait for each to
-    // finish; we deliberately skip the GPU-create phase (the engine is
-    // tearing down — there is nothing left to render with).
+    // Drop any still-pending decode entries. Loads which have not started
+    // are cancelled and running ones are waited for; we deliberately skip
+    // the GPU-create phase (the engine is tearing down — there is nothing
+    // left to render with). Doing this while LumeEngine is still loaded
+    // means the image loaders are still mapped.
     std::vector<BASE_NS::shared_ptr<DeferredLoad>> local;
     {
         std::lock_guard<std::mutex> lk(PendingMutex());
         local.swap(PendingLoads());
     }
     for (auto& e : local) {
-        if (e && e->decodeTask) {
-            e->decodeTask->Wait();
+        if (e && e->load) {
+            e->load->Cancel();
+            e->load->Wait();
         }
     }
-    local.clear();
-
-    // Now release the pool. Its destructor signals workers to exit and
-    // joins them; doing this while LumeEngine is still loaded means the
-    // join runs through code that's still mapped. Use the storage accessor
-    // so we don't lazily create a pool only to immediately destroy it when
-    // no resources were ever loaded.
-    std::lock_guard<std::mutex> lk(SharedDeferredLoadPoolMutex());
-    SharedDeferredLoadPoolStorage().reset();
 }
 
 Future<IShader::Ptr> RenderResourceManager::LoadShader(BASE_NS::string_view uri)
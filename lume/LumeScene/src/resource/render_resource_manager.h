@@ -36,11 +36,11 @@ public:
     Future<IShader::Ptr> LoadShader(BASE_NS::string_view uri) override;
 
     /**
-     * @brief Drain the process-wide deferred-load queue and tear down the
-     * shared decode thread pool. Must be called while the LumeEngine plugin
-     * (which owns the ITaskQueueFactory used to construct the pool) is still
-     * loaded; otherwise the pool's destructor joins worker threads via code
-     * that has already been unmapped, causing a segfault at process exit.
+     * @brief Drain the process-wide deferred-load queue, cancelling loads
+     * which have not started. Must be called while the LumeEngine plugin
+     * (which owns the image loaders and the thread pool running them) is
+     * still loaded; otherwise the decodes still in flight run code that has
+     * already been unmapped, causing a segfault at process exit.
      *
      * Safe to call multiple times — second and later calls are no-ops.
      * Called from the LumeScene plugin's UnregisterInterfaces.
@@ -18,6 +18,8 @@
 
 #if !defined(IMPLEMENT_MANAGER)
 #include <3d/namespace.h>
+#include <base/containers/vector.h>
+#include <base/math/matrix.h>
 #include <core/ecs/component_struct_macros.h>
 #include <core/ecs/intf_component_manager.h>
 
@@ -31,6 +33,12 @@ enum class BatchType : uint8_t {
 };
 #endif
 DEFINE_PROPERTY(BatchType, batchType, "Batch Type", 0, VALUE(BatchType::GPU_INSTANCING))
+
+/** Transforms of instances relative to the world matrix of the entities using this batch. When not empty, every
+ * entity whose RenderMeshComponent::renderMeshBatch refers to this batch renders its own mesh once per transform,
+ * instead of being batched with the mesh of the batch entity. E.g. imported from EXT_mesh_gpu_instancing.
+ */
+DEFINE_PROPERTY(BASE_NS::vector<BASE_NS::Math::Mat4X4>, instanceTransforms, "Instance Transforms", 0, )
 END_COMPONENT(IRenderMeshBatchComponentManager, RenderMeshBatchComponent, "f72d1dcf-c68c-4b61-9582-601c3fdbccf8")
 #if !defined(IMPLEMENT_MANAGER)
 CORE3D_END_NAMESPACE()
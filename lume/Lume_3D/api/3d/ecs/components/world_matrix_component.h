@@ -18,6 +18,7 @@
 
 #if !defined(IMPLEMENT_MANAGER)
 #include <3d/namespace.h>
+#include <base/containers/array_view.h>
 #include <base/math/matrix.h>
 #include <core/ecs/component_struct_macros.h>
 #include <core/ecs/intf_component_manager.h>
@@ -36,7 +37,14 @@ DEFINE_PROPERTY(BASE_NS::Math::Mat4X4, matrix, "World Matrix", 0, VALUE(BASE_NS:
  */
 DEFINE_PROPERTY(BASE_NS::Math::Mat4X4, prevMatrix, "Previous World Matrix", 0, VALUE(BASE_NS::Math::IDENTITY_4X4))
 
-END_COMPONENT(IWorldMatrixComponentManager, WorldMatrixComponent, "4f76b9cc-4586-434d-a4dd-3bd115188d48")
+END_COMPONENT_EXT(
+    IWorldMatrixComponentManager, WorldMatrixComponent, "4f76b9cc-4586-434d-a4dd-3bd115188d48",
+    /** Get all the world matrix components as a tightly packed array indexed with ComponentId.
+     * The view is valid until components are added or removed.
+     * @return Array of world matrix components. Destroyed components are included until garbage collected.
+     */
+    virtual BASE_NS::array_view<const WorldMatrixComponent> GetComponentArray() const = 0;)
+
 #if !defined(IMPLEMENT_MANAGER)
 CORE3D_END_NAMESPACE()
 #endif
@@ -51,6 +51,16 @@ public:
         BASE_NS::string dataStoreLightProbe;
         /** Data store prefix for other data stores in e.g. different plugins */
         BASE_NS::string dataStorePrefix;
+        /** Number of frames rendering may lag behind the ECS update. With 0 the default render data stores are read
+         * by the renderer directly. With 1 the scene, camera, light and material data stores are double-buffered and
+         * the next update can run while the render nodes process the previous frame. Larger values are clamped to 1.
+         */
+        uint32_t frameLatency{0U};
+        /** Submit render meshes in retained mode. Render meshes are kept in the material data store over frames and
+         * only the ones whose render mesh, world matrix, node or layer component has changed are updated. Skinned
+         * render meshes are still added every frame.
+         */
+        bool retainedRenderMeshes{false};
     };
 
     /** Get render node graphs for this ECS render system.
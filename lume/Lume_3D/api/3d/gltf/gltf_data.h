@@ -18,6 +18,7 @@
 
 #include <cstdint>
 
+#include <base/containers/array_view.h>
 #include <base/containers/atomics.h>
 #include <base/containers/string.h>
 #include <base/containers/unique_ptr.h>
@@ -146,8 +147,18 @@ struct Buffer {
     /** URI to the buffer data. Either empty (GLB buffer), a file path, or a data-URI. */
     BASE_NS::string uri;
 
-    /** Raw data for this buffer. Populated after LoadBuffers(). */
+    /** Raw data for this buffer. Populated after LoadBuffers(), unless the data is borrowed. */
     BASE_NS::vector<uint8_t> data;
+
+    /** Data for this buffer when it is not copied into data, e.g. a region of the memory the glTF was loaded from.
+     *  Points to memory whose lifetime is tied to the glTF data. Populated after LoadBuffers(). */
+    BASE_NS::array_view<const uint8_t> borrowedData;
+
+    /** Returns the loaded data of the buffer, whether owned or borrowed. */
+    BASE_NS::array_view<const uint8_t> GetData() const
+    {
+        return borrowedData.empty() ? BASE_NS::array_view<const uint8_t>(data) : borrowedData;
+    }
 };
 
 struct BufferView {
@@ -178,7 +189,7 @@ struct BufferView {
         size_t count = 0;
         CompressionMode mode = CompressionMode::INVALID;
         CompressionFilter filter = CompressionFilter::NONE;
-        /** Decompressed data. Populated lazily on first access. */
+        /** Decompressed data. Populated by the importer while loading buffers, otherwise lazily on first access. */
         BASE_NS::vector<uint8_t> data;
         BASE_NS::SpinLock dataLock;
     } meshoptCompression;
@@ -481,6 +492,13 @@ struct Node {
 
     /** Morph target weights. */
     BASE_NS::vector<float> weights;
+
+    /** Per-instance TRS accessors (EXT_mesh_gpu_instancing). Missing attributes are null. */
+    struct GpuInstancing {
+        Accessor* translation{nullptr};
+        Accessor* rotation{nullptr};
+        Accessor* scale{nullptr};
+    } gpuInstancing;
 };
 
 struct Scene {
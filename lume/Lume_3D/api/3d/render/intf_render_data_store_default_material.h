@@ -345,6 +345,31 @@ public:
     virtual void AddFrameRenderMeshData(const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData,
         const RenderMeshBatchData& meshBatchData) = 0;
 
+    /** Add frame render mesh data of instances with batching.
+     * The mesh is looked up and the skin joint matrices are added only once for all the instances.
+     * @param meshData render mesh data, one per instance.
+     * @param meshSkinData render mesh skin data, shared by the instances.
+     * @param meshBatchData render mesh batch data.
+     */
+    virtual void AddFrameRenderMeshData(BASE_NS::array_view<const RenderMeshData> meshData,
+        const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& meshBatchData) = 0;
+
+    /** Set (or create) retained render mesh data.
+     * Retained render meshes are kept over frames and submitted with every frame until destroyed, only changed render
+     * meshes need to be set again. A frame with only unchanged retained render meshes reuses the previous submission.
+     * Skinned render meshes need to be added every frame with AddFrameRenderMeshData().
+     * @param id Render mesh id. In typical ECS usage render mesh entity id.
+     * @param meshData Render mesh data, one per instance of the render mesh.
+     * @param meshBatchData Render mesh batch data.
+     */
+    virtual void SetRetainedRenderMeshData(uint64_t id, BASE_NS::array_view<const RenderMeshData> meshData,
+        const RenderMeshBatchData& meshBatchData) = 0;
+
+    /** Destroy retained render mesh data.
+     * @param id Render mesh id.
+     */
+    virtual void DestroyRetainedRenderMeshData(uint64_t id) = 0;
+
     /** Update (or create) rendering mesh data.
      * Automatic hashing with id. (E.g. mesh entity id)
      * Final rendering flags are per submesh (RenderDataDefaultMaterial::SubmeshMaterialFlags)
@@ -43,6 +43,7 @@
 #include <core/property_tools/property_api_impl.inl>
 #include <core/property_tools/property_data.h>
 #include <core/property_tools/property_macros.h>
+#include <core/util/parallel_for.h>
 
 #include "ecs/components/initial_transform_component.h"
 #include "ecs/systems/animation_playback.h"
@@ -68,74 +69,6 @@ struct AnimationSystem::InterpolationData {
     float weight;
 };
 
-class AnimationSystem::InitTask final : public IThreadPool::ITask {
-public:
-    InitTask(AnimationSystem& system, size_t offset, size_t count) : system_(system), offset_(offset), count_(count){};
-
-    void operator()() override
-    {
-        const auto offset = Math::min(offset_, system_.trackOrder_.size());
-        const auto count = Math::min(count_, system_.trackOrder_.size() - offset);
-        const auto results = array_view(static_cast<const uint32_t*>(system_.trackOrder_.data()) + offset, count);
-        system_.InitializeTrackValues(results);
-    }
-
-protected:
-    void Destroy() override
-    {}
-
-private:
-    AnimationSystem& system_;
-    size_t offset_;
-    size_t count_;
-};
-
-class AnimationSystem::FrameIndexTask final : public IThreadPool::ITask {
-public:
-    FrameIndexTask(AnimationSystem& system, size_t offset, size_t count)
-        : system_(system), offset_(offset), count_(count){};
-
-    void operator()() override
-    {
-        const auto offset = Math::min(offset_, system_.trackOrder_.size());
-        const auto count = Math::min(count_, system_.trackOrder_.size() - offset);
-        const auto results = array_view(static_cast<const uint32_t*>(system_.trackOrder_.data()) + offset, count);
-        system_.CalculateFrameIndices(results);
-    }
-
-protected:
-    void Destroy() override
-    {}
-
-private:
-    AnimationSystem& system_;
-    size_t offset_;
-    size_t count_;
-};
-
-class AnimationSystem::AnimateTask final : public IThreadPool::ITask {
-public:
-    AnimateTask(AnimationSystem& system, size_t offset, size_t count)
-        : system_(system), offset_(offset), count_(count){};
-
-    void operator()() override
-    {
-        const auto offset = Math::min(offset_, system_.trackOrder_.size());
-        const auto count = Math::min(count_, system_.trackOrder_.size() - offset);
-        const auto results = array_view(static_cast<const uint32_t*>(system_.trackOrder_.data()) + offset, count);
-        system_.AnimateTracks(results);
-    }
-
-protected:
-    void Destroy() override
-    {}
-
-private:
-    AnimationSystem& system_;
-    size_t offset_;
-    size_t count_;
-};
-
 namespace {
 PROPERTY_LIST(
     AnimationSystem::Properties, SystemMetadata, MEMBER_PROPERTY(minTaskSize, "Task size", PropertyFlags::IS_SLIDER))
@@ -765,20 +698,14 @@ bool AnimationSystem::Update(bool frameRenderingQueued, uint64_t time, uint64_t
     {
         const auto threadCount = threadPool_->GetNumberOfThreads() + 1;
         const auto resultCount = trackOrder_.size();
-        taskSize_ = Math::max(systemProperties_.minTaskSize, resultCount / threadCount);
-        tasks_ = ((resultCount / taskSize_)) ? (resultCount / taskSize_) - 1U : 0U;
-        remaining_ = resultCount - (tasks_ * taskSize_);
+        taskSize_ = Math::max(Math::max(systemProperties_.minTaskSize, size_t(1U)), resultCount / threadCount);
+        tasks_ = (resultCount + taskSize_ - 1U) / taskSize_;
     }
 
-    taskId_ = 0U;
-    taskResults_.clear();
-
-    // Start tasks for filling the initial values to trackValues_.
-    InitializeTrackValues();
-
-    // For each track batch reset the target properties to initial values, wait for trackValues_ to be filled and start
-    // new task to handle the actual animation.
+    // Fill the initial values to trackValues_ and calculate the animated values for each track batch.
     AnimateTrackValues();
+
+    // Reset the target properties to initial values so we can later sum the results of multiple tracks.
     ResetToInitialTrackValues();
 
     // Update target properties, this will apply animations on top of current value.
@@ -1105,68 +1032,19 @@ void AnimationSystem::UpdateAnimation(AnimationStateComponent& state, const Anim
     }
 }
 
-void AnimationSystem::InitializeTrackValues()
-{
-#if (CORE3D_DEV_ENABLED == 1)
-    CORE_CPU_PERF_SCOPE("CORE3D", "AnimationSystem", "InitializeTrackValues", CORE3D_PROFILER_DEFAULT_COLOR);
-#endif
-    initTasks_.clear();
-    if (tasks_) {
-        // Reserve for twice as many tasks as both init and anim task results are in the same vector.
-        taskResults_.reserve(taskResults_.size() + tasks_ * 2U);
-
-        initTasks_.reserve(remaining_ ? (tasks_ + 1U) : tasks_);
-        initTaskStart_ = taskId_;
-        for (size_t i = 0; i < tasks_; ++i) {
-            auto& task = initTasks_.emplace_back(*this, i * taskSize_, taskSize_);
-            taskResults_.push_back(threadPool_->Push(IThreadPool::ITask::Ptr{&task}));
-            ++taskId_;
-        }
-    }
-    if (remaining_ >= systemProperties_.minTaskSize) {
-        auto& task = initTasks_.emplace_back(*this, tasks_ * taskSize_, remaining_);
-        taskResults_.push_back(threadPool_->Push(IThreadPool::ITask::Ptr{&task}));
-        ++taskId_;
-    } else {
-        InitializeTrackValues(array_view(static_cast<const uint32_t*>(trackOrder_.data()), remaining_));
-    }
-}
-
 void AnimationSystem::AnimateTrackValues()
 {
 #if (CORE3D_DEV_ENABLED == 1)
     CORE_CPU_PERF_SCOPE("CORE3D", "AnimationSystem", "AnimateTrackValues", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
-
-    frameIndexTasks_.clear();
-    frameIndexTasks_.reserve(remaining_ ? (tasks_ + 1U) : tasks_);
-
-    animTasks_.clear();
-    animTasks_.reserve(remaining_ ? (tasks_ + 1U) : tasks_);
-    animTaskStart_ = taskId_;
-
-    auto batch = [this](size_t i, size_t offset, size_t count) {
-        // Start task for calculating which keyframes are used.
-        auto& frameIndexTask = frameIndexTasks_.emplace_back(*this, offset, count);
-        threadPool_->PushNoWait(IThreadPool::ITask::Ptr{&frameIndexTask});
-
-        // Start task for interpolating between the selected keyframes.
-        // This work requires the initial values as well as the keyframe indices.
-        auto& task = animTasks_.emplace_back(*this, offset, count);
-        const IThreadPool::ITask* dependencies[] = {&initTasks_[i], &frameIndexTask};
-        taskResults_.push_back(threadPool_->Push(IThreadPool::ITask::Ptr{&task}, dependencies));
-        ++taskId_;
-    };
-    for (size_t i = 0U; i < tasks_; ++i) {
-        batch(i, i * taskSize_, taskSize_);
-    }
-    if (remaining_ >= systemProperties_.minTaskSize) {
-        batch(tasks_, tasks_ * taskSize_, remaining_);
-    } else {
-        const auto results = array_view(static_cast<const uint32_t*>(trackOrder_.data()), remaining_);
+    // The calling thread animates batches too, so this completes even if the pool threads are busy. Each batch fills
+    // the initial values, calculates which keyframes are used and interpolates between them.
+    ParallelFor(threadPool_.get(), tasks_, [this](size_t task) {
+        const auto results = GetTrackBatch(task);
+        InitializeTrackValues(results);
         CalculateFrameIndices(results);
         AnimateTracks(results);
-    }
+    });
 }
 
 void AnimationSystem::ResetToInitialTrackValues()
@@ -1174,23 +1052,7 @@ void AnimationSystem::ResetToInitialTrackValues()
 #if (CORE3D_DEV_ENABLED == 1)
     CORE_CPU_PERF_SCOPE("CORE3D", "AnimationSystem", "ResetToInitialTrackValues", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
-
-    auto batch = [this](size_t i, size_t count) {
-        // Wait that initial values for this track batch have been filled
-        taskResults_[i]->Wait();
-
-        // While task is running reset the target property so we can later sum the results of multiple tracks.
-        ResetTargetProperties(array_view(static_cast<const uint32_t*>(trackOrder_.data()) + i * taskSize_, count));
-    };
-    for (size_t i = 0U; i < tasks_; ++i) {
-        batch(i, taskSize_);
-    }
-    if (remaining_ >= systemProperties_.minTaskSize) {
-        batch(tasks_, remaining_);
-    } else {
-        const auto results = array_view(static_cast<const uint32_t*>(trackOrder_.data()), remaining_);
-        ResetTargetProperties(results);
-    }
+    ResetTargetProperties(trackOrder_);
 }
 
 void AnimationSystem::WriteUpdatedTrackValues()
@@ -1198,21 +1060,15 @@ void AnimationSystem::WriteUpdatedTrackValues()
 #if (CORE3D_DEV_ENABLED == 1)
     CORE_CPU_PERF_SCOPE("CORE3D", "AnimationSystem", "WriteUpdatedTrackValues", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
-    auto batch = [this](size_t i, size_t count) {
-        // Wait for animation task for this batch to finish.
-        taskResults_[i + animTaskStart_]->Wait();
-
-        // Apply the result of each track animation to the target property.
-        ApplyResults(array_view(static_cast<const uint32_t*>(trackOrder_.data()) + i * taskSize_, count));
-    };
-    for (size_t i = 0U; i < tasks_; ++i) {
-        batch(i, taskSize_);
-    }
-    if (remaining_ >= systemProperties_.minTaskSize) {
-        batch(tasks_, remaining_);
-    } else {
-        ApplyResults(array_view(static_cast<const uint32_t*>(trackOrder_.data()), remaining_));
-    }
+    // Apply the result of each track animation to the target property.
+    ApplyResults(trackOrder_);
+}
+
+array_view<const uint32_t> AnimationSystem::GetTrackBatch(size_t task) const
+{
+    const auto offset = Math::min(task * taskSize_, trackOrder_.size());
+    const auto count = Math::min(taskSize_, trackOrder_.size() - offset);
+    return array_view(static_cast<const uint32_t*>(trackOrder_.data()) + offset, count);
 }
 
 void AnimationSystem::ResetTargetProperties(array_view<const uint32_t> resultIndices)
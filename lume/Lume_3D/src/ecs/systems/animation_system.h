@@ -120,10 +120,6 @@ private:
         bool updated{false};
     };
 
-    class InitTask;
-    class FrameIndexTask;
-    class AnimateTask;
-
     // IEcs::ComponentListener
     void OnComponentEvent(EventType type, const CORE_NS::IComponentManager& componentManager,
         BASE_NS::array_view<const CORE_NS::Entity> entities) override;
@@ -134,7 +130,6 @@ private:
     void UpdateAnimationStates(uint64_t delta);
     void UpdateAnimation(AnimationStateComponent& state, const AnimationComponent& animation,
         const CORE_NS::ComponentQuery& trackQuery, float delta);
-    void InitializeTrackValues();
     void AnimateTrackValues();
     void ResetToInitialTrackValues();
     void WriteUpdatedTrackValues();
@@ -144,6 +139,7 @@ private:
     void CalculateFrameIndices(BASE_NS::array_view<const uint32_t> resultIndices);
     void AnimateTracks(BASE_NS::array_view<const uint32_t> resultIndices);
     void ApplyResults(BASE_NS::array_view<const uint32_t> resultIndices);
+    BASE_NS::array_view<const uint32_t> GetTrackBatch(size_t task) const;
 
     const PropertyEntry& GetEntry(const AnimationTrackComponent& track);
     void InitializeInitialDataComponent(CORE_NS::Entity trackEntity, const AnimationTrackComponent& animationTrack);
@@ -176,19 +172,6 @@ private:
 
     size_t taskSize_{0U};
     size_t tasks_{0U};
-    size_t remaining_{0U};
-
-    uint64_t taskId_{0U};
-
-    BASE_NS::vector<CORE_NS::IThreadPool::IResult::Ptr> taskResults_;
-
-    BASE_NS::vector<InitTask> initTasks_;
-    uint64_t initTaskStart_{0U};
-
-    BASE_NS::vector<FrameIndexTask> frameIndexTasks_;
-
-    BASE_NS::vector<AnimateTask> animTasks_;
-    uint64_t animTaskStart_{0U};
 
     BASE_NS::vector<TrackValues> trackValues_;
     BASE_NS::vector<FrameData> frameIndices_;
@@ -64,6 +64,7 @@
 #include <render/nodecontext/intf_render_node_graph_manager.h>
 
 #include "ecs/systems/render_preprocessor_system.h"
+#include "render/datastore/render_data_store_default_camera.h"
 #include "util/log.h"
 
 using namespace BASE_NS;
@@ -302,7 +303,7 @@ bool LightProbeBakerSystem::Update(bool frameRenderingQueued, uint64_t /* time *
         if (!currentBake_.rng && cameraId != RenderSceneDataConstants::INVALID_ID) {
             currentBake_.rng = CreateLightProbeBakeRenderNodeGraph(renderContext_->GetRenderNodeGraphManager(),
                 currentBake_.cameraId,
-                dsCamera_->GetCamera(cameraId).postProcessName,
+                GetFrameWriter<RenderDataStoreDefaultCamera>(*dsCamera_).GetCamera(cameraId).postProcessName,
                 dataStoreScene_);
         }
     }
@@ -545,13 +546,14 @@ uint64_t LightProbeBakerSystem::CreateLightProbeBakingCamera()
 
     // Find environment to use for bakes
     CORE3D_NS::RenderCamera::Environment environment{};
+    const IRenderDataStoreDefaultCamera& dsCamera = GetFrameWriter<RenderDataStoreDefaultCamera>(*dsCamera_);
     if (Entity mainCameraEntity = FindMainCamera(cameraMgr_, renderConfig); EntityUtil::IsValid(mainCameraEntity)) {
         // Main camera environment
-        RenderCamera mainCamera = dsCamera_->GetCamera(mainCameraEntity.id);
+        RenderCamera mainCamera = dsCamera.GetCamera(mainCameraEntity.id);
         environment = mainCamera.environment;
     } else {
         // Default environment
-        environment = dsCamera_->GetEnvironment(RenderSceneDataConstants::INVALID_ID);
+        environment = dsCamera.GetEnvironment(RenderSceneDataConstants::INVALID_ID);
     }
 
     BASE_NS::vector<RenderCamera::LightProbeBakingData::PerProbeData> probeBakingData{};
@@ -606,7 +608,7 @@ uint64_t LightProbeBakerSystem::CreateLightProbeBakingCamera()
         camera.environment.envMap = environment.radianceCubemap;
     }
 
-    dsCamera_->AddCamera(camera);
+    GetFrameWriter<RenderDataStoreDefaultCamera>(*dsCamera_).AddCamera(camera);
 
     return camera.id;
 }
@@ -36,6 +36,7 @@
 #include <render/implementation_uids.h>
 #include <render/intf_render_context.h>
 
+#include "render/datastore/render_data_store_morph.h"
 #include "util/log.h"
 
 CORE_BEGIN_NAMESPACE()
@@ -80,7 +81,7 @@ void AddMorphSubmesh(IRenderDataStoreMorph& dataStore, const MeshComponent::Subm
     submesh.morphTargetCount = submeshDesc.morphTargetCount;
 
     // don't touch submesh.activeTargets as it's same for each submesh
-    dataStore.AddSubmesh(submesh);
+    GetFrameWriter<RenderDataStoreMorph>(dataStore).AddSubmesh(submesh);
 }
 }  // namespace
 
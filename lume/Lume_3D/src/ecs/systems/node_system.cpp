@@ -25,12 +25,15 @@
 #include <3d/ecs/components/transform_component.h>
 #include <3d/ecs/components/world_matrix_component.h>
 #include <base/containers/unordered_map.h>
+#include <base/math/mathf.h>
 #include <core/ecs/intf_ecs.h>
 #include <core/ecs/intf_entity_manager.h>
 #include <core/namespace.h>
 #include <core/perf/cpu_perf_scope.h>
 #include <core/property/property_types.h>
 #include <core/property_tools/property_api_impl.inl>
+#include <core/threading/intf_thread_pool.h>
+#include <core/util/parallel_for.h>
 
 #include "util/log.h"
 #include "util/string_util.h"
@@ -43,6 +46,11 @@ namespace {
 constexpr auto NODE_INDEX = 0U;
 constexpr auto LOCAL_INDEX = 1U;
 constexpr auto WORLD_INDEX = 2U;
+// Parent index of nodes whose parent matrix was given instead of calculated.
+constexpr uint32_t INVALID_FLAT_INDEX = ~0U;
+// Levels smaller than this are calculated in the calling thread.
+constexpr size_t MIN_PARALLEL_NODES = 1024U;
+constexpr size_t MIN_TASK_SIZE = 256U;
 
 template<typename ListType, typename ValueType>
 inline auto Find(ListType&& list, ValueType&& value)
@@ -126,27 +134,6 @@ bool LookupNodesByComponent(
 
     return result;
 }
-
-void CalculateWorldMatrix(
-    Math::Mat4X4& pm, ILocalMatrixComponentManager& localMatrixManager, const ComponentQuery::ResultRow& row)
-{
-    if (auto local = localMatrixManager.Read(row.components[LOCAL_INDEX])) {
-        pm = pm * local->matrix;
-    }
-}
-
-void UpdateWorldMatrix(
-    const Math::Mat4X4& pm, IWorldMatrixComponentManager& worldMatrixManager, const ComponentQuery::ResultRow& row)
-{
-    auto id = row.components[WORLD_INDEX];
-    if (id == IComponentManager::INVALID_COMPONENT_ID) {
-        worldMatrixManager.Create(row.entity);
-        id = worldMatrixManager.GetComponentId(row.entity);
-    }
-    if (auto worldMatrixHandle = worldMatrixManager.Write(row.components[WORLD_INDEX])) {
-        worldMatrixHandle->matrix = pm;
-    }
-}
 }  // namespace
 
 // Interface that allows nodes to access other nodes and request cache updates.
@@ -1088,11 +1075,17 @@ private:
     BASE_NS::vector<SceneNodeListener*> listeners_;
 };
 
-// State when traversing node tree.
-struct NodeSystem::State {
+// Node in the flattened hierarchy.
+struct NodeSystem::FlatNode {
     SceneNode* node;
-    Math::Mat4X4 parentMatrix;
+    // Index of the parent in flatNodes_, or INVALID_FLAT_INDEX if the parent matrix was given.
+    uint32_t parent;
+    // Distance from the node where flattening started.
+    uint32_t level;
     bool parentEnabled;
+    // Valid only if the world matrix of the node is calculated.
+    IComponentManager::ComponentId localMatrixId;
+    IComponentManager::ComponentId worldMatrixId;
 };
 
 struct NodeSystem::NodeInfo {
@@ -1118,7 +1111,8 @@ NodeSystem::NodeSystem(IEcs& ecs)
       transformManager_(*(GetManager<ITransformComponentManager>(ecs))),
       localMatrixManager_(*(GetManager<ILocalMatrixComponentManager>(ecs))),
       worldMatrixManager_(*(GetManager<IWorldMatrixComponentManager>(ecs))),
-      cache_(make_unique<NodeCache>(ecs.GetEntityManager(), nameManager_, nodeManager_, transformManager_))
+      cache_(make_unique<NodeCache>(ecs.GetEntityManager(), nameManager_, nodeManager_, transformManager_)),
+      threadPool_(ecs.GetThreadPool())
 {}
 
 string_view NodeSystem::GetName() const
@@ -1294,50 +1288,23 @@ void NodeSystem::RefreshAllNodes()
     // Make sure node cache is valid.
     cache_->Refresh();
 
-    stack_.clear();
-    stack_.reserve(nodeManager_.GetComponentCount());
     for (auto* child : GetRootNode().GetChildren()) {
         if (child) {
-            stack_.push_back(State{static_cast<SceneNode*>(child), Math::IDENTITY_4X4, child->GetEnabled()});
-        }
-    }
-    while (!stack_.empty()) {
-        auto state = stack_.back();
-        stack_.pop_back();
-
-        auto row = nodeQuery_.FindResultRow(state.node->GetEntity());
-        if (!row) {
-            continue;
-        }
-        const auto nodeInfo = ProcessNode(state.node, state.parentEnabled, row);
-
-        Math::Mat4X4& pm = state.parentMatrix;
-
-        if (row->IsValidComponentId(LOCAL_INDEX)) {
-            CalculateWorldMatrix(pm, localMatrixManager_, *row);
-            UpdateWorldMatrix(pm, worldMatrixManager_, *row);
-
-            // Save the values that were used to calculate current world matrix.
-            state.node->lastState_.localMatrixGeneration =
-                localMatrixManager_.GetComponentGeneration(row->components[LOCAL_INDEX]);
-            if (state.node->lastState_.parent != nodeInfo.parent) {
-                state.node->lastState_.parent = nodeInfo.parent;
-                state.node->lastState_.parentNode = static_cast<SceneNode*>(GetNode(nodeInfo.parent));
-            }
-        }
-        for (auto* child : state.node->GetChildren()) {
-            if (!child) {
-                continue;
-            }
-            stack_.push_back(State{static_cast<SceneNode*>(child), pm, nodeInfo.isEffectivelyEnabled});
+            FlattenHierarchy(*static_cast<SceneNode*>(child), Math::IDENTITY_4X4, child->GetEnabled(), false);
         }
     }
+    UpdateTransformations();
 
     // Store generation counters.
     localMatrixGeneration_ = localMatrixManager_.GetGenerationCounter();
     nodeGeneration_ = nodeManager_.GetGenerationCounter();
 }
 
+array_view<const Entity> NodeSystem::GetUpdatedEntities() const
+{
+    return updatedEntities_;
+}
+
 void NodeSystem::OnComponentEvent(IEcs::ComponentListener::EventType type, const IComponentManager& componentManager,
     array_view<const Entity> entities)
 {
@@ -1412,6 +1379,7 @@ void NodeSystem::Initialize()
 
 bool NodeSystem::Update(bool, uint64_t, uint64_t)
 {
+    updatedEntities_.clear();
     if (!active_) {
         return false;
     }
@@ -1432,8 +1400,8 @@ bool NodeSystem::Update(bool, uint64_t, uint64_t)
     // Find all parent nodes that have their transform updated.
     const vector<ISceneNode*> changedNodes = CollectChangedNodes();
 
-    // Update world transformations for changed tree branches. Remember parent as nodes are sorted according to depth
-    // and parent so we don't have to that often fetch the information.
+    // Collect the changed tree branches for updating world transformations. Remember parent as nodes are sorted
+    // according to depth and parent so we don't have to that often fetch the information.
     const auto* root = &GetRootNode();
     bool parentEnabled = true;
     Math::Mat4X4 parentMatrix(Math::IDENTITY_4X4);
@@ -1472,8 +1440,9 @@ bool NodeSystem::Update(bool, uint64_t, uint64_t)
             parent = nullptr;
         }
 
-        UpdateTransformations(*node, parentMatrix, parentEnabled);
+        FlattenHierarchy(*static_cast<SceneNode*>(node), parentMatrix, parentEnabled, true);
     }
+    UpdateTransformations();
 
     // Store generation counters.
     localMatrixGeneration_ = localMatrixManager_.GetGenerationCounter();
@@ -1569,48 +1538,146 @@ NodeSystem::NodeInfo NodeSystem::ProcessNode(
     return info;
 }
 
-void NodeSystem::UpdateTransformations(ISceneNode& node, Math::Mat4X4 const& matrix, bool enabled)
+void NodeSystem::FlattenHierarchy(SceneNode& node, Math::Mat4X4 const& matrix, bool enabled, bool skipDisabled)
 {
-#if (CORE3D_DEV_ENABLED == 1)
-    CORE_CPU_PERF_SCOPE("CORE3D", "NodeSystem", "UpdateTransformations", CORE3D_PROFILER_DEFAULT_COLOR);
-#endif
-    stack_.clear();
-    stack_.reserve(nodeManager_.GetComponentCount());
-    stack_.push_back(State{static_cast<SceneNode*>(&node), matrix, enabled});
-    while (!stack_.empty()) {
-        auto state = stack_.back();
-        stack_.pop_back();
-
-        auto row = nodeQuery_.FindResultRow(state.node->GetEntity());
+    if (flatIndex_.Contains(node.GetEntity())) {
+        // Already included in the branch of an ancestor.
+        return;
+    }
+    flatNodes_.push_back(FlatNode{&node, INVALID_FLAT_INDEX, 0U, enabled, IComponentManager::INVALID_COMPONENT_ID,
+        IComponentManager::INVALID_COMPONENT_ID});
+    flatMatrices_.push_back(matrix);
+
+    // Breadth-first, flatNodes_ grows while the children are added.
+    for (auto index = flatNodes_.size() - 1U; index < flatNodes_.size(); ++index) {
+        SceneNode* current = flatNodes_[index].node;
+        flatIndex_.Insert(current->GetEntity(), static_cast<uint32_t>(index));
+
+        auto row = nodeQuery_.FindResultRow(current->GetEntity());
         if (!row) {
             continue;
         }
-        const auto nodeInfo = ProcessNode(state.node, state.parentEnabled, row);
+        const auto nodeInfo = ProcessNode(current, flatNodes_[index].parentEnabled, row);
 
-        Math::Mat4X4& pm = state.parentMatrix;
-
-        if (nodeInfo.isEffectivelyEnabled && row->IsValidComponentId(LOCAL_INDEX)) {
-            CalculateWorldMatrix(pm, localMatrixManager_, *row);
-            UpdateWorldMatrix(pm, worldMatrixManager_, *row);
+        if ((!skipDisabled || nodeInfo.isEffectivelyEnabled) && row->IsValidComponentId(LOCAL_INDEX)) {
+            auto& flatNode = flatNodes_[index];
+            flatNode.localMatrixId = row->components[LOCAL_INDEX];
+            flatNode.worldMatrixId = row->components[WORLD_INDEX];
 
             // Save the values that were used to calculate current world matrix.
-            state.node->lastState_.localMatrixGeneration =
-                localMatrixManager_.GetComponentGeneration(row->components[LOCAL_INDEX]);
-            if (state.node->lastState_.parent != nodeInfo.parent) {
-                state.node->lastState_.parent = nodeInfo.parent;
-                state.node->lastState_.parentNode = static_cast<SceneNode*>(GetNode(nodeInfo.parent));
+            current->lastState_.localMatrixGeneration =
+                localMatrixManager_.GetComponentGeneration(flatNode.localMatrixId);
+            if (current->lastState_.parent != nodeInfo.parent) {
+                current->lastState_.parent = nodeInfo.parent;
+                current->lastState_.parentNode = static_cast<SceneNode*>(GetNode(nodeInfo.parent));
             }
         }
-        if (nodeInfo.isEffectivelyEnabled || nodeInfo.effectivelyEnabledChanged) {
-            for (auto* child : state.node->GetChildren()) {
+        if (!skipDisabled || nodeInfo.isEffectivelyEnabled || nodeInfo.effectivelyEnabledChanged) {
+            const auto level = flatNodes_[index].level + 1U;
+            for (auto* child : current->GetChildren()) {
                 if (child) {
-                    stack_.push_back(State{static_cast<SceneNode*>(child), pm, nodeInfo.isEffectivelyEnabled});
+                    flatNodes_.push_back(FlatNode{static_cast<SceneNode*>(child), static_cast<uint32_t>(index),
+                        level, nodeInfo.isEffectivelyEnabled, IComponentManager::INVALID_COMPONENT_ID,
+                        IComponentManager::INVALID_COMPONENT_ID});
+                    flatMatrices_.emplace_back();
                 }
             }
         }
     }
 }
 
+void NodeSystem::UpdateTransformations()
+{
+#if (CORE3D_DEV_ENABLED == 1)
+    CORE_CPU_PERF_SCOPE("CORE3D", "NodeSystem", "UpdateTransformations", CORE3D_PROFILER_DEFAULT_COLOR);
+#endif
+    if (flatNodes_.empty()) {
+        return;
+    }
+
+    // Bucket the nodes by level. A node's parent is always on the previous level so each level can be calculated in
+    // parallel once the previous one is done.
+    levelOffsets_.clear();
+    for (const auto& flatNode : flatNodes_) {
+        if (flatNode.level >= levelOffsets_.size()) {
+            levelOffsets_.resize(flatNode.level + 1U, 0U);
+        }
+        ++levelOffsets_[flatNode.level];
+    }
+    size_t offset = 0U;
+    for (auto& levelOffset : levelOffsets_) {
+        const auto count = levelOffset;
+        levelOffset = offset;
+        offset += count;
+    }
+    levelOffsets_.push_back(offset);
+    levelOrder_.resize(flatNodes_.size());
+    for (size_t i = 0U; i < flatNodes_.size(); ++i) {
+        levelOrder_[levelOffsets_[flatNodes_[i].level]++] = static_cast<uint32_t>(i);
+    }
+    // After filling each offset points to the start of the next level, shift them back.
+    for (auto level = levelOffsets_.size() - 1U; level > 0U; --level) {
+        levelOffsets_[level] = levelOffsets_[level - 1U];
+    }
+    levelOffsets_[0U] = 0U;
+
+    const auto threadCount = threadPool_ ? threadPool_->GetNumberOfThreads() : 0U;
+    for (size_t level = 0U; (level + 1U) < levelOffsets_.size(); ++level) {
+        const auto begin = levelOffsets_[level];
+        const auto end = levelOffsets_[level + 1U];
+        const auto count = end - begin;
+        if ((threadCount <= 1U) || (count < MIN_PARALLEL_NODES)) {
+            CalculateWorldMatrices(begin, end);
+            continue;
+        }
+        // The calling thread calculates batches too, so the level completes even if the pool threads are busy.
+        const auto taskSize = Math::max(MIN_TASK_SIZE, count / (threadCount + 1U));
+        const auto tasks = (count + taskSize - 1U) / taskSize;
+        ParallelFor(threadPool_.get(), tasks, [this, begin, end, taskSize](size_t task) {
+            const auto taskBegin = begin + task * taskSize;
+            CalculateWorldMatrices(taskBegin, Math::min(taskBegin + taskSize, end));
+        });
+    }
+
+    // Component writes aren't thread safe so the results are written after all levels are done.
+    for (size_t i = 0U; i < flatNodes_.size(); ++i) {
+        const auto& flatNode = flatNodes_[i];
+        const Entity entity = flatNode.node->GetEntity();
+        flatIndex_.Erase(entity);
+        updatedEntities_.push_back(entity);
+        if (flatNode.localMatrixId == IComponentManager::INVALID_COMPONENT_ID) {
+            continue;
+        }
+        auto id = flatNode.worldMatrixId;
+        if (id == IComponentManager::INVALID_COMPONENT_ID) {
+            worldMatrixManager_.Create(entity);
+            id = worldMatrixManager_.GetComponentId(entity);
+        }
+        if (auto worldMatrixHandle = worldMatrixManager_.Write(id)) {
+            worldMatrixHandle->matrix = flatMatrices_[i];
+        }
+    }
+    flatNodes_.clear();
+    flatMatrices_.clear();
+}
+
+void NodeSystem::CalculateWorldMatrices(size_t begin, size_t end)
+{
+    for (auto i = begin; i < end; ++i) {
+        const auto index = levelOrder_[i];
+        const auto& flatNode = flatNodes_[index];
+        auto& matrix = flatMatrices_[index];
+        if (flatNode.parent != INVALID_FLAT_INDEX) {
+            matrix = flatMatrices_[flatNode.parent];
+        }
+        if (flatNode.localMatrixId != IComponentManager::INVALID_COMPONENT_ID) {
+            if (auto local = localMatrixManager_.Read(flatNode.localMatrixId)) {
+                matrix = matrix * local->matrix;
+            }
+        }
+    }
+}
+
 void NodeSystem::GatherNodeEntities(const ISceneNode& node, vector<Entity>& entities) const
 {
     entities.push_back(node.GetEntity());
@@ -1627,20 +1694,16 @@ void NodeSystem::UpdatePreviousWorldMatrices()
     CORE_CPU_PERF_SCOPE("CORE3D", "NodeSystem", "UpdatePreviousWorldMatrices", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
     if (worldMatrixGeneration_ != worldMatrixManager_.GetGenerationCounter()) {
-        const auto components = worldMatrixManager_.GetComponentCount();
+        // compare using the packed array and lock only the components which need to be written.
+        const auto worldMatrices = worldMatrixManager_.GetComponentArray();
+        const auto components = static_cast<IComponentManager::ComponentId>(worldMatrices.size());
         for (IComponentManager::ComponentId id = 0U; id < components; ++id) {
-            auto handle = worldMatrixManager_.GetData(id);
-            // this shouldn't be possible as we are going through 0..number of components.
-            if (!handle) {
+            if (worldMatrices[id].prevMatrix == worldMatrices[id].matrix) {
                 continue;
             }
-            if (auto comp = ScopedHandle<const WorldMatrixComponent>(*handle)) {
-                if (comp->prevMatrix == comp->matrix) {
-                    continue;
-                }
-            }
-            if (auto comp = ScopedHandle<WorldMatrixComponent>(*handle)) {
+            if (auto comp = worldMatrixManager_.Write(id)) {
                 comp->prevMatrix = comp->matrix;
+                updatedEntities_.push_back(worldMatrixManager_.GetEntity(id));
             }
         }
         worldMatrixGeneration_ = worldMatrixManager_.GetGenerationCounter();
@@ -17,6 +17,7 @@
 #define CORE_ECS_NODESYSTEM_H
 
 #include <ComponentTools/component_query.h>
+#include <ComponentTools/entity_index.h>
 
 #include <3d/ecs/systems/intf_node_system.h>
 #include <base/containers/unique_ptr.h>
@@ -25,6 +26,7 @@
 #include <base/math/matrix.h>
 #include <core/ecs/intf_ecs.h>
 #include <core/namespace.h>
+#include <core/threading/intf_thread_pool.h>
 
 CORE3D_BEGIN_NAMESPACE()
 class INameComponentManager;
@@ -70,6 +72,10 @@ public:
 
     void RefreshAllNodes() override;
 
+    // Entities whose node or world matrix components were written during the last Update(). The component events of
+    // these writes are sent only after all the systems have been updated.
+    BASE_NS::array_view<const CORE_NS::Entity> GetUpdatedEntities() const;
+
     // IEcs::ComponentListener
     void OnComponentEvent(CORE_NS::IEcs::ComponentListener::EventType type,
         const CORE_NS::IComponentManager& componentManager,
@@ -79,12 +85,18 @@ private:
     class NodeAccess;
     class SceneNode;
     class NodeCache;
-    struct State;
+    struct FlatNode;
     struct NodeInfo;
 
     BASE_NS::vector<ISceneNode*> CollectChangedNodes();
     NodeInfo ProcessNode(SceneNode* node, const bool parentEnabled, const CORE_NS::ComponentQuery::ResultRow* row);
-    void UpdateTransformations(ISceneNode& node, BASE_NS::Math::Mat4X4 const& matrix, bool enabled);
+    // Adds the node and its descendants to the flattened hierarchy. Nodes are processed breadth-first and the
+    // effectively enabled state is updated. If skipDisabled is true, disabled branches are not visited.
+    void FlattenHierarchy(SceneNode& node, BASE_NS::Math::Mat4X4 const& matrix, bool enabled, bool skipDisabled);
+    // Calculates the world matrices of the flattened hierarchy one depth level at a time and writes them to the world
+    // matrix components.
+    void UpdateTransformations();
+    void CalculateWorldMatrices(size_t begin, size_t end);
     void GatherNodeEntities(const ISceneNode& node, BASE_NS::vector<CORE_NS::Entity>& entities) const;
     void UpdatePreviousWorldMatrices();
 
@@ -106,7 +118,18 @@ private:
     uint32_t nodeGeneration_ = 0;
 
     BASE_NS::vector<CORE_NS::Entity> modifiedEntities_;
-    BASE_NS::vector<State> stack_;
+    BASE_NS::vector<CORE_NS::Entity> updatedEntities_;
+
+    // Nodes whose world matrices are updated in the order they were visited, and their world matrices.
+    BASE_NS::vector<FlatNode> flatNodes_;
+    BASE_NS::vector<BASE_NS::Math::Mat4X4> flatMatrices_;
+    // Indices to flatNodes_ sorted by level, and the offset of each level with flatNodes_.size() as the last entry.
+    BASE_NS::vector<uint32_t> levelOrder_;
+    BASE_NS::vector<size_t> levelOffsets_;
+    // Entities already in flatNodes_.
+    CORE_NS::EntityIndex flatIndex_;
+
+    CORE_NS::IThreadPool::Ptr threadPool_;
 };
 CORE3D_END_NAMESPACE()
 
@@ -44,6 +44,7 @@
 #include <3d/ecs/components/reflection_probe_component.h>
 #include <3d/ecs/components/render_configuration_component.h>
 #include <3d/ecs/components/render_handle_component.h>
+#include <3d/ecs/components/render_mesh_batch_component.h>
 #include <3d/ecs/components/render_mesh_component.h>
 #include <3d/ecs/components/skin_component.h>
 #include <3d/ecs/components/skin_joints_component.h>
@@ -95,8 +96,17 @@
 #include <render/resource_handle.h>
 
 #include "ecs/components/previous_joint_matrices_component.h"
+#include "ecs/systems/node_system.h"
 #include "ecs/systems/render_preprocessor_system.h"
+#include "render/datastore/render_data_store_default_camera.h"
+#include "render/datastore/render_data_store_default_light.h"
+#include "render/datastore/render_data_store_default_material.h"
+#include "render/datastore/render_data_store_default_scene.h"
+#include "render/datastore/render_data_store_frame_handoff.h"
+#include "render/datastore/render_data_store_light_probe.h"
+#include "render/datastore/render_data_store_morph.h"
 #include "util/component_util_functions.h"
+#include "util/light_probe_volume_index.h"
 #include "util/log.h"
 #include "util/mesh_util.h"
 #include "util/scene_util.h"
@@ -846,7 +856,9 @@ IRenderDataStorePostProcess::PostProcess::Variables FillPostProcessConfiguration
 PROPERTY_LIST(IRenderSystem::Properties, ComponentMetadata, MEMBER_PROPERTY(dataStoreMaterial, "dataStoreMaterial", 0),
     MEMBER_PROPERTY(dataStoreCamera, "dataStoreCamera", 0), MEMBER_PROPERTY(dataStoreLight, "dataStoreLight", 0),
     MEMBER_PROPERTY(dataStoreScene, "dataStoreScene", 0), MEMBER_PROPERTY(dataStoreMorph, "dataStoreMorph", 0),
-    MEMBER_PROPERTY(dataStoreLightProbe, "dataStoreLightProbe", 0), MEMBER_PROPERTY(dataStorePrefix, "", 0))
+    MEMBER_PROPERTY(dataStoreLightProbe, "dataStoreLightProbe", 0), MEMBER_PROPERTY(dataStorePrefix, "", 0),
+    MEMBER_PROPERTY(frameLatency, "frameLatency", 0),
+    MEMBER_PROPERTY(retainedRenderMeshes, "retainedRenderMeshes", 0))
 
 // Extended sign: returns -1, 0 or 1 based on sign of a
 float Sgn(float a)
@@ -1413,10 +1425,21 @@ bool GetEntityLayerMask(const ILayerComponentManager& layerMgr, Entity entity, u
     return false;
 }
 
+const LightProbeVolumeIndex* GetLightProbeVolumeIndex(const IRenderDataStoreLightProbe& dsLightProbe, uint64_t id)
+{
+    // the lookup index is only available from the built-in data store.
+    if (dsLightProbe.GetTypeName() != RenderDataStoreLightProbe::TYPE_NAME) {
+        return nullptr;
+    }
+    return static_cast<const RenderDataStoreLightProbe&>(dsLightProbe).GetLightProbeVolumeIndex(id);
+}
+
 LightProbeVolumeOpt GetLightProbesVolumeFromMainCamera(IEntityManager& entityMgr, ICameraComponentManager* cameraMgr,
     ILightProbeGroupComponentManager* lightProbeGroupMgr, INodeComponentManager* nodeMgr,
-    ILayerComponentManager* layerMgr, BASE_NS::refcnt_ptr<IRenderDataStoreLightProbe> dsLightProbe)
+    ILayerComponentManager* layerMgr, BASE_NS::refcnt_ptr<IRenderDataStoreLightProbe> dsLightProbe,
+    const LightProbeVolumeIndex*& lightProbeVolumeIndex)
 {
+    lightProbeVolumeIndex = nullptr;
     if (!cameraMgr || !lightProbeGroupMgr || !nodeMgr || !layerMgr || !dsLightProbe) {
         return {};
     }
@@ -1485,6 +1508,7 @@ LightProbeVolumeOpt GetLightProbesVolumeFromMainCamera(IEntityManager& entityMgr
         return {};
     }
 
+    lightProbeVolumeIndex = GetLightProbeVolumeIndex(*dsLightProbe, lightProbeGroupEntity.id);
     return dsLightProbe->GetLightProbeVolume(lightProbeGroupEntity.id);
 }
 
@@ -1502,12 +1526,39 @@ RenderMaterialFlags GetSubmeshRenderMaterialFlag(bool hasValidTetrahedron, Rende
     return flag;
 }
 
+uint32_t GetComponentGeneration(const IComponentManager& manager, const Entity& entity)
+{
+    const IComponentManager::ComponentId id = manager.GetComponentId(entity);
+    return (id != IComponentManager::INVALID_COMPONENT_ID) ? manager.GetComponentGeneration(id) : 0U;
+}
+
+template<typename DataStore>
+void StopDataStoreFrameBuffering(refcnt_ptr<DataStore>& frameBufferedDataStore)
+{
+    if (frameBufferedDataStore) {
+        frameBufferedDataStore->DisableFrameBuffering();
+        frameBufferedDataStore.reset();
+    }
+}
+
+// dataStore is the data store from the manager and is replaced with its frame writer.
+template<typename DataStore, typename Interface>
+void StartDataStoreFrameBuffering(refcnt_ptr<Interface>& dataStore, refcnt_ptr<DataStore>& frameBufferedDataStore,
+    const shared_ptr<RenderDataStoreFrameHandoff>& frameHandoff)
+{
+    if (dataStore && (dataStore->GetTypeName() == DataStore::TYPE_NAME)) {
+        frameBufferedDataStore = refcnt_ptr<DataStore>(static_cast<DataStore*>(dataStore.get()));
+        frameBufferedDataStore->EnableFrameBuffering(frameHandoff);
+        dataStore = refcnt_ptr<Interface>(&frameBufferedDataStore->GetFrameWriter());
+    }
+}
 }  // namespace
 
 RenderSystem::RenderSystem(IEcs& ecs)
     : ecs_(ecs),
       nodeMgr_(GetManager<INodeComponentManager>(ecs)),
       renderMeshMgr_(GetManager<IRenderMeshComponentManager>(ecs)),
+      renderMeshBatchMgr_(GetManager<IRenderMeshBatchComponentManager>(ecs)),
       worldMatrixMgr_(GetManager<IWorldMatrixComponentManager>(ecs)),
       renderConfigMgr_(GetManager<IRenderConfigurationComponentManager>(ecs)),
       cameraMgr_(GetManager<ICameraComponentManager>(ecs)),
@@ -1601,6 +1652,8 @@ void RenderSystem::SetProperties(const IPropertyHandle& data)
         properties_.dataStoreMorph = in->dataStoreMorph;
         properties_.dataStoreLightProbe = in->dataStoreLightProbe;
         properties_.dataStorePrefix = in->dataStorePrefix;
+        properties_.frameLatency = in->frameLatency;
+        properties_.retainedRenderMeshes = in->retainedRenderMeshes;
         if (renderContext_) {
             SetDataStorePointers(renderContext_->GetRenderDataStoreManager());
         }
@@ -1609,6 +1662,8 @@ void RenderSystem::SetProperties(const IPropertyHandle& data)
 
 void RenderSystem::SetDataStorePointers(IRenderDataStoreManager& manager)
 {
+    // retained render meshes are set again to the new data store, or added every frame when disabled
+    ResetRetainedRenderables();
     // get data stores
     dsScene_ = refcnt_ptr<IRenderDataStoreDefaultScene>(manager.GetRenderDataStore(properties_.dataStoreScene));
     dsCamera_ = refcnt_ptr<IRenderDataStoreDefaultCamera>(manager.GetRenderDataStore(properties_.dataStoreCamera));
@@ -1618,6 +1673,63 @@ void RenderSystem::SetDataStorePointers(IRenderDataStoreManager& manager)
     dsRenderPostProcesses_ = refcnt_ptr<IRenderDataStoreRenderPostProcesses>(manager.Create(
         IRenderDataStoreRenderPostProcesses::UID, (properties_.dataStorePrefix + RPP_DATA_STORE_NAME).data()));
     dsLightProbe_ = refcnt_ptr<IRenderDataStoreLightProbe>(manager.GetRenderDataStore(properties_.dataStoreLightProbe));
+    SetFrameBuffering(manager);
+}
+
+void RenderSystem::SetFrameBuffering(IRenderDataStoreManager& manager)
+{
+    if (!frameHandoff_) {
+        frameHandoff_ = make_shared<RenderDataStoreFrameHandoff>();
+    }
+    // written by the morphing system which runs before the render system
+    auto dsMorph = refcnt_ptr<IRenderDataStoreMorph>(manager.GetRenderDataStore(properties_.dataStoreMorph));
+    // the render nodes may still be reading the previous frame
+    const auto lock = frameHandoff_->LockIdle();
+    StopFrameBuffering();
+    if (properties_.frameLatency > 0U) {
+        StartDataStoreFrameBuffering(dsCamera_, frameBufferedStores_.camera, frameHandoff_);
+        StartDataStoreFrameBuffering(dsLight_, frameBufferedStores_.light, frameHandoff_);
+        StartDataStoreFrameBuffering(dsMaterial_, frameBufferedStores_.material, frameHandoff_);
+        StartDataStoreFrameBuffering(dsScene_, frameBufferedStores_.scene, frameHandoff_);
+        StartDataStoreFrameBuffering(dsMorph, frameBufferedStores_.morph, frameHandoff_);
+    }
+}
+
+void RenderSystem::StopFrameBuffering()
+{
+    StopDataStoreFrameBuffering(frameBufferedStores_.camera);
+    StopDataStoreFrameBuffering(frameBufferedStores_.light);
+    StopDataStoreFrameBuffering(frameBufferedStores_.material);
+    StopDataStoreFrameBuffering(frameBufferedStores_.scene);
+    StopDataStoreFrameBuffering(frameBufferedStores_.morph);
+}
+
+void RenderSystem::CommitFrameData()
+{
+    if (!frameHandoff_) {
+        return;
+    }
+    auto& stores = frameBufferedStores_;
+    if (stores.material) {
+        stores.material->PrepareFrameSwap();
+    }
+    // all the data stores are swapped together. waits only if the render nodes are still processing the previous frame
+    const auto lock = frameHandoff_->LockIdle();
+    if (stores.material) {
+        stores.material->SwapFrame();
+    }
+    if (stores.camera) {
+        stores.camera->SwapFrame();
+    }
+    if (stores.light) {
+        stores.light->SwapFrame();
+    }
+    if (stores.scene) {
+        stores.scene->SwapFrame();
+    }
+    if (stores.morph) {
+        stores.morph->SwapFrame();
+    }
 }
 
 const IEcs& RenderSystem::GetECS() const
@@ -1776,6 +1888,17 @@ void RenderSystem::Initialize()
     ecs_.AddListener(*graphicsStateMgr_, *this);
     ecs_.AddListener(*lightProbeMgr_, *this);
     ecs_.AddListener(*transformMgr_, *this);
+    // changes of the retained render meshes
+    ecs_.AddListener(*renderMeshMgr_, *this);
+    ecs_.AddListener(*renderMeshBatchMgr_, *this);
+    ecs_.AddListener(*worldMatrixMgr_, *this);
+    ecs_.AddListener(*nodeMgr_, *this);
+    ecs_.AddListener(*layerMgr_, *this);
+    ecs_.AddListener(*skinMgr_, *this);
+    ecs_.AddListener(*jointMatricesMgr_, *this);
+    ecs_.AddListener(*prevJointMatricesMgr_, *this);
+    ecs_.AddListener(static_cast<IEcs::EntityListener&>(*this));
+    nodeSystem_ = static_cast<NodeSystem*>(GetSystem<INodeSystem>(ecs_));
 }
 
 bool RenderSystem::Update(bool frameRenderingQueued, uint64_t totalTime, uint64_t deltaTime)
@@ -1798,6 +1921,7 @@ bool RenderSystem::Update(bool frameRenderingQueued, uint64_t totalTime, uint64_
     const auto layerGen = layerMgr_->GetGenerationCounter();
     const auto nodeGen = nodeMgr_->GetGenerationCounter();
     const auto renderMeshGen = renderMeshMgr_->GetGenerationCounter();
+    const auto renderMeshBatchGen = renderMeshBatchMgr_->GetGenerationCounter();
     const auto worldMatrixGen = worldMatrixMgr_->GetGenerationCounter();
     if (!frameRenderingQueued && (renderConfigurationGeneration_ == renderConfigurationGen) &&
         (cameraGeneration_ == cameraGen) && (lightGeneration_ == lightGen) &&
@@ -1806,7 +1930,7 @@ bool RenderSystem::Update(bool frameRenderingQueued, uint64_t totalTime, uint64_
         (postprocessConfigurationGeneration_ == postprocessConfigurationGen) &&
         (postprocessEffectGeneration_ == postprocessEffectGen) && (jointGeneration_ == jointGen) &&
         (layerGeneration_ == layerGen) && (nodeGeneration_ == nodeGen) && (renderMeshGeneration_ == renderMeshGen) &&
-        (worldMatrixGeneration_ == worldMatrixGen)) {
+        (renderMeshBatchGeneration_ == renderMeshBatchGen) && (worldMatrixGeneration_ == worldMatrixGen)) {
         return false;
     }
 
@@ -1823,6 +1947,7 @@ bool RenderSystem::Update(bool frameRenderingQueued, uint64_t totalTime, uint64_
     layerGeneration_ = layerGen;
     nodeGeneration_ = nodeGen;
     renderMeshGeneration_ = renderMeshGen;
+    renderMeshBatchGeneration_ = renderMeshBatchGen;
     worldMatrixGeneration_ = worldMatrixGen;
 
     totalTime_ = totalTime;
@@ -1834,6 +1959,7 @@ bool RenderSystem::Update(bool frameRenderingQueued, uint64_t totalTime, uint64_
         dsLight_->Clear();
         dsScene_->Clear();
         FetchFullScene();
+        CommitFrameData();
     } else {
 #if (CORE3D_VALIDATION_ENABLED == 1)
         PLUGIN_LOG_ONCE_W("rs_data_stores_not_found", "CORE3D_VALIDATION: render system render data stores not found");
@@ -1853,6 +1979,16 @@ void RenderSystem::Uninitialize()
     ecs_.RemoveListener(*graphicsStateMgr_, *this);
     ecs_.RemoveListener(*lightProbeMgr_, *this);
     ecs_.RemoveListener(*transformMgr_, *this);
+    ecs_.RemoveListener(*renderMeshMgr_, *this);
+    ecs_.RemoveListener(*renderMeshBatchMgr_, *this);
+    ecs_.RemoveListener(*worldMatrixMgr_, *this);
+    ecs_.RemoveListener(*nodeMgr_, *this);
+    ecs_.RemoveListener(*layerMgr_, *this);
+    ecs_.RemoveListener(*skinMgr_, *this);
+    ecs_.RemoveListener(*jointMatricesMgr_, *this);
+    ecs_.RemoveListener(*prevJointMatricesMgr_, *this);
+    ecs_.RemoveListener(static_cast<IEcs::EntityListener&>(*this));
+    nodeSystem_ = nullptr;
 
     lightQuery_.SetEcsListenersEnabled(false);
     renderableQuery_.SetEcsListenersEnabled(false);
@@ -1863,6 +1999,11 @@ void RenderSystem::Uninitialize()
     renderProcessing_ = {};
     DestroyRenderDataStores();
 
+    ResetRetainedRenderables();
+    if (frameHandoff_) {
+        const auto lock = frameHandoff_->LockIdle();
+        StopFrameBuffering();
+    }
     dsScene_.reset();
     dsCamera_.reset();
     dsLight_.reset();
@@ -1875,6 +2016,15 @@ void RenderSystem::Uninitialize()
 void RenderSystem::OnComponentEvent(
     EventType type, const IComponentManager& componentManager, array_view<const Entity> entities)
 {
+    // retained render meshes are compared to their component generations, so the type of the event doesn't matter.
+    // until the first full update there's nothing to compare to.
+    if (retainedRenderablesValid_ &&
+        ((&componentManager == renderMeshMgr_) || (&componentManager == renderMeshBatchMgr_) ||
+            (&componentManager == worldMatrixMgr_) || (&componentManager == nodeMgr_) ||
+            (&componentManager == layerMgr_) || (&componentManager == skinMgr_) ||
+            (&componentManager == jointMatricesMgr_) || (&componentManager == prevJointMatricesMgr_))) {
+        retainedDirtyEntities_.append(entities.cbegin(), entities.cend());
+    }
     if (componentManager.GetUid() == IMaterialComponentManager::UID) {
         if ((type == EventType::CREATED) || (type == EventType::MODIFIED)) {
             materialModifiedEvents_.append(entities.cbegin(), entities.cend());
@@ -1966,6 +2116,15 @@ void RenderSystem::OnComponentEvent(
     }
 }
 
+void RenderSystem::OnEntityEvent(const EntityListener::EventType type, const array_view<const Entity> entities)
+{
+    // deactivated entities leave the renderable query without component events
+    if (retainedRenderablesValid_ &&
+        ((type == EntityListener::EventType::ACTIVATED) || (type == EntityListener::EventType::DEACTIVATED))) {
+        retainedDirtyEntities_.append(entities.cbegin(), entities.cend());
+    }
+}
+
 RenderConfigurationComponent RenderSystem::GetRenderConfigurationComponent()
 {
     for (IComponentManager::ComponentId i = 0; i < renderConfigMgr_->GetComponentCount(); i++) {
@@ -2025,86 +2184,272 @@ void RenderSystem::EvaluateRenderDataStoreOutput()
         info.shadowCasterBoundingSphere, sceneBoundingSpherePosition_, sceneBoundingSphereRadius_);
 }
 
-void RenderSystem::ProcessRenderables()
+bool RenderSystem::UpdateRetainedRenderable(const ComponentQuery::ResultRow& row, RetainedRenderable& retained) const
+{
+    const uint32_t renderMeshGeneration = renderMeshMgr_->GetComponentGeneration(row.components[RQ_RMC]);
+    const uint32_t worldMatrixGeneration = worldMatrixMgr_->GetComponentGeneration(row.components[RQ_WM]);
+    const uint32_t nodeGeneration =
+        row.IsValidComponentId(RQ_N) ? nodeMgr_->GetComponentGeneration(row.components[RQ_N]) : 0U;
+    const uint32_t layerGeneration =
+        row.IsValidComponentId(RQ_L) ? layerMgr_->GetComponentGeneration(row.components[RQ_L]) : 0U;
+    uint32_t batchGeneration = 0U;
+    uint32_t batchRenderMeshGeneration = 0U;
+    if (EntityUtil::IsValid(retained.batch)) {
+        batchGeneration = GetComponentGeneration(*renderMeshBatchMgr_, retained.batch);
+        batchRenderMeshGeneration = GetComponentGeneration(*renderMeshMgr_, retained.batch);
+    }
+    // skinned render meshes are added every frame as the joint matrices are frame data
+    retained.skinned = row.IsValidComponentId(RQ_SM) && row.IsValidComponentId(RQ_JM) &&
+                       row.IsValidComponentId(RQ_PJM);
+    const bool changed = retained.skinned || (retained.renderMeshGeneration != renderMeshGeneration) ||
+                         (retained.worldMatrixGeneration != worldMatrixGeneration) ||
+                         (retained.nodeGeneration != nodeGeneration) || (retained.layerGeneration != layerGeneration) ||
+                         (retained.batchGeneration != batchGeneration) ||
+                         (retained.batchRenderMeshGeneration != batchRenderMeshGeneration);
+    retained.renderMeshGeneration = renderMeshGeneration;
+    retained.worldMatrixGeneration = worldMatrixGeneration;
+    retained.nodeGeneration = nodeGeneration;
+    retained.layerGeneration = layerGeneration;
+    retained.batchGeneration = batchGeneration;
+    retained.batchRenderMeshGeneration = batchRenderMeshGeneration;
+    return changed;
+}
+
+void RenderSystem::SetRetainedBatch(const Entity& entity, RetainedRenderable& retained, const Entity& batch)
+{
+    if (EntityUtil::IsValid(retained.batch)) {
+        if (auto pos = retainedBatchUsers_.find(retained.batch); pos != retainedBatchUsers_.end()) {
+            auto& users = pos->second;
+            users.erase(std::remove(users.begin(), users.end(), entity), users.cend());
+            if (users.empty()) {
+                retainedBatchUsers_.erase(pos);
+            }
+        }
+    }
+    retained.batch = batch;
+    if (EntityUtil::IsValid(batch)) {
+        retainedBatchUsers_[batch].push_back(entity);
+    }
+    // compared on the next frames to notice changes in the batch
+    retained.batchGeneration = GetComponentGeneration(*renderMeshBatchMgr_, batch);
+    retained.batchRenderMeshGeneration = GetComponentGeneration(*renderMeshMgr_, batch);
+}
+
+void RenderSystem::DestroyRetainedRenderable(const Entity& entity, RetainedRenderable& retained)
 {
-    renderableQuery_.Execute();
+    if (retained.retained) {
+        dsMaterial_->DestroyRetainedRenderMeshData(entity.id);
+        retained.retained = false;
+    }
+}
 
-    IComponentManager::ComponentId jointId = IComponentManager::INVALID_COMPONENT_ID;
-    IComponentManager::ComponentId prevJointId = IComponentManager::INVALID_COMPONENT_ID;
-    const auto queryResults = renderableQuery_.GetResults();
-    for (const auto& row : queryResults) {
-        jointId = IComponentManager::INVALID_COMPONENT_ID;
-        prevJointId = IComponentManager::INVALID_COMPONENT_ID;
-
-        const auto& entity = row.entity;
-        if (auto rmcHandle = renderMeshMgr_->Read(row.components[RQ_RMC])) {
-            uint32_t sceneId = 0U;
-            RenderMeshFlags renderMeshFlags = 0U;
-            bool enabled = false;  // not going to rendering if there's no node (could go..)
-            if (row.IsValidComponentId(RQ_N)) {
-                if (auto nodeHandle = nodeMgr_->Read(row.components[RQ_N]); nodeHandle) {
-                    sceneId = nodeHandle->sceneId;
-                    enabled = nodeHandle->effectivelyEnabled;
-                    if (nodeHandle->flags & NodeComponent::FlagBits::CONTRIBUTE_GI_BIT) {
-                        renderMeshFlags |= RENDER_MESH_CONTRIBUTE_GI_BIT;
-                    }
+void RenderSystem::ResetRetainedRenderables()
+{
+    if (dsMaterial_) {
+        for (const auto& ref : retainedRenderables_) {
+            if (ref.second.retained) {
+                dsMaterial_->DestroyRetainedRenderMeshData(ref.first.id);
+            }
+        }
+    }
+    retainedRenderables_.clear();
+    retainedBatchUsers_.clear();
+    retainedDirtyEntities_.clear();
+    retainedSkinned_.clear();
+    retainedRenderablesValid_ = false;
+}
+
+void RenderSystem::ProcessRenderable(const ComponentQuery::ResultRow& row,
+    const array_view<const WorldMatrixComponent> worldMatrices, RetainedRenderable* retained)
+{
+    const auto& entity = row.entity;
+    if (auto rmcHandle = renderMeshMgr_->Read(row.components[RQ_RMC])) {
+        uint32_t sceneId = 0U;
+        RenderMeshFlags renderMeshFlags = 0U;
+        bool enabled = false;  // not going to rendering if there's no node (could go..)
+        if (row.IsValidComponentId(RQ_N)) {
+            if (auto nodeHandle = nodeMgr_->Read(row.components[RQ_N]); nodeHandle) {
+                sceneId = nodeHandle->sceneId;
+                enabled = nodeHandle->effectivelyEnabled;
+                if (nodeHandle->flags & NodeComponent::FlagBits::CONTRIBUTE_GI_BIT) {
+                    renderMeshFlags |= RENDER_MESH_CONTRIBUTE_GI_BIT;
                 }
             }
-            if (!enabled) {
-                continue;
+        }
+        if (retained && (retained->batch != rmcHandle->renderMeshBatch)) {
+            SetRetainedBatch(entity, *retained, rmcHandle->renderMeshBatch);
+        }
+        if (!enabled) {
+            if (retained) {
+                DestroyRetainedRenderable(entity, *retained);
             }
-            RenderMeshBatchData renderMeshBatch;
-            if (EntityUtil::IsValid(rmcHandle->renderMeshBatch)) {
-                if (auto batchRenderMeshComponent = renderMeshMgr_->Read(rmcHandle->renderMeshBatch);
-                    batchRenderMeshComponent) {
-                    renderMeshBatch.renderMeshId = rmcHandle->renderMeshBatch.id;
-                    renderMeshBatch.meshId = batchRenderMeshComponent->mesh.id;
-                }
+            return;
+        }
+        RenderMeshBatchData renderMeshBatch;
+        instanceTransforms_.clear();
+        if (EntityUtil::IsValid(rmcHandle->renderMeshBatch)) {
+            if (auto batchHandle = renderMeshBatchMgr_->Read(rmcHandle->renderMeshBatch);
+                batchHandle && !batchHandle->instanceTransforms.empty()) {
+                // copied as the component data is only valid while the handle is alive
+                instanceTransforms_.append(
+                    batchHandle->instanceTransforms.cbegin(), batchHandle->instanceTransforms.cend());
+            } else if (auto batchRenderMeshComponent = renderMeshMgr_->Read(rmcHandle->renderMeshBatch);
+                       batchRenderMeshComponent) {
+                renderMeshBatch.renderMeshId = rmcHandle->renderMeshBatch.id;
+                renderMeshBatch.meshId = batchRenderMeshComponent->mesh.id;
             }
+        }
 
-            const WorldMatrixComponent& world = worldMatrixMgr_->Get(row.components[RQ_WM]);
-            const uint64_t layerMask = !row.IsValidComponentId(RQ_L) ? LayerConstants::DEFAULT_LAYER_MASK
-                                                                     : layerMgr_->Read(row.components[RQ_L])->layerMask;
-
-            // Pack per-instance RenderMeshFlags into the high 32 bits of sceneId (UBO layers.w).
-            const uint64_t sceneIdPacked =
-                static_cast<uint64_t>(sceneId) | (static_cast<uint64_t>(renderMeshFlags) << 32U);
-            // this is a batch of same material, so the material uniform data is duplicated
-            RenderMeshData rmd{
-                world.matrix, world.matrix, world.prevMatrix, entity.id, rmcHandle->mesh.id, layerMask, sceneIdPacked};
-            std::copy(std::begin(rmcHandle->customData), std::end(rmcHandle->customData), std::begin(rmd.customData));
-            // Optional skin, cannot change based on submesh)
-            RenderMeshSkinData rmsd;
-            if (row.IsValidComponentId(RQ_SM) && row.IsValidComponentId(RQ_JM) && row.IsValidComponentId(RQ_PJM)) {
-                jointId = row.components[RQ_JM];
-                prevJointId = row.components[RQ_PJM];
-                if (auto skin = skinMgr_->Read(row.components[RQ_SM])) {
-                    rmsd.id = skin->skinRoot.id;
-                } else {
-                    static_assert(RenderSceneDataConstants::INVALID_INDEX == INVALID_ENTITY);
-                    rmsd.id = RenderSceneDataConstants::INVALID_INDEX;
-                }
-                auto const jointMatricesData = jointMatricesMgr_->Read(jointId);
-                auto const prevJointMatricesData = prevJointMatricesMgr_->Read(prevJointId);
-                const SkinProcessData spd{&(*jointMatricesData), &(*prevJointMatricesData)};
-
-                PLUGIN_ASSERT(spd.prevJointMatricesComponent);
-                rmsd.skinJointMatrices = array_view<Math::Mat4X4 const>(
-                    spd.jointMatricesComponent->jointMatrices, spd.jointMatricesComponent->count);
-                rmsd.prevSkinJointMatrices = array_view<Math::Mat4X4 const>(
-                    spd.prevJointMatricesComponent->jointMatrices, spd.prevJointMatricesComponent->count);
-                rmsd.aabb.minAabb = spd.jointMatricesComponent->jointsAabbMin;
-                rmsd.aabb.maxAabb = spd.jointMatricesComponent->jointsAabbMax;
+        const WorldMatrixComponent& world = worldMatrices[row.components[RQ_WM]];
+        const uint64_t layerMask = !row.IsValidComponentId(RQ_L) ? LayerConstants::DEFAULT_LAYER_MASK
+                                                                 : layerMgr_->Read(row.components[RQ_L])->layerMask;
+
+        // Pack per-instance RenderMeshFlags into the high 32 bits of sceneId (UBO layers.w).
+        const uint64_t sceneIdPacked =
+            static_cast<uint64_t>(sceneId) | (static_cast<uint64_t>(renderMeshFlags) << 32U);
+        // this is a batch of same material, so the material uniform data is duplicated
+        RenderMeshData rmd{
+            world.matrix, world.matrix, world.prevMatrix, entity.id, rmcHandle->mesh.id, layerMask, sceneIdPacked};
+        std::copy(std::begin(rmcHandle->customData), std::end(rmcHandle->customData), std::begin(rmd.customData));
+        // Optional skin, cannot change based on submesh)
+        RenderMeshSkinData rmsd;
+        if (row.IsValidComponentId(RQ_SM) && row.IsValidComponentId(RQ_JM) && row.IsValidComponentId(RQ_PJM)) {
+            const IComponentManager::ComponentId jointId = row.components[RQ_JM];
+            const IComponentManager::ComponentId prevJointId = row.components[RQ_PJM];
+            if (auto skin = skinMgr_->Read(row.components[RQ_SM])) {
+                rmsd.id = skin->skinRoot.id;
+            } else {
+                static_assert(RenderSceneDataConstants::INVALID_INDEX == INVALID_ENTITY);
+                rmsd.id = RenderSceneDataConstants::INVALID_INDEX;
             }
+            auto const jointMatricesData = jointMatricesMgr_->Read(jointId);
+            auto const prevJointMatricesData = prevJointMatricesMgr_->Read(prevJointId);
+            const SkinProcessData spd{&(*jointMatricesData), &(*prevJointMatricesData)};
+
+            PLUGIN_ASSERT(spd.prevJointMatricesComponent);
+            rmsd.skinJointMatrices = array_view<Math::Mat4X4 const>(
+                spd.jointMatricesComponent->jointMatrices, spd.jointMatricesComponent->count);
+            rmsd.prevSkinJointMatrices = array_view<Math::Mat4X4 const>(
+                spd.prevJointMatricesComponent->jointMatrices, spd.prevJointMatricesComponent->count);
+            rmsd.aabb.minAabb = spd.jointMatricesComponent->jointsAabbMin;
+            rmsd.aabb.maxAabb = spd.jointMatricesComponent->jointsAabbMax;
+        }
+
+        instanceMeshData_.clear();
+        if (instanceTransforms_.empty()) {
+            instanceMeshData_.push_back(rmd);
+        } else {
+            for (const auto& instance : instanceTransforms_) {
+                rmd.world = world.matrix * instance;
+                rmd.normalWorld = rmd.world;
+                rmd.prevWorld = world.prevMatrix * instance;
+                instanceMeshData_.push_back(rmd);
+            }
+        }
+        if (retained && !retained->skinned) {
+            dsMaterial_->SetRetainedRenderMeshData(entity.id, instanceMeshData_, renderMeshBatch);
+            retained->retained = true;
+            return;
+        }
+        if (retained) {
+            DestroyRetainedRenderable(entity, *retained);
+        }
+        // instances of the same mesh are instanced automatically by the data store.
+        dsMaterial_->AddFrameRenderMeshData(instanceMeshData_, rmsd, renderMeshBatch);
+    }
+}
+
+void RenderSystem::ProcessRenderables()
+{
+    renderableQuery_.Execute();
+    // world matrices are required by the query so the component ids index directly into the packed array.
+    const auto worldMatrices = worldMatrixMgr_->GetComponentArray();
 
-            dsMaterial_->AddFrameRenderMeshData(rmd, rmsd, renderMeshBatch);
+    if (properties_.retainedRenderMeshes && retainedRenderablesValid_) {
+        ProcessRetainedRenderables(worldMatrices);
+    } else {
+        const bool retainedMode = properties_.retainedRenderMeshes;
+        for (const auto& row : renderableQuery_.GetResults()) {
+            RetainedRenderable* retained = nullptr;
+            if (retainedMode) {
+                retained = &retainedRenderables_[row.entity];
+                UpdateRetainedRenderable(row, *retained);
+                if (retained->skinned) {
+                    retainedSkinned_.push_back(row.entity);
+                }
+            }
+            ProcessRenderable(row, worldMatrices, retained);
         }
+        // from now on only the entities mentioned in the events are checked
+        retainedDirtyEntities_.clear();
+        retainedRenderablesValid_ = retainedMode;
     }
 
     // force submission
     dsMaterial_->SubmitFrameMeshData();
 }
 
+void RenderSystem::ProcessRetainedRenderables(const array_view<const WorldMatrixComponent> worldMatrices)
+{
+    auto& dirty = retainedDirtyEntities_;
+    if (nodeSystem_) {
+        const auto updated = nodeSystem_->GetUpdatedEntities();
+        dirty.append(updated.cbegin(), updated.cend());
+    }
+    // a change in a render mesh batch affects every render mesh using it
+    for (size_t i = 0U, count = dirty.size(); i < count; ++i) {
+        if (auto pos = retainedBatchUsers_.find(dirty[i]); pos != retainedBatchUsers_.end()) {
+            dirty.append(pos->second.cbegin(), pos->second.cend());
+        }
+    }
+    // the same entity can be mentioned by several events
+    std::sort(dirty.begin(), dirty.end());
+    dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.cend());
+
+    for (const Entity& entity : dirty) {
+        const auto* row = renderableQuery_.FindResultRow(entity);
+        auto pos = retainedRenderables_.find(entity);
+        if (!row) {
+            // no longer a render mesh
+            if (pos != retainedRenderables_.end()) {
+                DestroyRetainedRenderable(entity, pos->second);
+                SetRetainedBatch(entity, pos->second, {});
+                retainedRenderables_.erase(pos);
+            }
+            continue;
+        }
+        if (pos == retainedRenderables_.end()) {
+            pos = retainedRenderables_.insert({entity, RetainedRenderable{}}).first;
+        }
+        RetainedRenderable& retained = pos->second;
+        const bool wasSkinned = retained.skinned;
+        if (!UpdateRetainedRenderable(*row, retained)) {
+            continue;
+        }
+        if (retained.skinned) {
+            // added below with the other skinned render meshes
+            if (!wasSkinned) {
+                retainedSkinned_.push_back(entity);
+            }
+            continue;
+        }
+        ProcessRenderable(*row, worldMatrices, &retained);
+    }
+    dirty.clear();
+
+    // skinned render meshes are added every frame as the joint matrices are frame data
+    auto last = retainedSkinned_.begin();
+    for (const Entity& entity : retainedSkinned_) {
+        const auto* row = renderableQuery_.FindResultRow(entity);
+        auto pos = retainedRenderables_.find(entity);
+        if (row && (pos != retainedRenderables_.end()) && pos->second.skinned) {
+            ProcessRenderable(*row, worldMatrices, &pos->second);
+            *last++ = entity;
+        }
+    }
+    retainedSkinned_.erase(last, retainedSkinned_.cend());
+}
+
 void RenderSystem::ProcessEnvironments(const RenderConfigurationComponent& renderConfig)
 {
     if (!(environmentMgr_ && layerMgr_ && gpuHandleMgr_)) {
@@ -3349,18 +3694,30 @@ void RenderSystem::HandleLightProbeDestroyEvents() noexcept
     }
 }
 
+LightProbeInterpolatedDataOpt RenderSystem::GetInterpolatedLightProbeData(const LightProbeVolume& lightProbeVolume,
+    const LightProbeVolumeIndex* lightProbeVolumeIndex, const Math::Vec3& worldCenter, size_t submeshIndex)
+{
+    if (!lightProbeVolumeIndex || (submeshIndex >= lightProbeTetrahedronHints_.size())) {
+        return LightProbeUtil::GetInterpolatedLightProbeData(lightProbeVolume, worldCenter);
+    }
+    return LightProbeUtil::GetInterpolatedLightProbeData(
+        lightProbeVolume, *lightProbeVolumeIndex, worldCenter, lightProbeTetrahedronHints_[submeshIndex]);
+}
+
 void RenderSystem::ProcessLightProbeShRecalculate() noexcept
 {
 #if (CORE3D_DEV_ENABLED == 1)
     CORE_CPU_PERF_SCOPE("CORE3D", "RenderSystem", "ProcessLightProbeShRecalculate", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
-    const auto& lightProbeVolumeOpt = GetLightProbesVolumeFromMainCamera(
-        ecs_.GetEntityManager(), cameraMgr_, lightProbeMgr_, nodeMgr_, layerMgr_, dsLightProbe_);
+    const LightProbeVolumeIndex* lightProbeVolumeIndex = nullptr;
+    const auto& lightProbeVolumeOpt = GetLightProbesVolumeFromMainCamera(ecs_.GetEntityManager(), cameraMgr_,
+        lightProbeMgr_, nodeMgr_, layerMgr_, dsLightProbe_, lightProbeVolumeIndex);
     if (!lightProbeVolumeOpt) {
         return;
     }
     const auto& submeshes = dsMaterial_->GetSubmeshes();
     const auto& submeshesMaterialFlags = dsMaterial_->GetSubmeshMaterialFlags();
+    lightProbeTetrahedronHints_.resize(submeshes.size(), LightProbeVolumeIndex::INVALID_INDEX);
     for (size_t i = 0U; i < submeshes.size(); ++i) {
         auto& submesh = submeshes[i];
         if (i >= submeshesMaterialFlags.size()) {
@@ -3372,8 +3729,8 @@ void RenderSystem::ProcessLightProbeShRecalculate() noexcept
         if ((renderSubmeshMaterialFlags & RENDER_MATERIAL_LIGHT_PROBE_RECEIVER_BIT) == 0) {
             continue;
         }
-        auto lightProbeShOpt = LightProbeUtil::GetInterpolatedLightProbeData(
-            lightProbeVolumeOpt.lightProbeVolume, submesh.bounds.worldCenter);
+        auto lightProbeShOpt = GetInterpolatedLightProbeData(
+            lightProbeVolumeOpt.lightProbeVolume, lightProbeVolumeIndex, submesh.bounds.worldCenter, i);
 
         auto updatedRenderSubmeshMaterialFlags =
             GetSubmeshRenderMaterialFlag(lightProbeShOpt, renderSubmeshMaterialFlags);
@@ -3396,8 +3753,9 @@ void RenderSystem::HandleRecalculateCertainLightProbeShEvents() noexcept
     CORE_CPU_PERF_SCOPE(
         "CORE3D", "RenderSystem", "HandleRecalculateCertainLightProbeShEvents", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
-    const auto& lightProbeVolumeOpt = GetLightProbesVolumeFromMainCamera(
-        ecs_.GetEntityManager(), cameraMgr_, lightProbeMgr_, nodeMgr_, layerMgr_, dsLightProbe_);
+    const LightProbeVolumeIndex* lightProbeVolumeIndex = nullptr;
+    const auto& lightProbeVolumeOpt = GetLightProbesVolumeFromMainCamera(ecs_.GetEntityManager(), cameraMgr_,
+        lightProbeMgr_, nodeMgr_, layerMgr_, dsLightProbe_, lightProbeVolumeIndex);
 
     if (!lightProbeVolumeOpt) {
         PLUGIN_LOG_E("HandleRecalculateCertainLightProbeShEvents invalid light probe volume");
@@ -3405,6 +3763,7 @@ void RenderSystem::HandleRecalculateCertainLightProbeShEvents() noexcept
     }
     const auto& submeshes = dsMaterial_->GetSubmeshes();
     const auto& submeshesMaterialFlags = dsMaterial_->GetSubmeshMaterialFlags();
+    lightProbeTetrahedronHints_.resize(submeshes.size(), LightProbeVolumeIndex::INVALID_INDEX);
     for (const auto& entity : recalculateCertainLightProbeShEvents_) {
         const auto rmcHandle = renderMeshMgr_->Read(entity);
         if (!rmcHandle) {
@@ -3424,8 +3783,8 @@ void RenderSystem::HandleRecalculateCertainLightProbeShEvents() noexcept
             if ((renderSubmeshMaterialFlags & RENDER_MATERIAL_LIGHT_PROBE_RECEIVER_BIT) == 0) {
                 continue;
             }
-            auto lightProbeShOpt = LightProbeUtil::GetInterpolatedLightProbeData(
-                lightProbeVolumeOpt.lightProbeVolume, submesh.bounds.worldCenter);
+            auto lightProbeShOpt = GetInterpolatedLightProbeData(
+                lightProbeVolumeOpt.lightProbeVolume, lightProbeVolumeIndex, submesh.bounds.worldCenter, i);
 
             auto updatedRenderSubmeshMaterialFlags =
                 GetSubmeshRenderMaterialFlag(lightProbeShOpt, renderSubmeshMaterialFlags);
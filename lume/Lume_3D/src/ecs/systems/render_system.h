@@ -24,7 +24,9 @@
 #include <3d/ecs/components/render_configuration_component.h>
 #include <3d/ecs/systems/intf_render_system.h>
 #include <3d/render/render_data_defines_3d.h>
+#include <base/containers/shared_ptr.h>
 #include <base/containers/unordered_map.h>
+#include <base/math/matrix.h>
 #include <base/math/vector.h>
 #include <core/namespace.h>
 #include <core/property_tools/property_api_impl.h>
@@ -58,6 +60,7 @@ class IWeatherComponentManager;
 class INameComponentManager;
 class INodeComponentManager;
 class IRenderMeshComponentManager;
+class IRenderMeshBatchComponentManager;
 class IWorldMatrixComponentManager;
 class IRenderConfigurationComponentManager;
 class ICameraComponentManager;
@@ -80,8 +83,15 @@ class IRenderDataStoreDefaultLight;
 class IRenderDataStoreLightProbe;
 class IRenderDataStoreDefaultMaterial;
 class IRenderDataStoreDefaultScene;
+class RenderDataStoreDefaultCamera;
+class RenderDataStoreDefaultLight;
+class RenderDataStoreDefaultMaterial;
+class RenderDataStoreDefaultScene;
+class RenderDataStoreMorph;
+class RenderDataStoreFrameHandoff;
 
 class IRenderPreprocessorSystem;
+class NodeSystem;
 class ITransformComponentManager;
 class IMesh;
 class IMaterial;
@@ -98,7 +108,7 @@ struct WorldMatrixComponent;
 struct LightComponent;
 struct MinAndMax;
 
-class RenderSystem final : public IRenderSystem, CORE_NS::IEcs::ComponentListener {
+class RenderSystem final : public IRenderSystem, CORE_NS::IEcs::ComponentListener, CORE_NS::IEcs::EntityListener {
 public:
     explicit RenderSystem(CORE_NS::IEcs& ecs);
     ~RenderSystem() override;
@@ -158,14 +168,29 @@ private:
         const JointMatricesComponent* const jointMatricesComponent{nullptr};
         const PreviousJointMatricesComponent* const prevJointMatricesComponent{nullptr};
     };
+    // the events of both listeners have an EventType, the component events are handled with the unqualified name
+    using EventType = ComponentListener::EventType;
     void OnComponentEvent(EventType type, const CORE_NS::IComponentManager& componentManager,
         BASE_NS::array_view<const CORE_NS::Entity> entities) override;
+    void OnEntityEvent(EntityListener::EventType type, BASE_NS::array_view<const CORE_NS::Entity> entities) override;
 
     void SetDataStorePointers(RENDER_NS::IRenderDataStoreManager& manager);
+    void SetFrameBuffering(RENDER_NS::IRenderDataStoreManager& manager);
+    // called while holding the frame handoff lock
+    void StopFrameBuffering();
+    void CommitFrameData();
     // returns the instance's valid scene component
     RenderConfigurationComponent GetRenderConfigurationComponent();
     CORE_NS::Entity ProcessScene(const RenderConfigurationComponent& sc);
     void ProcessRenderables();
+    struct RetainedRenderable;
+    void ProcessRenderable(const CORE_NS::ComponentQuery::ResultRow& row,
+        BASE_NS::array_view<const WorldMatrixComponent> worldMatrices, RetainedRenderable* retained);
+    bool UpdateRetainedRenderable(const CORE_NS::ComponentQuery::ResultRow& row, RetainedRenderable& retained) const;
+    void SetRetainedBatch(const CORE_NS::Entity& entity, RetainedRenderable& retained, const CORE_NS::Entity& batch);
+    void DestroyRetainedRenderable(const CORE_NS::Entity& entity, RetainedRenderable& retained);
+    void ProcessRetainedRenderables(BASE_NS::array_view<const WorldMatrixComponent> worldMatrices);
+    void ResetRetainedRenderables();
     void ProcessEnvironments(const RenderConfigurationComponent& sceneComponent);
     void ProcessCameras(const RenderConfigurationComponent& sceneComponent, const CORE_NS::Entity& mainCameraEntity,
         RenderScene& renderScene);
@@ -185,6 +210,9 @@ private:
 
     void ProcessRenderNodeGraphs(const RenderConfigurationComponent& renderConfig, const RenderScene& renderScene);
     void ProcessLightProbeShRecalculate() noexcept;
+    LightProbeInterpolatedDataOpt GetInterpolatedLightProbeData(const LightProbeVolume& lightProbeVolume,
+        const LightProbeVolumeIndex* lightProbeVolumeIndex, const BASE_NS::Math::Vec3& worldCenter,
+        size_t submeshIndex);
     void DestroyRenderDataStores();
     CameraRngsOutput GetCameraRenderNodeGraphs(const RenderScene& renderScene, const RenderCamera& renderCamera);
     RENDER_NS::RenderHandleReference GetSceneRenderNodeGraph(const RenderScene& renderScene);
@@ -216,12 +244,51 @@ private:
     BASE_NS::refcnt_ptr<IRenderDataStoreDefaultScene> dsScene_;
     BASE_NS::refcnt_ptr<IRenderDataStoreLightProbe> dsLightProbe_;
     BASE_NS::refcnt_ptr<RENDER_NS::IRenderDataStoreRenderPostProcesses> dsRenderPostProcesses_;
+    // the registered data stores when frame latency is used, the ds*_ pointers above are then the frame writers
+    struct FrameBufferedDataStores {
+        BASE_NS::refcnt_ptr<RenderDataStoreDefaultCamera> camera;
+        BASE_NS::refcnt_ptr<RenderDataStoreDefaultLight> light;
+        BASE_NS::refcnt_ptr<RenderDataStoreDefaultMaterial> material;
+        BASE_NS::refcnt_ptr<RenderDataStoreDefaultScene> scene;
+        BASE_NS::refcnt_ptr<RenderDataStoreMorph> morph;
+    };
+    FrameBufferedDataStores frameBufferedStores_;
+    // shared by the frame buffered data stores, so that a render frame reads all of them from the same ECS frame
+    BASE_NS::shared_ptr<RenderDataStoreFrameHandoff> frameHandoff_;
+
+    // component generations of the render mesh data last set to the material data store in retained mode
+    struct RetainedRenderable {
+        uint32_t renderMeshGeneration{~0U};
+        uint32_t worldMatrixGeneration{~0U};
+        uint32_t nodeGeneration{~0U};
+        uint32_t layerGeneration{~0U};
+        CORE_NS::Entity batch;
+        uint32_t batchGeneration{~0U};
+        uint32_t batchRenderMeshGeneration{~0U};
+        // the data store has retained data, skinned render meshes are added every frame instead
+        bool retained{false};
+        bool skinned{false};
+    };
+    BASE_NS::unordered_map<CORE_NS::Entity, RetainedRenderable> retainedRenderables_;
+    // per instance render mesh data and instance transforms of the processed render mesh, reused between meshes
+    BASE_NS::vector<RenderMeshData> instanceMeshData_;
+    BASE_NS::vector<BASE_NS::Math::Mat4X4> instanceTransforms_;
+    // render mesh entities using each render mesh batch, a change in the batch sets them all again
+    BASE_NS::unordered_map<CORE_NS::Entity, BASE_NS::vector<CORE_NS::Entity>> retainedBatchUsers_;
+    // entities from the component and entity events since the last processing, only these need to be checked
+    BASE_NS::vector<CORE_NS::Entity> retainedDirtyEntities_;
+    bool retainedRenderablesValid_{false};
+    // skinned render meshes, processed every frame also when nothing else has changed
+    BASE_NS::vector<CORE_NS::Entity> retainedSkinned_;
+    // the node system reports the nodes it updated during this frame, their events come only after the update
+    NodeSystem* nodeSystem_{nullptr};
     RENDER_NS::IShaderManager* shaderMgr_ = nullptr;
     RENDER_NS::IGpuResourceManager* gpuResourceMgr_ = nullptr;
     CORE_NS::IFrustumUtil* frustumUtil_ = nullptr;
 
     INodeComponentManager* nodeMgr_ = nullptr;
     IRenderMeshComponentManager* renderMeshMgr_ = nullptr;
+    IRenderMeshBatchComponentManager* renderMeshBatchMgr_ = nullptr;
     IWorldMatrixComponentManager* worldMatrixMgr_ = nullptr;
     IRenderConfigurationComponentManager* renderConfigMgr_ = nullptr;
     ICameraComponentManager* cameraMgr_ = nullptr;
@@ -265,6 +332,7 @@ private:
     uint32_t layerGeneration_ = 0U;
     uint32_t nodeGeneration_ = 0U;
     uint32_t renderMeshGeneration_ = 0U;
+    uint32_t renderMeshBatchGeneration_ = 0U;
     uint32_t worldMatrixGeneration_ = 0U;
     uint32_t materialGeneration_ = 0U;
     uint32_t meshGeneration_ = 0U;
@@ -280,6 +348,9 @@ private:
     BASE_NS::vector<CORE_NS::Entity> lightProbeDestroyedEvents_;
     BASE_NS::vector<CORE_NS::Entity> recalculateCertainLightProbeShEvents_;
     BASE_NS::vector<CORE_NS::Entity> updateEnvironmentLightProbeEvents_;
+    // last tetrahedron containing each submesh, used as the starting point of the next light probe lookup. Submesh
+    // indices change when the scene changes, but a stale hint only makes the lookup start further away.
+    BASE_NS::vector<uint32_t> lightProbeTetrahedronHints_;
 
     IPicking* picking_ = nullptr;
 
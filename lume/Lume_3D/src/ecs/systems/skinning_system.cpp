@@ -37,6 +37,7 @@
 #include <core/namespace.h>
 #include <core/plugin/intf_plugin_register.h>
 #include <core/property_tools/property_api_impl.inl>
+#include <core/util/parallel_for.h>
 #include <render/implementation_uids.h>
 #include <render/intf_render_context.h>
 
@@ -122,27 +123,6 @@ IPicking* GetPicking(IEcs& ecs)
 }
 }  // namespace
 
-class SkinningSystem::SkinTask final : public IThreadPool::ITask {
-public:
-    SkinTask(SkinningSystem& system, array_view<const ComponentQuery::ResultRow> results)
-        : system_(system), results_(results){};
-
-    void operator()() override
-    {
-        for (const ComponentQuery::ResultRow& row : results_) {
-            system_.UpdateSkin(row);
-        }
-    }
-
-protected:
-    void Destroy() override
-    {}
-
-private:
-    SkinningSystem& system_;
-    array_view<const ComponentQuery::ResultRow> results_;
-};
-
 SkinningSystem::SkinningSystem(IEcs& ecs)
     : active_(true),
       ecs_(ecs),
@@ -343,29 +323,16 @@ bool SkinningSystem::Update(bool frameRenderingQueued, uint64_t, uint64_t)
     const auto resultCount = queryResults.size();
     constexpr size_t minTaskSize = 8U;
     const auto taskSize = Math::max(minTaskSize, resultCount / threadCount);
-    const auto tasks = resultCount / taskSize;
-
-    tasks_.clear();
-    tasks_.reserve(tasks);
-
-    taskResults_.clear();
-    taskResults_.reserve(tasks);
-    for (size_t i = 0; i < tasks; ++i) {
-        auto& task = tasks_.emplace_back(*this, array_view(queryResults.data() + i * taskSize, taskSize));
-        taskResults_.push_back(threadPool_->Push(IThreadPool::ITask::Ptr{&task}));
-    }
-
-    // Skin the tail in the main thread.
-    if (const auto remaining = resultCount - (tasks * taskSize); remaining) {
-        auto finalBatch = array_view(queryResults.data() + tasks * taskSize, remaining);
-        for (const ComponentQuery::ResultRow& row : finalBatch) {
-            UpdateSkin(row);
+    const auto tasks = (resultCount + taskSize - 1U) / taskSize;
+
+    // The calling thread skins batches too, so this completes even if the pool threads are busy.
+    ParallelFor(threadPool_.get(), tasks, [this, queryResults, taskSize](size_t task) {
+        const auto begin = task * taskSize;
+        const auto end = Math::min(begin + taskSize, queryResults.size());
+        for (auto i = begin; i < end; ++i) {
+            UpdateSkin(queryResults[i]);
         }
-    }
-
-    for (const auto& result : taskResults_) {
-        result->Wait();
-    }
+    });
 
     if (missingPrevJointMatrices) {
         for (const auto& row : componentQuery_.GetResults()) {
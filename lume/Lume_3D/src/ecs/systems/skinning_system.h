@@ -95,9 +95,6 @@ private:
     CORE_NS::PropertyApiImpl<void> SKINNING_SYSTEM_PROPERTIES;
 
     CORE_NS::IThreadPool::Ptr threadPool_;
-    class SkinTask;
-    BASE_NS::vector<SkinTask> tasks_;
-    BASE_NS::vector<CORE_NS::IThreadPool::IResult::Ptr> taskResults_;
 };
 CORE3D_END_NAMESPACE()
 
@@ -18,6 +18,7 @@
 
 #include <3d/gltf/gltf.h>
 #include <3d/loaders/intf_scene_loader.h>
+#include <base/containers/array_view.h>
 #include <base/containers/unique_ptr.h>
 #include <base/containers/vector.h>
 #include <core/io/intf_file.h>
@@ -50,7 +51,12 @@ public:
     const GltfData& GetData() const override;
     AccessorData ReadAccessorData(const GLTF2::Accessor& accessor) const override;
 
-    CORE_NS::IFile::Ptr memoryFile_;
+    // Memory the glTF was loaded from. Buffers without a data URI point into it instead of copying, the caller
+    // keeps it alive until importing has completed.
+    BASE_NS::array_view<const uint8_t> memoryData_;
+
+    // Memory mapped buffer files which buffers point into. Filled by LoadBuffers, which only gets a const Data.
+    mutable BASE_NS::vector<CORE_NS::IFile::Ptr> mappedFiles_;
 
     // Internal-only fields not in the public GltfData struct.
     int64_t defaultResourcesOffset = -1;
@@ -35,6 +35,7 @@
 #define GLTF2_EXTENSION_KHR_TEXTURE_BASISU
 #define GLTF2_EXTENSION_KHR_TEXTURE_TRANSFORM
 #define GLTF2_EXTENSION_EXT_LIGHTS_IMAGE_BASED
+#define GLTF2_EXTENSION_EXT_MESH_GPU_INSTANCING
 #define GLTF2_EXTRAS_CLEAR_COAT_MATERIAL
 #define GLTF2_EXTENSION_HW_XR_EXT
 #define GLTF2_EXTRAS_RSDZ
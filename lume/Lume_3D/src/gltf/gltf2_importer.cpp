@@ -34,6 +34,7 @@
 #include <3d/ecs/components/node_component.h>
 #include <3d/ecs/components/render_configuration_component.h>
 #include <3d/ecs/components/render_handle_component.h>
+#include <3d/ecs/components/render_mesh_batch_component.h>
 #include <3d/ecs/components/render_mesh_component.h>
 #include <3d/ecs/components/rsdz_model_id_component.h>
 #include <3d/ecs/components/skin_ibm_component.h>
@@ -2109,6 +2110,64 @@ void CreateTransform(IEcs& ecs, const GLTF2::Node& node, const Entity entity)
     }
 }
 
+#if defined(GLTF2_EXTENSION_EXT_MESH_GPU_INSTANCING)
+template<class T>
+bool LoadInstanceAttribute(GLTF2::Accessor* accessor, vector<T>& values)
+{
+    if (!accessor) {
+        return true;
+    }
+    const GLTF2::GLTFLoadDataResult result = GLTF2::LoadData(*accessor);
+    if (!result.success) {
+        return false;
+    }
+    CopyFrames(result, values);
+    return values.size() == accessor->count;
+}
+
+vector<Math::Mat4X4> LoadInstanceTransforms(const GLTF2::Node& node)
+{
+    vector<Math::Vec3> translations;
+    vector<Math::Quat> rotations;
+    vector<Math::Vec3> scales;
+    if (!LoadInstanceAttribute(node.gpuInstancing.translation, translations) ||
+        !LoadInstanceAttribute(node.gpuInstancing.rotation, rotations) ||
+        !LoadInstanceAttribute(node.gpuInstancing.scale, scales)) {
+        PLUGIN_LOG_W("Failed to load EXT_mesh_gpu_instancing attributes of node '%s'", node.name.c_str());
+        return {};
+    }
+    const size_t count = Math::max(translations.size(), Math::max(rotations.size(), scales.size()));
+    vector<Math::Mat4X4> transforms;
+    transforms.reserve(count);
+    for (size_t i = 0U; i < count; ++i) {
+        const Math::Vec3 translation = translations.empty() ? Math::Vec3(0.f, 0.f, 0.f) : translations[i];
+        const Math::Quat rotation = rotations.empty() ? Math::Quat(0.f, 0.f, 0.f, 1.f) : rotations[i];
+        const Math::Vec3 scale = scales.empty() ? Math::Vec3(1.f, 1.f, 1.f) : scales[i];
+        transforms.push_back(Math::Trs(translation, rotation, scale));
+    }
+    return transforms;
+}
+
+// Instances are stored in a RenderMeshBatchComponent on the node itself so that the whole set costs one entity.
+void CreateInstances(IEcs& ecs, const GLTF2::Node& node, const Entity entity, RenderMeshComponent& renderMesh)
+{
+    if (node.skin) {
+        // skinned instances would need their own joint matrices.
+        return;
+    }
+    auto transforms = LoadInstanceTransforms(node);
+    if (transforms.empty()) {
+        return;
+    }
+    IRenderMeshBatchComponentManager& batchManager = *(GetManager<IRenderMeshBatchComponentManager>(ecs));
+    batchManager.Create(entity);
+    if (ScopedHandle<RenderMeshBatchComponent> batch = batchManager.Write(entity); batch) {
+        batch->instanceTransforms = move(transforms);
+        renderMesh.renderMeshBatch = entity;
+    }
+}
+#endif
+
 void CreateMesh(IEcs& ecs, const GLTF2::Node& node, const Entity entity, const GLTF2::Data& data,
     const GLTFResourceData& gltfResourceData)
 {
@@ -2119,6 +2178,9 @@ void CreateMesh(IEcs& ecs, const GLTF2::Node& node, const Entity entity, const G
         renderMeshManager.Create(entity);
         ScopedHandle<RenderMeshComponent> component = renderMeshManager.Write(entity);
         component->mesh = gltfResourceData.meshes[meshIndex];
+#if defined(GLTF2_EXTENSION_EXT_MESH_GPU_INSTANCING)
+        CreateInstances(ecs, node, entity, *component);
+#endif
     }
 }
 
@@ -3711,7 +3773,7 @@ void GLTF2Importer::PrepareBufferTasks()
     task->name = "Load buffers";
     task->phase = ImportPhase::BUFFERS;
     task->gather = [this, t = task.get()]() -> bool {
-        BufferLoadResult result = LoadBuffers(data_, engine_.GetFileManager());
+        BufferLoadResult result = LoadBuffers(data_, engine_.GetFileManager(), threadPool_.get());
         t->errors += result.error;
         return result.success;
     };
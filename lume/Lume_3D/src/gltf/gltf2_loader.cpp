@@ -114,6 +114,9 @@ const string_view SUPPORTED_EXTENSIONS[] = {
 #endif
 #if defined(GLTF2_EXTENSION_EXT_LIGHTS_IMAGE_BASED)
     "EXT_lights_image_based",
+#endif
+#if defined(GLTF2_EXTENSION_EXT_MESH_GPU_INSTANCING)
+    "EXT_mesh_gpu_instancing",
 #endif
     "MSFT_texture_dds",
     // legacy stuff found potentially in animoji models
@@ -2306,6 +2309,52 @@ struct ExtensionData {
     bool compressed;
 };
 
+#if defined(GLTF2_EXTENSION_EXT_MESH_GPU_INSTANCING)
+bool NodeInstanceAttribute(
+    LoadResult& loadResult, const json::value& attributes, const string_view name, DataType type, Accessor*& accessor)
+{
+    size_t index;
+    if (!ParseOptionalNumber<size_t>(loadResult, index, attributes, name, GLTF_INVALID_INDEX)) {
+        return false;
+    }
+    if (index == GLTF_INVALID_INDEX) {
+        return true;
+    }
+    if (index >= loadResult.data->accessors.size()) {
+        RETURN_WITH_ERROR(loadResult, "Instancing attribute refers to invalid accessor index");
+    }
+    accessor = loadResult.data->accessors[index].get();
+    if (accessor->type != type) {
+        RETURN_WITH_ERROR(loadResult, "Invalid instancing attribute accessor type");
+    }
+    return true;
+}
+
+bool NodeGpuInstancing(LoadResult& loadResult, const json::value& instancing, Node& node)
+{
+    auto& attributes = node.gpuInstancing;
+    const auto parseAttributes = [&attributes](LoadResult& loadResult, const json::value& json) -> bool {
+        return NodeInstanceAttribute(loadResult, json, "TRANSLATION", DataType::VEC3, attributes.translation) &&
+               NodeInstanceAttribute(loadResult, json, "ROTATION", DataType::VEC4, attributes.rotation) &&
+               NodeInstanceAttribute(loadResult, json, "SCALE", DataType::VEC3, attributes.scale);
+    };
+    if (!ParseObject(loadResult, instancing, "attributes", parseAttributes)) {
+        return false;
+    }
+    // all attribute accessors must have the same count.
+    uint32_t count = 0U;
+    for (const Accessor* accessor : { attributes.translation, attributes.rotation, attributes.scale }) {
+        if (accessor) {
+            if (count && (accessor->count != count)) {
+                RETURN_WITH_ERROR(loadResult, "Instancing attribute accessors must have the same count");
+            }
+            count = accessor->count;
+        }
+    }
+    return true;
+}
+#endif
+
 std::optional<ExtensionData> NodeExtensions(LoadResult& loadResult, const json::value& jsonData, Node& node)
 {
     ExtensionData data{GLTF_INVALID_INDEX, false};
@@ -2345,6 +2394,15 @@ std::optional<ExtensionData> NodeExtensions(LoadResult& loadResult, const json::
         }
 #endif
 
+#if defined(GLTF2_EXTENSION_EXT_MESH_GPU_INSTANCING)
+        const auto parseGpuInstancing = [&node](LoadResult& loadResult, const json::value& instancing) -> bool {
+            return NodeGpuInstancing(loadResult, instancing, node);
+        };
+        if (!ParseObject(loadResult, extensions, "EXT_mesh_gpu_instancing", parseGpuInstancing)) {
+            return false;
+        }
+#endif
+
 #ifdef GLTF2_EXTENSION_IGFX_COMPRESSED
         const auto parseCompressed = [&data, &weights = node.weights](
                                          LoadResult& loadResult, const json::value& compressedJson) {
@@ -3265,25 +3323,77 @@ bool LoadGLB(LoadResult& loadResult, IFile& file, int64_t offset)
 }
 }  // namespace
 
-// Internal loading function.
-LoadResult LoadGLTF(IFileManager& fileManager, const string_view uri, int64_t offset)
-{
-    if (offset < 0) {
-        PLUGIN_LOG_D("Error loading '%s', offset is negative", string(uri).data());
-        return LoadResult("Offset must not be negative");
+namespace {
+// Read-only file reading straight from memory owned by someone else.
+class MemoryViewFile final : public IFile {
+public:
+    explicit MemoryViewFile(array_view<const uint8_t> data) : data_(data)
+    {}
+    ~MemoryViewFile() override = default;
+
+    Mode GetMode() const override
+    {
+        return Mode::READ_ONLY;
     }
 
-    LoadResult result;
+    void Close() override
+    {
+        data_ = {};
+        position_ = 0U;
+    }
 
-    CORE_CPU_PERF_SCOPE("CORE3D", "LoadGLTF()", uri, CORE3D_PROFILER_DEFAULT_COLOR);
+    uint64_t Read(void* buffer, uint64_t count) override
+    {
+        const uint64_t available = (position_ < data_.size()) ? (data_.size() - position_) : 0U;
+        count = std::min(count, available);
+        if (count && (memcpy_s(buffer, static_cast<size_t>(count), data_.data() + position_, count) != EOK)) {
+            return 0U;
+        }
+        position_ += count;
+        return count;
+    }
 
-    IFile::Ptr file = fileManager.OpenFile(uri);
-    if (!file) {
-        PLUGIN_LOG_D("Error loading '%s'", string(uri).data());
-        return LoadResult("Failed to open file.");
+    uint64_t Write(const void*, uint64_t) override
+    {
+        return 0U;
+    }
+
+    uint64_t Append(const void*, uint64_t, uint64_t) override
+    {
+        return 0U;
     }
 
-    const uint64_t fileTotalLength = file->GetLength();
+    uint64_t GetLength() const override
+    {
+        return data_.size();
+    }
+
+    bool Seek(uint64_t offset) override
+    {
+        if (offset > data_.size()) {
+            return false;
+        }
+        position_ = offset;
+        return true;
+    }
+
+    uint64_t GetPosition() const override
+    {
+        return position_;
+    }
+
+protected:
+    void Destroy() override
+    {}
+
+private:
+    array_view<const uint8_t> data_;
+    uint64_t position_{0U};
+};
+
+LoadResult LoadGLTF(IFileManager& fileManager, IFile& file, const string_view uri, int64_t offset)
+{
+    const uint64_t fileTotalLength = file.GetLength();
 
     if (fileTotalLength > SIZE_MAX) {
         PLUGIN_LOG_D("Error loading '%s'", string(uri).data());
@@ -3301,6 +3411,7 @@ LoadResult LoadGLTF(IFileManager& fileManager, const string_view uri, int64_t of
     string_view path;
     SplitFilename(uri, baseName, path);
 
+    LoadResult result;
     result.data = make_unique<Data>(fileManager);
     result.data->filepath = path;
     result.data->defaultResources = baseName;
@@ -3316,20 +3427,39 @@ LoadResult LoadGLTF(IFileManager& fileManager, const string_view uri, int64_t of
     });
 
     if (offset != 0) {
-        file->Seek(static_cast<uint64_t>(offset));
+        file.Seek(static_cast<uint64_t>(offset));
     }
 
     if (extension == "gltf" || extension == "glt") {
-        LoadGLTF(result, *file);
+        LoadGLTF(result, file);
     } else if (extension == "glb") {
-        LoadGLB(result, *file, 0);
+        LoadGLB(result, file, 0);
     } else if (extension == "mp4") {
-        LoadGLB(result, *file, offset);
+        LoadGLB(result, file, offset);
     } else {
-        LoadGLB(result, *file, 0);
+        LoadGLB(result, file, 0);
     }
     return result;
 }
+}  // namespace
+
+// Internal loading function.
+LoadResult LoadGLTF(IFileManager& fileManager, const string_view uri, int64_t offset)
+{
+    if (offset < 0) {
+        PLUGIN_LOG_D("Error loading '%s', offset is negative", string(uri).data());
+        return LoadResult("Offset must not be negative");
+    }
+
+    CORE_CPU_PERF_SCOPE("CORE3D", "LoadGLTF()", uri, CORE3D_PROFILER_DEFAULT_COLOR);
+
+    IFile::Ptr file = fileManager.OpenFile(uri);
+    if (!file) {
+        PLUGIN_LOG_D("Error loading '%s'", string(uri).data());
+        return LoadResult("Failed to open file.");
+    }
+    return LoadGLTF(fileManager, *file, uri, offset);
+}
 
 LoadResult LoadGLTF(IFileManager& fileManager, const string_view uri)
 {
@@ -3338,8 +3468,6 @@ LoadResult LoadGLTF(IFileManager& fileManager, const string_view uri)
 
 LoadResult LoadGLTF(IFileManager& fileManager, array_view<uint8_t const> data)
 {
-    LoadResult result;
-
     // if the buffer starts with a GLB header assume GLB, otherwise glTF with embedded data.
     const char* ext = ".gltf";
     if (data.size() >= (sizeof(GLBHeader) + sizeof(GLBChunk))) {
@@ -3350,28 +3478,18 @@ LoadResult LoadGLTF(IFileManager& fileManager, array_view<uint8_t const> data)
         }
     }
 
-    // wrap the buffer in a temporary file
+    // parse straight from the caller's memory. the name is only used for naming the imported resources.
     static volatile int32_t counter{0};
-    auto const tmpFileName = "memory://" + to_string(BASE_NS::AtomicIncrement(&counter)) + ext;
-    {
-        auto tmpFile = fileManager.CreateFile(tmpFileName);
-        if (!tmpFile) {
-            result.success = false;
-            return result;
-        }
-        // NOTE: not ideal as this actually copies the data
-        // alternative would be to cast to MemoryFile and give the array_view to the file
-        tmpFile->Write(data.data(), data.size());
+    auto const name = "memory://" + to_string(BASE_NS::AtomicIncrement(&counter)) + ext;
+    CORE_CPU_PERF_SCOPE("CORE3D", "LoadGLTF()", name, CORE3D_PROFILER_DEFAULT_COLOR);
 
-        result = GLTF2::LoadGLTF(fileManager, tmpFileName);
-        if (result.success) {
-            // File is stored here so it can be deleted from the file manager. loadBuffers is the only thing at
-            // the moment which will need the file after parsing and that will check whether to use the
-            // mMemoryFile or the URI related to the buffer.
-            (*result.data).memoryFile_ = move(tmpFile);
-        }
+    MemoryViewFile file(data);
+    LoadResult result = LoadGLTF(fileManager, file, name, 0);
+    if (result.success) {
+        // the binary chunk and other buffers are not copied. LoadBuffers points them into the caller's memory,
+        // which according to IGltf2::LoadGLTF must stay alive until importing has completed.
+        result.data->memoryData_ = data;
     }
-    fileManager.DeleteFile(tmpFileName);
     return result;
 }
 }  // namespace GLTF2
@@ -30,6 +30,9 @@
 #include <base/util/base64_decode.h>
 #include <core/io/intf_file_manager.h>
 #include <core/namespace.h>
+#include <core/perf/cpu_perf_scope.h>
+#include <core/threading/intf_thread_pool.h>
+#include <core/util/parallel_for.h>
 
 #include "util/log.h"
 
@@ -66,6 +69,88 @@ vector<uint8_t> Read(const uint8_t* src, uint32_t componentByteSize, uint32_t co
     return result;
 }
 
+#if defined(GLTF2_EXTENSION_EXT_MESHOPT_COMPRESSION)
+// Decompresses the meshopt compressed data of the buffer view unless another thread already did.
+void DecompressMeshopt(BufferView& view)
+{
+    auto& meshoptCompression = view.meshoptCompression;
+    meshoptCompression.dataLock.Lock();
+    if (!meshoptCompression.data.empty()) {
+        meshoptCompression.dataLock.Unlock();
+        return;
+    }
+    CORE_CPU_PERF_SCOPE("CORE3D", "DecompressMeshopt()", "", CORE3D_PROFILER_DEFAULT_COLOR);
+#if defined(__OHOS_PLATFORM__)
+    // Open the dynamic meshopt library.
+    void* handle = dlopen("libmeshoptimizer.z.so", RTLD_LAZY);
+    if (!handle) {
+        PLUGIN_LOG_E("Unable to load dynamic library meshopt dynamic library");
+        meshoptCompression.dataLock.Unlock();
+        return;
+    }
+    // Obtaining a Function Pointer.
+    typedef int (*DecodeVertexBufferFunc)(void*, size_t, size_t, const unsigned char*, size_t);
+    typedef void (*DecodeFilterOctFunc)(void*, size_t, size_t);
+    typedef void (*DecodeFilterQuatFunc)(void*, size_t, size_t);
+    typedef void (*DecodeFilterExpFunc)(void*, size_t, size_t);
+    typedef int (*DecodeIndexBufferFunc)(void*, size_t, size_t, const unsigned char*, size_t);
+    DecodeVertexBufferFunc meshopt_decodeVertexBuffer =
+        (DecodeVertexBufferFunc)dlsym(handle, "meshopt_decodeVertexBuffer");
+    DecodeFilterOctFunc meshopt_decodeFilterOct = (DecodeFilterOctFunc)dlsym(handle, "meshopt_decodeFilterOct");
+    DecodeFilterQuatFunc meshopt_decodeFilterQuat = (DecodeFilterQuatFunc)dlsym(handle, "meshopt_decodeFilterQuat");
+    DecodeFilterExpFunc meshopt_decodeFilterExp = (DecodeFilterExpFunc)dlsym(handle, "meshopt_decodeFilterExp");
+    DecodeIndexBufferFunc meshopt_decodeIndexBuffer =
+        (DecodeIndexBufferFunc)dlsym(handle, "meshopt_decodeIndexBuffer");
+    if (!meshopt_decodeVertexBuffer || !meshopt_decodeFilterOct || !meshopt_decodeFilterQuat ||
+        !meshopt_decodeFilterExp || !meshopt_decodeIndexBuffer) {
+        PLUGIN_LOG_E("Unable to find a function to decompress meshopt format.");
+        dlclose(handle);
+        meshoptCompression.dataLock.Unlock();
+        return;
+    }
+#endif
+    // meshoptCompression.byteOffset + byteLength validated against buffer->byteLength in
+    // ParseMeshoptCompression (gltf2_loader.cpp). LoadBuffer guarantees buffer->GetData().size() >=
+    // buffer->byteLength.
+    meshoptCompression.data.resize(view.byteLength);
+    const uint8_t* compressed = meshoptCompression.buffer->GetData().data() + meshoptCompression.byteOffset;
+    uint8_t* decompressed = meshoptCompression.data.data();
+    if (meshoptCompression.mode == CompressionMode::ATTRIBUTES) {
+        const auto ret = meshopt_decodeVertexBuffer(decompressed,
+            meshoptCompression.count,
+            meshoptCompression.byteStride,
+            compressed,
+            meshoptCompression.byteLength);
+        if (ret) {
+            PLUGIN_LOG_E("meshopt_decodeVertexBuffer %d", ret);
+            meshoptCompression.data.clear();
+        } else {
+            if (meshoptCompression.filter == CompressionFilter::OCTAHEDRAL) {
+                meshopt_decodeFilterOct(decompressed, meshoptCompression.count, meshoptCompression.byteStride);
+            } else if (meshoptCompression.filter == CompressionFilter::QUATERNION) {
+                meshopt_decodeFilterQuat(decompressed, meshoptCompression.count, meshoptCompression.byteStride);
+            } else if (meshoptCompression.filter == CompressionFilter::EXPONENTIAL)
+                meshopt_decodeFilterExp(decompressed, meshoptCompression.count, meshoptCompression.byteStride);
+        }
+    } else {
+        // mode 1 (TRIANGLES) for triangle list, mode 2 (INDICES) for other topologies,
+        const auto ret = meshopt_decodeIndexBuffer(decompressed,
+            meshoptCompression.count,
+            meshoptCompression.byteStride,
+            compressed,
+            meshoptCompression.byteLength);
+        if (ret) {
+            PLUGIN_LOG_E("meshopt_decodeIndexBuffer %d", ret);
+            meshoptCompression.data.clear();
+        }
+    }
+#if defined(__OHOS_PLATFORM__)
+    dlclose(handle);
+#endif
+    meshoptCompression.dataLock.Unlock();
+}
+#endif
+
 vector<uint8_t> Read(Accessor const& accessor)
 {
     const uint32_t componentByteSize = GetComponentByteSize(accessor.componentType);
@@ -77,78 +162,13 @@ vector<uint8_t> Read(Accessor const& accessor)
     // this would allow progressing tasks depending on which part of a buffer has been loaded instead of waiting for the
     // whole buffer.
     if (accessor.bufferView && accessor.bufferView->meshoptCompression.buffer &&
-        !accessor.bufferView->meshoptCompression.buffer->data.empty()) {
-#if defined(__OHOS_PLATFORM__)
-        // Open the dynamic meshopt library.
-        void* handle = dlopen("libmeshoptimizer.z.so", RTLD_LAZY);
-        if (!handle) {
-            PLUGIN_LOG_E("Unable to load dynamic library meshopt dynamic library");
-            return {};
-        }
-        // Obtaining a Function Pointer.
-        typedef int (*DecodeVertexBufferFunc)(void*, size_t, size_t, const unsigned char*, size_t);
-        typedef void (*DecodeFilterOctFunc)(void*, size_t, size_t);
-        typedef void (*DecodeFilterQuatFunc)(void*, size_t, size_t);
-        typedef void (*DecodeFilterExpFunc)(void*, size_t, size_t);
-        typedef int (*DecodeIndexBufferFunc)(void*, size_t, size_t, const unsigned char*, size_t);
-        DecodeVertexBufferFunc meshopt_decodeVertexBuffer =
-            (DecodeVertexBufferFunc)dlsym(handle, "meshopt_decodeVertexBuffer");
-        DecodeFilterOctFunc meshopt_decodeFilterOct = (DecodeFilterOctFunc)dlsym(handle, "meshopt_decodeFilterOct");
-        DecodeFilterQuatFunc meshopt_decodeFilterQuat = (DecodeFilterQuatFunc)dlsym(handle, "meshopt_decodeFilterQuat");
-        DecodeFilterExpFunc meshopt_decodeFilterExp = (DecodeFilterExpFunc)dlsym(handle, "meshopt_decodeFilterExp");
-        DecodeIndexBufferFunc meshopt_decodeIndexBuffer =
-            (DecodeIndexBufferFunc)dlsym(handle, "meshopt_decodeIndexBuffer");
-        if (!meshopt_decodeVertexBuffer || !meshopt_decodeFilterOct || !meshopt_decodeFilterQuat ||
-            !meshopt_decodeFilterExp || !meshopt_decodeIndexBuffer) {
-            PLUGIN_LOG_E("Unable to find a function to decompress meshopt format.");
-            dlclose(handle);
-            return {};
-        }
-#endif
-        auto& meshoptCompression = accessor.bufferView->meshoptCompression;
-        meshoptCompression.dataLock.Lock();
-        if (meshoptCompression.data.empty()) {
-            // meshoptCompression.byteOffset + byteLength validated against buffer->byteLength in
-            // ParseMeshoptCompression (gltf2_loader.cpp). ReadBufferFile guarantees buffer->data.size() >=
-            // buffer->byteLength.
-            meshoptCompression.data.resize(accessor.bufferView->byteLength);
-            const uint8_t* compressed = meshoptCompression.buffer->data.data() + meshoptCompression.byteOffset;
-            uint8_t* decompressed = meshoptCompression.data.data();
-            if (meshoptCompression.mode == CompressionMode::ATTRIBUTES) {
-                const auto ret = meshopt_decodeVertexBuffer(decompressed,
-                    meshoptCompression.count,
-                    meshoptCompression.byteStride,
-                    compressed,
-                    meshoptCompression.byteLength);
-                if (ret) {
-                    PLUGIN_LOG_E("meshopt_decodeVertexBuffer %d", ret);
-                    meshoptCompression.data.clear();
-                } else {
-                    if (meshoptCompression.filter == CompressionFilter::OCTAHEDRAL) {
-                        meshopt_decodeFilterOct(decompressed, meshoptCompression.count, meshoptCompression.byteStride);
-                    } else if (meshoptCompression.filter == CompressionFilter::QUATERNION) {
-                        meshopt_decodeFilterQuat(decompressed, meshoptCompression.count, meshoptCompression.byteStride);
-                    } else if (meshoptCompression.filter == CompressionFilter::EXPONENTIAL)
-                        meshopt_decodeFilterExp(decompressed, meshoptCompression.count, meshoptCompression.byteStride);
-                }
-            } else {
-                // mode 1 (TRIANGLES) for triangle list, mode 2 (INDICES) for other topologies,
-                const auto ret = meshopt_decodeIndexBuffer(decompressed,
-                    meshoptCompression.count,
-                    meshoptCompression.byteStride,
-                    compressed,
-                    meshoptCompression.byteLength);
-                if (ret) {
-                    PLUGIN_LOG_E("meshopt_decodeIndexBuffer %d", ret);
-                    meshoptCompression.data.clear();
-                }
-            }
-        }
-        meshoptCompression.dataLock.Unlock();
+        !accessor.bufferView->meshoptCompression.buffer->GetData().empty()) {
+        DecompressMeshopt(*accessor.bufferView);
+        const auto& meshoptCompression = accessor.bufferView->meshoptCompression;
         vector<uint8_t> data;
         if (!meshoptCompression.data.empty()) {
             // accessor.byteOffset + count * elementSize fits within bufferView->byteLength by ValidateAccessor
-            // (gltf2_loader.cpp). meshoptCompression.data is sized to bufferView->byteLength above.
+            // (gltf2_loader.cpp). meshoptCompression.data is sized to bufferView->byteLength by DecompressMeshopt.
             // Additional defense-in-depth: verify stride-aware bounds against actual decompressed size.
             const size_t total = static_cast<size_t>(count) * elementSize;
             data.resize(total);
@@ -161,9 +181,6 @@ vector<uint8_t> Read(Accessor const& accessor)
                     : accessor.byteOffset + total;
             if (srcRequired > decompressedSize) {
                 PLUGIN_LOG_E("meshopt accessor out of source bounds");
-#if defined(__OHOS_PLATFORM__)
-                dlclose(handle);
-#endif
                 return {};
             }
             const uint8_t* src = accessor.bufferView->meshoptCompression.data.data() + accessor.byteOffset;
@@ -178,9 +195,6 @@ vector<uint8_t> Read(Accessor const& accessor)
                 }
             }
         }
-#if defined(__OHOS_PLATFORM__)
-        dlclose(handle);
-#endif
         return data;
     }
 #endif
@@ -326,10 +340,6 @@ string ResolveUri(string_view base, string_view uri)
 
 IFile* OpenBufferFile(Data const& data, IFileManager& fileManager, const string_view uri, IFile::Ptr& file)
 {
-    if (data.memoryFile_) {
-        return data.memoryFile_.get();
-    }
-
     const string fileName = ResolveUri(data.filepath, uri);
     if (fileName.empty()) {
         PLUGIN_LOG_W("GLTF2: Buffer URI escapes base directory: %s", string(uri).c_str());
@@ -362,9 +372,22 @@ BufferLoadResult ReadBufferFile(Buffer& buffer, IFile& file, const uint64_t offs
     return BufferLoadResult{};
 }
 
-BufferLoadResult LoadBuffer(Data const& data, Buffer& buffer, IFileManager& fileManager)
+// Points the buffer to the memory the glTF was loaded from instead of copying.
+BufferLoadResult BorrowBufferData(Buffer& buffer, array_view<const uint8_t> memory, const uint64_t offset)
+{
+    if ((offset > memory.size()) || ((memory.size() - offset) < buffer.byteLength)) {
+        return BufferLoadResult{false, "Buffer larger than data: " + buffer.uri + '\n'};
+    }
+    buffer.borrowedData = array_view(memory.data() + offset, buffer.byteLength);
+    return BufferLoadResult{};
+}
+
+// Buffers in mapped files point into the mapping instead of copying. The file is returned in mappedFile and the caller
+// keeps it open while the buffer is in use.
+BufferLoadResult LoadBuffer(Data const& data, Buffer& buffer, IFileManager& fileManager, IFile::Ptr& mappedFile)
 {
     if (IsDataURI(buffer.uri)) {
+        CORE_CPU_PERF_SCOPE("CORE3D", "LoadBuffer()", "data uri", CORE3D_PROFILER_DEFAULT_COLOR);
         if (!DecodeDataURI(buffer.data, buffer.uri, buffer.byteLength, true, MAX_BUFFER_SIZE)) {
             return BufferLoadResult{false, "Failed to decode data uri: " + buffer.uri + '\n'};
         }
@@ -377,12 +400,23 @@ BufferLoadResult LoadBuffer(Data const& data, Buffer& buffer, IFileManager& file
     if (!sourceResult.success) {
         return sourceResult;
     }
+    if (!data.memoryData_.empty()) {
+        return BorrowBufferData(buffer, data.memoryData_, offset);
+    }
+    CORE_CPU_PERF_SCOPE("CORE3D", "LoadBuffer()", uri, CORE3D_PROFILER_DEFAULT_COLOR);
 
     IFile::Ptr file;
     IFile* filePtr = OpenBufferFile(data, fileManager, uri, file);
     if (!filePtr) {
         return BufferLoadResult{false, "Failed open uri: " + buffer.uri + '\n'};
     }
+    if (const auto mapped = filePtr->GetData(); !mapped.empty()) {
+        auto result = BorrowBufferData(buffer, mapped, offset);
+        if (result.success) {
+            mappedFile = move(file);
+        }
+        return result;
+    }
 
     return ReadBufferFile(buffer, *filePtr, offset);
 }
@@ -1309,36 +1343,70 @@ GLTFLoadDataResult& GLTFLoadDataResult::operator=(GLTFLoadDataResult&& other) no
 // Populate GLTF buffers with data.
 BufferLoadResult LoadBuffers(const Data* data, IFileManager& fileManager)
 {
-    BufferLoadResult result;
+    return LoadBuffers(data, fileManager, nullptr);
+}
+
+BufferLoadResult LoadBuffers(const Data* data, IFileManager& fileManager, IThreadPool* threadPool)
+{
     if (!data) {
-        result.success = false;
-        result.error = "Not Data";
-        return result;
+        return BufferLoadResult{false, "Not Data"};
     }
+    CORE_CPU_PERF_SCOPE("CORE3D", "LoadBuffers()", data->defaultResources, CORE3D_PROFILER_DEFAULT_COLOR);
+
     // Load data to all buffers.
-    for (const auto& buffer : data->buffers) {
-        if (buffer && buffer->data.empty()) {
+    vector<uint32_t> buffersToLoad;
+    for (uint32_t i = 0U; i < static_cast<uint32_t>(data->buffers.size()); ++i) {
+        const auto& buffer = data->buffers[i];
+        if (buffer && buffer->GetData().empty()) {
 #if defined(GLTF2_EXTENSION_EXT_MESHOPT_COMPRESSION)
             if (data->meshCompression && (data->defaultResourcesOffset < 0) && buffer->uri.empty()) {
                 continue;
             }
 #endif
-            result = LoadBuffer(*data, *buffer, fileManager);
-            if (!result.success) {
-                return result;
-            }
+            buffersToLoad.push_back(i);
+        }
+    }
+    vector<BufferLoadResult> bufferResults(buffersToLoad.size());
+    vector<IFile::Ptr> mappedFiles(buffersToLoad.size());
+    ParallelFor(threadPool, buffersToLoad.size(), [&](size_t i) {
+        bufferResults[i] = LoadBuffer(*data, *data->buffers[buffersToLoad[i]], fileManager, mappedFiles[i]);
+    });
+    for (auto& file : mappedFiles) {
+        if (file) {
+            data->mappedFiles_.push_back(move(file));
+        }
+    }
+    // report the error of the first failed buffer, as loading the buffers one by one would.
+    for (auto& result : bufferResults) {
+        if (!result.success) {
+            return move(result);
         }
     }
 
     // Set up bufferview data pointers. BufferView bounds (byteOffset + byteLength <= buffer->byteLength)
-    // are validated at parse time. ReadBufferFile guarantees buffer->data.size() >= buffer->byteLength.
+    // are validated at parse time. LoadBuffer guarantees buffer->GetData().size() >= buffer->byteLength.
     for (const auto& view : data->bufferViews) {
-        if (view && view->buffer && (view->byteOffset < view->buffer->data.size())) {
-            view->data = &(view->buffer->data[view->byteOffset]);
+        if (view && view->buffer) {
+            if (const auto bufferData = view->buffer->GetData(); view->byteOffset < bufferData.size()) {
+                view->data = bufferData.data() + view->byteOffset;
+            }
         }
     }
 
-    return result;
+#if defined(GLTF2_EXTENSION_EXT_MESHOPT_COMPRESSION)
+    // without a pool the views are decompressed when their accessors are first read.
+    if (threadPool) {
+        vector<BufferView*> viewsToDecompress;
+        for (const auto& view : data->bufferViews) {
+            if (view && view->meshoptCompression.buffer && !view->meshoptCompression.buffer->GetData().empty()) {
+                viewsToDecompress.push_back(view.get());
+            }
+        }
+        ParallelFor(threadPool, viewsToDecompress.size(), [&](size_t i) { DecompressMeshopt(*viewsToDecompress[i]); });
+    }
+#endif
+
+    return BufferLoadResult{};
 }
 
 UriLoadResult LoadUri(const string_view uri, const string_view expectedMimeType, const string_view filePath,
@@ -1492,7 +1560,9 @@ void Data::ReleaseBuffers()
     for (size_t i = 0u; i < buffers.size(); ++i) {
         Buffer* buffer = buffers[i].get();
         buffer->data = vector<uint8_t>();
+        buffer->borrowedData = {};
     }
+    mappedFiles_.clear();
 }
 
 vector<string> Data::GetExternalFileUris()
@@ -20,6 +20,7 @@
 #include <base/containers/string_view.h>
 #include <base/containers/vector.h>
 #include <core/namespace.h>
+#include <core/threading/intf_thread_pool.h>
 
 #include "gltf/data.h"
 
@@ -107,6 +108,10 @@ struct BufferLoadResult {
 // Populate GLTF buffers with data.
 BufferLoadResult LoadBuffers(const Data* data, CORE_NS::IFileManager& fileManager);
 
+// Populate GLTF buffers with data using the thread pool for loading buffers and decompressing meshopt compressed buffer
+// views in parallel. When several buffers fail, the error of the first one is returned.
+BufferLoadResult LoadBuffers(const Data* data, CORE_NS::IFileManager& fileManager, CORE_NS::IThreadPool* threadPool);
+
 enum UriLoadResult {
     URI_LOAD_SUCCESS,
     URI_LOAD_FAILED_INVALID_MIME_TYPE,
@@ -31,9 +31,15 @@ using namespace BASE_NS;
 RenderDataStoreDefaultCamera::RenderDataStoreDefaultCamera(const string_view name) : name_(name)
 {}
 
+void RenderDataStoreDefaultCamera::PreRender()
+{
+    BeginFrameRead();
+}
+
 void RenderDataStoreDefaultCamera::PostRender()
 {
     Clear();
+    EndFrameRead();
 }
 
 void RenderDataStoreDefaultCamera::Clear()
@@ -198,6 +204,19 @@ uint32_t RenderDataStoreDefaultCamera::GetEnvironmentIndex(const uint64_t id) co
     return 0U;
 }
 
+refcnt_ptr<RenderDataStoreDefaultCamera> RenderDataStoreDefaultCamera::CreateFrameWriter()
+{
+    return refcnt_ptr<RenderDataStoreDefaultCamera>(new RenderDataStoreDefaultCamera(name_));
+}
+
+void RenderDataStoreDefaultCamera::SwapFrameData(RenderDataStoreDefaultCamera& writer)
+{
+    // the writer gets the previous frame's buffers which it clears when it starts the next frame
+    cameras_.swap(writer.cameras_);
+    environments_.swap(writer.environments_);
+    hasBlendEnvironments_ = writer.hasBlendEnvironments_;
+}
+
 refcnt_ptr<RENDER_NS::IRenderDataStore> RenderDataStoreDefaultCamera::Create(
     RENDER_NS::IRenderContext&, const char* name)
 {
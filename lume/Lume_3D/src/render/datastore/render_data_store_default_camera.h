@@ -29,6 +29,8 @@
 #include <base/containers/vector.h>
 #include <base/util/uid.h>
 
+#include "render/datastore/render_data_store_frame_handoff.h"
+
 RENDER_BEGIN_NAMESPACE()
 class IRenderContext;
 RENDER_END_NAMESPACE()
@@ -37,14 +39,15 @@ CORE3D_BEGIN_NAMESPACE()
 /**
 RenderDataStoreDefaultCamera implementation.
 */
-class RenderDataStoreDefaultCamera final : public IRenderDataStoreDefaultCamera {
+class RenderDataStoreDefaultCamera final
+    : public IRenderDataStoreDefaultCamera,
+      public RenderDataStoreFrameBuffered<RenderDataStoreDefaultCamera, IRenderDataStoreDefaultCamera> {
 public:
     explicit RenderDataStoreDefaultCamera(const BASE_NS::string_view name);
     ~RenderDataStoreDefaultCamera() override = default;
 
     // IRenderDataStore
-    void PreRender() override
-    {}
+    void PreRender() override;
     // clear in post render
     void PostRender() override;
     void PreRenderBackend() override
@@ -98,6 +101,11 @@ public:
     static BASE_NS::refcnt_ptr<IRenderDataStore> Create(RENDER_NS::IRenderContext& renderContext, const char* name);
 
 private:
+    // RenderDataStoreFrameBuffered
+    friend RenderDataStoreFrameBuffered;
+    BASE_NS::refcnt_ptr<RenderDataStoreDefaultCamera> CreateFrameWriter();
+    void SwapFrameData(RenderDataStoreDefaultCamera& writer);
+
     const BASE_NS::string name_;
 
     BASE_NS::vector<RenderCamera> cameras_;
@@ -31,9 +31,15 @@ using namespace RENDER_NS;
 RenderDataStoreDefaultLight::RenderDataStoreDefaultLight(const string_view name) : name_(name)
 {}
 
+void RenderDataStoreDefaultLight::PreRender()
+{
+    BeginFrameRead();
+}
+
 void RenderDataStoreDefaultLight::PostRender()
 {
     Clear();
+    EndFrameRead();
 }
 
 void RenderDataStoreDefaultLight::Clear()
@@ -63,6 +69,10 @@ int32_t RenderDataStoreDefaultLight::GetRefCount()
 void RenderDataStoreDefaultLight::SetShadowTypes(const ShadowTypes& shadowTypes, const uint32_t flags)
 {
     shadowTypes_ = shadowTypes;
+    if (frameWriter_) {
+        // settings from outside the ECS would otherwise be overwritten by the next commit
+        frameWriter_->shadowTypes_ = shadowTypes;
+    }
 }
 
 IRenderDataStoreDefaultLight::ShadowTypes RenderDataStoreDefaultLight::GetShadowTypes() const
@@ -74,6 +84,9 @@ void RenderDataStoreDefaultLight::SetShadowQualityResolutions(
     const ShadowQualityResolutions& resolutions, const uint32_t flags)
 {
     resolutions_ = resolutions;
+    if (frameWriter_) {
+        frameWriter_->resolutions_ = resolutions;
+    }
 }
 
 Math::UVec2 RenderDataStoreDefaultLight::GetShadowQualityResolution() const
@@ -171,6 +184,23 @@ IRenderDataStoreDefaultLight::LightingFlags RenderDataStoreDefaultLight::GetLigh
     return lightingSpecializationFlags;
 }
 
+refcnt_ptr<RenderDataStoreDefaultLight> RenderDataStoreDefaultLight::CreateFrameWriter()
+{
+    auto writer = refcnt_ptr<RenderDataStoreDefaultLight>(new RenderDataStoreDefaultLight(name_));
+    writer->shadowTypes_ = shadowTypes_;
+    writer->resolutions_ = resolutions_;
+    return writer;
+}
+
+void RenderDataStoreDefaultLight::SwapFrameData(RenderDataStoreDefaultLight& writer)
+{
+    // the writer gets the previous frame's buffers which it clears when it starts the next frame
+    lights_.swap(writer.lights_);
+    lightCounts_ = writer.lightCounts_;
+    shadowTypes_ = writer.shadowTypes_;
+    resolutions_ = writer.resolutions_;
+}
+
 // for plugin / factory interface
 refcnt_ptr<IRenderDataStore> RenderDataStoreDefaultLight::Create(RENDER_NS::IRenderContext&, const char* name)
 {
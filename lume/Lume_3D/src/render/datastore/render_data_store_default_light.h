@@ -26,6 +26,8 @@
 #include <base/containers/vector.h>
 #include <base/util/uid.h>
 
+#include "render/datastore/render_data_store_frame_handoff.h"
+
 RENDER_BEGIN_NAMESPACE()
 class IRenderContext;
 RENDER_END_NAMESPACE()
@@ -34,14 +36,15 @@ CORE3D_BEGIN_NAMESPACE()
 /**
 RenderDataStoreDefaultLight implementation.
 */
-class RenderDataStoreDefaultLight final : public IRenderDataStoreDefaultLight {
+class RenderDataStoreDefaultLight final
+    : public IRenderDataStoreDefaultLight,
+      public RenderDataStoreFrameBuffered<RenderDataStoreDefaultLight, IRenderDataStoreDefaultLight> {
 public:
     explicit RenderDataStoreDefaultLight(const BASE_NS::string_view name);
     ~RenderDataStoreDefaultLight() override = default;
 
     // IRenderDataStore
-    void PreRender() override
-    {}
+    void PreRender() override;
     // clear in post render
     void PostRender() override;
     void PreRenderBackend() override
@@ -90,6 +93,11 @@ public:
     static BASE_NS::refcnt_ptr<IRenderDataStore> Create(RENDER_NS::IRenderContext& renderContext, const char* name);
 
 private:
+    // RenderDataStoreFrameBuffered
+    friend RenderDataStoreFrameBuffered;
+    BASE_NS::refcnt_ptr<RenderDataStoreDefaultLight> CreateFrameWriter();
+    void SwapFrameData(RenderDataStoreDefaultLight& writer);
+
     const BASE_NS::string name_;
 
     BASE_NS::vector<RenderLight> lights_;
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <utility>
 
 #include <3d/implementation_uids.h>
 #include <3d/intf_graphics_context.h>
@@ -494,6 +495,35 @@ RenderSubmeshBounds GetSubmeshBounds(const RenderMinAndMax aabb)
     return bounds;
 }
 
+// only transforms and custom data can be patched, other changes affect batching, sorting, or render slots
+bool IsRetainedRenderMeshPatchable(const array_view<const RenderMeshData> prevMeshData,
+    const RenderMeshBatchData& prevBatchData, const array_view<const RenderMeshData> meshData,
+    const RenderMeshBatchData& batchData)
+{
+    if ((prevMeshData.size() != meshData.size()) || (prevBatchData.renderMeshId != batchData.renderMeshId) ||
+        (prevBatchData.meshId != batchData.meshId) || (prevBatchData.materialFlags != batchData.materialFlags)) {
+        return false;
+    }
+    for (size_t idx = 0; idx < meshData.size(); ++idx) {
+        const auto& prevRef = prevMeshData[idx];
+        const auto& ref = meshData[idx];
+        if ((prevRef.id != ref.id) || (prevRef.meshId != ref.meshId) || (prevRef.layerMask != ref.layerMask) ||
+            (prevRef.sceneId != ref.sceneId) ||
+            ((Math::Determinant(prevRef.world) < 0.0f) != (Math::Determinant(ref.world) < 0.0f))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// removing an aabb can only shrink the scene bounds if it touches them
+inline bool IsOnBoundsEdge(const RenderMinAndMax& aabb, const RenderMinAndMax& bounds)
+{
+    return (aabb.minAabb.x <= bounds.minAabb.x) || (aabb.minAabb.y <= bounds.minAabb.y) ||
+           (aabb.minAabb.z <= bounds.minAabb.z) || (aabb.maxAabb.x >= bounds.maxAabb.x) ||
+           (aabb.maxAabb.y >= bounds.maxAabb.y) || (aabb.maxAabb.z >= bounds.maxAabb.z);
+}
+
 void DestroyMaterialByIndex(const uint32_t index, RenderDataStoreDefaultMaterial::AllMaterialData& matData)
 {
     if (index < matData.data.size()) {
@@ -651,6 +681,7 @@ RenderDataStoreDefaultMaterial::RenderDataStoreDefaultMaterial(
 
 void RenderDataStoreDefaultMaterial::PreRender()
 {
+    BeginFrameRead();
     // make sure that data is submitted
     SubmitFrameMeshData();
 }
@@ -658,6 +689,7 @@ void RenderDataStoreDefaultMaterial::PreRender()
 void RenderDataStoreDefaultMaterial::PostRender()
 {
     Clear();
+    EndFrameRead();
 }
 
 void RenderDataStoreDefaultMaterial::Clear()
@@ -665,30 +697,18 @@ void RenderDataStoreDefaultMaterial::Clear()
     // NOTE: clear is at the moment called typically two times
     // this could be further optimized to know if clear has already been called
 
-    renderFrameObjectInfo_ = {};
-    shadowBoundingVolume_ = {};
-
-    meshData_.frameMeshData.clear();
-    meshData_.frameSubmeshes.clear();
+    // the instance which renders with frame buffering has no retained render meshes, its frame data is kept as is
+    if (retainedFrameData_.kept && (!frameWriter_) && (!RetainedFrameDataMatches())) {
+        retainedFrameData_.kept = false;
+    }
+    ResetFrameMeshData();
     meshData_.frameSkinIndices.clear();
     meshData_.frameJointMatrixIndices.clear();
-    meshData_.frameSubmeshMaterialFlags.clear();
     meshData_.frameMeshBlasInstanceData.clear();
-    meshData_.frameLightProbeInterpolatedData.clear();
     // NOTE: material data is not cleared automatically anymore
     // we keep the data but update the resource references if data is used
     // separate destroy
     {
-        // resize the frame indices to match the material count
-        matData_.frameIndices.clear();
-        matData_.frameIndices.resize(matData_.data.size());
-        matData_.baseMaterialCount = static_cast<uint32_t>(matData_.frameIndices.size());
-        canUpdateBaseMaterialCount_ = true;
-        // make sure that the base material indices are alive and well
-        for (size_t idx = 0; idx < matData_.baseMaterialCount; ++idx) {
-            matData_.frameIndices[idx] = static_cast<uint32_t>(idx);
-        }
-
 #if (CORE3D_VALIDATION_ENABLED == 1)
         vector<uint32_t> noIdRemoval;
 #endif
@@ -697,6 +717,7 @@ void RenderDataStoreDefaultMaterial::Clear()
             auto& matRef = matData_.data[idx];
             if (matRef.noId) {
                 DestroyMaterialByIndex(static_cast<uint32_t>(idx), matData_);
+                materialDataGeneration_++;
 #if (CORE3D_VALIDATION_ENABLED == 1)
                 // should not have an id
                 noIdRemoval.push_back(static_cast<uint32_t>(idx));
@@ -715,12 +736,6 @@ void RenderDataStoreDefaultMaterial::Clear()
 #endif
     }
 
-    for (auto& slotRef : slotToSubmeshIndices_) {  // does not remove slots from use
-        slotRef.second.indices.clear();
-        slotRef.second.materialData.clear();
-        slotRef.second.objectCounts = {};
-    }
-
     if (!meshJointMatricesAllocator_.allocators.empty()) {
         meshJointMatricesAllocator_.currentIndex = 0;
         if (meshJointMatricesAllocator_.allocators.size() == 1) {  // size is good for this frame
@@ -742,6 +757,10 @@ void RenderDataStoreDefaultMaterial::Clear()
     if (materialRenderSlots_.opaqueMask != 0) {
         GetDefaultRenderSlots();
     }
+    // retained render meshes are submitted again for the next frame
+    if (!retainedMeshes_.data.empty()) {
+        frameMeshDataSubmitted_ = false;
+    }
 }
 
 void RenderDataStoreDefaultMaterial::Ref()
@@ -774,6 +793,7 @@ void RenderDataStoreDefaultMaterial::DestroyMaterialData(const uint64_t id)
 
         // destroy from material map
         matData_.materialIdToIndex.erase(iter);
+        materialDataGeneration_++;
     }
 }
 
@@ -792,6 +812,7 @@ void RenderDataStoreDefaultMaterial::DestroyMeshData(const uint64_t id)
 
         // destroy from mesh map
         meshData_.meshIdToIndex.erase(iter);
+        meshDataGeneration_++;
     }
 }
 
@@ -844,6 +865,8 @@ uint32_t RenderDataStoreDefaultMaterial::AddMaterialDataImpl(const uint32_t matI
     const RenderDataDefaultMaterial::MaterialData& materialData, const array_view<const uint8_t> customData,
     const array_view<const RenderHandleReference> customResourceData)
 {
+    DropRetainedFrameData();
+    materialDataGeneration_++;
     uint32_t materialIndex = matIndex;
     // matData_.frameIndices can have higher counts)
     PLUGIN_ASSERT(matData_.allUniforms.size() == matData_.data.size());
@@ -960,6 +983,13 @@ uint32_t RenderDataStoreDefaultMaterial::UpdateMaterialData(const uint64_t id,
 
 RenderFrameMaterialIndices RenderDataStoreDefaultMaterial::AddFrameMaterialData(
     const uint32_t index, const uint32_t instanceCount)
+{
+    DropRetainedFrameData();
+    return AddFrameMaterialDataImpl(index, instanceCount);
+}
+
+RenderFrameMaterialIndices RenderDataStoreDefaultMaterial::AddFrameMaterialDataImpl(
+    const uint32_t index, const uint32_t instanceCount)
 {
     if (index >= matData_.data.size()) {
         // we expect the material to be in data
@@ -1043,6 +1073,10 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
     if (frameMeshDataSubmitted_) {
         return;
     }
+    // retained render meshes were created, destroyed or changed so that the kept frame data needs to be rebuilt
+    if (retainedFrameData_.kept && (!RetainedFrameDataMatches())) {
+        DropRetainedFrameData();
+    }
     frameMeshDataSubmitted_ = true;
 
     // make sure that the base material indices are alive and well
@@ -1053,6 +1087,8 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
         }
     }
 
+    // the batches and submeshes of the retained render meshes are recorded when the retained frame data is built
+    RetainedFrameLayout* retainedLayout = nullptr;
     // NOTES:
     // 1. When using skinning the skinning AABB is the mesh AABB and submesh AABB calculations are irrelevant
     // 2. Full mesh AABB is currently irrelevant, it could be used in the future for coarse culling
@@ -1097,11 +1133,25 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
 
             if (batchIndex == 0) {
                 baseRenderMeshIndex = static_cast<uint32_t>(meshData_.frameMeshData.size());
+                if (retainedLayout) {
+                    const uint32_t meshIndex = static_cast<uint32_t>(&meshDataContainer - meshData_.data.data());
+                    retainedLayout->batches.push_back({meshIndex, baseRenderMeshIndex, 0U,
+                        static_cast<uint32_t>(retainedLayout->submeshes.size()), 0U});
+                }
             }
             MeshDataContainer* rmbcMesh = nullptr;
             if (materialInstancing && (batchMeshRef.rmcBatchMeshIndex < meshData_.data.size())) {
                 rmbcMesh = &meshData_.data[batchMeshRef.rmcBatchMeshIndex];
             }
+            if (retainedLayout) {
+                const uint32_t batchLayoutIndex = static_cast<uint32_t>(retainedLayout->batches.size()) - 1U;
+                retainedLayout->batches.back().frameMeshCount++;
+                retainedLayout->frameMeshBatches.push_back(batchLayoutIndex);
+                if (batchMeshRef.retainedInstance < retainedLayout->instanceFrameMeshes.size()) {
+                    retainedLayout->instanceFrameMeshes[batchMeshRef.retainedInstance] =
+                        static_cast<uint32_t>(meshData_.frameMeshData.size());
+                }
+            }
             meshData_.frameMeshData.push_back(rmd);
 
             uint32_t currMatBatchCount = 1U;
@@ -1133,7 +1183,7 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
                 if (batchIndex == 0) {
                     auto& submesh = meshDataContainer.submeshes[submeshIdx];
                     RenderFrameMaterialIndices matIndices =
-                        AddFrameMaterialData(submesh.sd.materialIndex, currMatBatchCount);
+                        AddFrameMaterialDataImpl(submesh.sd.materialIndex, currMatBatchCount);
                     materialFrameOffsets_.push_back(matIndices.frameOffset);
                     shadowCaster = IsShadowCaster(matIndices.index, matData_.data);
                 }
@@ -1189,6 +1239,13 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
 
                     // add bounds to shadow casters
                     ExtentShadowSceneBounds(shadowCaster, finalAabb, shadowBoundingVolume_);
+                    if (retainedLayout) {
+                        retainedLayout->batches.back().submeshCount++;
+                        retainedLayout->submeshes.push_back({submeshIdx, submeshFrameIndex,
+                            static_cast<uint32_t>(meshData_.frameSubmeshes.size()) - submeshFrameIndex,
+                            shadowCaster});
+                        retainedFrameData_.submeshAabbs.push_back(finalAabb);
+                    }
                 }
                 // add instanced materials from the correct mesh
                 if (materialInstancing) {
@@ -1220,36 +1277,351 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
         }
     };
 
-    for (auto& meshDataRef : meshData_.data) {
-        if (meshDataRef.batchComponentFrameMeshData.empty() && meshDataRef.batchFrameMeshData.empty() &&
-            meshDataRef.frameMeshData.empty()) {
+    auto ProcessFrameMeshData = [&]() {
+        for (auto& meshDataRef : meshData_.data) {
+            if (meshDataRef.batchComponentFrameMeshData.empty() && meshDataRef.batchFrameMeshData.empty() &&
+                meshDataRef.frameMeshData.empty()) {
+                continue;
+            }
+            // NOTE: would not be needed if doing direct submesh GPU instancing
+            const bool allowInstancing = GetMeshAllowInstancing(meshDataRef, matData_.data);
+
+            // process both, automatic batching and render mesh batch component data
+            if (!meshDataRef.batchComponentFrameMeshData.empty()) {
+                ProcessMeshBatchData(allowInstancing, true, meshDataRef, meshDataRef.batchComponentFrameMeshData);
+                meshDataRef.batchComponentFrameMeshData.clear();
+            }
+            if (!meshDataRef.batchFrameMeshData.empty()) {
+                ProcessMeshBatchData(allowInstancing, false, meshDataRef, meshDataRef.batchFrameMeshData);
+                meshDataRef.batchFrameMeshData.clear();
+            }
+            // process non patchable frame mesh data
+            if (!meshDataRef.frameMeshData.empty()) {
+                ProcessMeshBatchData(false, false, meshDataRef, meshDataRef.frameMeshData);
+                meshDataRef.frameMeshData.clear();
+            }
+        }
+    };
+
+    if (retainedFrameData_.kept) {
+        // only the changed retained render meshes are updated to the kept frame data
+        PatchRetainedFrameData();
+    } else if (!frameHasRetainedMeshData_) {
+        frameHasRetainedMeshData_ = true;
+        if (CanBuildRetainedFrameData()) {
+            // the retained render meshes are processed first to the start of the frame data
+            BeginRetainedFrameData();
+            retainedLayout = &retainedFrameLayout_;
+            ProcessFrameMeshData();
+            retainedLayout = nullptr;
+            EndRetainedFrameData();
+        } else {
+            for (const auto& retainedRef : retainedMeshes_.data) {
+                AddFrameRenderMeshDataImpl(
+                    retainedRef.meshData, {}, retainedRef.batchData, RenderSceneDataConstants::INVALID_INDEX);
+            }
+        }
+    }
+    ProcessFrameMeshData();
+    // update shadow caster bounds
+    renderFrameObjectInfo_.shadowCasterBoundingSphere = CalculateFinalSceneBoundingSphere(shadowBoundingVolume_);
+
+    TrimRetainedPatches();
+    frameHasImmediateMeshData_ = false;
+}
+
+void RenderDataStoreDefaultMaterial::ResetFrameMeshData()
+{
+    RetainedFrameData& rfd = retainedFrameData_;
+    if (rfd.kept) {
+        // the retained frame data is kept at the start, restore the flags which were changed after submit
+        auto& submeshMaterialFlags = meshData_.frameSubmeshMaterialFlags;
+        for (size_t idx = rfd.changedFlags.size(); idx > 0; --idx) {
+            const auto& changedRef = rfd.changedFlags[idx - 1U];
+            if (changedRef.first < submeshMaterialFlags.size()) {
+                submeshMaterialFlags[changedRef.first] = changedRef.second;
+            }
+        }
+        meshData_.frameMeshData.resize(rfd.meshCount);
+        meshData_.frameSubmeshes.resize(rfd.submeshCount);
+        submeshMaterialFlags.resize(rfd.submeshCount);
+        renderFrameObjectInfo_ = rfd.renderFrameObjectInfo;
+        shadowBoundingVolume_ = rfd.shadowBoundingVolume;
+    } else {
+        meshData_.frameMeshData.clear();
+        meshData_.frameSubmeshes.clear();
+        meshData_.frameSubmeshMaterialFlags.clear();
+        renderFrameObjectInfo_ = {};
+        shadowBoundingVolume_ = {};
+    }
+    rfd.changedFlags.clear();
+    meshData_.frameLightProbeInterpolatedData.clear();
+    frameHasRetainedMeshData_ = rfd.kept;
+
+    // resize the frame indices to match the material count
+    if (!rfd.kept) {
+        matData_.frameIndices.clear();
+    }
+    matData_.frameIndices.resize(rfd.kept ? rfd.materialFrameIndexCount : matData_.data.size());
+    matData_.baseMaterialCount = static_cast<uint32_t>(matData_.data.size());
+    canUpdateBaseMaterialCount_ = true;
+    // make sure that the base material indices are alive and well
+    for (size_t idx = 0; idx < matData_.baseMaterialCount; ++idx) {
+        matData_.frameIndices[idx] = static_cast<uint32_t>(idx);
+    }
+
+    for (auto& slotRef : slotToSubmeshIndices_) {  // does not remove slots from use
+        auto& slotData = slotRef.second;
+        if (!rfd.kept) {
+            slotData.retainedCount = 0U;
+            slotData.retainedObjectCounts = {};
+        }
+        slotData.indices.resize(slotData.retainedCount);
+        slotData.materialData.resize(slotData.retainedCount);
+        slotData.objectCounts = slotData.retainedObjectCounts;
+    }
+}
+
+bool RenderDataStoreDefaultMaterial::RetainedFrameDataMatches() const
+{
+    const RetainedFrameData& rfd = retainedFrameData_;
+    // older patches are not available anymore for the kept frame data
+    return rfd.kept && (!retainedMeshes_.data.empty()) &&
+           (rfd.retainedMeshGeneration == retainedMeshes_.generation) &&
+           (rfd.retainedPatchGeneration >= retainedMeshes_.patchesStart) &&
+           (rfd.materialDataGeneration == materialDataGeneration_) && (rfd.meshDataGeneration == meshDataGeneration_);
+}
+
+bool RenderDataStoreDefaultMaterial::CanBuildRetainedFrameData() const
+{
+    // ray tracing instance data is not retained
+    return (!retainedMeshes_.data.empty()) && (!rtEnabled_) && meshData_.frameMeshData.empty() &&
+           meshData_.frameSubmeshes.empty() && (matData_.baseMaterialCount == matData_.data.size()) &&
+           (matData_.frameIndices.size() == matData_.baseMaterialCount);
+}
+
+void RenderDataStoreDefaultMaterial::BeginRetainedFrameData()
+{
+    RetainedFrameData& rfd = retainedFrameData_;
+    rfd.retainedMeshGeneration = retainedMeshes_.generation;
+    rfd.retainedPatchGeneration = retainedMeshes_.patchGeneration;
+    rfd.materialDataGeneration = materialDataGeneration_;
+    rfd.meshDataGeneration = meshDataGeneration_;
+    rfd.submeshAabbs.clear();
+    rfd.shadowBoundsPatchCount = 0U;
+    rfd.changedFlags.clear();
+
+    RetainedFrameLayout& layout = retainedFrameLayout_;
+    layout.batches.clear();
+    layout.submeshes.clear();
+    layout.frameMeshBatches.clear();
+    layout.instanceFrameMeshes.clear();
+
+    // frame only render mesh data is processed after the retained frame data
+    stashedFrameMeshData_.clear();
+    if (frameHasImmediateMeshData_) {
+        for (uint32_t idx = 0; idx < static_cast<uint32_t>(meshData_.data.size()); ++idx) {
+            auto& meshDataRef = meshData_.data[idx];
+            if (meshDataRef.batchComponentFrameMeshData.empty() && meshDataRef.batchFrameMeshData.empty() &&
+                meshDataRef.frameMeshData.empty()) {
+                continue;
+            }
+            auto& stashRef = stashedFrameMeshData_.emplace_back();
+            stashRef.meshIndex = idx;
+            stashRef.batchComponentFrameMeshData.swap(meshDataRef.batchComponentFrameMeshData);
+            stashRef.batchFrameMeshData.swap(meshDataRef.batchFrameMeshData);
+            stashRef.frameMeshData.swap(meshDataRef.frameMeshData);
+        }
+    }
+    stashedRenderFrameObjectInfo_ = renderFrameObjectInfo_;
+    renderFrameObjectInfo_ = {};
+
+    uint32_t instanceCount = 0U;
+    for (auto& retainedRef : retainedMeshes_.data) {
+        retainedRef.firstInstance = instanceCount;
+        instanceCount += static_cast<uint32_t>(retainedRef.meshData.size());
+    }
+    layout.instanceFrameMeshes.resize(instanceCount, RenderSceneDataConstants::INVALID_INDEX);
+    for (const auto& retainedRef : retainedMeshes_.data) {
+        AddFrameRenderMeshDataImpl(retainedRef.meshData, {}, retainedRef.batchData, retainedRef.firstInstance);
+    }
+}
+
+void RenderDataStoreDefaultMaterial::EndRetainedFrameData()
+{
+    RetainedFrameData& rfd = retainedFrameData_;
+    rfd.meshCount = static_cast<uint32_t>(meshData_.frameMeshData.size());
+    rfd.submeshCount = static_cast<uint32_t>(meshData_.frameSubmeshes.size());
+    rfd.materialFrameIndexCount = static_cast<uint32_t>(matData_.frameIndices.size());
+    rfd.renderFrameObjectInfo = renderFrameObjectInfo_;
+    rfd.shadowBoundingVolume = shadowBoundingVolume_;
+    rfd.kept = true;
+    for (auto& slotRef : slotToSubmeshIndices_) {
+        auto& slotData = slotRef.second;
+        slotData.retainedCount = static_cast<uint32_t>(slotData.indices.size());
+        slotData.retainedObjectCounts = slotData.objectCounts;
+    }
+
+    renderFrameObjectInfo_.renderMaterialFlags |= stashedRenderFrameObjectInfo_.renderMaterialFlags;
+    for (auto& stashRef : stashedFrameMeshData_) {
+        auto& meshDataRef = meshData_.data[stashRef.meshIndex];
+        meshDataRef.batchComponentFrameMeshData.swap(stashRef.batchComponentFrameMeshData);
+        meshDataRef.batchFrameMeshData.swap(stashRef.batchFrameMeshData);
+        meshDataRef.frameMeshData.swap(stashRef.frameMeshData);
+    }
+    stashedFrameMeshData_.clear();
+}
+
+void RenderDataStoreDefaultMaterial::DropRetainedFrameData()
+{
+    RetainedFrameData& rfd = retainedFrameData_;
+    if (!rfd.kept) {
+        return;
+    }
+    rfd.kept = false;
+    // the kept frame data is removed if nothing has been added after it. otherwise it is still used for this frame.
+    if ((!frameMeshDataSubmitted_) && (meshData_.frameMeshData.size() == rfd.meshCount) &&
+        (meshData_.frameSubmeshes.size() == rfd.submeshCount) &&
+        (matData_.frameIndices.size() == rfd.materialFrameIndexCount)) {
+        ResetFrameMeshData();
+    }
+}
+
+void RenderDataStoreDefaultMaterial::PatchRetainedFrameData()
+{
+    RetainedFrameData& rfd = retainedFrameData_;
+    if (rfd.retainedPatchGeneration == retainedMeshes_.patchGeneration) {
+        return;
+    }
+    const RetainedFrameLayout& layout = retainedFrameLayout_;
+    patchedRetainedBatches_.clear();
+    for (const auto& patchRef : retainedMeshes_.patches) {
+        if ((patchRef.first <= rfd.retainedPatchGeneration) || (patchRef.second >= retainedMeshes_.data.size())) {
+            continue;
+        }
+        const auto& retainedRef = retainedMeshes_.data[patchRef.second];
+        // only the latest patch of the render mesh is applied
+        if (retainedRef.patchGeneration != patchRef.first) {
             continue;
         }
-        // NOTE: would not be needed if doing direct submesh GPU instancing
-        const bool allowInstancing = GetMeshAllowInstancing(meshDataRef, matData_.data);
+        for (uint32_t idx = 0; idx < static_cast<uint32_t>(retainedRef.meshData.size()); ++idx) {
+            const uint32_t instance = retainedRef.firstInstance + idx;
+            const uint32_t frameMeshIndex = (instance < layout.instanceFrameMeshes.size())
+                                                ? layout.instanceFrameMeshes[instance]
+                                                : RenderSceneDataConstants::INVALID_INDEX;
+            if (frameMeshIndex < rfd.meshCount) {
+                meshData_.frameMeshData[frameMeshIndex] = retainedRef.meshData[idx];
+                patchedRetainedBatches_.push_back(layout.frameMeshBatches[frameMeshIndex]);
+            }
+        }
+    }
+    std::sort(patchedRetainedBatches_.begin(), patchedRetainedBatches_.end());
+    patchedRetainedBatches_.erase(
+        std::unique(patchedRetainedBatches_.begin(), patchedRetainedBatches_.end()), patchedRetainedBatches_.cend());
 
-        // process both, automatic batching and render mesh batch component data
-        if (!meshDataRef.batchComponentFrameMeshData.empty()) {
-            ProcessMeshBatchData(allowInstancing, true, meshDataRef, meshDataRef.batchComponentFrameMeshData);
-            meshDataRef.batchComponentFrameMeshData.clear();
+    const SceneBoundingVolumeHelper prevShadowBoundingVolume = rfd.shadowBoundingVolume;
+    bool recalculateShadowBounds = false;
+    for (const uint32_t batchIndex : patchedRetainedBatches_) {
+        PatchRetainedBatchBounds(batchIndex, recalculateShadowBounds);
+    }
+    // incremental updates are recalculated after a while to avoid accumulating floating point errors
+    if (recalculateShadowBounds || (rfd.shadowBoundsPatchCount >= rfd.submeshAabbs.size())) {
+        RecalculateRetainedShadowBounds();
+    }
+    rfd.retainedPatchGeneration = retainedMeshes_.patchGeneration;
+
+    if (meshData_.frameSubmeshes.size() == rfd.submeshCount) {
+        shadowBoundingVolume_ = rfd.shadowBoundingVolume;
+    } else {
+        // frame only data has already been submitted, keep its bounds
+        const auto& volume = rfd.shadowBoundingVolume;
+        shadowBoundingVolume_.sumOfSubmeshPoints +=
+            volume.sumOfSubmeshPoints - prevShadowBoundingVolume.sumOfSubmeshPoints;
+        shadowBoundingVolume_.submeshCount =
+            shadowBoundingVolume_.submeshCount + volume.submeshCount - prevShadowBoundingVolume.submeshCount;
+        shadowBoundingVolume_.aabb.minAabb = Math::min(shadowBoundingVolume_.aabb.minAabb, volume.aabb.minAabb);
+        shadowBoundingVolume_.aabb.maxAabb = Math::max(shadowBoundingVolume_.aabb.maxAabb, volume.aabb.maxAabb);
+    }
+}
+
+void RenderDataStoreDefaultMaterial::PatchRetainedBatchBounds(const uint32_t batchIndex, bool& recalculateShadowBounds)
+{
+    RetainedFrameData& rfd = retainedFrameData_;
+    const RetainedFrameLayout& layout = retainedFrameLayout_;
+    if (batchIndex >= layout.batches.size()) {
+        return;
+    }
+    const auto& batchRef = layout.batches[batchIndex];
+    if (batchRef.meshIndex >= meshData_.data.size()) {
+        return;
+    }
+    const auto& meshDataRef = meshData_.data[batchRef.meshIndex];
+    auto& volume = rfd.shadowBoundingVolume;
+    const uint32_t submeshEnd = batchRef.firstSubmesh + batchRef.submeshCount;
+    for (uint32_t submeshIdx = batchRef.firstSubmesh; submeshIdx < submeshEnd; ++submeshIdx) {
+        const auto& submeshRef = layout.submeshes[submeshIdx];
+        if (submeshRef.submeshIndex >= meshDataRef.submeshes.size()) {
+            continue;
+        }
+        // same as when processing the batch
+        const auto& submeshAabb = meshDataRef.submeshes[submeshRef.submeshIndex].sd.aabb;
+        RenderMinAndMax aabb;
+        for (uint32_t idx = 0; idx < batchRef.frameMeshCount; ++idx) {
+            const RenderMinAndMax rmam =
+                GetWorldAABB(meshData_.frameMeshData[batchRef.firstFrameMesh + idx].world, submeshAabb);
+            aabb.minAabb = Math::min(aabb.minAabb, rmam.minAabb);
+            aabb.maxAabb = Math::max(aabb.maxAabb, rmam.maxAabb);
         }
-        if (!meshDataRef.batchFrameMeshData.empty()) {
-            ProcessMeshBatchData(allowInstancing, false, meshDataRef, meshDataRef.batchFrameMeshData);
-            meshDataRef.batchFrameMeshData.clear();
+        const RenderSubmeshBounds bounds = GetSubmeshBounds(aabb);
+        for (uint32_t idx = 0; idx < submeshRef.frameSubmeshCount; ++idx) {
+            meshData_.frameSubmeshes[submeshRef.firstFrameSubmesh + idx].bounds = bounds;
         }
-        // process non patchable frame mesh data
-        if (!meshDataRef.frameMeshData.empty()) {
-            ProcessMeshBatchData(false, false, meshDataRef, meshDataRef.frameMeshData);
-            meshDataRef.frameMeshData.clear();
+
+        auto& prevAabb = rfd.submeshAabbs[submeshIdx];
+        if (submeshRef.shadowCaster) {
+            if (prevAabb.minAabb.x <= prevAabb.maxAabb.x) {
+                volume.sumOfSubmeshPoints -= (prevAabb.minAabb + prevAabb.maxAabb) / 2.f;
+                --volume.submeshCount;
+                recalculateShadowBounds = recalculateShadowBounds || IsOnBoundsEdge(prevAabb, volume.aabb);
+            }
+            ExtentShadowSceneBounds(true, aabb, volume);
+            ++rfd.shadowBoundsPatchCount;
         }
+        prevAabb = aabb;
     }
-    // update shadow caster bounds
-    renderFrameObjectInfo_.shadowCasterBoundingSphere = CalculateFinalSceneBoundingSphere(shadowBoundingVolume_);
+}
+
+void RenderDataStoreDefaultMaterial::RecalculateRetainedShadowBounds()
+{
+    RetainedFrameData& rfd = retainedFrameData_;
+    const auto& submeshes = retainedFrameLayout_.submeshes;
+    rfd.shadowBoundingVolume = {};
+    for (size_t idx = 0; (idx < submeshes.size()) && (idx < rfd.submeshAabbs.size()); ++idx) {
+        ExtentShadowSceneBounds(submeshes[idx].shadowCaster, rfd.submeshAabbs[idx], rfd.shadowBoundingVolume);
+    }
+    rfd.shadowBoundsPatchCount = 0U;
+}
+
+void RenderDataStoreDefaultMaterial::TrimRetainedPatches()
+{
+    RetainedRenderMeshes& retained = retainedMeshes_;
+    if (retained.submittedPatchGeneration == retained.patchGeneration) {
+        return;
+    }
+    // with frame buffering the other frame data was patched up to the previously submitted generation
+    retained.patchesStart = Math::max(retained.patchesStart, retained.submittedPatchGeneration);
+    const uint64_t patchesStart = retained.patchesStart;
+    const auto iter = std::find_if(retained.patches.cbegin(), retained.patches.cend(),
+        [patchesStart](const pair<uint64_t, uint32_t>& patch) { return patch.first > patchesStart; });
+    retained.patches.erase(retained.patches.cbegin(), iter);
+    retained.submittedPatchGeneration = retained.patchGeneration;
 }
 
 uint32_t RenderDataStoreDefaultMaterial::AddMeshData(const RenderMeshData& meshData)
 {
+    DropRetainedFrameData();
     frameMeshDataSubmitted_ = false;
+    frameHasImmediateMeshData_ = true;
     // DEPRECATED support, needs to work for compatibility
     const uint32_t renderMeshIdx = static_cast<uint32_t>(meshData_.frameMeshData.size());
     meshData_.frameMeshData.push_back(meshData);
@@ -1259,13 +1631,33 @@ uint32_t RenderDataStoreDefaultMaterial::AddMeshData(const RenderMeshData& meshD
 void RenderDataStoreDefaultMaterial::AddFrameRenderMeshData(
     const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData)
 {
+    AddFrameRenderMeshData(array_view<const RenderMeshData>(&meshData, 1U), meshSkinData, batchData);
+}
+
+void RenderDataStoreDefaultMaterial::AddFrameRenderMeshData(const array_view<const RenderMeshData> meshData,
+    const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData)
+{
+    if (meshData.empty()) {
+        return;
+    }
     frameMeshDataSubmitted_ = false;
+    frameHasImmediateMeshData_ = true;
+    AddFrameRenderMeshDataImpl(meshData, meshSkinData, batchData, RenderSceneDataConstants::INVALID_INDEX);
+}
 
+void RenderDataStoreDefaultMaterial::AddFrameRenderMeshDataImpl(const array_view<const RenderMeshData> meshData,
+    const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData, const uint32_t firstRetainedInstance)
+{
+    if (meshData.empty()) {
+        return;
+    }
+    // all the instances share the mesh and the batch
+    const RenderMeshData& firstMeshData = meshData[0U];
     // with real render mesh batch component we need the actual mesh where batching happens
     const bool isRmbc = (batchData.meshId != RenderSceneDataConstants::INVALID_ID) &&
                         (batchData.renderMeshId != RenderSceneDataConstants::INVALID_ID);
-    const uint64_t meshId = isRmbc ? batchData.meshId : meshData.meshId;
-    const uint64_t batchDataMeshId = isRmbc ? meshData.meshId : RenderSceneDataConstants::INVALID_ID;
+    const uint64_t meshId = isRmbc ? batchData.meshId : firstMeshData.meshId;
+    const uint64_t batchDataMeshId = isRmbc ? firstMeshData.meshId : RenderSceneDataConstants::INVALID_ID;
     auto iter = meshData_.meshIdToIndex.find(meshId);
     if (iter == meshData_.meshIdToIndex.end()) {
 #if (CORE3D_VALIDATION_ENABLED == 1)
@@ -1284,11 +1676,6 @@ void RenderDataStoreDefaultMaterial::AddFrameRenderMeshData(
     // full mesh instancing checked later
     bool allowInstancing = true;
 
-    if (rtEnabled_) {
-        // update for tlas update
-        UpdateFrameMeshBlasInstanceData(mesh, meshData.world);
-    }
-
     const uint32_t skinJointIndex = AddFrameSkinJointMatricesImpl(
         meshSkinData.id, meshSkinData.skinJointMatrices, meshSkinData.prevSkinJointMatrices);
     // if joint matrices were stored and instancing is allowed check are there instances with a index. this
@@ -1302,31 +1689,32 @@ void RenderDataStoreDefaultMaterial::AddFrameRenderMeshData(
             batchDataContainer.cend(),
             [skinJointIndex](const RenderMeshBatchDataContainer& data) { return data.skinIndex != skinJointIndex; });
     }
-    if (allowInstancing) {
-        const auto& world = meshData.world;
-        // negative scale requires a different graphics state and assuming most of the content
-        // doesn't have negative scaling we'll just use separate draws for inverted meshes instead
-        // of instanced draws. negative scaling factor can be determined by checking is the
-        // determinant of the 3x3 sub-matrix negative.
-        const float determinant = world.x.x * (world.y.y * world.z.z - world.z.y * world.y.z) -
-                                  world.x.y * (world.y.x * world.z.z - world.y.z * world.z.x) +
-                                  world.x.z * (world.y.x * world.z.y - world.y.y * world.z.x);
-        if (determinant < 0.f) {
-            allowInstancing = false;
+    uint32_t rmbcMeshIdx = RenderSceneDataConstants::INVALID_INDEX;
+    if (allowInstancing && isRmbc) {
+        if (const auto rmbcIter = meshData_.meshIdToIndex.find(batchDataMeshId);
+            rmbcIter != meshData_.meshIdToIndex.cend()) {
+            rmbcMeshIdx = rmbcIter->second;
         }
     }
-    uint32_t rmbcMeshIdx = RenderSceneDataConstants::INVALID_INDEX;
-    if (!allowInstancing) {
-        mesh.frameMeshData.push_back({meshData, rmbcMeshIdx, skinJointIndex, meshSkinData.aabb});
-    } else {
-        if (isRmbc) {
-            if (const auto rmbcIter = meshData_.meshIdToIndex.find(batchDataMeshId);
-                rmbcIter != meshData_.meshIdToIndex.cend()) {
-                rmbcMeshIdx = rmbcIter->second;
-            }
-            mesh.batchComponentFrameMeshData.push_back({meshData, rmbcMeshIdx, skinJointIndex, meshSkinData.aabb});
+    auto& batchFrameMeshData = (isRmbc) ? mesh.batchComponentFrameMeshData : mesh.batchFrameMeshData;
+    for (uint32_t idx = 0U; idx < static_cast<uint32_t>(meshData.size()); ++idx) {
+        const RenderMeshData& instanceMeshData = meshData[idx];
+        if (rtEnabled_) {
+            // update for tlas update
+            UpdateFrameMeshBlasInstanceData(mesh, instanceMeshData.world);
+        }
+        const uint32_t retainedInstance = (firstRetainedInstance != RenderSceneDataConstants::INVALID_INDEX)
+                                              ? (firstRetainedInstance + idx)
+                                              : RenderSceneDataConstants::INVALID_INDEX;
+        // negative scale requires a different graphics state and assuming most of the content
+        // doesn't have negative scaling we'll just use separate draws for inverted meshes instead
+        // of instanced draws.
+        if (!allowInstancing || (Math::Determinant(instanceMeshData.world) < 0.0f)) {
+            mesh.frameMeshData.push_back({instanceMeshData, RenderSceneDataConstants::INVALID_INDEX, skinJointIndex,
+                meshSkinData.aabb, retainedInstance});
         } else {
-            mesh.batchFrameMeshData.push_back({meshData, rmbcMeshIdx, skinJointIndex, meshSkinData.aabb});
+            batchFrameMeshData.push_back(
+                {instanceMeshData, rmbcMeshIdx, skinJointIndex, meshSkinData.aabb, retainedInstance});
         }
     }
 }
@@ -1342,10 +1730,61 @@ void RenderDataStoreDefaultMaterial::AddFrameRenderMeshData(const RenderMeshData
     AddFrameRenderMeshData(meshData, {}, {});
 }
 
+void RenderDataStoreDefaultMaterial::SetRetainedRenderMeshData(
+    const uint64_t id, const array_view<const RenderMeshData> meshData, const RenderMeshBatchData& batchData)
+{
+    frameMeshDataSubmitted_ = false;
+    RetainedRenderMeshes& retained = retainedMeshes_;
+    uint32_t index = static_cast<uint32_t>(retained.data.size());
+    if (const auto iter = retained.idToIndex.find(id); iter != retained.idToIndex.cend()) {
+        index = iter->second;
+        auto& retainedRef = retained.data[index];
+        if (IsRetainedRenderMeshPatchable(retainedRef.meshData, retainedRef.batchData, meshData, batchData)) {
+            // the kept frame data is patched in place
+            std::copy(meshData.cbegin(), meshData.cend(), retainedRef.meshData.begin());
+            retainedRef.patchGeneration = ++retained.patchGeneration;
+            retained.patches.push_back({retainedRef.patchGeneration, index});
+            return;
+        }
+    } else {
+        retained.idToIndex.insert_or_assign(id, index);
+        retained.data.push_back({id, {}, {}});
+    }
+    retained.generation++;
+    retained.patches.clear();
+    retained.patchesStart = retained.patchGeneration;
+    auto& retainedRef = retained.data[index];
+    retainedRef.batchData = batchData;
+    retainedRef.meshData.clear();
+    retainedRef.meshData.append(meshData.cbegin(), meshData.cend());
+}
+
+void RenderDataStoreDefaultMaterial::DestroyRetainedRenderMeshData(const uint64_t id)
+{
+    RetainedRenderMeshes& retained = retainedMeshes_;
+    const auto iter = retained.idToIndex.find(id);
+    if (iter == retained.idToIndex.cend()) {
+        return;
+    }
+    frameMeshDataSubmitted_ = false;
+    retained.generation++;
+    retained.patches.clear();
+    retained.patchesStart = retained.patchGeneration;
+    // keep the data packed by moving the last one to the removed index
+    const uint32_t index = iter->second;
+    retained.idToIndex.erase(iter);
+    const uint32_t lastIndex = static_cast<uint32_t>(retained.data.size()) - 1U;
+    if (index != lastIndex) {
+        retained.data[index] = move(retained.data[lastIndex]);
+        retained.idToIndex.insert_or_assign(retained.data[index].id, index);
+    }
+    retained.data.pop_back();
+}
+
 void RenderDataStoreDefaultMaterial::AddFrameRenderMeshDataAdditionalMaterial(
     const uint32_t matIndex, const uint32_t submeshFrameIndex, RenderSubmesh& renderSubmesh)
 {
-    RenderFrameMaterialIndices matIndices = GetCertainMaterialIndices(AddFrameMaterialData(matIndex, 1U), matData_);
+    RenderFrameMaterialIndices matIndices = GetCertainMaterialIndices(AddFrameMaterialDataImpl(matIndex, 1U), matData_);
     renderSubmesh.indices.materialIndex = matIndices.index;
     renderSubmesh.indices.materialFrameOffset = matIndices.frameOffset;
     const auto& matData = matData_.data[matIndices.index].md;
@@ -1372,6 +1811,7 @@ void RenderDataStoreDefaultMaterial::AddFrameSubmeshAdditionalMaterials(
 
 void RenderDataStoreDefaultMaterial::UpdateMeshData(const uint64_t id, const MeshDataWithHandleReference& meshData)
 {
+    meshDataGeneration_++;
     auto& md = meshData_;
     uint32_t index = ~0U;
 
@@ -1611,6 +2051,7 @@ void RenderDataStoreDefaultMaterial::AddSubmesh(const RenderSubmeshWithHandleRef
 #if (CORE3D_VALIDATION_ENABLED == 1)
     ValidateSubmesh(submesh);
 #endif
+    DropRetainedFrameData();
     const uint32_t submeshIndex = static_cast<uint32_t>(meshData_.frameSubmeshes.size());
     meshData_.frameSubmeshes.push_back(ConvertRenderSubmeshInput(submesh));
     auto& currSubmesh = meshData_.frameSubmeshes.back();
@@ -1972,6 +2413,10 @@ void RenderDataStoreDefaultMaterial::UpdateSubmeshRenderMaterialFlagByIndex(
         return;
     }
     auto& frameSubmeshMaterialFlags = meshData_.frameSubmeshMaterialFlags[submeshIndex];
+    // the kept retained frame data gets the original flags back for the next frame
+    if (retainedFrameData_.kept && (submeshIndex < retainedFrameData_.submeshCount)) {
+        retainedFrameData_.changedFlags.push_back({submeshIndex, frameSubmeshMaterialFlags});
+    }
     frameSubmeshMaterialFlags.renderMaterialFlags = flag;
     frameSubmeshMaterialFlags.renderHash = HashSubmeshMaterials(frameSubmeshMaterialFlags.materialType,
         frameSubmeshMaterialFlags.renderMaterialFlags,
@@ -1988,6 +2433,65 @@ array_view<const AsInstance> RenderDataStoreDefaultMaterial::GetMeshBlasData() c
     return meshData_.frameMeshBlasInstanceData;
 }
 
+refcnt_ptr<RenderDataStoreDefaultMaterial> RenderDataStoreDefaultMaterial::CreateFrameWriter()
+{
+    // retained render meshes need to be set again to the instance that the ECS writes to
+    retainedMeshes_ = {};
+    retainedFrameData_ = {};
+    retainedFrameLayout_ = {};
+    // mesh and material data is only updated when changed, move it to the side that the ECS writes to
+    auto writer = refcnt_ptr<RenderDataStoreDefaultMaterial>(new RenderDataStoreDefaultMaterial(renderContext_, name_));
+    writer->matData_ = AllMaterialData(matData_);
+    writer->meshData_ = AllMeshData(meshData_);
+    writer->materialDataGeneration_ = materialDataGeneration_;
+    return writer;
+}
+
+void RenderDataStoreDefaultMaterial::ReleaseFrameWriter(RenderDataStoreDefaultMaterial& writer)
+{
+    // the retained render meshes of the writer are dropped and set again by the ECS
+    matData_ = move(writer.matData_);
+    meshData_ = move(writer.meshData_);
+    materialDataGeneration_++;
+    retainedFrameData_ = {};
+    Clear();
+}
+
+void RenderDataStoreDefaultMaterial::PrepareFrameCommit(RenderDataStoreDefaultMaterial& writer)
+{
+    // processed on the ECS side so that PreRender() has nothing left to do
+    writer.SubmitFrameMeshData();
+}
+
+void RenderDataStoreDefaultMaterial::SwapFrameData(RenderDataStoreDefaultMaterial& writer)
+{
+    // material data is kept over frames, copy it only when it has changed
+    if (materialDataGeneration_ != writer.materialDataGeneration_) {
+        matData_ = AllMaterialData(writer.matData_);
+        materialDataGeneration_ = writer.materialDataGeneration_;
+    } else {
+        matData_.frameIndices.swap(writer.matData_.frameIndices);
+        matData_.baseMaterialCount = writer.matData_.baseMaterialCount;
+    }
+    // the writer gets the previous frame's buffers which it clears when it starts the next frame
+    meshData_.frameMeshData.swap(writer.meshData_.frameMeshData);
+    meshData_.frameJointMatrixIndices.swap(writer.meshData_.frameJointMatrixIndices);
+    meshData_.frameSkinIndices.swap(writer.meshData_.frameSkinIndices);
+    meshData_.frameSubmeshes.swap(writer.meshData_.frameSubmeshes);
+    meshData_.frameSubmeshMaterialFlags.swap(writer.meshData_.frameSubmeshMaterialFlags);
+    meshData_.frameMeshBlasInstanceData.swap(writer.meshData_.frameMeshBlasInstanceData);
+    meshData_.frameLightProbeInterpolatedData.swap(writer.meshData_.frameLightProbeInterpolatedData);
+    // joint matrix data points to the allocators
+    std::swap(meshJointMatricesAllocator_, writer.meshJointMatricesAllocator_);
+    std::swap(slotToSubmeshIndices_, writer.slotToSubmeshIndices_);
+    // the kept retained frame data goes with the frame data
+    std::swap(retainedFrameData_, writer.retainedFrameData_);
+    std::swap(frameHasRetainedMeshData_, writer.frameHasRetainedMeshData_);
+    renderFrameObjectInfo_ = writer.renderFrameObjectInfo_;
+    materialRenderSlots_ = writer.materialRenderSlots_;
+    frameMeshDataSubmitted_ = true;
+}
+
 // for plugin / factory interface
 refcnt_ptr<IRenderDataStore> RenderDataStoreDefaultMaterial::Create(
     RENDER_NS::IRenderContext& renderContext, const char* name)
@@ -31,6 +31,7 @@
 #include <base/util/uid.h>
 #include <render/device/intf_shader_manager.h>
 
+#include "render/datastore/render_data_store_frame_handoff.h"
 #include "util/linear_allocator.h"
 
 RENDER_BEGIN_NAMESPACE()
@@ -44,7 +45,9 @@ CORE3D_BEGIN_NAMESPACE()
 /**
 RenderDataStoreDefaultMaterial implementation.
 */
-class RenderDataStoreDefaultMaterial final : public IRenderDataStoreDefaultMaterial {
+class RenderDataStoreDefaultMaterial final
+    : public IRenderDataStoreDefaultMaterial,
+      public RenderDataStoreFrameBuffered<RenderDataStoreDefaultMaterial, IRenderDataStoreDefaultMaterial> {
 public:
     static constexpr uint64_t SLOT_SORT_HASH_MASK{0xFFFFffff};
     static constexpr uint64_t SLOT_SORT_HASH_SHIFT{32U};
@@ -110,6 +113,12 @@ public:
     void AddFrameRenderMeshData(const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData) override;
     void AddFrameRenderMeshData(const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData,
         const RenderMeshBatchData& batchData) override;
+    void AddFrameRenderMeshData(BASE_NS::array_view<const RenderMeshData> meshData,
+        const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData) override;
+
+    void SetRetainedRenderMeshData(uint64_t id, BASE_NS::array_view<const RenderMeshData> meshData,
+        const RenderMeshBatchData& batchData) override;
+    void DestroyRetainedRenderMeshData(uint64_t id) override;
 
     void UpdateMeshData(uint64_t id, const MeshDataWithHandleReference& meshData) override;
     void DestroyMeshData(uint64_t id) override;
@@ -296,6 +305,8 @@ public:
         uint32_t skinIndex{RenderSceneDataConstants::INVALID_INDEX};
         // typically used with skinning, otherwise ignored (with skinning in world space)
         RenderMinAndMax forcedAabb{};
+        // index of the retained render mesh instance, invalid for frame only render mesh data
+        uint32_t retainedInstance{RenderSceneDataConstants::INVALID_INDEX};
     };
     // container for MeshData and frame info
     struct MeshDataContainer {
@@ -332,6 +343,13 @@ public:
     };
 
 private:
+    // RenderDataStoreFrameBuffered
+    friend RenderDataStoreFrameBuffered;
+    BASE_NS::refcnt_ptr<RenderDataStoreDefaultMaterial> CreateFrameWriter();
+    void ReleaseFrameWriter(RenderDataStoreDefaultMaterial& writer);
+    void PrepareFrameCommit(RenderDataStoreDefaultMaterial& writer);
+    void SwapFrameData(RenderDataStoreDefaultMaterial& writer);
+
     uint32_t AddMaterialDataImpl(uint32_t matIndex,
         const RenderDataDefaultMaterial::InputMaterialUniforms& materialUniforms,
         const RenderDataDefaultMaterial::MaterialHandlesWithHandleReference& materialHandles,
@@ -339,6 +357,19 @@ private:
         const BASE_NS::array_view<const uint8_t> customData,
         const BASE_NS::array_view<const RENDER_NS::RenderHandleReference> customResourceData);
     void UpdateFrameMaterialResourceReferences(uint32_t materialIndex);
+    void AddFrameRenderMeshDataImpl(BASE_NS::array_view<const RenderMeshData> meshData,
+        const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData, uint32_t firstRetainedInstance);
+    RenderFrameMaterialIndices AddFrameMaterialDataImpl(uint32_t index, uint32_t instanceCount);
+    void ResetFrameMeshData();
+    bool RetainedFrameDataMatches() const;
+    bool CanBuildRetainedFrameData() const;
+    void BeginRetainedFrameData();
+    void EndRetainedFrameData();
+    void DropRetainedFrameData();
+    void PatchRetainedFrameData();
+    void PatchRetainedBatchBounds(uint32_t batchIndex, bool& recalculateShadowBounds);
+    void RecalculateRetainedShadowBounds();
+    void TrimRetainedPatches();
 
     void ValidateSubmeshIndices(RenderSubmesh& submesh);
     const RenderDataDefaultMaterial::MaterialData& EnsureSubmeshMaterialData(RenderSubmesh& submesh);
@@ -383,9 +414,98 @@ private:
         BASE_NS::vector<RenderDataDefaultMaterial::SlotMaterialData> materialData;
 
         RenderDataDefaultMaterial::ObjectCounts objectCounts;
+
+        // the first ones are from the retained frame data
+        uint32_t retainedCount{0U};
+        RenderDataDefaultMaterial::ObjectCounts retainedObjectCounts;
     };
     BASE_NS::unordered_map<uint32_t, SlotSubmeshData> slotToSubmeshIndices_;
 
+    struct RetainedRenderMesh {
+        uint64_t id{RenderSceneDataConstants::INVALID_ID};
+        RenderMeshBatchData batchData;
+        BASE_NS::vector<RenderMeshData> meshData;
+        // index of the first instance in RetainedFrameLayout::instanceFrameMeshes
+        uint32_t firstInstance{0U};
+        // patch generation of the latest change
+        uint64_t patchGeneration{0U};
+    };
+    struct RetainedRenderMeshes {
+        BASE_NS::vector<RetainedRenderMesh> data;
+        // render mesh id to index of data
+        BASE_NS::unordered_map<uint64_t, uint32_t> idToIndex;
+        // incremented when retained render meshes are created, destroyed or changed so that the frame data is rebuilt
+        uint64_t generation{0U};
+        // incremented when only the transforms or the custom data of a retained render mesh change
+        uint64_t patchGeneration{0U};
+        // patch generations with the changed render mesh index, has all the patches after patchesStart
+        BASE_NS::vector<BASE_NS::pair<uint64_t, uint32_t>> patches;
+        uint64_t patchesStart{0U};
+        // patch generation of the previous submission, with frame buffering the other frame data has it
+        uint64_t submittedPatchGeneration{0U};
+    };
+    RetainedRenderMeshes retainedMeshes_;
+    // frame data of the retained render meshes. it is kept at the start of the frame data over frames, and the patched
+    // render meshes are updated in place. with frame buffering it is swapped with the frame data.
+    struct RetainedFrameData {
+        uint32_t meshCount{0U};
+        uint32_t submeshCount{0U};
+        uint32_t materialFrameIndexCount{0U};
+        RenderFrameObjectInfo renderFrameObjectInfo;
+        SceneBoundingVolumeHelper shadowBoundingVolume;
+        // world aabbs of RetainedFrameLayout::submeshes
+        BASE_NS::vector<RenderMinAndMax> submeshAabbs;
+        // shadow bounds are recalculated from the submesh aabbs after this many patched submeshes
+        uint32_t shadowBoundsPatchCount{0U};
+        // original flags of the submeshes which were changed after submit (e.g. light probes)
+        BASE_NS::vector<BASE_NS::pair<uint32_t, RenderDataDefaultMaterial::SubmeshMaterialFlags>> changedFlags;
+
+        // generations of the data this was built from
+        uint64_t retainedMeshGeneration{~0ULL};
+        uint64_t retainedPatchGeneration{0U};
+        uint64_t materialDataGeneration{~0ULL};
+        uint64_t meshDataGeneration{~0ULL};
+        // the retained frame data is at the start of the frame data
+        bool kept{false};
+    };
+    RetainedFrameData retainedFrameData_;
+    // where the retained render meshes are in the frame data. it is the same for all the frame data built from the same
+    // retained meshes, meshes and materials.
+    struct RetainedFrameLayout {
+        // submitted submeshes of a batch of instances
+        struct Batch {
+            uint32_t meshIndex{0U};
+            uint32_t firstFrameMesh{0U};
+            uint32_t frameMeshCount{0U};
+            uint32_t firstSubmesh{0U};
+            uint32_t submeshCount{0U};
+        };
+        struct Submesh {
+            uint32_t submeshIndex{0U};
+            // the submesh and its additional material submeshes
+            uint32_t firstFrameSubmesh{0U};
+            uint32_t frameSubmeshCount{0U};
+            bool shadowCaster{false};
+        };
+        BASE_NS::vector<Batch> batches;
+        BASE_NS::vector<Submesh> submeshes;
+        // batch index of the frame meshes
+        BASE_NS::vector<uint32_t> frameMeshBatches;
+        // frame mesh index of the retained render mesh instances
+        BASE_NS::vector<uint32_t> instanceFrameMeshes;
+    };
+    RetainedFrameLayout retainedFrameLayout_;
+    // frame only render mesh data which is processed after the retained frame data is built
+    struct StashedFrameMeshData {
+        uint32_t meshIndex{0U};
+        BASE_NS::vector<RenderMeshBatchDataContainer> batchFrameMeshData;
+        BASE_NS::vector<RenderMeshBatchDataContainer> batchComponentFrameMeshData;
+        BASE_NS::vector<RenderMeshBatchDataContainer> frameMeshData;
+    };
+    BASE_NS::vector<StashedFrameMeshData> stashedFrameMeshData_;
+    RenderFrameObjectInfo stashedRenderFrameObjectInfo_;
+    BASE_NS::vector<uint32_t> patchedRetainedBatches_;
+
     MaterialRenderSlots materialRenderSlots_;
 
     // helpers
@@ -395,12 +515,21 @@ private:
     bool rtEnabled_{false};
     bool bindlessEnabled_{false};
     bool frameMeshDataSubmitted_{false};
+    // render mesh data was added for this frame only
+    bool frameHasImmediateMeshData_{false};
+    // the retained render meshes are in the frame data
+    bool frameHasRetainedMeshData_{false};
     bool canUpdateBaseMaterialCount_{true};
 
     SceneBoundingVolumeHelper shadowBoundingVolume_;
     // for bindless global resource indices
     MaterialHandleResourceIndices bindlessResourceIndices_;
 
+    // incremented when the material data kept over frames changes, the render side copy is updated on commit
+    uint64_t materialDataGeneration_{0U};
+    // incremented when mesh data changes
+    uint64_t meshDataGeneration_{0U};
+
     std::atomic_int32_t refcnt_{0};
     BASE_NS::array_view<const LightProbeGroupComponent::LightProbe> lightProbes_;
 };
@@ -16,6 +16,7 @@
 #include "render_data_store_default_scene.h"
 
 #include <cstdint>
+#include <utility>
 
 #include <3d/render/intf_render_data_store_default_scene.h>
 #include <base/containers/string.h>
@@ -30,9 +31,15 @@ using namespace RENDER_NS;
 RenderDataStoreDefaultScene::RenderDataStoreDefaultScene(const string_view name) : name_(name)
 {}
 
+void RenderDataStoreDefaultScene::PreRender()
+{
+    BeginFrameRead();
+}
+
 void RenderDataStoreDefaultScene::PostRender()
 {
     Clear();
+    EndFrameRead();
 }
 
 void RenderDataStoreDefaultScene::Clear()
@@ -90,6 +97,19 @@ RenderScene RenderDataStoreDefaultScene::GetScene() const
     }
 }
 
+refcnt_ptr<RenderDataStoreDefaultScene> RenderDataStoreDefaultScene::CreateFrameWriter()
+{
+    return refcnt_ptr<RenderDataStoreDefaultScene>(new RenderDataStoreDefaultScene(name_));
+}
+
+void RenderDataStoreDefaultScene::SwapFrameData(RenderDataStoreDefaultScene& writer)
+{
+    // the writer gets the previous frame's buffers which it clears when it starts the next frame
+    scenes_.swap(writer.scenes_);
+    std::swap(nameToScene_, writer.nameToScene_);
+    nextId = writer.nextId;
+}
+
 // for plugin / factory interface
 refcnt_ptr<IRenderDataStore> RenderDataStoreDefaultScene::Create(IRenderContext&, const char* name)
 {
@@ -26,6 +26,8 @@
 #include <base/containers/vector.h>
 #include <base/util/uid.h>
 
+#include "render/datastore/render_data_store_frame_handoff.h"
+
 RENDER_BEGIN_NAMESPACE()
 class IRenderContext;
 RENDER_END_NAMESPACE()
@@ -34,14 +36,15 @@ CORE3D_BEGIN_NAMESPACE()
 /**
 RenderDataStoreDefaultScene implementation.
 */
-class RenderDataStoreDefaultScene final : public IRenderDataStoreDefaultScene {
+class RenderDataStoreDefaultScene final
+    : public IRenderDataStoreDefaultScene,
+      public RenderDataStoreFrameBuffered<RenderDataStoreDefaultScene, IRenderDataStoreDefaultScene> {
 public:
     explicit RenderDataStoreDefaultScene(const BASE_NS::string_view name);
     ~RenderDataStoreDefaultScene() override = default;
 
     // IRenderDataStore
-    void PreRender() override
-    {}
+    void PreRender() override;
     // Reset and start indexing from the beginning. i.e. frame boundary reset.
     void PostRender() override;
     void PreRenderBackend() override
@@ -82,8 +85,14 @@ public:
     static BASE_NS::refcnt_ptr<IRenderDataStore> Create(RENDER_NS::IRenderContext& renderContext, const char* name);
 
 private:
+    // RenderDataStoreFrameBuffered
+    friend RenderDataStoreFrameBuffered;
+    BASE_NS::refcnt_ptr<RenderDataStoreDefaultScene> CreateFrameWriter();
+    void SwapFrameData(RenderDataStoreDefaultScene& writer);
+
     BASE_NS::string name_;
 
+
     BASE_NS::vector<RenderScene> scenes_;
     BASE_NS::unordered_map<BASE_NS::string, size_t> nameToScene_;
     uint32_t nextId{0u};
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE__RENDER__NODE_DATA__RENDER_DATA_STORE_FRAME_HANDOFF_H
+#define CORE__RENDER__NODE_DATA__RENDER_DATA_STORE_FRAME_HANDOFF_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include <3d/namespace.h>
+#include <base/containers/refcnt_ptr.h>
+#include <base/containers/shared_ptr.h>
+
+CORE3D_BEGIN_NAMESPACE()
+/**
+Synchronizes double-buffered render data stores.
+With frame buffering the ECS writes to separate writer instances of the data stores while the render nodes read the
+instances registered to the render data store manager. The data stores filled by one system share a handoff, so the
+written frames are swapped to the render side together under LockIdle(). That only waits if the render nodes are still
+reading the previous frame, and a render frame starting during the swap waits until all the data stores have been
+swapped. The ECS can therefore be one frame ahead of rendering and the render nodes never see data of two ECS frames.
+A frame which has not been rendered yet is replaced by the newer one.
+*/
+class RenderDataStoreFrameHandoff {
+public:
+    // Render side, called from PreRender() of the registered data stores. The first data store to begin starts reading
+    // the frame and the last one to end finishes it.
+    void BeginRead()
+    {
+        const std::lock_guard lock(mutex_);
+        ++readers_;
+    }
+
+    // Render side, called from PostRender() of the registered data stores.
+    void EndRead()
+    {
+        {
+            const std::lock_guard lock(mutex_);
+            if (readers_ == 0U || --readers_ != 0U) {
+                return;
+            }
+        }
+        readDone_.notify_all();
+    }
+
+    // ECS side. Render nodes cannot start reading while the returned lock is held.
+    std::unique_lock<std::mutex> LockIdle()
+    {
+        std::unique_lock lock(mutex_);
+        readDone_.wait(lock, [this]() { return readers_ == 0U; });
+        return lock;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable readDone_;
+    uint32_t readers_{0U};
+};
+
+/**
+Frame buffering for a render data store, DataStore derives from this.
+The ECS writes to GetFrameWriter(). The owner of the handoff hands the frame to rendering by calling
+PrepareFrameSwap() for each data store, and SwapFrame() for each while holding the handoff's LockIdle(). The
+registered instance calls BeginFrameRead() from PreRender() and EndFrameRead() from PostRender(). DataStore implements
+- BASE_NS::refcnt_ptr<DataStore> CreateFrameWriter(), called when buffering is enabled,
+- void SwapFrameData(DataStore& writer), moves the written frame to the registered instance,
+and optionally
+- void ReleaseFrameWriter(DataStore& writer), called when buffering is disabled,
+- void PrepareFrameCommit(DataStore& writer), called on the ECS side before waiting for the render nodes.
+All but PrepareFrameCommit() are called while the render nodes are idle, the first two after DataStore::Clear().
+*/
+template<typename DataStore, typename Interface>
+class RenderDataStoreFrameBuffered {
+public:
+    // Starts buffering with frames handed over through frameHandoff. The caller holds frameHandoff.LockIdle(). Without
+    // buffering the ECS and the render nodes don't access the data store at the same time, so the previous handoff
+    // is idle as well.
+    void EnableFrameBuffering(const BASE_NS::shared_ptr<RenderDataStoreFrameHandoff>& frameHandoff)
+    {
+        if (frameWriter_ || !frameHandoff) {
+            return;
+        }
+        auto& self = static_cast<DataStore&>(*this);
+        if (frameHandoff_ != frameHandoff) {
+            frameHandoff_ = frameHandoff;
+        }
+        self.Clear();
+        frameWriter_ = self.CreateFrameWriter();
+    }
+
+    // Stops buffering, the ECS writes directly to the registered instance again. The caller holds LockIdle() of the
+    // handoff given to EnableFrameBuffering(). The handoff is kept so that a frame being begun stays balanced.
+    void DisableFrameBuffering()
+    {
+        if (!frameWriter_) {
+            return;
+        }
+        auto& self = static_cast<DataStore&>(*this);
+        self.Clear();
+        self.ReleaseFrameWriter(*frameWriter_);
+        frameWriter_.reset();
+    }
+
+    Interface& GetFrameWriter()
+    {
+        if (frameWriter_) {
+            return *frameWriter_;
+        }
+        return static_cast<DataStore&>(*this);
+    }
+
+    // ECS side work before the handoff's LockIdle().
+    void PrepareFrameSwap()
+    {
+        if (frameWriter_) {
+            static_cast<DataStore&>(*this).PrepareFrameCommit(*frameWriter_);
+        }
+    }
+
+    // Moves the written frame to the registered instance. The caller holds the handoff's LockIdle().
+    void SwapFrame()
+    {
+        if (frameWriter_) {
+            static_cast<DataStore&>(*this).SwapFrameData(*frameWriter_);
+        }
+    }
+
+protected:
+    void ReleaseFrameWriter(DataStore&) {}
+    void PrepareFrameCommit(DataStore&) {}
+
+    void BeginFrameRead()
+    {
+        readHandoff_ = frameHandoff_;
+        if (readHandoff_) {
+            readHandoff_->BeginRead();
+        }
+    }
+    void EndFrameRead()
+    {
+        if (readHandoff_) {
+            readHandoff_->EndRead();
+            readHandoff_.reset();
+        }
+    }
+
+    BASE_NS::refcnt_ptr<DataStore> frameWriter_;
+
+private:
+    // set by the ECS side while the render side is idle.
+    BASE_NS::shared_ptr<RenderDataStoreFrameHandoff> frameHandoff_;
+    // render side, the handoff of the frame being read.
+    BASE_NS::shared_ptr<RenderDataStoreFrameHandoff> readHandoff_;
+};
+
+/** Returns the frame writer if dataStore is a frame buffered DataStore, otherwise dataStore itself. */
+template<typename DataStore, typename Interface>
+Interface& GetFrameWriter(Interface& dataStore)
+{
+    if (dataStore.GetTypeName() == DataStore::TYPE_NAME) {
+        return static_cast<DataStore&>(dataStore).GetFrameWriter();
+    }
+    return dataStore;
+}
+CORE3D_END_NAMESPACE()
+
+#endif  // CORE__RENDER__NODE_DATA__RENDER_DATA_STORE_FRAME_HANDOFF_H
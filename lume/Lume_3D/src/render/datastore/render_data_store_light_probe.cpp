@@ -62,6 +62,7 @@ bool RenderDataStoreLightProbe::BuildTetrahedralMesh(uint64_t lightProbeId)
     BowyerWatsonDelaunay3D delaunay3D;
     delaunay3D.BuildTetrahedralMesh(bwLightProbeDelaunay);
     l->second.volume.tetrahedrons = l->second.tetVec;
+    l->second.index.Build(l->second.volume);
     return !l->second.volume.tetrahedrons.empty();
 }
 
@@ -73,6 +74,7 @@ void RenderDataStoreLightProbe::AddLightProbes(
         PLUGIN_LOG_W("override light probe with id");
         l->second.volume.lightProbes = lightProbes;
         l->second.volume.tetrahedrons = {};
+        l->second.index.Clear();
         return;
     }
 
@@ -101,6 +103,12 @@ LightProbeVolumeOpt RenderDataStoreLightProbe::GetLightProbeVolume(uint64_t ligh
     return result;
 }
 
+const LightProbeVolumeIndex* RenderDataStoreLightProbe::GetLightProbeVolumeIndex(uint64_t lightProbeEntity) const
+{
+    auto it = lightProbeVolume_.find(lightProbeEntity);
+    return (it != lightProbeVolume_.end()) ? &it->second.index : nullptr;
+}
+
 // for plugin / factory interface
 refcnt_ptr<RENDER_NS::IRenderDataStore> RenderDataStoreLightProbe::Create(RENDER_NS::IRenderContext&, const char* name)
 {
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <util/light_probe_util.h>
+#include <util/light_probe_volume_index.h>
 
 #include <3d/light_probe_types/light_probe.h>
 #include <3d/light_probe_types/light_probe_constants.h>
@@ -79,6 +80,10 @@ public:
     bool BuildTetrahedralMesh(uint64_t lightProbeId) override;
 
     LightProbeVolumeOpt GetLightProbeVolume(uint64_t lightProbeEntity) const override;
+
+    /** Lookup acceleration structure of the volume, nullptr if the volume is not found. The index is empty until the
+     * tetrahedral mesh has been built. */
+    const LightProbeVolumeIndex* GetLightProbeVolumeIndex(uint64_t lightProbeEntity) const;
     static constexpr const char* const TYPE_NAME = "RenderDataStoreLightProbe";
     static BASE_NS::refcnt_ptr<RENDER_NS::IRenderDataStore> Create(
         RENDER_NS::IRenderContext& renderContext, const char* name);
@@ -88,6 +93,7 @@ private:
     struct LightProbeVolumeBindTetVec {
         LightProbeVolume volume;
         BASE_NS::vector<Tetrahedron> tetVec;
+        LightProbeVolumeIndex index;
     };
 
     BASE_NS::unordered_map<uint64_t, LightProbeVolumeBindTetVec> lightProbeVolume_;
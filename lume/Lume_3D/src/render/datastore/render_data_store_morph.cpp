@@ -33,9 +33,15 @@ void RenderDataStoreMorph::Init(const IRenderDataStoreMorph::ReserveSize& reserv
     submeshes_.reserve(reserveSize.submeshCount);
 }
 
+void RenderDataStoreMorph::PreRender()
+{
+    BeginFrameRead();
+}
+
 void RenderDataStoreMorph::PostRender()
 {
     Clear();
+    EndFrameRead();
 }
 
 void RenderDataStoreMorph::Clear()
@@ -71,6 +77,18 @@ array_view<const RenderDataMorph::Submesh> RenderDataStoreMorph::GetSubmeshes()
     return submeshes_;
 }
 
+refcnt_ptr<RenderDataStoreMorph> RenderDataStoreMorph::CreateFrameWriter()
+{
+    return refcnt_ptr<RenderDataStoreMorph>(new RenderDataStoreMorph(name_));
+}
+
+void RenderDataStoreMorph::SwapFrameData(RenderDataStoreMorph& writer)
+{
+    // the morphing system does not clear the data store, the writer is cleared here for the next frame
+    submeshes_.swap(writer.submeshes_);
+    writer.Clear();
+}
+
 // for plugin / factory interface
 refcnt_ptr<IRenderDataStore> RenderDataStoreMorph::Create(RENDER_NS::IRenderContext&, const char* name)
 {
@@ -27,6 +27,8 @@
 #include <base/containers/vector.h>
 #include <base/util/uid.h>
 
+#include "render/datastore/render_data_store_frame_handoff.h"
+
 RENDER_BEGIN_NAMESPACE()
 class IRenderContext;
 RENDER_END_NAMESPACE()
@@ -35,7 +37,9 @@ CORE3D_BEGIN_NAMESPACE()
 /**
 RenderDataStoreMorph implementation.
 */
-class RenderDataStoreMorph final : public IRenderDataStoreMorph {
+class RenderDataStoreMorph final
+    : public IRenderDataStoreMorph,
+      public RenderDataStoreFrameBuffered<RenderDataStoreMorph, IRenderDataStoreMorph> {
 public:
     explicit RenderDataStoreMorph(const BASE_NS::string_view name);
     ~RenderDataStoreMorph() override = default;
@@ -43,8 +47,7 @@ public:
     void Init(const IRenderDataStoreMorph::ReserveSize& reserveSize);
 
     // IRenderDataStore
-    void PreRender() override
-    {}
+    void PreRender() override;
     // Reset and start indexing from the beginning. i.e. frame boundary reset.
     void PostRender() override;
     void PreRenderBackend() override
@@ -86,6 +89,11 @@ public:
     static BASE_NS::refcnt_ptr<IRenderDataStore> Create(RENDER_NS::IRenderContext& renderContext, const char* name);
 
 private:
+    // RenderDataStoreFrameBuffered
+    friend RenderDataStoreFrameBuffered;
+    BASE_NS::refcnt_ptr<RenderDataStoreMorph> CreateFrameWriter();
+    void SwapFrameData(RenderDataStoreMorph& writer);
+
     const BASE_NS::string name_;
 
     BASE_NS::vector<RenderDataMorph::Submesh> submeshes_;
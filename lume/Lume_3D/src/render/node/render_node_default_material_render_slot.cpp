@@ -28,6 +28,7 @@
 #include <base/math/vector.h>
 #include <core/namespace.h>
 #include <core/plugin/intf_class_register.h>
+#include <core/threading/intf_thread_pool.h>
 #include <render/datastore/intf_render_data_store.h>
 #include <render/datastore/intf_render_data_store_manager.h>
 #include <render/datastore/intf_render_data_store_pod.h>
@@ -166,6 +167,7 @@ RenderDataDefaultMaterial::SubmeshMaterialFlags GetSubmeshMaterialFlags(
 void RenderNodeDefaultMaterialRenderSlot::InitNode(IRenderNodeContextManager& renderNodeContextMgr)
 {
     renderNodeContextMgr_ = &renderNodeContextMgr;
+    slotSubmeshScratch_.threadPool = renderNodeContextMgr.GetRenderNodeContextInterface<CORE_NS::IThreadPool>();
 
     // get flags
     bindlessEnabled_ = false;
@@ -772,7 +774,8 @@ void RenderNodeDefaultMaterialRenderSlot::ProcessSlotSubmeshes(
         currentScene_.camData.cameraIdx,
         currentScene_.mvCameraIndices,
         rsi,
-        sortedSlotSubmeshes_);
+        sortedSlotSubmeshes_,
+        slotSubmeshScratch_);
 }
 
 array_view<const DynamicStateEnum> RenderNodeDefaultMaterialRenderSlot::GetDynamicStates() const
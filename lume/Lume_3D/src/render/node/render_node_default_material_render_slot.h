@@ -217,6 +217,7 @@ protected:
 
     RENDER_NS::RenderPostProcessConfiguration currentRenderPPConfiguration_;
     BASE_NS::vector<SlotSubmeshIndex> sortedSlotSubmeshes_;
+    RenderNodeSceneUtil::RenderSlotSubmeshScratch slotSubmeshScratch_;
 };
 CORE3D_END_NAMESPACE()
 
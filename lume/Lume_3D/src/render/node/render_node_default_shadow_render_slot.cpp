@@ -28,6 +28,7 @@
 #include <base/math/vector_util.h>
 #include <core/namespace.h>
 #include <core/plugin/intf_class_register.h>
+#include <core/threading/intf_thread_pool.h>
 #include <render/datastore/intf_render_data_store.h>
 #include <render/datastore/intf_render_data_store_manager.h>
 #include <render/device/intf_gpu_resource_manager.h>
@@ -191,6 +192,7 @@ FrameGlobalDescriptorSets GetFrameGlobalDescriptorSets(
 void RenderNodeDefaultShadowRenderSlot::InitNode(IRenderNodeContextManager& renderNodeContextMgr)
 {
     renderNodeContextMgr_ = &renderNodeContextMgr;
+    slotSubmeshScratch_.threadPool = renderNodeContextMgr.GetRenderNodeContextInterface<CORE_NS::IThreadPool>();
     // get flags
     bindlessEnabled_ = false;
     IRenderContext& renderContext = renderNodeContextMgr_->GetRenderContext();
@@ -801,7 +803,7 @@ void RenderNodeDefaultShadowRenderSlot::ProcessSlotSubmeshes(const IRenderDataSt
     const IRenderNodeSceneUtil::RenderSlotInfo rsi{
         currentScene_.renderSlotId, jsonInputs_.sortType, jsonInputs_.cullType, 0};
     RenderNodeSceneUtil::GetRenderSlotSubmeshes(
-        dataStoreCamera, dataStoreMaterial, cameraIndex, {}, rsi, sortedSlotSubmeshes_);
+        dataStoreCamera, dataStoreMaterial, cameraIndex, {}, rsi, sortedSlotSubmeshes_, slotSubmeshScratch_);
 }
 
 void RenderNodeDefaultShadowRenderSlot::ParseRenderNodeInputs()
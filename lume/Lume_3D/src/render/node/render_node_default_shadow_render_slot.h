@@ -173,6 +173,7 @@ private:
 
     RENDER_NS::RenderPass renderPass_;
     BASE_NS::vector<SlotSubmeshIndex> sortedSlotSubmeshes_;
+    RenderNodeSceneUtil::RenderSlotSubmeshScratch slotSubmeshScratch_;
 
     bool validShadowNode_{true};
     bool bindlessEnabled_{false};
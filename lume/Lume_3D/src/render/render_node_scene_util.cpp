@@ -17,6 +17,11 @@
 
 #include <algorithm>
 #include <cinttypes>
+#if defined(BASE_SIMD) && defined(_M_X64)
+#include <immintrin.h>
+#elif defined(BASE_SIMD) && (defined(_M_ARM64) || defined(__ARM_ARCH_ISA_A64))
+#include <arm_neon.h>
+#endif
 
 #include <3d/render/intf_render_data_store_default_camera.h>
 #include <3d/render/intf_render_data_store_default_material.h>
@@ -28,6 +33,7 @@
 #include <core/namespace.h>
 #include <core/plugin/intf_plugin_register.h>
 #include <core/util/intf_frustum_util.h>
+#include <core/util/parallel_for.h>
 #include <render/datastore/intf_render_data_store_manager.h>
 #include <render/device/intf_gpu_resource_manager.h>
 #include <render/device/pipeline_state_desc.h>
@@ -166,22 +172,255 @@ void UpdateCameraFlags(const RenderCamera& camera, RenderPass& renderPass)
     }
 }
 
-bool IsObjectCulled(IFrustumUtil& frustumUtil, const Frustum& camFrustum, const array_view<const Frustum> addFrustums,
-    const RenderSubmesh& submesh)
+// Bounding spheres of the candidate submeshes in structure-of-arrays layout, used for culling and depth computation.
+struct CandidateSpheres {
+    const float* data{nullptr};
+    size_t count{0U};
+
+    const float* CenterX() const
+    {
+        return data;
+    }
+    const float* CenterY() const
+    {
+        return data + count;
+    }
+    const float* CenterZ() const
+    {
+        return data + count * 2U;
+    }
+    const float* Radius() const
+    {
+        return data + count * 3U;
+    }
+};
+
+CandidateSpheres GatherCandidateSpheres(const array_view<const RenderSubmesh> submeshes,
+    const array_view<const uint32_t> slotSubmeshIndices, const array_view<const uint32_t> candidates,
+    vector<float>& sphereData)
+{
+    const size_t count = candidates.size();
+    sphereData.resize(count * 4U);
+    float* centerX = sphereData.data();
+    float* centerY = centerX + count;
+    float* centerZ = centerY + count;
+    float* radius = centerZ + count;
+    for (size_t i = 0; i < count; ++i) {
+        const auto& bounds = submeshes[slotSubmeshIndices[candidates[i]]].bounds;
+        centerX[i] = bounds.worldCenter.x;
+        centerY[i] = bounds.worldCenter.y;
+        centerZ[i] = bounds.worldCenter.z;
+        radius[i] = bounds.worldRadius;
+    }
+    return CandidateSpheres{sphereData.data(), count};
+}
+
+// candidate spheres per culling task, a multiple of the visibility word size.
+constexpr size_t CULL_TASK_SIZE{4096U};
+
+// Culls the candidate submeshes against the camera frustum (first) and the additional frustums. Bit i of visibility is
+// set if candidate i is visible in any of the frustums. The candidates are split into tasks of whole visibility words
+// which test their spheres against all the frustums into their own block of frustumVisibility. The calling thread runs
+// tasks too, so this completes even if the pool threads are busy with other render nodes.
+void CullSubmeshes(IThreadPool* threadPool, const IFrustumUtil& frustumUtil, const array_view<const Frustum> frustums,
+    const CandidateSpheres& spheres, vector<uint64_t>& frustumVisibility, vector<uint64_t>& visibility)
+{
+    constexpr size_t bitsPerWord = 64U;
+    constexpr size_t taskWordCount = CULL_TASK_SIZE / bitsPerWord;
+    const size_t count = spheres.count;
+    const size_t tasks = (count + CULL_TASK_SIZE - 1U) / CULL_TASK_SIZE;
+
+    frustumVisibility.resize(tasks * frustums.size() * taskWordCount);
+    visibility.resize((count + bitsPerWord - 1U) / bitsPerWord);
+    ParallelFor(threadPool, tasks,
+        [&frustumUtil, frustums, &spheres, &frustumVisibility, &visibility, count](size_t task) {
+            const size_t begin = task * CULL_TASK_SIZE;
+            const size_t size = Math::min(CULL_TASK_SIZE, count - begin);
+            const size_t wordCount = (size + bitsPerWord - 1U) / bitsPerWord;
+            uint64_t* frustumWords = frustumVisibility.data() + task * frustums.size() * taskWordCount;
+            uint64_t* words = visibility.data() + begin / bitsPerWord;
+            const BoundingSpheres bounds{{spheres.CenterX() + begin, size}, {spheres.CenterY() + begin, size},
+                {spheres.CenterZ() + begin, size}, {spheres.Radius() + begin, size}};
+            if (!frustumUtil.SphereFrustumCollision(frustums, bounds, {frustumWords, frustums.size() * wordCount})) {
+                std::fill(words, words + wordCount, ~0ULL);
+                return;
+            }
+            // if culled by main camera check additional cameras
+            std::copy(frustumWords, frustumWords + wordCount, words);
+            for (size_t frustum = 1U; frustum < frustums.size(); ++frustum) {
+                const uint64_t* additionalWords = frustumWords + frustum * wordCount;
+                for (size_t word = 0U; word < wordCount; ++word) {
+                    words[word] |= additionalWords[word];
+                }
+            }
+        });
+}
+
+// Absolute view space depth of each candidate sphere center.
+void ComputeViewDepths(const Math::Mat4X4& view, const CandidateSpheres& spheres, vector<float>& depths)
+{
+    const size_t count = spheres.count;
+    depths.resize(count);
+    const float* centerX = spheres.CenterX();
+    const float* centerY = spheres.CenterY();
+    const float* centerZ = spheres.CenterZ();
+    float* depth = depths.data();
+    size_t i = 0U;
+#if defined(BASE_SIMD) && defined(_M_X64)
+    const __m128 rowX = _mm_set1_ps(view.x.z);
+    const __m128 rowY = _mm_set1_ps(view.y.z);
+    const __m128 rowZ = _mm_set1_ps(view.z.z);
+    const __m128 rowW = _mm_set1_ps(view.w.z);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    for (; (i + 4U) <= count; i += 4U) {
+        __m128 z = _mm_add_ps(_mm_mul_ps(rowX, _mm_loadu_ps(centerX + i)), rowW);
+        z = _mm_add_ps(z, _mm_mul_ps(rowY, _mm_loadu_ps(centerY + i)));
+        z = _mm_add_ps(z, _mm_mul_ps(rowZ, _mm_loadu_ps(centerZ + i)));
+        _mm_storeu_ps(depth + i, _mm_andnot_ps(signMask, z));
+    }
+#elif defined(BASE_SIMD) && (defined(_M_ARM64) || defined(__ARM_ARCH_ISA_A64))
+    const float32x4_t rowW = vdupq_n_f32(view.w.z);
+    for (; (i + 4U) <= count; i += 4U) {
+        float32x4_t z = vmlaq_n_f32(rowW, vld1q_f32(centerX + i), view.x.z);
+        z = vmlaq_n_f32(z, vld1q_f32(centerY + i), view.y.z);
+        z = vmlaq_n_f32(z, vld1q_f32(centerZ + i), view.z.z);
+        vst1q_f32(depth + i, vabsq_f32(z));
+    }
+#endif
+    for (; i < count; ++i) {
+        depth[i] =
+            Math::abs((view.x.z * centerX[i]) + view.w.z + (view.y.z * centerY[i]) + (view.z.z * centerZ[i]));
+    }
+}
+
+using RadixSortEntry = RenderNodeSceneUtil::SlotSortEntry;
+
+constexpr uint32_t RADIX_BITS{8U};
+constexpr uint32_t RADIX_BUCKET_COUNT{1U << RADIX_BITS};
+constexpr uint32_t RADIX_KEY_DIGIT_COUNT{64U / RADIX_BITS};
+constexpr uint32_t RADIX_DIGIT_COUNT{RADIX_KEY_DIGIT_COUNT + 32U / RADIX_BITS};
+// below this a comparison sort is faster than going through the histograms.
+constexpr size_t RADIX_SORT_MIN_COUNT{256U};
+// entries per task of the parallel radix sort, smaller slots are sorted on the calling thread.
+constexpr size_t RADIX_SORT_TASK_SIZE{8192U};
+
+inline uint32_t GetRadixDigit(const RadixSortEntry& entry, const uint32_t digit)
+{
+    if (digit < RADIX_KEY_DIGIT_COUNT) {
+        return static_cast<uint32_t>(entry.key >> (digit * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1U);
+    }
+    return (entry.layer >> ((digit - RADIX_KEY_DIGIT_COUNT) * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1U);
+}
+
+// Radix sort passes split into task ranges. Every task counts the digits of its own range and then scatters the range
+// to offsets which come after the same digits of the preceding ranges, so each pass stays stable. The calling thread
+// runs ranges too, so this completes even if the pool threads are busy with other render nodes.
+void RadixSortPassesParallel(IThreadPool& threadPool, const array_view<const uint32_t> digits, const size_t count,
+    RadixSortEntry*& src, RadixSortEntry*& dst, vector<uint32_t>& taskHistograms)
 {
-    bool notCulled =
-        frustumUtil.SphereFrustumCollision(camFrustum, submesh.bounds.worldCenter, submesh.bounds.worldRadius);
-    if (!notCulled) {
-        // if culled by main camera check additional cameras
-        for (const auto& fRef : addFrustums) {
-            notCulled =
-                frustumUtil.SphereFrustumCollision(fRef, submesh.bounds.worldCenter, submesh.bounds.worldRadius);
-            if (notCulled) {
-                break;
+    const size_t tasks = (count + RADIX_SORT_TASK_SIZE - 1U) / RADIX_SORT_TASK_SIZE;
+    taskHistograms.resize(tasks * RADIX_BUCKET_COUNT);
+    uint32_t* histograms = taskHistograms.data();
+    for (const uint32_t digit : digits) {
+        const RadixSortEntry* in = src;
+        RadixSortEntry* out = dst;
+        ParallelFor(&threadPool, tasks, [histograms, in, count, digit](size_t task) {
+            uint32_t* histogram = histograms + task * RADIX_BUCKET_COUNT;
+            std::fill(histogram, histogram + RADIX_BUCKET_COUNT, 0U);
+            const size_t begin = task * RADIX_SORT_TASK_SIZE;
+            const size_t end = Math::min(begin + RADIX_SORT_TASK_SIZE, count);
+            for (size_t idx = begin; idx < end; ++idx) {
+                histogram[GetRadixDigit(in[idx], digit)]++;
+            }
+        });
+        uint32_t offset = 0U;
+        for (uint32_t bucket = 0U; bucket < RADIX_BUCKET_COUNT; ++bucket) {
+            for (size_t task = 0U; task < tasks; ++task) {
+                uint32_t& histogram = histograms[task * RADIX_BUCKET_COUNT + bucket];
+                const uint32_t bucketSize = histogram;
+                histogram = offset;
+                offset += bucketSize;
             }
         }
+        ParallelFor(&threadPool, tasks, [histograms, in, out, count, digit](size_t task) {
+            uint32_t* histogram = histograms + task * RADIX_BUCKET_COUNT;
+            const size_t begin = task * RADIX_SORT_TASK_SIZE;
+            const size_t end = Math::min(begin + RADIX_SORT_TASK_SIZE, count);
+            for (size_t idx = begin; idx < end; ++idx) {
+                out[histogram[GetRadixDigit(in[idx], digit)]++] = in[idx];
+            }
+        });
+        std::swap(src, dst);
     }
-    return !notCulled;
+}
+
+// LSD radix sort by sortLayerKey and then by sortKey. Digits which are the same for every entry (e.g. unused layer
+// bits or the high bits of small depths) don't change the order and are skipped.
+void RadixSortSlotSubmeshes(vector<SlotSubmeshIndex>& submeshIndices, const bool descendingSortKey,
+    RenderNodeSceneUtil::RenderSlotSubmeshScratch& scratch)
+{
+    const size_t count = submeshIndices.size();
+    const uint64_t keyFlip = descendingSortKey ? ~0ULL : 0ULL;
+    auto& entries = scratch.sortEntries;
+    entries.resize(count * 2U);
+    RadixSortEntry* src = entries.data();
+    RadixSortEntry* dst = src + count;
+    RadixSortEntry anyBits{0U, 0U, 0U};
+    RadixSortEntry allBits{~0ULL, ~0U, 0U};
+    for (size_t idx = 0; idx < count; ++idx) {
+        const RadixSortEntry entry{
+            submeshIndices[idx].sortKey ^ keyFlip, submeshIndices[idx].sortLayerKey, static_cast<uint32_t>(idx)};
+        src[idx] = entry;
+        anyBits.key |= entry.key;
+        anyBits.layer |= entry.layer;
+        allBits.key &= entry.key;
+        allBits.layer &= entry.layer;
+    }
+    const RadixSortEntry varyingBits{anyBits.key ^ allBits.key, anyBits.layer ^ allBits.layer, 0U};
+    uint32_t digits[RADIX_DIGIT_COUNT];
+    uint32_t digitCount = 0U;
+    for (uint32_t digit = 0U; digit < RADIX_DIGIT_COUNT; ++digit) {
+        if (GetRadixDigit(varyingBits, digit) != 0U) {
+            digits[digitCount++] = digit;
+        }
+    }
+
+    if (scratch.threadPool && (count >= (RADIX_SORT_TASK_SIZE * 2U))) {
+        RadixSortPassesParallel(*scratch.threadPool, {digits, digitCount}, count, src, dst, scratch.radixHistograms);
+    } else {
+        uint32_t histograms[RADIX_DIGIT_COUNT][RADIX_BUCKET_COUNT]{};
+        for (size_t idx = 0; idx < count; ++idx) {
+            for (uint32_t pass = 0U; pass < digitCount; ++pass) {
+                histograms[pass][GetRadixDigit(src[idx], digits[pass])]++;
+            }
+        }
+        for (uint32_t pass = 0U; pass < digitCount; ++pass) {
+            uint32_t* histogram = histograms[pass];
+            uint32_t offset = 0U;
+            for (uint32_t bucket = 0U; bucket < RADIX_BUCKET_COUNT; ++bucket) {
+                const uint32_t bucketSize = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += bucketSize;
+            }
+            const uint32_t digit = digits[pass];
+            for (size_t idx = 0; idx < count; ++idx) {
+                dst[histogram[GetRadixDigit(src[idx], digit)]++] = src[idx];
+            }
+            std::swap(src, dst);
+        }
+    }
+
+    auto& sorted = scratch.sortedSubmeshes;
+    sorted.resize(count);
+    const size_t tasks = (count + RADIX_SORT_TASK_SIZE - 1U) / RADIX_SORT_TASK_SIZE;
+    ParallelFor(scratch.threadPool, tasks, [&sorted, &submeshIndices, src, count](size_t task) {
+        const size_t begin = task * RADIX_SORT_TASK_SIZE;
+        const size_t end = Math::min(begin + RADIX_SORT_TASK_SIZE, count);
+        for (size_t idx = begin; idx < end; ++idx) {
+            sorted[idx] = submeshIndices[src[idx].index];
+        }
+    });
+    submeshIndices.swap(sorted);
 }
 
 inline constexpr RenderSlotCullType GetRenderSlotBaseCullType(
@@ -292,6 +531,16 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
     const IRenderDataStoreDefaultMaterial& dataStoreMaterial, const uint32_t cameraIndex,
     const array_view<const uint32_t> addCameraIndices, const IRenderNodeSceneUtil::RenderSlotInfo& renderSlotInfo,
     vector<SlotSubmeshIndex>& refSubmeshIndices)
+{
+    RenderSlotSubmeshScratch scratch;
+    GetRenderSlotSubmeshes(
+        dataStoreCamera, dataStoreMaterial, cameraIndex, addCameraIndices, renderSlotInfo, refSubmeshIndices, scratch);
+}
+
+void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCamera& dataStoreCamera,
+    const IRenderDataStoreDefaultMaterial& dataStoreMaterial, const uint32_t cameraIndex,
+    const array_view<const uint32_t> addCameraIndices, const IRenderNodeSceneUtil::RenderSlotInfo& renderSlotInfo,
+    vector<SlotSubmeshIndex>& refSubmeshIndices, RenderSlotSubmeshScratch& scratch)
 {
     // Get IFrustumUtil from global plugin registry.
     auto frustumUtil = CORE3D_NS::GetInstance<IFrustumUtil>(UID_FRUSTUM_UTIL);
@@ -308,7 +557,8 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
     uint64_t camLayerMask{RenderSceneDataConstants::INVALID_ID};
     uint32_t camLevel{0U};
     uint32_t camReflection{0U};
-    Frustum camFrustum;
+    auto& frustums = scratch.frustums;
+    frustums.clear();
     bool reflectionCamera = false;
     const auto& cameras = dataStoreCamera.GetCameras();
     const uint32_t maxCameraCount = static_cast<uint32_t>(cameras.size());
@@ -326,15 +576,17 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
         reflectionCamera = cam.flags & RenderCamera::CameraFlagBits::CAMERA_FLAG_REFLECTION_BIT;
         rsCullType = GetRenderSlotBaseCullType(rsCullType, cam);
         if (rsCullType == RenderSlotCullType::VIEW_FRUSTUM_CULL) {
-            camFrustum = frustumUtil->CreateFrustum(cam.matrices.proj * cam.matrices.view);
+            frustums.push_back(frustumUtil->CreateFrustum(cam.matrices.proj * cam.matrices.view));
         }
     }
-    vector<Frustum> addFrustums;
     if (rsCullType == RenderSlotCullType::VIEW_FRUSTUM_CULL) {
-        addFrustums.reserve(addCameraIndices.size());
+        // the camera frustum is always first, default constructed without a valid camera.
+        if (frustums.empty()) {
+            frustums.emplace_back();
+        }
         for (const auto& indexRef : addCameraIndices) {
             if (indexRef < maxCameraCount) {
-                addFrustums.push_back(
+                frustums.push_back(
                     frustumUtil->CreateFrustum(cameras[indexRef].matrices.proj * cameras[indexRef].matrices.view));
             }
         }
@@ -350,12 +602,13 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
     const auto& slotSubmeshMatData = dataStoreMaterial.GetSlotSubmeshMaterialData(renderSlotInfo.id);
     const auto& submeshes = dataStoreMaterial.GetSubmeshes();
 
-    refSubmeshIndices.clear();
-    refSubmeshIndices.reserve(slotSubmeshIndices.size());
+    // Skip mesh if it's not in the same scene, layer, or in case of a planar reflection camera the plane itself. The
+    // remaining meshes are frustum culled as one batch.
+    auto& candidates = scratch.candidates;
+    candidates.clear();
+    candidates.reserve(slotSubmeshIndices.size());
     for (size_t idx = 0; idx < slotSubmeshIndices.size(); ++idx) {
-        const uint32_t submeshIndex = slotSubmeshIndices[idx];
-        const auto& submesh = submeshes[submeshIndex];
-        // Skip mesh if it's not in the same scene, layer, or in case of a planar reflection camera the plane itself.
+        const auto& submesh = submeshes[slotSubmeshIndices[idx]];
         if (camLevel != submesh.layers.sceneId) {
             continue;
         }
@@ -365,16 +618,31 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
         if ((camLayerMask & submesh.layers.layerMask) == 0U) {
             continue;
         }
+        candidates.push_back(static_cast<uint32_t>(idx));
+    }
+    const CandidateSpheres spheres =
+        GatherCandidateSpheres(submeshes, slotSubmeshIndices, candidates, scratch.spheres);
+    auto& visibility = scratch.visibility;
+    if (rsCullType == RenderSlotCullType::VIEW_FRUSTUM_CULL) {
+        CullSubmeshes(scratch.threadPool, *frustumUtil, frustums, spheres, scratch.frustumVisibility, visibility);
+    }
+    auto& depths = scratch.depths;
+    ComputeViewDepths(camView, spheres, depths);
+
+    refSubmeshIndices.clear();
+    refSubmeshIndices.reserve(candidates.size());
+    for (size_t candidate = 0; candidate < candidates.size(); ++candidate) {
+        const uint32_t idx = candidates[candidate];
+        const uint32_t submeshIndex = slotSubmeshIndices[idx];
         const auto& submeshMatData = slotSubmeshMatData[idx];
         const bool notCulled =
             ((submeshMatData.renderMaterialFlags & RenderMaterialFlagBits::RENDER_MATERIAL_CAMERA_EFFECT_BIT) ||
                 (rsCullType != RenderSlotCullType::VIEW_FRUSTUM_CULL) ||
-                (!IsObjectCulled(*frustumUtil, camFrustum, addFrustums, submesh)));
+                ((visibility[candidate / 64U] >> (candidate % 64U)) & 1U));
         const bool discardedMat = (submeshMatData.renderMaterialFlags & renderSlotInfo.materialDiscardFlags);
         if (notCulled && (!discardedMat)) {
-            const Math::Vec4 pos = (camView * Math::Vec4(submesh.bounds.worldCenter, 1.0f));
-            const float zVal = Math::abs(pos.z);
-            uint64_t sortKey = Math::min(maxUDepth, static_cast<uint64_t>(double(zVal) * camSortCoefficient));
+            uint64_t sortKey =
+                Math::min(maxUDepth, static_cast<uint64_t>(double(depths[candidate]) * camSortCoefficient));
             if (renderSlotInfo.sortType == RenderSlotSortType::BY_MATERIAL) {
                 // High 32bits for render sort hash, Low 32bits for depth
                 sortKey |= (((uint64_t)submeshMatData.renderSortHash & sRenderMask) << sRenderShift);
@@ -396,19 +664,13 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
         // 3. Sort groups from front to back order based on distance
 
         // First sort by material, so identical materials grouped together
-        std::sort(refSubmeshIndices.begin(), refSubmeshIndices.end(), Less<SlotSubmeshIndex>());
-
-        struct MaterialGroup {
-            // Denotes a range in refSubmeshIndices
-            uint32_t submeshesStart = 0;
-            uint32_t submeshesSize = 0;
-            uint32_t sortLayerKey = 0U;
-            uint32_t renderSortHash = 0;
-            uint32_t minDepth = UINT32_MAX;
-        };
+        SortSlotSubmeshes(refSubmeshIndices, false, scratch);
+
+        using MaterialGroup = SlotMaterialGroup;
 
         // Determine materials closest to camera
-        vector<MaterialGroup> materialGroups;
+        auto& materialGroups = scratch.materialGroups;
+        materialGroups.clear();
         {
             MaterialGroup* group = &materialGroups.emplace_back();
 
@@ -442,7 +704,8 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
         });
 
         // Create new sorted array
-        vector<SlotSubmeshIndex> sortedSubmeshIndices(refSubmeshIndices.size());
+        auto& sortedSubmeshIndices = scratch.sortedSubmeshes;
+        sortedSubmeshIndices.resize(refSubmeshIndices.size());
         auto sortedIt = sortedSubmeshIndices.begin();
         for (auto& matGroup : materialGroups) {
             const auto itBegin = refSubmeshIndices.begin() + matGroup.submeshesStart;
@@ -451,13 +714,33 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
             sortedIt += matGroup.submeshesSize;
         }
 
-        refSubmeshIndices = std::move(sortedSubmeshIndices);
+        refSubmeshIndices.swap(sortedSubmeshIndices);
     } else if (renderSlotInfo.sortType == RenderSlotSortType::FRONT_TO_BACK) {
         // front-to-back render layer sort is 0 -> 63
-        std::sort(refSubmeshIndices.begin(), refSubmeshIndices.end(), Less<SlotSubmeshIndex>());
+        SortSlotSubmeshes(refSubmeshIndices, false, scratch);
     } else if (renderSlotInfo.sortType == RenderSlotSortType::BACK_TO_FRONT) {
         // back-to-front render layer sort is 63 -> 0
-        std::sort(refSubmeshIndices.begin(), refSubmeshIndices.end(), Greater<SlotSubmeshIndex>());
+        SortSlotSubmeshes(refSubmeshIndices, true, scratch);
+    }
+}
+
+void RenderNodeSceneUtil::SortSlotSubmeshes(vector<SlotSubmeshIndex>& submeshIndices, const bool descendingSortKey)
+{
+    RenderSlotSubmeshScratch scratch;
+    SortSlotSubmeshes(submeshIndices, descendingSortKey, scratch);
+}
+
+void RenderNodeSceneUtil::SortSlotSubmeshes(
+    vector<SlotSubmeshIndex>& submeshIndices, const bool descendingSortKey, RenderSlotSubmeshScratch& scratch)
+{
+    if (submeshIndices.size() < RADIX_SORT_MIN_COUNT) {
+        if (descendingSortKey) {
+            std::sort(submeshIndices.begin(), submeshIndices.end(), Greater<SlotSubmeshIndex>());
+        } else {
+            std::sort(submeshIndices.begin(), submeshIndices.end(), Less<SlotSubmeshIndex>());
+        }
+    } else {
+        RadixSortSlotSubmeshes(submeshIndices, descendingSortKey, scratch);
     }
 }
 
@@ -22,10 +22,15 @@
 #include <3d/render/render_data_defines_3d.h>
 #include <base/containers/array_view.h>
 #include <base/containers/vector.h>
+#include <core/util/intf_frustum_util.h>
 #include <render/datastore/render_data_store_render_pods.h>
 #include <render/device/pipeline_state_desc.h>
 #include <render/render_data_structures.h>
 
+CORE_BEGIN_NAMESPACE()
+class IThreadPool;
+CORE_END_NAMESPACE()
+
 RENDER_BEGIN_NAMESPACE()
 class IRenderNodeUtil;
 class IRenderNodeContextManager;
@@ -75,11 +80,54 @@ public:
     static void UpdateRenderPassFromCamera(const RenderCamera& camera, RENDER_NS::RenderPass& renderPass);
     static void UpdateRenderPassFromCustomCamera(
         const RenderCamera& camera, const bool isNamedCamera, RENDER_NS::RenderPass& renderPass);
+    /** Radix sort entry, key is the sort key, flipped for descending order. */
+    struct SlotSortEntry {
+        uint64_t key;
+        uint32_t layer;
+        uint32_t index;
+    };
+    /** Range of submeshes with the same material in a material sorted slot. */
+    struct SlotMaterialGroup {
+        uint32_t submeshesStart{0U};
+        uint32_t submeshesSize{0U};
+        uint32_t sortLayerKey{0U};
+        uint32_t renderSortHash{0U};
+        uint32_t minDepth{UINT32_MAX};
+    };
+    /** Working memory of GetRenderSlotSubmeshes. Render nodes keep one to avoid allocating every frame. */
+    struct RenderSlotSubmeshScratch {
+        BASE_NS::vector<CORE_NS::Frustum> frustums;
+        BASE_NS::vector<uint32_t> candidates;
+        BASE_NS::vector<float> spheres;
+        BASE_NS::vector<uint64_t> visibility;
+        // per task and frustum visibility of the culling tasks.
+        BASE_NS::vector<uint64_t> frustumVisibility;
+        BASE_NS::vector<float> depths;
+        BASE_NS::vector<SlotSortEntry> sortEntries;
+        BASE_NS::vector<SlotMaterialGroup> materialGroups;
+        // sorting permutes into this and swaps it with the output.
+        BASE_NS::vector<SlotSubmeshIndex> sortedSubmeshes;
+        // per task digit counts of the parallel radix sort.
+        BASE_NS::vector<uint32_t> radixHistograms;
+        // large slots are culled and sorted with this pool when set, otherwise on the calling thread.
+        CORE_NS::IThreadPool* threadPool{nullptr};
+    };
+
     static void GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCamera& dataStoreCamera,
         const IRenderDataStoreDefaultMaterial& dataStoreMaterial, const uint32_t cameraIndex,
         const BASE_NS::array_view<const uint32_t> addCameraIndices,
         const IRenderNodeSceneUtil::RenderSlotInfo& renderSlotInfo,
         BASE_NS::vector<SlotSubmeshIndex>& refSubmeshIndices);
+    static void GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCamera& dataStoreCamera,
+        const IRenderDataStoreDefaultMaterial& dataStoreMaterial, const uint32_t cameraIndex,
+        const BASE_NS::array_view<const uint32_t> addCameraIndices,
+        const IRenderNodeSceneUtil::RenderSlotInfo& renderSlotInfo,
+        BASE_NS::vector<SlotSubmeshIndex>& refSubmeshIndices, RenderSlotSubmeshScratch& scratch);
+    // sorts ascending by sortLayerKey and then by sortKey, descending by sortKey if descendingSortKey is true.
+    // large slots use a radix sort, so the order of submeshes with identical keys is not defined.
+    static void SortSlotSubmeshes(BASE_NS::vector<SlotSubmeshIndex>& submeshIndices, bool descendingSortKey);
+    static void SortSlotSubmeshes(BASE_NS::vector<SlotSubmeshIndex>& submeshIndices, bool descendingSortKey,
+        RenderSlotSubmeshScratch& scratch);
 
     static SceneBufferHandles GetSceneBufferHandles(
         RENDER_NS::IRenderNodeContextManager& renderNodeContextMgr, const BASE_NS::string_view sceneName);
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/aabb_tree.h"
+
+#include <algorithm>
+
+#include <base/math/mathf.h>
+#include <base/math/vector_util.h>
+
+CORE3D_BEGIN_NAMESPACE()
+using namespace BASE_NS;
+
+void AabbTree::Build(array_view<const MinAndMax> bounds)
+{
+    Clear();
+    if (bounds.empty()) {
+        return;
+    }
+
+    const auto count = static_cast<uint32_t>(bounds.size());
+    vector<Math::Vec3> centers;
+    centers.reserve(count);
+    items_.reserve(count);
+    for (uint32_t i = 0U; i < count; ++i) {
+        centers.push_back((bounds[i].minAABB + bounds[i].maxAABB) * 0.5f);
+        items_.push_back(i);
+    }
+    // a binary tree with n leaves has 2n-1 nodes.
+    nodes_.reserve(((count + MAX_LEAF_ITEMS - 1U) / MAX_LEAF_ITEMS) * 2U);
+    BuildNode(bounds, centers, 0U, count, 0U);
+}
+
+uint32_t AabbTree::BuildNode(array_view<const MinAndMax> bounds, array_view<const Math::Vec3> centers, uint32_t begin,
+    uint32_t end, uint32_t depth)
+{
+    const auto index = static_cast<uint32_t>(nodes_.size());
+    nodes_.push_back({});
+
+    MinAndMax nodeBounds;
+    MinAndMax centerBounds;
+    for (uint32_t i = begin; i < end; ++i) {
+        const auto item = items_[i];
+        nodeBounds.minAABB = Math::min(nodeBounds.minAABB, bounds[item].minAABB);
+        nodeBounds.maxAABB = Math::max(nodeBounds.maxAABB, bounds[item].maxAABB);
+        centerBounds.minAABB = Math::min(centerBounds.minAABB, centers[item]);
+        centerBounds.maxAABB = Math::max(centerBounds.maxAABB, centers[item]);
+    }
+    nodes_[index].minAABB = nodeBounds.minAABB;
+    nodes_[index].maxAABB = nodeBounds.maxAABB;
+
+    // split at the median of the item centers along the longest axis.
+    const Math::Vec3 extents = centerBounds.maxAABB - centerBounds.minAABB;
+    uint32_t axis = 0U;
+    if (extents.y > extents.x) {
+        axis = 1U;
+    }
+    if (extents.z > extents[axis]) {
+        axis = 2U;
+    }
+    if (((end - begin) <= MAX_LEAF_ITEMS) || (extents[axis] <= 0.0f) || ((depth + 1U) >= MAX_DEPTH)) {
+        nodes_[index].offset = begin;
+        nodes_[index].count = end - begin;
+        return index;
+    }
+
+    const uint32_t middle = begin + (end - begin) / 2U;
+    std::nth_element(items_.begin() + begin, items_.begin() + middle, items_.begin() + end,
+        [centers, axis](uint32_t lhs, uint32_t rhs) { return centers[lhs][axis] < centers[rhs][axis]; });
+
+    BuildNode(bounds, centers, begin, middle, depth + 1U);
+    const uint32_t second = BuildNode(bounds, centers, middle, end, depth + 1U);
+    nodes_[index].offset = second;
+    nodes_[index].count = 0U;
+    return index;
+}
+
+void AabbTree::Refit(array_view<const MinAndMax> bounds)
+{
+    if (bounds.size() != items_.size()) {
+        Build(bounds);
+        return;
+    }
+    // children are always after their parent so walking backwards updates them before the parent.
+    for (auto i = nodes_.size(); i > 0U; --i) {
+        Node& node = nodes_[i - 1U];
+        if (node.count) {
+            MinAndMax nodeBounds;
+            for (uint32_t j = node.offset, end = node.offset + node.count; j < end; ++j) {
+                nodeBounds.minAABB = Math::min(nodeBounds.minAABB, bounds[items_[j]].minAABB);
+                nodeBounds.maxAABB = Math::max(nodeBounds.maxAABB, bounds[items_[j]].maxAABB);
+            }
+            node.minAABB = nodeBounds.minAABB;
+            node.maxAABB = nodeBounds.maxAABB;
+        } else {
+            const Node& first = nodes_[i];
+            const Node& second = nodes_[node.offset];
+            node.minAABB = Math::min(first.minAABB, second.minAABB);
+            node.maxAABB = Math::max(first.maxAABB, second.maxAABB);
+        }
+    }
+}
+
+void AabbTree::Clear()
+{
+    nodes_.clear();
+    items_.clear();
+}
+CORE3D_END_NAMESPACE()
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CORE_UTIL_AABB_TREE_H
+#define CORE_UTIL_AABB_TREE_H
+
+#include <cstdint>
+#include <limits>
+
+#include <3d/namespace.h>
+#include <3d/util/intf_picking.h>
+#include <base/containers/array_view.h>
+#include <base/containers/vector.h>
+#include <base/math/mathf.h>
+#include <base/math/vector.h>
+#include <base/math/vector_util.h>
+
+CORE3D_BEGIN_NAMESPACE()
+/** Bounding volume hierarchy over axis aligned boxes.
+ * Items are identified by their index in the array given to Build. The nodes are stored in depth-first order so that
+ * the first child of an inner node directly follows it, which allows refitting the boxes with a single backwards pass
+ * when the items move but the set of items stays the same.
+ */
+class AabbTree {
+public:
+    struct Node {
+        BASE_NS::Math::Vec3 minAABB;
+        /** Inner node: index of the second child. Leaf: index of the first item in the item array. */
+        uint32_t offset;
+        BASE_NS::Math::Vec3 maxAABB;
+        /** Number of items in a leaf, zero for inner nodes. */
+        uint32_t count;
+    };
+
+    AabbTree() = default;
+    ~AabbTree() = default;
+
+    /** Build the tree for the given boxes. */
+    void Build(BASE_NS::array_view<const MinAndMax> bounds);
+
+    /** Update the node boxes after the item boxes have changed. The number of items must match the one used in Build.
+     */
+    void Refit(BASE_NS::array_view<const MinAndMax> bounds);
+
+    void Clear();
+
+    bool Empty() const
+    {
+        return nodes_.empty();
+    }
+
+    size_t GetItemCount() const
+    {
+        return items_.size();
+    }
+
+    /** Call visitor(itemIndex) for every item in the leaves which the ray hits. The node test is conservative: every
+     * item whose box the ray hits is visited, but the visitor must still test the item itself.
+     * @param start Ray origin.
+     * @param invDirection Component wise inverse of the ray direction.
+     * @param visitor Callable taking an uint32_t item index.
+     */
+    template<typename Visitor>
+    void RayCast(const BASE_NS::Math::Vec3& start, const BASE_NS::Math::Vec3& invDirection, Visitor&& visitor) const
+    {
+        if (nodes_.empty()) {
+            return;
+        }
+        // the tree is balanced so the depth stays well below the stack size.
+        uint32_t stack[MAX_DEPTH];
+        uint32_t stackSize = 0U;
+        uint32_t current = 0U;
+        for (;;) {
+            const Node& node = nodes_[current];
+            if (IntersectRay(node, start, invDirection)) {
+                if (node.count == 0U) {
+                    stack[stackSize++] = node.offset;
+                    ++current;
+                    continue;
+                }
+                for (uint32_t i = node.offset, end = node.offset + node.count; i < end; ++i) {
+                    visitor(items_[i]);
+                }
+            }
+            if (stackSize == 0U) {
+                break;
+            }
+            current = stack[--stackSize];
+        }
+    }
+
+    /** Call visitor(itemIndex) for every item in the leaves whose box contains the point, until the visitor returns
+     * true.
+     * @param point Point to look up.
+     * @param visitor Callable taking an uint32_t item index and returning true to stop the query.
+     */
+    template<typename Visitor>
+    void Query(const BASE_NS::Math::Vec3& point, Visitor&& visitor) const
+    {
+        if (nodes_.empty()) {
+            return;
+        }
+        uint32_t stack[MAX_DEPTH];
+        uint32_t stackSize = 0U;
+        uint32_t current = 0U;
+        for (;;) {
+            const Node& node = nodes_[current];
+            if (Contains(node, point)) {
+                if (node.count == 0U) {
+                    stack[stackSize++] = node.offset;
+                    ++current;
+                    continue;
+                }
+                for (uint32_t i = node.offset, end = node.offset + node.count; i < end; ++i) {
+                    if (visitor(items_[i])) {
+                        return;
+                    }
+                }
+            }
+            if (stackSize == 0U) {
+                break;
+            }
+            current = stack[--stackSize];
+        }
+    }
+
+    /** Call visitor(itemIndex) for the items in the leaves closer to the point than the squared distance which the
+     * visitor returned last. The closer child of a node is visited first, so the limit shrinks quickly when searching
+     * for the nearest items.
+     * @param point Point to search around.
+     * @param visitor Callable taking an uint32_t item index and returning the squared distance within which items are
+     * still of interest.
+     */
+    template<typename Visitor>
+    void Nearest(const BASE_NS::Math::Vec3& point, Visitor&& visitor) const
+    {
+        if (nodes_.empty()) {
+            return;
+        }
+        struct Entry {
+            uint32_t node;
+            float distance2;
+        };
+        Entry stack[MAX_DEPTH];
+        uint32_t stackSize = 0U;
+        Entry current{0U, Distance2(nodes_[0U], point)};
+        float limit = std::numeric_limits<float>::max();
+        for (;;) {
+            if (current.distance2 <= limit) {
+                const Node& node = nodes_[current.node];
+                if (node.count == 0U) {
+                    Entry first{current.node + 1U, Distance2(nodes_[current.node + 1U], point)};
+                    Entry second{node.offset, Distance2(nodes_[node.offset], point)};
+                    if (second.distance2 < first.distance2) {
+                        stack[stackSize++] = first;
+                        current = second;
+                    } else {
+                        stack[stackSize++] = second;
+                        current = first;
+                    }
+                    continue;
+                }
+                for (uint32_t i = node.offset, end = node.offset + node.count; i < end; ++i) {
+                    limit = visitor(items_[i]);
+                }
+            }
+            if (stackSize == 0U) {
+                break;
+            }
+            current = stack[--stackSize];
+        }
+    }
+
+private:
+    static constexpr uint32_t MAX_LEAF_ITEMS = 4U;
+    static constexpr uint32_t MAX_DEPTH = 64U;
+
+    static bool IntersectRay(const Node& node, const BASE_NS::Math::Vec3& start, const BASE_NS::Math::Vec3& invDir)
+    {
+        // same slab test as the per item test, but only the result is needed.
+        const float tx1 = (node.minAABB.x - start.x) * invDir.x;
+        const float tx2 = (node.maxAABB.x - start.x) * invDir.x;
+        float tmin = BASE_NS::Math::min(tx1, tx2);
+        float tmax = BASE_NS::Math::max(tx1, tx2);
+
+        const float ty1 = (node.minAABB.y - start.y) * invDir.y;
+        const float ty2 = (node.maxAABB.y - start.y) * invDir.y;
+        tmin = BASE_NS::Math::max(tmin, BASE_NS::Math::min(ty1, ty2));
+        tmax = BASE_NS::Math::min(tmax, BASE_NS::Math::max(ty1, ty2));
+
+        const float tz1 = (node.minAABB.z - start.z) * invDir.z;
+        const float tz2 = (node.maxAABB.z - start.z) * invDir.z;
+        tmin = BASE_NS::Math::max(tmin, BASE_NS::Math::min(tz1, tz2));
+        tmax = BASE_NS::Math::min(tmax, BASE_NS::Math::max(tz1, tz2));
+
+        return tmax >= tmin && tmax > 0.0f;
+    }
+
+    static bool Contains(const Node& node, const BASE_NS::Math::Vec3& point)
+    {
+        return (point.x >= node.minAABB.x) && (point.x <= node.maxAABB.x) && (point.y >= node.minAABB.y) &&
+               (point.y <= node.maxAABB.y) && (point.z >= node.minAABB.z) && (point.z <= node.maxAABB.z);
+    }
+
+    static float Distance2(const Node& node, const BASE_NS::Math::Vec3& point)
+    {
+        const BASE_NS::Math::Vec3 outside = BASE_NS::Math::max(
+            BASE_NS::Math::max(node.minAABB - point, point - node.maxAABB), BASE_NS::Math::Vec3(0.0f, 0.0f, 0.0f));
+        return BASE_NS::Math::SqrMagnitude(outside);
+    }
+
+    uint32_t BuildNode(BASE_NS::array_view<const MinAndMax> bounds,
+        BASE_NS::array_view<const BASE_NS::Math::Vec3> centers, uint32_t begin, uint32_t end, uint32_t depth);
+
+    BASE_NS::vector<Node> nodes_;
+    BASE_NS::vector<uint32_t> items_;
+};
+CORE3D_END_NAMESPACE()
+
+#endif  // CORE_UTIL_AABB_TREE_H
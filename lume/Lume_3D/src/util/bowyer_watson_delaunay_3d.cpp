@@ -19,12 +19,103 @@
 #include <array>
 #include <cmath>
 #include <limits>
-#include <map>
 #include <util/log.h>
+#include <utility>
 
 #include <3d/light_probe_types/light_probe_constants.h>
+#include <base/math/vector_util.h>
 
 CORE3D_BEGIN_NAMESPACE()
+namespace {
+constexpr uint32_t VERTEX_COUNT = LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT;
+constexpr uint32_t HILBERT_BITS = 16U;
+constexpr uint32_t CAVITY_STAMP_COUNT = 2U;
+
+// Index along a 3D Hilbert curve (Skilling, "Programming the Hilbert curve").
+uint64_t HilbertIndex(uint32_t x, uint32_t y, uint32_t z)
+{
+    uint32_t axes[3U] = {x, y, z};
+    for (uint32_t q = 1U << (HILBERT_BITS - 1U); q > 1U; q >>= 1U) {
+        const uint32_t p = q - 1U;
+        for (uint32_t i = 0U; i < 3U; ++i) {
+            if (axes[i] & q) {
+                axes[0U] ^= p;
+            } else {
+                const uint32_t t = (axes[0U] ^ axes[i]) & p;
+                axes[0U] ^= t;
+                axes[i] ^= t;
+            }
+        }
+    }
+    axes[1U] ^= axes[0U];
+    axes[2U] ^= axes[1U];
+    uint32_t t = 0U;
+    for (uint32_t q = 1U << (HILBERT_BITS - 1U); q > 1U; q >>= 1U) {
+        if (axes[2U] & q) {
+            t ^= q - 1U;
+        }
+    }
+    uint64_t index = 0U;
+    for (uint32_t bit = HILBERT_BITS; bit > 0U; --bit) {
+        for (uint32_t i = 0U; i < 3U; ++i) {
+            index = (index << 1U) | (((axes[i] ^ t) >> (bit - 1U)) & 1U);
+        }
+    }
+    return index;
+}
+
+// Positive when d is on the side of the plane abc where (b - a) x (c - a) points to.
+double Orient(const BASE_NS::Math::Vec3& a, const BASE_NS::Math::Vec3& b, const BASE_NS::Math::Vec3& c,
+    const BASE_NS::Math::Vec3& d)
+{
+    const double bax = static_cast<double>(b.x) - a.x;
+    const double bay = static_cast<double>(b.y) - a.y;
+    const double baz = static_cast<double>(b.z) - a.z;
+    const double cax = static_cast<double>(c.x) - a.x;
+    const double cay = static_cast<double>(c.y) - a.y;
+    const double caz = static_cast<double>(c.z) - a.z;
+    const double dax = static_cast<double>(d.x) - a.x;
+    const double day = static_cast<double>(d.y) - a.y;
+    const double daz = static_cast<double>(d.z) - a.z;
+    return dax * (bay * caz - baz * cay) + day * (baz * cax - bax * caz) + daz * (bax * cay - bay * cax);
+}
+
+// Positive when e is inside the circumsphere of the positively oriented tetrahedron abcd.
+double InSphere(const BASE_NS::Math::Vec3& a, const BASE_NS::Math::Vec3& b, const BASE_NS::Math::Vec3& c,
+    const BASE_NS::Math::Vec3& d, const BASE_NS::Math::Vec3& e)
+{
+    const double aex = static_cast<double>(a.x) - e.x;
+    const double aey = static_cast<double>(a.y) - e.y;
+    const double aez = static_cast<double>(a.z) - e.z;
+    const double bex = static_cast<double>(b.x) - e.x;
+    const double bey = static_cast<double>(b.y) - e.y;
+    const double bez = static_cast<double>(b.z) - e.z;
+    const double cex = static_cast<double>(c.x) - e.x;
+    const double cey = static_cast<double>(c.y) - e.y;
+    const double cez = static_cast<double>(c.z) - e.z;
+    const double dex = static_cast<double>(d.x) - e.x;
+    const double dey = static_cast<double>(d.y) - e.y;
+    const double dez = static_cast<double>(d.z) - e.z;
+
+    const double ab = aex * bey - bex * aey;
+    const double bc = bex * cey - cex * bey;
+    const double cd = cex * dey - dex * cey;
+    const double da = dex * aey - aex * dey;
+    const double ac = aex * cey - cex * aey;
+    const double bd = bex * dey - dex * bey;
+
+    const double abc = aez * bc - bez * ac + cez * ab;
+    const double bcd = bez * cd - cez * bd + dez * bc;
+    const double cda = cez * da + dez * ac + aez * cd;
+    const double dab = dez * ab + aez * bd + bez * da;
+
+    const double aLift = aex * aex + aey * aey + aez * aez;
+    const double bLift = bex * bex + bey * bey + bez * bez;
+    const double cLift = cex * cex + cey * cey + cez * cez;
+    const double dLift = dex * dex + dey * dey + dez * dez;
+    return (cLift * dab - dLift * abc) + (aLift * bcd - bLift * cda);
+}
+}  // namespace
 
 void BowyerWatsonDelaunay3D::BuildTetrahedralMesh(LightProbeVolume& lightProbeVolume)
 {
@@ -46,19 +137,58 @@ void BowyerWatsonDelaunay3D::BuildTetrahedralMesh(LightProbeVolume& lightProbeVo
         allPoints_.push_back(probe.position);
     }
 
-    CreateSuperTetrahedron(lightProbeVolume);
+    const auto pointCount = static_cast<uint32_t>(lightProbeVolume.lightProbes.size());
+    SortInsertionOrder(pointCount);
+    CreateSuperTetrahedron();
 
-    for (uint32_t i = 0; i < static_cast<uint32_t>(lightProbeVolume.lightProbes.size()); ++i) {
-        InsertPoint(i, lightProbeVolume);
+    for (const uint32_t pointIndex : insertionOrder_) {
+        InsertPoint(pointIndex);
     }
     RemoveSuperTetrahedron(lightProbeVolume);
     allPoints_.clear();
+    insertionOrder_.clear();
+    cells_.clear();
+    freeCells_.clear();
+    cellStamps_.clear();
+    vertexStamps_.clear();
     PLUGIN_LOG_I("BowyerWatson: Generated %zu tetrahedra from %zu light probes",
         lightProbeVolume.tetrahedrons.size(),
         lightProbeVolume.lightProbes.size());
 }
 
-void BowyerWatsonDelaunay3D::CreateSuperTetrahedron(LightProbeVolume& lightProbeVolume)
+void BowyerWatsonDelaunay3D::SortInsertionOrder(uint32_t pointCount)
+{
+    BASE_NS::Math::Vec3 minP{
+        std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    BASE_NS::Math::Vec3 maxP{std::numeric_limits<float>::lowest(),
+        std::numeric_limits<float>::lowest(),
+        std::numeric_limits<float>::lowest()};
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        minP = BASE_NS::Math::min(minP, allPoints_[i]);
+        maxP = BASE_NS::Math::max(maxP, allPoints_[i]);
+    }
+    const BASE_NS::Math::Vec3 range = maxP - minP;
+    const float maxRange = std::max({range.x, range.y, range.z});
+    const float scale = (maxRange > 0.0f) ? (static_cast<float>((1U << HILBERT_BITS) - 1U) / maxRange) : 0.0f;
+
+    // Consecutive points along the curve are close to each other, so the walk to the next point is short.
+    BASE_NS::vector<std::pair<uint64_t, uint32_t>> keys;
+    keys.reserve(pointCount);
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        const BASE_NS::Math::Vec3 p = (allPoints_[i] - minP) * scale;
+        const uint64_t key =
+            HilbertIndex(static_cast<uint32_t>(p.x), static_cast<uint32_t>(p.y), static_cast<uint32_t>(p.z));
+        keys.push_back({key, i});
+    }
+    std::sort(keys.begin(), keys.end());
+    insertionOrder_.clear();
+    insertionOrder_.reserve(pointCount);
+    for (const auto& key : keys) {
+        insertionOrder_.push_back(key.second);
+    }
+}
+
+void BowyerWatsonDelaunay3D::CreateSuperTetrahedron()
 {
     BASE_NS::Math::Vec3 minP{
         std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
@@ -94,83 +224,295 @@ void BowyerWatsonDelaunay3D::CreateSuperTetrahedron(LightProbeVolume& lightProbe
         allPoints_.push_back(superTet.vertices[i]);
     }
 
-    ComputeCircumsphere(superTet, lightProbeVolume);
-    lightProbeVolume.tetrahedrons.push_back(superTet);
+    ComputeCircumsphere(superTet);
+    cells_.clear();
+    freeCells_.clear();
+    cellStamps_.clear();
+    // the vertices are positively oriented and all neighbors are outside the hull.
+    cells_.push_back({superTet, {INVALID_INDEX, INVALID_INDEX, INVALID_INDEX, INVALID_INDEX}, true});
+    cellStamps_.push_back(0U);
+    cavityStamp_ = 0U;
+    vertexStamps_.clear();
+    vertexStamps_.resize(allPoints_.size(), 0U);
+    vertexStamp_ = 0U;
+    lastCell_ = 0U;
 }
 
-void BowyerWatsonDelaunay3D::InsertPoint(uint32_t pointIndex, LightProbeVolume& lightProbeVolume)
+void BowyerWatsonDelaunay3D::InsertPoint(uint32_t pointIndex)
 {
     const BASE_NS::Math::Vec3& point = allPoints_[pointIndex];
 
-    BASE_NS::vector<uint32_t> badTetrahedra;
-
-    for (uint32_t i = 0; i < static_cast<uint32_t>(lightProbeVolume.tetrahedrons.size()); ++i) {
-        float distSquared = BASE_NS::Math::Distance2(point, lightProbeVolume.tetrahedrons[i].circumcenter);
-        float circumRadiusSquared = lightProbeVolume.tetrahedrons[i].circumradiusSquared;
-        float tolerance = std::max(circumRadiusSquared * 1e-4f, 1e-5f);
-
-        if (distSquared <= circumRadiusSquared + tolerance) {
-            badTetrahedra.push_back(i);
+    // The tetrahedron containing the point always has the point inside its circumsphere. If rounding says otherwise
+    // any tetrahedron in conflict will do.
+    uint32_t seed = LocatePoint(point);
+    if ((seed == INVALID_INDEX) || !InCircumsphere(seed, point)) {
+        seed = INVALID_INDEX;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(cells_.size()); ++i) {
+            if (cells_[i].alive && InCircumsphere(i, point)) {
+                seed = i;
+                break;
+            }
+        }
+    }
+    if (seed == INVALID_INDEX) {
+        return;
+    }
+    for (const auto& vertex : cells_[seed].tet.vertices) {
+        if (vertex == point) {
+            // duplicate points are skipped.
+            return;
         }
     }
 
-    if (badTetrahedra.empty()) {
+    GrowCavity(seed, point);
+    if (cavity_.empty()) {
+        // the point is too close to the faces of the cavity to be inserted.
         return;
     }
+    FillCavity(pointIndex);
+}
 
-    std::map<std::array<uint32_t, 3>, FaceData> uniqueFaces;
-    std::map<std::array<uint32_t, 3>, int> faceCounts;
+uint32_t BowyerWatsonDelaunay3D::LocatePoint(const BASE_NS::Math::Vec3& point) const
+{
+    uint32_t current = (lastCell_ < cells_.size() && cells_[lastCell_].alive) ? lastCell_ : INVALID_INDEX;
+    if (current == INVALID_INDEX) {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(cells_.size()); ++i) {
+            if (cells_[i].alive) {
+                current = i;
+                break;
+            }
+        }
+    }
+    // Visibility walk: step over a face which has the point on its other side. Starting the face tests from a
+    // different face on each step prevents cycling in degenerate configurations, and the step count is bounded anyway.
+    const auto maxSteps = static_cast<uint32_t>(cells_.size());
+    for (uint32_t step = 0; (current != INVALID_INDEX) && (step < maxSteps); ++step) {
+        uint32_t next = INVALID_INDEX;
+        for (uint32_t i = 0; i < VERTEX_COUNT; ++i) {
+            const uint32_t face = (i + step) % VERTEX_COUNT;
+            if (Orientation(current, face, point) < 0.0) {
+                next = cells_[current].neighbors[face];
+                if (next == INVALID_INDEX) {
+                    // outside of the super tetrahedron.
+                    return INVALID_INDEX;
+                }
+                break;
+            }
+        }
+        if (next == INVALID_INDEX) {
+            return current;
+        }
+        current = next;
+    }
+    return INVALID_INDEX;
+}
 
-    for (uint32_t tetIndex : badTetrahedra) {
-        const Tetrahedron& tet = lightProbeVolume.tetrahedrons[tetIndex];
-        FaceData faces[4] = {
-            {{tet.indices[1], tet.indices[2], tet.indices[3]}, {tet.vertices[1], tet.vertices[2], tet.vertices[3]}},
-            {{tet.indices[0], tet.indices[2], tet.indices[3]}, {tet.vertices[0], tet.vertices[2], tet.vertices[3]}},
-            {{tet.indices[0], tet.indices[1], tet.indices[3]}, {tet.vertices[0], tet.vertices[1], tet.vertices[3]}},
-            {{tet.indices[0], tet.indices[1], tet.indices[2]}, {tet.vertices[0], tet.vertices[1], tet.vertices[2]}},
-        };
+bool BowyerWatsonDelaunay3D::InCircumsphere(uint32_t cellIndex, const BASE_NS::Math::Vec3& point) const
+{
+    // Evaluated from the vertices in double precision instead of using the float circumsphere, so that points on the
+    // sphere, as in regular grids of probes, are consistently outside of it.
+    const auto& vertices = cells_[cellIndex].tet.vertices;
+    return InSphere(vertices[0U], vertices[1U], vertices[2U], vertices[3U], point) > 0.0;
+}
 
-        for (const auto& face : faces) {
-            std::array<uint32_t, LightProbeConstants::VERTICES_PER_FACE_COUNT> sortedIndices = {
-                face.indices[0], face.indices[1], face.indices[2]};
-            std::sort(sortedIndices.begin(), sortedIndices.end());
+double BowyerWatsonDelaunay3D::Orientation(uint32_t cellIndex, uint32_t face, const BASE_NS::Math::Vec3& point) const
+{
+    // orientation of the tetrahedron where the vertex opposite to the face is replaced with the point. Positive when
+    // the point is on the same side of the face as the vertex.
+    const auto& vertices = cells_[cellIndex].tet.vertices;
+    const BASE_NS::Math::Vec3& v0 = (face == 0U) ? point : vertices[0U];
+    const BASE_NS::Math::Vec3& v1 = (face == 1U) ? point : vertices[1U];
+    const BASE_NS::Math::Vec3& v2 = (face == 2U) ? point : vertices[2U];
+    const BASE_NS::Math::Vec3& v3 = (face == 3U) ? point : vertices[3U];
+    return Orient(v0, v1, v2, v3);
+}
 
-            faceCounts[sortedIndices]++;
-            if (faceCounts[sortedIndices] == 1) {
-                uniqueFaces[sortedIndices] = face;
+void BowyerWatsonDelaunay3D::GrowCavity(uint32_t seed, const BASE_NS::Math::Vec3& point)
+{
+    // two stamps per insertion: in the cavity and tested but outside.
+    if (cavityStamp_ > (std::numeric_limits<uint32_t>::max() - 2U * CAVITY_STAMP_COUNT)) {
+        std::fill(cellStamps_.begin(), cellStamps_.end(), 0U);
+        cavityStamp_ = 0U;
+    }
+    cavityStamp_ += CAVITY_STAMP_COUNT;
+    const uint32_t inside = cavityStamp_;
+    const uint32_t outside = cavityStamp_ + 1U;
+
+    cavity_.clear();
+    cavity_.push_back(seed);
+    cellStamps_[seed] = inside;
+    for (size_t i = 0; i < cavity_.size(); ++i) {
+        for (const uint32_t neighbor : cells_[cavity_[i]].neighbors) {
+            if ((neighbor == INVALID_INDEX) || (cellStamps_[neighbor] == inside) ||
+                (cellStamps_[neighbor] == outside)) {
+                continue;
+            }
+            if (InCircumsphere(neighbor, point)) {
+                cellStamps_[neighbor] = inside;
+                cavity_.push_back(neighbor);
+            } else {
+                cellStamps_[neighbor] = outside;
             }
         }
     }
 
-    for (const auto& pair : faceCounts) {
-        if (pair.second == 1) {
-            const FaceData& face = uniqueFaces[pair.first];
-            Tetrahedron newTet;
+    // The predicates are not exact, so the point might not see all of the boundary faces, which would create flat or
+    // inverted tetrahedra, or a vertex might end up inside the cavity and be lost. Shrink the cavity until neither
+    // happens.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < cavity_.size(); ++i) {
+            const uint32_t cell = cavity_[i];
+            if (cellStamps_[cell] != inside) {
+                continue;
+            }
+            for (uint32_t face = 0; face < VERTEX_COUNT; ++face) {
+                const uint32_t neighbor = cells_[cell].neighbors[face];
+                if ((neighbor != INVALID_INDEX) && (cellStamps_[neighbor] == inside)) {
+                    continue;
+                }
+                if (Orientation(cell, face, point) <= 0.0) {
+                    cellStamps_[cell] = outside;
+                    changed = true;
+                    break;
+                }
+            }
+        }
+        if (!changed) {
+            // a vertex which isn't on the boundary of the cavity would be lost.
+            if (const uint32_t cell = FindCellWithInnerVertex(); cell != INVALID_INDEX) {
+                cellStamps_[cell] = outside;
+                changed = true;
+            }
+        }
+    }
+    cavity_.erase(std::remove_if(cavity_.begin(), cavity_.end(),
+                      [this, inside](uint32_t cell) { return cellStamps_[cell] != inside; }),
+        cavity_.cend());
+}
 
-            newTet.indices[0] = face.indices[0];
-            newTet.indices[1] = face.indices[1];
-            newTet.indices[2] = face.indices[2];
-            newTet.indices[3] = pointIndex;
+uint32_t BowyerWatsonDelaunay3D::FindCellWithInnerVertex()
+{
+    const uint32_t inside = cavityStamp_;
+    ++vertexStamp_;
+    if (vertexStamp_ == 0U) {
+        std::fill(vertexStamps_.begin(), vertexStamps_.end(), 0U);
+        vertexStamp_ = 1U;
+    }
+    for (const uint32_t cell : cavity_) {
+        if (cellStamps_[cell] != inside) {
+            continue;
+        }
+        for (uint32_t face = 0; face < VERTEX_COUNT; ++face) {
+            const uint32_t neighbor = cells_[cell].neighbors[face];
+            if ((neighbor != INVALID_INDEX) && (cellStamps_[neighbor] == inside)) {
+                continue;
+            }
+            for (uint32_t i = 0; i < VERTEX_COUNT; ++i) {
+                if (i != face) {
+                    vertexStamps_[cells_[cell].tet.indices[i]] = vertexStamp_;
+                }
+            }
+        }
+    }
+    for (const uint32_t cell : cavity_) {
+        if (cellStamps_[cell] != inside) {
+            continue;
+        }
+        for (const uint32_t vertex : cells_[cell].tet.indices) {
+            if (vertexStamps_[vertex] != vertexStamp_) {
+                return cell;
+            }
+        }
+    }
+    return INVALID_INDEX;
+}
 
-            newTet.vertices[0] = face.vertices[0];
-            newTet.vertices[1] = face.vertices[1];
-            newTet.vertices[2] = face.vertices[2];
-            newTet.vertices[3] = point;
+void BowyerWatsonDelaunay3D::FillCavity(uint32_t pointIndex)
+{
+    const uint32_t inside = cavityStamp_;
+    const BASE_NS::Math::Vec3& point = allPoints_[pointIndex];
 
-            ComputeCircumsphere(newTet, lightProbeVolume);
-            lightProbeVolume.tetrahedrons.push_back(newTet);
+    // Connect each boundary face to the point. The new cell keeps the vertex order of the old one with the point in
+    // place of the vertex opposite to the face, so it is positively oriented as well.
+    cavityFaces_.clear();
+    for (const uint32_t cell : cavity_) {
+        for (uint32_t face = 0; face < VERTEX_COUNT; ++face) {
+            const uint32_t neighbor = cells_[cell].neighbors[face];
+            if ((neighbor != INVALID_INDEX) && (cellStamps_[neighbor] == inside)) {
+                continue;
+            }
+            const uint32_t newCell = AllocateCell();
+            Cell& created = cells_[newCell];
+            created.tet = cells_[cell].tet;
+            created.tet.indices[face] = pointIndex;
+            created.tet.vertices[face] = point;
+            ComputeCircumsphere(created.tet);
+            created.alive = true;
+            for (uint32_t i = 0; i < VERTEX_COUNT; ++i) {
+                created.neighbors[i] = INVALID_INDEX;
+            }
+            created.neighbors[face] = neighbor;
+            if (neighbor != INVALID_INDEX) {
+                for (auto& back : cells_[neighbor].neighbors) {
+                    if (back == cell) {
+                        back = newCell;
+                    }
+                }
+            }
+            // the other faces contain the point and are shared with other new cells through the opposite edge.
+            for (uint32_t other = 0; other < VERTEX_COUNT; ++other) {
+                if (other == face) {
+                    continue;
+                }
+                uint32_t edge[2U];
+                uint32_t edgeCount = 0U;
+                for (uint32_t i = 0; i < VERTEX_COUNT; ++i) {
+                    if ((i != face) && (i != other)) {
+                        edge[edgeCount++] = created.tet.indices[i];
+                    }
+                }
+                cavityFaces_.push_back(
+                    {{std::min(edge[0U], edge[1U]), std::max(edge[0U], edge[1U])}, newCell, other});
+            }
+            lastCell_ = newCell;
         }
     }
 
-    std::sort(badTetrahedra.rbegin(), badTetrahedra.rend());
-    for (uint32_t tetIndex : badTetrahedra) {
-        if (tetIndex < static_cast<uint32_t>(lightProbeVolume.tetrahedrons.size())) {
-            lightProbeVolume.tetrahedrons.erase(lightProbeVolume.tetrahedrons.begin() + tetIndex);
+    std::sort(cavityFaces_.begin(), cavityFaces_.end(), [](const CavityFace& lhs, const CavityFace& rhs) {
+        return (lhs.edge[0U] < rhs.edge[0U]) || ((lhs.edge[0U] == rhs.edge[0U]) && (lhs.edge[1U] < rhs.edge[1U]));
+    });
+    for (size_t i = 0; (i + 1U) < cavityFaces_.size(); ++i) {
+        const auto& first = cavityFaces_[i];
+        const auto& second = cavityFaces_[i + 1U];
+        if ((first.edge[0U] == second.edge[0U]) && (first.edge[1U] == second.edge[1U])) {
+            cells_[first.cell].neighbors[first.face] = second.cell;
+            cells_[second.cell].neighbors[second.face] = first.cell;
+            ++i;
         }
     }
+
+    for (const uint32_t cell : cavity_) {
+        cells_[cell].alive = false;
+        cellStamps_[cell] = 0U;
+        freeCells_.push_back(cell);
+    }
 }
 
-void BowyerWatsonDelaunay3D::ComputeCircumsphere(Tetrahedron& tet, const LightProbeVolume& lightProbeVolume)
+uint32_t BowyerWatsonDelaunay3D::AllocateCell()
+{
+    if (!freeCells_.empty()) {
+        const uint32_t cell = freeCells_.back();
+        freeCells_.pop_back();
+        return cell;
+    }
+    cells_.push_back({});
+    cellStamps_.push_back(0U);
+    return static_cast<uint32_t>(cells_.size() - 1U);
+}
+
+void BowyerWatsonDelaunay3D::ComputeCircumsphere(Tetrahedron& tet)
 {
     const BASE_NS::Math::Vec3& a = tet.vertices[0];
     const BASE_NS::Math::Vec3& b = tet.vertices[1];
@@ -213,23 +555,22 @@ void BowyerWatsonDelaunay3D::ComputeCircumsphere(Tetrahedron& tet, const LightPr
 
 void BowyerWatsonDelaunay3D::RemoveSuperTetrahedron(LightProbeVolume& lightProbeVolume)
 {
-    BASE_NS::vector<Tetrahedron> validTetrahedra;
-
-    for (const auto& tet : lightProbeVolume.tetrahedrons) {
+    for (const auto& cell : cells_) {
+        if (!cell.alive) {
+            continue;
+        }
         bool hasSuperVertex = false;
         for (uint32_t i = 0U; i < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++i) {
-            if (tet.indices[i] >= superTetrahedronStartIndex_) {
+            if (cell.tet.indices[i] >= superTetrahedronStartIndex_) {
                 hasSuperVertex = true;
                 break;
             }
         }
 
         if (!hasSuperVertex) {
-            validTetrahedra.push_back(tet);
+            lightProbeVolume.tetrahedrons.push_back(cell.tet);
         }
     }
-
-    lightProbeVolume.tetrahedrons = validTetrahedra;
 }
 
 CORE3D_END_NAMESPACE()
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <functional>
 
 #include <3d/light_probe_types/light_probe.h>
@@ -28,6 +29,11 @@
 
 CORE3D_BEGIN_NAMESPACE()
 
+/** Incremental Delaunay tetrahedralization of the light probe positions.
+ * The points are inserted in Hilbert curve order. Each point is located by walking through the tetrahedron neighbors
+ * from the last created tetrahedron, and the tetrahedra whose circumsphere contains the point are found by growing the
+ * cavity through the neighbors, so that the cost of an insertion depends only on the mesh around the point.
+ */
 class BowyerWatsonDelaunay3D {
 public:
     struct LightProbeVolume {
@@ -40,20 +46,51 @@ public:
     void BuildTetrahedralMesh(LightProbeVolume& lightProbeVolume);
 
 private:
-    struct FaceData {
-        uint32_t indices[3];
-        BASE_NS::Math::Vec3 vertices[3];
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFffffu;
+
+    struct Cell {
+        Tetrahedron tet;
+        /** Neighbor sharing the face opposite to the vertex with the same index, INVALID_INDEX on the hull. */
+        uint32_t neighbors[LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT];
+        bool alive;
+    };
+
+    /** Face of a new cell which contains the inserted point, identified by the edge opposite to the point. */
+    struct CavityFace {
+        uint32_t edge[2];
+        uint32_t cell;
+        uint32_t face;
     };
 
-    void CreateSuperTetrahedron(LightProbeVolume& lightProbeVolume);
+    void CreateSuperTetrahedron();
+    void SortInsertionOrder(uint32_t pointCount);
 
-    void InsertPoint(uint32_t pointIndex, LightProbeVolume& lightProbeVolume);
+    void InsertPoint(uint32_t pointIndex);
+    uint32_t LocatePoint(const BASE_NS::Math::Vec3& point) const;
+    bool InCircumsphere(uint32_t cellIndex, const BASE_NS::Math::Vec3& point) const;
+    double Orientation(uint32_t cellIndex, uint32_t face, const BASE_NS::Math::Vec3& point) const;
+    void GrowCavity(uint32_t seed, const BASE_NS::Math::Vec3& point);
+    uint32_t FindCellWithInnerVertex();
+    void FillCavity(uint32_t pointIndex);
+    uint32_t AllocateCell();
 
-    void ComputeCircumsphere(Tetrahedron& tet, const LightProbeVolume& lightProbeVolume);
+    static void ComputeCircumsphere(Tetrahedron& tet);
     void RemoveSuperTetrahedron(LightProbeVolume& lightProbeVolume);
 
     uint32_t superTetrahedronStartIndex_ = 0;
+    uint32_t lastCell_ = 0;
+    uint32_t cavityStamp_ = 0;
     BASE_NS::vector<BASE_NS::Math::Vec3> allPoints_;
+    BASE_NS::vector<uint32_t> insertionOrder_;
+    BASE_NS::vector<Cell> cells_;
+    BASE_NS::vector<uint32_t> freeCells_;
+    // Per cell: cavityStamp_ when the cell is in the current cavity, cavityStamp_ + 1 when tested and not in it.
+    BASE_NS::vector<uint32_t> cellStamps_;
+    // Per point: vertexStamp_ when the point is on the boundary of the cavity.
+    BASE_NS::vector<uint32_t> vertexStamps_;
+    uint32_t vertexStamp_ = 0;
+    BASE_NS::vector<uint32_t> cavity_;
+    BASE_NS::vector<CavityFace> cavityFaces_;
 };
 
 CORE3D_END_NAMESPACE()
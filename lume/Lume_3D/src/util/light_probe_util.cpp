@@ -26,6 +26,7 @@
 #include <core/namespace.h>
 
 #include "bowyer_watson_delaunay_3d.h"
+#include "light_probe_volume_index.h"
 
 namespace {
 void InterpolateLightProbeData(const BASE_NS::Math::Vec4& barycentric, const CORE3D_NS::Tetrahedron& tet,
@@ -64,16 +65,16 @@ void InterpolateLightProbeData(const BASE_NS::Math::Vec4& barycentric, const COR
     lightProbeInterpolatedData.bentNormalAo = BASE_NS::Math::Vec4(normalized, ao);
 }
 
-constexpr uint32_t IDW_NEAREST_PROBES = 3U;
+constexpr uint32_t IDW_NEAREST_PROBES = CORE3D_NS::LightProbeVolumeIndex::NEAREST_PROBE_COUNT;
 
-struct ProbeDistance {
-    size_t index;
-    float distance;
-};
+using ProbeDistance = CORE3D_NS::LightProbeVolumeIndex::ProbeDistance;
 
-uint32_t FindNearestProbes(const CORE3D_NS::LightProbeVolume& volume, const BASE_NS::Math::Vec3& worldCenter,
-    ProbeDistance (&nearest)[IDW_NEAREST_PROBES])
+uint32_t FindNearestProbes(const CORE3D_NS::LightProbeVolume& volume, const CORE3D_NS::LightProbeVolumeIndex* index,
+    const BASE_NS::Math::Vec3& worldCenter, ProbeDistance (&nearest)[IDW_NEAREST_PROBES])
 {
+    if (index) {
+        return index->FindNearestProbes(volume, worldCenter, nearest);
+    }
     for (auto& slot : nearest) {
         slot = {0U, FLT_MAX};
     }
@@ -114,7 +115,8 @@ void ComputeIdwWeights(
 }
 
 bool InterpolateFromNearestProbes(const CORE3D_NS::LightProbeVolume& lightProbeVolume,
-    const BASE_NS::Math::Vec3& worldCenter, CORE3D_NS::LightProbeInterpolatedData& lightProbeInterpolatedData)
+    const CORE3D_NS::LightProbeVolumeIndex* index, const BASE_NS::Math::Vec3& worldCenter,
+    CORE3D_NS::LightProbeInterpolatedData& lightProbeInterpolatedData)
 {
     if (lightProbeVolume.lightProbes.empty()) {
         return false;
@@ -122,7 +124,7 @@ bool InterpolateFromNearestProbes(const CORE3D_NS::LightProbeVolume& lightProbeV
     auto& result = lightProbeInterpolatedData;
 
     ProbeDistance nearest[IDW_NEAREST_PROBES] = {};
-    const uint32_t probeCount = FindNearestProbes(lightProbeVolume, worldCenter, nearest);
+    const uint32_t probeCount = FindNearestProbes(lightProbeVolume, index, worldCenter, nearest);
 
     float weights[IDW_NEAREST_PROBES] = {0.0f, 0.0f, 0.0f};
     ComputeIdwWeights(nearest, probeCount, weights);
@@ -226,8 +228,7 @@ TetrahedronOpt LightProbeUtil::FindContainingTetrahedron(
                 tet.vertices[3].z);
         }
 
-        if (bary.x >= 0.0f && bary.y >= 0.0f && bary.z >= 0.0f && bary.w >= 0.0f &&
-            std::abs(bary.x + bary.y + bary.z + bary.w - 1.0f) < LightProbeConstants::EPSILON) {
+        if (IsInsideTetrahedron(bary)) {
             if constexpr (DBG_HIT_TET) {
                 PLUGIN_LOG_W(
                     "find material position(%f, %f, %f) correct tetrahedron", position.x, position.y, position.z);
@@ -243,27 +244,62 @@ TetrahedronOpt LightProbeUtil::FindContainingTetrahedron(
     return {};
 }
 
-LightProbeInterpolatedDataOpt LightProbeUtil::GetInterpolatedLightProbeData(
-    const LightProbeVolume& lightProbeVolume, const BASE_NS::Math::Vec3& worldCenter)
+bool LightProbeUtil::IsInsideTetrahedron(const BASE_NS::Math::Vec4& barycentric)
 {
-    LightProbeInterpolatedData lightProbeInterpolatedData;
-    if (lightProbeVolume.lightProbes.empty()) {
-        return {lightProbeInterpolatedData, false};
-    }
-    auto tetOpt = FindContainingTetrahedron(worldCenter, lightProbeVolume);
+    const float sum = barycentric.x + barycentric.y + barycentric.z + barycentric.w;
+    return barycentric.x >= 0.0f && barycentric.y >= 0.0f && barycentric.z >= 0.0f && barycentric.w >= 0.0f &&
+           std::abs(sum - 1.0f) < LightProbeConstants::EPSILON;
+}
+
+namespace {
+LightProbeInterpolatedDataOpt InterpolateFromTetrahedron(const LightProbeVolume& lightProbeVolume,
+    const LightProbeVolumeIndex* index, const TetrahedronOpt& tetOpt, const BASE_NS::Math::Vec3& worldCenter)
+{
+    // zero initialized, the nearest probe interpolation accumulates into it.
+    LightProbeInterpolatedData lightProbeInterpolatedData{};
     if (!tetOpt) {
-        auto res = InterpolateFromNearestProbes(lightProbeVolume, worldCenter, lightProbeInterpolatedData);
+        auto res = InterpolateFromNearestProbes(lightProbeVolume, index, worldCenter, lightProbeInterpolatedData);
         return {lightProbeInterpolatedData, res};
     }
     const auto& tet = tetOpt.tetrahedrons;
     const uint32_t probeCount = static_cast<uint32_t>(lightProbeVolume.lightProbes.size());
     if (tet.indices[0] >= probeCount || tet.indices[1] >= probeCount || tet.indices[2] >= probeCount ||
         tet.indices[3] >= probeCount) {
-        auto res = InterpolateFromNearestProbes(lightProbeVolume, worldCenter, lightProbeInterpolatedData);
+        auto res = InterpolateFromNearestProbes(lightProbeVolume, index, worldCenter, lightProbeInterpolatedData);
         return {lightProbeInterpolatedData, res};
     }
-    auto barycentric = CalculateBarycentricCoordinates(worldCenter, tet);
+    auto barycentric = LightProbeUtil::CalculateBarycentricCoordinates(worldCenter, tet);
     InterpolateLightProbeData(barycentric, tet, lightProbeVolume, lightProbeInterpolatedData);
     return {lightProbeInterpolatedData, true};
 }
+}  // namespace
+
+LightProbeInterpolatedDataOpt LightProbeUtil::GetInterpolatedLightProbeData(
+    const LightProbeVolume& lightProbeVolume, const BASE_NS::Math::Vec3& worldCenter)
+{
+    if (lightProbeVolume.lightProbes.empty()) {
+        return {};
+    }
+    return InterpolateFromTetrahedron(
+        lightProbeVolume, nullptr, FindContainingTetrahedron(worldCenter, lightProbeVolume), worldCenter);
+}
+
+LightProbeInterpolatedDataOpt LightProbeUtil::GetInterpolatedLightProbeData(const LightProbeVolume& lightProbeVolume,
+    const LightProbeVolumeIndex& index, const BASE_NS::Math::Vec3& worldCenter, uint32_t& tetrahedronHint)
+{
+    if (lightProbeVolume.lightProbes.empty()) {
+        return {};
+    }
+    if (!index.IsValidFor(lightProbeVolume)) {
+        return GetInterpolatedLightProbeData(lightProbeVolume, worldCenter);
+    }
+    TetrahedronOpt tetOpt;
+    const uint32_t tet = index.FindContainingTetrahedron(lightProbeVolume, worldCenter, tetrahedronHint);
+    if (tet != LightProbeVolumeIndex::INVALID_INDEX) {
+        // keep the old hint when outside, the object is likely to come back near to where it left the volume.
+        tetrahedronHint = tet;
+        tetOpt = {lightProbeVolume.tetrahedrons[tet], true};
+    }
+    return InterpolateFromTetrahedron(lightProbeVolume, &index, tetOpt, worldCenter);
+}
 CORE3D_END_NAMESPACE()
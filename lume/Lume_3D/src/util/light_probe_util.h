@@ -27,6 +27,8 @@ class Vec4;
 BASE_END_NAMESPACE()
 
 CORE3D_BEGIN_NAMESPACE()
+class LightProbeVolumeIndex;
+
 class LightProbeUtil {
 public:
     static TetrahedronOpt FindContainingTetrahedron(
@@ -36,6 +38,17 @@ public:
     static LightProbeInterpolatedDataOpt GetInterpolatedLightProbeData(
         const LightProbeVolume& lightProbeVolume, const BASE_NS::Math::Vec3& worldCenter);
 
+    /** Same as above, but uses the index built for the volume for the lookups.
+     * @param tetrahedronHint Tetrahedron to start the search from, updated to the containing tetrahedron. Callers keep
+     * one hint per object so that the next lookup starts close to the object. Initialize with
+     * LightProbeVolumeIndex::INVALID_INDEX.
+     */
+    static LightProbeInterpolatedDataOpt GetInterpolatedLightProbeData(const LightProbeVolume& lightProbeVolume,
+        const LightProbeVolumeIndex& index, const BASE_NS::Math::Vec3& worldCenter, uint32_t& tetrahedronHint);
+
+    /** Returns true if the barycentric coordinates are those of a point inside the tetrahedron. */
+    static bool IsInsideTetrahedron(const BASE_NS::Math::Vec4& barycentric);
+
     LightProbeUtil() = default;
     ~LightProbeUtil() = default;
 };
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/light_probe_volume_index.h"
+
+#include <algorithm>
+#include <cfloat>
+
+#include <base/math/mathf.h>
+#include <base/math/vector_util.h>
+
+#include "util/light_probe_util.h"
+
+CORE3D_BEGIN_NAMESPACE()
+using namespace BASE_NS;
+
+namespace {
+struct TetrahedronFace {
+    uint32_t vertices[3U];
+    uint32_t tetrahedron;
+    uint32_t face;
+
+    bool operator<(const TetrahedronFace& rhs) const
+    {
+        return std::lexicographical_compare(vertices, vertices + 3U, rhs.vertices, rhs.vertices + 3U);
+    }
+
+    bool SameVertices(const TetrahedronFace& rhs) const
+    {
+        return std::equal(vertices, vertices + 3U, rhs.vertices);
+    }
+};
+
+// (distance, index) order matches the order in which a linear scan over the probes keeps the nearest ones.
+bool IsCloser(const LightProbeVolumeIndex::ProbeDistance& lhs, const LightProbeVolumeIndex::ProbeDistance& rhs)
+{
+    return (lhs.distance < rhs.distance) || ((lhs.distance == rhs.distance) && (lhs.index < rhs.index));
+}
+}  // namespace
+
+void LightProbeVolumeIndex::Build(const LightProbeVolume& lightProbeVolume)
+{
+    Clear();
+    tetrahedronCount_ = lightProbeVolume.tetrahedrons.size();
+    probeCount_ = lightProbeVolume.lightProbes.size();
+
+    vector<MinAndMax> bounds;
+    bounds.reserve(tetrahedronCount_);
+    for (const auto& tet : lightProbeVolume.tetrahedrons) {
+        MinAndMax& tetBounds = bounds.emplace_back();
+        for (const auto& vertex : tet.vertices) {
+            tetBounds.minAABB = Math::min(tetBounds.minAABB, vertex);
+            tetBounds.maxAABB = Math::max(tetBounds.maxAABB, vertex);
+        }
+    }
+    tetrahedronTree_.Build(bounds);
+
+    bounds.clear();
+    bounds.reserve(probeCount_);
+    for (const auto& probe : lightProbeVolume.lightProbes) {
+        bounds.push_back({probe.position, probe.position});
+    }
+    probeTree_.Build(bounds);
+
+    BuildNeighbors(lightProbeVolume);
+}
+
+void LightProbeVolumeIndex::BuildNeighbors(const LightProbeVolume& lightProbeVolume)
+{
+    // faces with the same sorted vertex indices are shared by two neighboring tetrahedra.
+    vector<TetrahedronFace> faces;
+    faces.reserve(tetrahedronCount_ * VERTEX_COUNT);
+    for (uint32_t tet = 0U; tet < tetrahedronCount_; ++tet) {
+        const auto& indices = lightProbeVolume.tetrahedrons[tet].indices;
+        for (uint32_t face = 0U; face < VERTEX_COUNT; ++face) {
+            TetrahedronFace& tetFace = faces.emplace_back();
+            for (uint32_t i = 0U, j = 0U; i < VERTEX_COUNT; ++i) {
+                if (i != face) {
+                    tetFace.vertices[j++] = indices[i];
+                }
+            }
+            std::sort(tetFace.vertices, tetFace.vertices + 3U);
+            tetFace.tetrahedron = tet;
+            tetFace.face = face;
+        }
+    }
+    std::sort(faces.begin(), faces.end());
+
+    neighbors_.resize(tetrahedronCount_ * VERTEX_COUNT, INVALID_INDEX);
+    for (size_t i = 1U; i < faces.size(); ++i) {
+        const TetrahedronFace& first = faces[i - 1U];
+        const TetrahedronFace& second = faces[i];
+        if (first.SameVertices(second)) {
+            neighbors_[first.tetrahedron * VERTEX_COUNT + first.face] = second.tetrahedron;
+            neighbors_[second.tetrahedron * VERTEX_COUNT + second.face] = first.tetrahedron;
+            ++i;
+        }
+    }
+}
+
+void LightProbeVolumeIndex::Clear()
+{
+    neighbors_.clear();
+    tetrahedronTree_.Clear();
+    probeTree_.Clear();
+    tetrahedronCount_ = 0U;
+    probeCount_ = 0U;
+}
+
+bool LightProbeVolumeIndex::IsValidFor(const LightProbeVolume& lightProbeVolume) const
+{
+    return (lightProbeVolume.tetrahedrons.size() == tetrahedronCount_) &&
+           (lightProbeVolume.lightProbes.size() == probeCount_);
+}
+
+uint32_t LightProbeVolumeIndex::FindContainingTetrahedron(
+    const LightProbeVolume& lightProbeVolume, const Math::Vec3& position, uint32_t hint) const
+{
+    const auto& tetrahedrons = lightProbeVolume.tetrahedrons;
+    // step to the neighbor behind the face opposite to the most negative barycentric coordinate, i.e. the face which
+    // separates the point from the tetrahedron the most.
+    uint32_t current = (hint < tetrahedronCount_) ? hint : INVALID_INDEX;
+    for (uint32_t step = 0U; (current != INVALID_INDEX) && (step < MAX_WALK_STEPS); ++step) {
+        const Math::Vec4 bary = LightProbeUtil::CalculateBarycentricCoordinates(position, tetrahedrons[current]);
+        if (LightProbeUtil::IsInsideTetrahedron(bary)) {
+            return current;
+        }
+        uint32_t exitFace = 0U;
+        for (uint32_t i = 1U; i < VERTEX_COUNT; ++i) {
+            if (bary[i] < bary[exitFace]) {
+                exitFace = i;
+            }
+        }
+        current = GetNeighbor(current, exitFace);
+    }
+
+    // no hint, the walk left the hull or the point was too far away.
+    uint32_t found = INVALID_INDEX;
+    tetrahedronTree_.Query(position, [&](uint32_t tet) {
+        if (LightProbeUtil::IsInsideTetrahedron(
+                LightProbeUtil::CalculateBarycentricCoordinates(position, tetrahedrons[tet]))) {
+            found = tet;
+            return true;
+        }
+        return false;
+    });
+    return found;
+}
+
+uint32_t LightProbeVolumeIndex::FindNearestProbes(const LightProbeVolume& lightProbeVolume,
+    const Math::Vec3& position, ProbeDistance (&nearest)[NEAREST_PROBE_COUNT]) const
+{
+    for (auto& slot : nearest) {
+        slot = {0U, FLT_MAX};
+    }
+    uint32_t count = 0U;
+    probeTree_.Nearest(position, [&](uint32_t probe) {
+        const ProbeDistance candidate{probe, Math::distance(position, lightProbeVolume.lightProbes[probe].position)};
+        if ((count < NEAREST_PROBE_COUNT) || IsCloser(candidate, nearest[NEAREST_PROBE_COUNT - 1U])) {
+            uint32_t slot = (count < NEAREST_PROBE_COUNT) ? count++ : (NEAREST_PROBE_COUNT - 1U);
+            for (; (slot > 0U) && IsCloser(candidate, nearest[slot - 1U]); --slot) {
+                nearest[slot] = nearest[slot - 1U];
+            }
+            nearest[slot] = candidate;
+        }
+        if (count < NEAREST_PROBE_COUNT) {
+            return FLT_MAX;
+        }
+        // widened slightly so that a probe at the same distance as the last one, but with a lower index, is not pruned
+        // by rounding differences between the squared box distance and the squared probe distance.
+        const float limit = nearest[NEAREST_PROBE_COUNT - 1U].distance;
+        return limit * limit * (1.0f + FLT_EPSILON * 4.0f);
+    });
+    return count;
+}
+CORE3D_END_NAMESPACE()
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CORE_UTIL_LIGHT_PROBE_VOLUME_INDEX_H
+#define CORE_UTIL_LIGHT_PROBE_VOLUME_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <3d/light_probe_types/light_probe.h>
+#include <3d/namespace.h>
+#include <base/containers/vector.h>
+#include <base/math/vector.h>
+
+#include "util/aabb_tree.h"
+
+CORE3D_BEGIN_NAMESPACE()
+/** Acceleration structure for point queries against a light probe volume.
+ * Containing tetrahedra are found by walking across the tetrahedron faces starting from a hint, usually the
+ * tetrahedron found for the same object on an earlier lookup. Without a usable hint, or when the walk does not reach
+ * the point, a BVH over the tetrahedron bounds is used. Probes are kept in a second BVH for nearest probe lookups.
+ * Only indices are stored, the volume itself must be passed to the lookups and must match the one used in Build.
+ */
+class LightProbeVolumeIndex {
+public:
+    static constexpr uint32_t INVALID_INDEX = ~0U;
+    static constexpr uint32_t NEAREST_PROBE_COUNT = 3U;
+
+    struct ProbeDistance {
+        size_t index;
+        float distance;
+    };
+
+    LightProbeVolumeIndex() = default;
+    ~LightProbeVolumeIndex() = default;
+
+    void Build(const LightProbeVolume& lightProbeVolume);
+    void Clear();
+
+    /** Returns true if the index was built for a volume with the same number of probes and tetrahedra. */
+    bool IsValidFor(const LightProbeVolume& lightProbeVolume) const;
+
+    /** Find the tetrahedron containing the position.
+     * @param lightProbeVolume Volume used in Build.
+     * @param position Point to look up.
+     * @param hint Index of the tetrahedron to start the walk from, or INVALID_INDEX.
+     * @return Index of the containing tetrahedron, or INVALID_INDEX if the position is outside of the volume.
+     */
+    uint32_t FindContainingTetrahedron(
+        const LightProbeVolume& lightProbeVolume, const BASE_NS::Math::Vec3& position, uint32_t hint) const;
+
+    /** Find the probes nearest to the position, sorted by distance. Equally distant probes are ordered by index.
+     * @return Number of probes found.
+     */
+    uint32_t FindNearestProbes(const LightProbeVolume& lightProbeVolume, const BASE_NS::Math::Vec3& position,
+        ProbeDistance (&nearest)[NEAREST_PROBE_COUNT]) const;
+
+    /** Neighbor of the tetrahedron across the face opposite to the given vertex, INVALID_INDEX on the hull. */
+    uint32_t GetNeighbor(uint32_t tetrahedron, uint32_t vertex) const
+    {
+        return neighbors_[tetrahedron * VERTEX_COUNT + vertex];
+    }
+
+private:
+    static constexpr uint32_t VERTEX_COUNT = 4U;
+    // the walk crosses roughly one tetrahedron per probe spacing the object has moved.
+    static constexpr uint32_t MAX_WALK_STEPS = 64U;
+
+    void BuildNeighbors(const LightProbeVolume& lightProbeVolume);
+
+    BASE_NS::vector<uint32_t> neighbors_;
+    AabbTree tetrahedronTree_;
+    AabbTree probeTree_;
+    size_t tetrahedronCount_{0U};
+    size_t probeCount_{0U};
+};
+CORE3D_END_NAMESPACE()
+
+#endif  // CORE_UTIL_LIGHT_PROBE_VOLUME_INDEX_H
@@ -40,6 +40,7 @@
 #include <core/plugin/intf_plugin_register.h>
 #include <core/property/intf_property_handle.h>
 
+#include "util/aabb_tree.h"
 #include "util/log.h"
 #include "util/scene_util.h"
 
@@ -49,6 +50,11 @@ using namespace CORE_NS;
 using namespace RENDER_NS;
 
 namespace {
+// Below this many render meshes testing all of them is cheaper than keeping a BVH up to date.
+constexpr size_t MIN_BVH_RENDER_MESH_COUNT = 64U;
+// Number of ECS instances for which a BVH is kept.
+constexpr size_t MAX_SCENE_BVH_COUNT = 4U;
+
 MinAndMax GetWorldAABB(const Math::Mat4X4& world, const Math::Vec3& aabbMin, const Math::Vec3& aabbMax)
 {
     // Based on https://gist.github.com/cmf028/81e8d3907035640ee0e3fdd69ada543f
@@ -391,30 +397,207 @@ Math::Vec3 Picking::WorldToScreen(IEcs const& ecs, Entity cameraEntity, Math::Ve
     return Math::Vec3{screenCoordinate.x, screenCoordinate.y, screenCoordinate.z};
 }
 
-vector<RayCastResult> Picking::RayCast(const IEcs& ecs, const Math::Vec3& start, const Math::Vec3& direction) const
+struct Picking::RayCastManagers {
+    const INodeSystem& nodeSystem;
+    const IRenderMeshComponentManager& renderMeshManager;
+    const IWorldMatrixComponentManager& worldMatrixManager;
+    const IJointMatricesComponentManager& jointMatricesManager;
+    const IMeshComponentManager& meshManager;
+    // null when layers are not checked.
+    const ILayerComponentManager* layerManager;
+};
+
+// World space boxes of the render meshes of one ECS. The tree is rebuilt when render meshes or meshes change, or
+// components are added or removed. Otherwise the boxes of the meshes whose world matrix or joint matrices component
+// generation has changed are recalculated and the tree is refitted.
+struct Picking::SceneBvh {
+    struct Leaf {
+        IComponentManager::ComponentId renderMeshId;
+        // World matrix component, or joint matrices component for skinned meshes.
+        IComponentManager::ComponentId matrixId;
+        uint32_t matrixGeneration;
+        bool skinned;
+        // Model space AABB of the mesh, not used for skinned meshes.
+        Math::Vec3 aabbMin;
+        Math::Vec3 aabbMax;
+    };
+
+    void Build(const RayCastManagers& managers);
+    bool Update(const RayCastManagers& managers);
+
+    uint64_t ecsId{0U};
+    bool valid{false};
+    uint32_t renderMeshGeneration{0U};
+    uint32_t meshGeneration{0U};
+    uint32_t worldMatrixGeneration{0U};
+    uint32_t jointMatricesGeneration{0U};
+    size_t worldMatrixCount{0U};
+    size_t jointMatricesCount{0U};
+    size_t skinnedCount{0U};
+    vector<Leaf> leaves;
+    vector<MinAndMax> bounds;
+    AabbTree tree;
+};
+
+void Picking::SceneBvh::Build(const RayCastManagers& managers)
 {
-    vector<RayCastResult> result;
+    const auto& renderMeshManager = managers.renderMeshManager;
+    const auto& worldMatrixManager = managers.worldMatrixManager;
+    const auto& jointMatricesManager = managers.jointMatricesManager;
+
+    leaves.clear();
+    bounds.clear();
+    skinnedCount = 0U;
+    const auto renderMeshCount = renderMeshManager.GetComponentCount();
+    leaves.reserve(renderMeshCount);
+    bounds.reserve(renderMeshCount);
+    for (IComponentManager::ComponentId i = 0; i < renderMeshCount; i++) {
+        const Entity id = renderMeshManager.GetEntity(i);
+        if (!EntityUtil::IsValid(id)) {
+            continue;
+        }
+        if (const auto jointMatricesId = jointMatricesManager.GetComponentId(id);
+            jointMatricesId != IComponentManager::INVALID_COMPONENT_ID) {
+            // Use the skinned aabb's.
+            const auto jointMatrices = jointMatricesManager.Read(jointMatricesId);
+            leaves.push_back(
+                Leaf{i, jointMatricesId, jointMatricesManager.GetComponentGeneration(jointMatricesId), true, {}, {}});
+            bounds.push_back(MinAndMax{jointMatrices->jointsAabbMin, jointMatrices->jointsAabbMax});
+            ++skinnedCount;
+        } else if (const auto worldMatrixId = worldMatrixManager.GetComponentId(id);
+                   worldMatrixId != IComponentManager::INVALID_COMPONENT_ID) {
+            auto const renderMeshComponent = renderMeshManager.Get(i);
+            if (const auto meshHandle = managers.meshManager.Read(renderMeshComponent.mesh); meshHandle) {
+                leaves.push_back(Leaf{i, worldMatrixId, worldMatrixManager.GetComponentGeneration(worldMatrixId),
+                    false, meshHandle->aabbMin, meshHandle->aabbMax});
+                bounds.push_back(CORE3D_NS::GetWorldAABB(
+                    worldMatrixManager.Get(worldMatrixId).matrix, meshHandle->aabbMin, meshHandle->aabbMax));
+            } else {
+                PLUGIN_LOG_W(
+                    "no mesh resource for entity %" PRIx64 ", resource %" PRIx64, id.id, renderMeshComponent.mesh.id);
+            }
+        }
+    }
+    tree.Build(bounds);
 
-    auto nodeSystem = GetSystem<INodeSystem>(ecs);
-    auto const renderMeshComponentManager = GetManager<IRenderMeshComponentManager>(ecs);
-    auto const worldMatrixComponentManager = GetManager<IWorldMatrixComponentManager>(ecs);
-    auto const jointMatricesComponentManager = GetManager<IJointMatricesComponentManager>(ecs);
-    auto const meshComponentManagerPtr = GetManager<IMeshComponentManager>(ecs);
-    if (!nodeSystem || !renderMeshComponentManager || !worldMatrixComponentManager || !jointMatricesComponentManager ||
-        !meshComponentManagerPtr) {
-        return result;
+    renderMeshGeneration = renderMeshManager.GetGenerationCounter();
+    meshGeneration = managers.meshManager.GetGenerationCounter();
+    worldMatrixGeneration = worldMatrixManager.GetGenerationCounter();
+    jointMatricesGeneration = jointMatricesManager.GetGenerationCounter();
+    worldMatrixCount = worldMatrixManager.GetComponentCount();
+    jointMatricesCount = jointMatricesManager.GetComponentCount();
+    valid = true;
+}
+
+bool Picking::SceneBvh::Update(const RayCastManagers& managers)
+{
+    const auto& renderMeshManager = managers.renderMeshManager;
+    const auto& worldMatrixManager = managers.worldMatrixManager;
+    const auto& jointMatricesManager = managers.jointMatricesManager;
+    if (!valid || (renderMeshGeneration != renderMeshManager.GetGenerationCounter()) ||
+        (meshGeneration != managers.meshManager.GetGenerationCounter()) ||
+        (worldMatrixCount != worldMatrixManager.GetComponentCount()) ||
+        (jointMatricesCount != jointMatricesManager.GetComponentCount())) {
+        return false;
     }
-    auto const& meshComponentManager = *meshComponentManagerPtr;
-    float distance = 0;
+    const bool worldMatricesChanged = (worldMatrixGeneration != worldMatrixManager.GetGenerationCounter());
+    const bool jointMatricesChanged = (jointMatricesGeneration != jointMatricesManager.GetGenerationCounter());
+    if (!worldMatricesChanged && !jointMatricesChanged) {
+        return true;
+    }
+    if (jointMatricesChanged) {
+        // A render mesh which got joint matrices in place of removed ones would change to use the skinned AABB.
+        size_t skinned = 0U;
+        for (IComponentManager::ComponentId i = 0; i < jointMatricesCount; i++) {
+            if (renderMeshManager.HasComponent(jointMatricesManager.GetEntity(i))) {
+                ++skinned;
+            }
+        }
+        if (skinned != skinnedCount) {
+            return false;
+        }
+    }
+
+    const auto worldMatrices = worldMatrixManager.GetComponentArray();
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        Leaf& leaf = leaves[i];
+        const Entity id = renderMeshManager.GetEntity(leaf.renderMeshId);
+        if (leaf.skinned) {
+            if (!jointMatricesChanged) {
+                continue;
+            }
+            if (jointMatricesManager.GetEntity(leaf.matrixId) != id) {
+                return false;
+            }
+            if (const auto generation = jointMatricesManager.GetComponentGeneration(leaf.matrixId);
+                generation != leaf.matrixGeneration) {
+                const auto jointMatrices = jointMatricesManager.Read(leaf.matrixId);
+                bounds[i] = MinAndMax{jointMatrices->jointsAabbMin, jointMatrices->jointsAabbMax};
+                leaf.matrixGeneration = generation;
+            }
+        } else if (worldMatricesChanged) {
+            if ((leaf.matrixId >= worldMatrices.size()) || (worldMatrixManager.GetEntity(leaf.matrixId) != id)) {
+                return false;
+            }
+            if (const auto generation = worldMatrixManager.GetComponentGeneration(leaf.matrixId);
+                generation != leaf.matrixGeneration) {
+                bounds[i] = CORE3D_NS::GetWorldAABB(worldMatrices[leaf.matrixId].matrix, leaf.aabbMin, leaf.aabbMax);
+                leaf.matrixGeneration = generation;
+            }
+        }
+    }
+    tree.Refit(bounds);
+
+    worldMatrixGeneration = worldMatrixManager.GetGenerationCounter();
+    jointMatricesGeneration = jointMatricesManager.GetGenerationCounter();
+    return true;
+}
+
+Picking::~Picking() = default;
+
+Picking::SceneBvh* Picking::GetSceneBvh(const RayCastManagers& managers) const
+{
+    if (managers.renderMeshManager.GetComponentCount() < MIN_BVH_RENDER_MESH_COUNT) {
+        return nullptr;
+    }
+    const auto ecsId = managers.renderMeshManager.GetEcs().GetId();
+    auto pos = std::find_if(
+        sceneBvhs_.begin(), sceneBvhs_.end(), [ecsId](const auto& sceneBvh) { return sceneBvh->ecsId == ecsId; });
+    if (pos == sceneBvhs_.end()) {
+        // reuse the least recently used one if there are already enough.
+        if (sceneBvhs_.size() < MAX_SCENE_BVH_COUNT) {
+            sceneBvhs_.push_back(make_unique<SceneBvh>());
+        }
+        pos = sceneBvhs_.end() - 1;
+        (*pos)->ecsId = ecsId;
+        (*pos)->valid = false;
+    }
+    std::rotate(sceneBvhs_.begin(), pos, pos + 1);
+
+    SceneBvh& sceneBvh = *sceneBvhs_.front();
+    if (!sceneBvh.Update(managers)) {
+        sceneBvh.Build(managers);
+    }
+    return &sceneBvh;
+}
+
+vector<RayCastResult> Picking::RayCastRenderMeshes(
+    const RayCastManagers& managers, const Math::Vec3& start, const Math::Vec3& direction, uint64_t layerMask) const
+{
+    vector<RayCastResult> result;
 
     auto const invDir = DirectionVectorInverse(direction);
-    for (IComponentManager::ComponentId i = 0; i < renderMeshComponentManager->GetComponentCount(); i++) {
-        const Entity id = renderMeshComponentManager->GetEntity(i);
-        auto node = nodeSystem->GetNode(id);
+    float distance = 0;
+    const auto hitTest = [&](IComponentManager::ComponentId i) {
+        const Entity id = managers.renderMeshManager.GetEntity(i);
+        auto node = managers.nodeSystem.GetNode(id);
         if (!node) {
-            continue;
+            return;
         }
-        if (const auto jointMatrices = jointMatricesComponentManager->Read(id); jointMatrices) {
+        if (managers.layerManager && !(managers.layerManager->Get(id).layerMask & layerMask)) {
+            return;
+        }
+        if (const auto jointMatrices = managers.jointMatricesManager.Read(id); jointMatrices) {
             // Use the skinned aabb's.
             const auto& jointMatricesComponent = *jointMatrices;
             if (IntersectAabb(jointMatricesComponent.jointsAabbMin,
@@ -427,11 +610,11 @@ vector<RayCastResult> Picking::RayCast(const IEcs& ecs, const Math::Vec3& start,
                 const Math::Vec3 hitPosition = start + direction * distance;
                 result.push_back(RayCastResult{node, centerDistance, distance, hitPosition});
             }
-        } else if (const auto worldMatrixId = worldMatrixComponentManager->GetComponentId(id);
+        } else if (const auto worldMatrixId = managers.worldMatrixManager.GetComponentId(id);
                    worldMatrixId != IComponentManager::INVALID_COMPONENT_ID) {
-            auto const renderMeshComponent = renderMeshComponentManager->Get(i);
-            if (const auto meshHandle = meshComponentManager.Read(renderMeshComponent.mesh); meshHandle) {
-                auto const worldMatrixComponent = worldMatrixComponentManager->Get(worldMatrixId);
+            auto const renderMeshComponent = managers.renderMeshManager.Get(i);
+            if (const auto meshHandle = managers.meshManager.Read(renderMeshComponent.mesh); meshHandle) {
+                auto const worldMatrixComponent = managers.worldMatrixManager.Get(worldMatrixId);
                 const auto raycastResult = HitTestNode(*node, *meshHandle, worldMatrixComponent.matrix, start, invDir);
                 if (raycastResult.node) {
                     result.push_back(raycastResult);
@@ -441,6 +624,20 @@ vector<RayCastResult> Picking::RayCast(const IEcs& ecs, const Math::Vec3& start,
                     "no mesh resource for entity %" PRIx64 ", resource %" PRIx64, id.id, renderMeshComponent.mesh.id);
             }
         }
+    };
+
+    {
+        std::unique_lock lock(bvhMutex_);
+        if (const SceneBvh* sceneBvh = GetSceneBvh(managers); sceneBvh) {
+            // Only the render meshes in the leaves hit by the ray need to be tested.
+            sceneBvh->tree.RayCast(
+                start, invDir, [&](uint32_t leaf) { hitTest(sceneBvh->leaves[leaf].renderMeshId); });
+        } else {
+            lock.unlock();
+            for (IComponentManager::ComponentId i = 0; i < managers.renderMeshManager.GetComponentCount(); i++) {
+                hitTest(i);
+            }
+        }
     }
 
     std::sort(
@@ -449,69 +646,38 @@ vector<RayCastResult> Picking::RayCast(const IEcs& ecs, const Math::Vec3& start,
     return result;
 }
 
+vector<RayCastResult> Picking::RayCast(const IEcs& ecs, const Math::Vec3& start, const Math::Vec3& direction) const
+{
+    auto nodeSystem = GetSystem<INodeSystem>(ecs);
+    auto const renderMeshComponentManager = GetManager<IRenderMeshComponentManager>(ecs);
+    auto const worldMatrixComponentManager = GetManager<IWorldMatrixComponentManager>(ecs);
+    auto const jointMatricesComponentManager = GetManager<IJointMatricesComponentManager>(ecs);
+    auto const meshComponentManager = GetManager<IMeshComponentManager>(ecs);
+    if (!nodeSystem || !renderMeshComponentManager || !worldMatrixComponentManager || !jointMatricesComponentManager ||
+        !meshComponentManager) {
+        return {};
+    }
+    const RayCastManagers managers{*nodeSystem, *renderMeshComponentManager, *worldMatrixComponentManager,
+        *jointMatricesComponentManager, *meshComponentManager, nullptr};
+    return RayCastRenderMeshes(managers, start, direction, ~0ULL);
+}
+
 vector<RayCastResult> Picking::RayCast(
     const IEcs& ecs, const Math::Vec3& start, const Math::Vec3& direction, uint64_t layerMask) const
 {
-    vector<RayCastResult> result;
-
     auto nodeSystem = GetSystem<INodeSystem>(ecs);
     auto const renderMeshComponentManager = GetManager<IRenderMeshComponentManager>(ecs);
     auto const layerComponentManager = GetManager<ILayerComponentManager>(ecs);
     auto const worldMatrixComponentManager = GetManager<IWorldMatrixComponentManager>(ecs);
     auto const jointMatricesComponentManager = GetManager<IJointMatricesComponentManager>(ecs);
-    auto const meshComponentManagerPtr = GetManager<IMeshComponentManager>(ecs);
+    auto const meshComponentManager = GetManager<IMeshComponentManager>(ecs);
     if (!nodeSystem || !renderMeshComponentManager || !layerComponentManager || !worldMatrixComponentManager ||
-        !jointMatricesComponentManager || !meshComponentManagerPtr) {
-        return result;
-    }
-    auto const& meshComponentManager = *meshComponentManagerPtr;
-
-    auto const invDir = DirectionVectorInverse(direction);
-    float distance = 0;
-    for (IComponentManager::ComponentId i = 0; i < renderMeshComponentManager->GetComponentCount(); i++) {
-        const Entity id = renderMeshComponentManager->GetEntity(i);
-        if (auto node = nodeSystem->GetNode(id); node) {
-            if (layerComponentManager->Get(id).layerMask & layerMask) {
-                if (const auto jointMatrices = jointMatricesComponentManager->Read(id); jointMatrices) {
-                    // Use the skinned aabb's.
-                    const auto& jointMatricesComponent = *jointMatrices;
-                    if (IntersectAabb(jointMatricesComponent.jointsAabbMin,
-                            jointMatricesComponent.jointsAabbMax,
-                            start,
-                            invDir,
-                            distance)) {
-                        const float centerDistance = Math::Magnitude(
-                            (jointMatricesComponent.jointsAabbMax + jointMatricesComponent.jointsAabbMin) * 0.5f -
-                            start);
-                        const Math::Vec3 hitPosition = start + direction * distance;
-                        result.push_back(RayCastResult{node, centerDistance, distance, hitPosition});
-                    }
-                } else {
-                    if (const auto worldMatrixId = worldMatrixComponentManager->GetComponentId(id);
-                        worldMatrixId != IComponentManager::INVALID_COMPONENT_ID) {
-                        auto const renderMeshComponent = renderMeshComponentManager->Get(i);
-                        if (const auto meshHandle = meshComponentManager.Read(renderMeshComponent.mesh); meshHandle) {
-                            auto const worldMatrixComponent = worldMatrixComponentManager->Get(worldMatrixId);
-                            const auto raycastResult =
-                                HitTestNode(*node, *meshHandle, worldMatrixComponent.matrix, start, invDir);
-                            if (raycastResult.node) {
-                                result.push_back(raycastResult);
-                            }
-                        } else {
-                            PLUGIN_LOG_W("no mesh resource for entity %" PRIx64 ", resource %" PRIx64,
-                                id.id,
-                                renderMeshComponent.mesh.id);
-                        }
-                    }
-                }
-            }
-        }
+        !jointMatricesComponentManager || !meshComponentManager) {
+        return {};
     }
-
-    std::sort(
-        result.begin(), result.end(), [](const auto& lhs, const auto& rhs) { return (lhs.distance < rhs.distance); });
-
-    return result;
+    const RayCastManagers managers{*nodeSystem, *renderMeshComponentManager, *worldMatrixComponentManager,
+        *jointMatricesComponentManager, *meshComponentManager, layerComponentManager};
+    return RayCastRenderMeshes(managers, start, direction, layerMask);
 }
 
 BASE_NS::vector<RayTriangleCastResult> Core3D::Picking::RayCast(const BASE_NS::Math::Vec3& start,
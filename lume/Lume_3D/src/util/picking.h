@@ -15,8 +15,12 @@
 #ifndef CORE_UTIL_PICKING_H
 #define CORE_UTIL_PICKING_H
 
+#include <mutex>
+
 #include <3d/util/intf_picking.h>
 #include <base/containers/string_view.h>
+#include <base/containers/unique_ptr.h>
+#include <base/containers/vector.h>
 #include <core/namespace.h>
 
 CORE_BEGIN_NAMESPACE()
@@ -26,7 +30,9 @@ CORE_END_NAMESPACE()
 
 CORE3D_BEGIN_NAMESPACE()
 class IJointMatricesComponentManager;
+class ILayerComponentManager;
 class IMeshComponentManager;
+class INodeSystem;
 class ITransformComponentManager;
 class IRenderMeshComponentManager;
 class IWorldMatrixComponentManager;
@@ -36,7 +42,7 @@ struct MeshComponent;
 class Picking : public IPicking {
 public:
     Picking() = default;
-    ~Picking() override = default;
+    ~Picking() override;
     BASE_NS::Math::Vec3 ScreenToWorld(
         CORE_NS::IEcs const& ecs, CORE_NS::Entity cameraEntity, BASE_NS::Math::Vec3 screenCoordinate) const override;
 
@@ -88,6 +94,23 @@ protected:
         }
         return invDir;
     }
+
+private:
+    struct SceneBvh;
+    struct RayCastManagers;
+
+    BASE_NS::vector<RayCastResult> RayCastRenderMeshes(const RayCastManagers& managers,
+        const BASE_NS::Math::Vec3& start, const BASE_NS::Math::Vec3& direction, uint64_t layerMask) const;
+
+    /** Get the BVH of the render meshes in the ECS, rebuilt or refitted if the components have changed since the
+     * previous ray cast. Returns null if there are so few render meshes that testing all of them is cheaper.
+     * bvhMutex_ must be locked while the BVH is used.
+     */
+    SceneBvh* GetSceneBvh(const RayCastManagers& managers) const;
+
+    mutable std::mutex bvhMutex_;
+    // BVHs of the most recently ray cast ECS instances, most recently used first.
+    mutable BASE_NS::vector<BASE_NS::unique_ptr<SceneBvh>> sceneBvhs_;
 };
 
 inline constexpr BASE_NS::string_view GetName(const IPicking*)
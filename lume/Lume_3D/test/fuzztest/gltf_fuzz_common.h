@@ -272,9 +272,8 @@ private:
     BASE_NS::vector<MemoryFile*> allFiles_;
 };
 
-// Drive the loader over one buffer. The LoadResult is scoped to die BEFORE the file manager:
-// it holds a unique_ptr<IFile> (the temp memoryFile_), and the manager frees the backing
-// MemoryFile in its destructor/Clear, so the result must be released first.
+// Drive the loader over one buffer. The LoadResult is scoped to die BEFORE the file manager
+// and the input: its buffers borrow the input data and it keeps a reference to the manager.
 inline void RunLoadGltf(BASE_NS::array_view<uint8_t const> data)
 {
     FuzzFileManager fileManager;
@@ -642,6 +642,56 @@ UNIT_TEST(API_EcsNodeSystem, EffectivelyEnabledTest, testing::ext::TestSize.Leve
     }
 }
 
+/**
+ * @tc.name: WideHierarchyWorldMatrixTest
+ * @tc.desc: Tests that world matrices are propagated through levels large enough to be calculated in parallel.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsNodeSystem, WideHierarchyWorldMatrixTest, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto ecs = testContext->ecs;
+
+    auto wcm = GetManager<IWorldMatrixComponentManager>(*ecs);
+    auto nodeSystem = GetSystem<INodeSystem>(*ecs);
+    ASSERT_NE(nullptr, nodeSystem);
+
+    constexpr uint32_t childCount = 4096U;
+    auto root = nodeSystem->CreateNode();
+    vector<ISceneNode*> leaves;
+    leaves.reserve(childCount);
+    for (uint32_t i = 0U; i < childCount; ++i) {
+        auto child = nodeSystem->CreateNode();
+        child->SetPosition(BASE_NS::Math::Vec3(static_cast<float>(i), 0.f, 0.f));
+        child->SetParent(*root);
+        auto leaf = nodeSystem->CreateNode();
+        leaf->SetPosition(BASE_NS::Math::Vec3(0.f, 0.f, 1.f));
+        leaf->SetParent(*child);
+        leaves.push_back(leaf);
+    }
+
+    ecs->ProcessEvents();
+    ecs->Update(1u, 1u);
+    ecs->ProcessEvents();
+
+    for (uint32_t i = 0U; i < childCount; ++i) {
+        EXPECT_EQ(wcm->Get(leaves[i]->GetEntity()).matrix.w,
+            BASE_NS::Math::Vec4(static_cast<float>(i), 0.f, 1.f, 1.f));
+    }
+
+    // moving the root updates the whole hierarchy.
+    root->SetPosition(BASE_NS::Math::Vec3(0.f, 2.f, 0.f));
+    ecs->ProcessEvents();
+    ecs->Update(2u, 1u);
+    ecs->ProcessEvents();
+
+    for (uint32_t i = 0U; i < childCount; ++i) {
+        EXPECT_EQ(wcm->Get(leaves[i]->GetEntity()).matrix.w,
+            BASE_NS::Math::Vec4(static_cast<float>(i), 2.f, 1.f, 1.f));
+    }
+    nodeSystem->DestroyNode(*root);
+}
+
 /**
  * @tc.name: AddChild
  * @tc.desc: Tests for Add Child. [AUTO-GENERATED]
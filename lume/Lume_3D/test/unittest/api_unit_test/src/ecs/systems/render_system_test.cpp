@@ -14,13 +14,24 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 #include <3d/ecs/components/camera_component.h>
 #include <3d/ecs/components/graphics_state_component.h>
 #include <3d/ecs/components/light_component.h>
+#include <3d/ecs/components/node_component.h>
+#include <3d/ecs/components/render_mesh_batch_component.h>
+#include <3d/ecs/components/render_mesh_component.h>
+#include <3d/ecs/components/transform_component.h>
+#include <3d/ecs/systems/intf_node_system.h>
 #include <3d/ecs/systems/intf_render_system.h>
 #include <3d/ecs/systems/intf_render_preprocessor_system.h>
+#include <3d/intf_graphics_context.h>
 #include <3d/render/intf_render_data_store_default_camera.h>
+#include <3d/render/intf_render_data_store_default_light.h>
+#include <3d/render/intf_render_data_store_default_material.h>
 #include <3d/render/render_data_defines_3d.h>
 #include <3d/util/intf_mesh_util.h>
 #include <3d/util/intf_scene_util.h>
@@ -37,6 +48,8 @@
 #include <core/property/intf_property_handle.h>
 #include <core/property/property_types.h>
 #include <render/datastore/intf_render_data_store_manager.h>
+#include <render/intf_render_context.h>
+#include <render/intf_renderer.h>
 
 #include "test_framework.h"
 #if defined(UNIT_TESTS_USE_HCPPTEST)
@@ -50,6 +63,112 @@ using namespace CORE_NS;
 using namespace RENDER_NS;
 using namespace CORE3D_NS;
 
+namespace {
+void SetFrameLatency(IRenderSystem& renderSystem, const uint32_t frameLatency)
+{
+    IPropertyHandle* handle = renderSystem.GetProperties();
+    ASSERT_NE(nullptr, handle);
+    if (auto props = ScopedHandle<IRenderSystem::Properties>(handle); props) {
+        props->frameLatency = frameLatency;
+    }
+    renderSystem.SetProperties(*handle);
+}
+
+// data stores registered to the manager, i.e. the ones read by the render nodes
+struct RegisteredDataStores {
+    refcnt_ptr<IRenderDataStoreDefaultCamera> camera;
+    refcnt_ptr<IRenderDataStoreDefaultLight> light;
+    refcnt_ptr<IRenderDataStoreDefaultMaterial> material;
+};
+
+RegisteredDataStores GetRegisteredDataStores(IRenderSystem& renderSystem, IRenderContext& renderContext)
+{
+    RegisteredDataStores stores;
+    auto& dsManager = renderContext.GetRenderDataStoreManager();
+    if (auto props = ScopedHandle<const IRenderSystem::Properties>(renderSystem.GetProperties()); props) {
+        stores.camera = refcnt_ptr<IRenderDataStoreDefaultCamera>(dsManager.GetRenderDataStore(props->dataStoreCamera));
+        stores.light = refcnt_ptr<IRenderDataStoreDefaultLight>(dsManager.GetRenderDataStore(props->dataStoreLight));
+        stores.material =
+            refcnt_ptr<IRenderDataStoreDefaultMaterial>(dsManager.GetRenderDataStore(props->dataStoreMaterial));
+    }
+    return stores;
+}
+
+struct FrameBufferingScene {
+    Entity camera;
+    Entity light;
+    Entity cube;
+};
+
+FrameBufferingScene CreateFrameBufferingScene(IEcs& ecs, const IGraphicsContext& graphicsContext)
+{
+    const auto& sceneUtil = graphicsContext.GetSceneUtil();
+    FrameBufferingScene scene;
+    scene.camera = sceneUtil.CreateCamera(ecs, Math::Vec3{0.0f, 0.0f, 10.0f}, Math::Quat{}, 0.1f, 100.0f, 75.0f);
+    if (auto cameraMgr = GetManager<ICameraComponentManager>(ecs); cameraMgr) {
+        if (auto handle = cameraMgr->Write(scene.camera); handle) {
+            handle->sceneFlags |=
+                CameraComponent::SceneFlagBits::MAIN_CAMERA_BIT | CameraComponent::SceneFlagBits::ACTIVE_RENDER_BIT;
+        }
+    }
+    LightComponent lightInfo;
+    scene.light = sceneUtil.CreateLight(ecs, lightInfo, Math::Vec3{}, Math::Quat{});
+    scene.cube = graphicsContext.GetMeshUtil().GenerateCube(ecs, "frameBufferingCube", Entity{}, 1.0f, 1.0f, 1.0f);
+    return scene;
+}
+
+void DestroyFrameBufferingScene(IEcs& ecs, const FrameBufferingScene& scene)
+{
+    auto& entityManager = ecs.GetEntityManager();
+    entityManager.Destroy(scene.camera);
+    entityManager.Destroy(scene.light);
+    entityManager.Destroy(scene.cube);
+    ecs.ProcessEvents();
+}
+
+void SetRetainedRenderMeshes(IRenderSystem& renderSystem, const bool retainedRenderMeshes)
+{
+    IPropertyHandle* handle = renderSystem.GetProperties();
+    ASSERT_NE(nullptr, handle);
+    if (auto props = ScopedHandle<IRenderSystem::Properties>(handle); props) {
+        props->retainedRenderMeshes = retainedRenderMeshes;
+    }
+    renderSystem.SetProperties(*handle);
+}
+
+void SetPositionX(IEcs& ecs, const Entity entity, const float x)
+{
+    if (auto transformMgr = GetManager<ITransformComponentManager>(ecs); transformMgr) {
+        if (auto handle = transformMgr->Write(entity); handle) {
+            handle->position.x = x;
+        }
+    }
+}
+
+const RenderMeshData* FindRenderMeshData(const IRenderDataStoreDefaultMaterial& dataStore, const Entity entity)
+{
+    for (const auto& meshData : dataStore.GetMeshData()) {
+        if (meshData.id == entity.id) {
+            return &meshData;
+        }
+    }
+    return nullptr;
+}
+
+uint32_t CountRenderMeshData(const IRenderDataStoreDefaultMaterial& dataStore, const Entity entity)
+{
+    const auto meshData = dataStore.GetMeshData();
+    return static_cast<uint32_t>(std::count_if(meshData.begin(), meshData.end(),
+        [id = entity.id](const RenderMeshData& data) { return data.id == id; }));
+}
+
+template<typename T>
+bool ContainsId(const array_view<const T> items, const uint64_t id)
+{
+    return std::any_of(items.begin(), items.end(), [id](const T& item) { return item.id == id; });
+}
+}  // namespace
+
 /**
  * @tc.name: GetRenderNodeGraphsTest
  * @tc.desc: Tests for Get Render Node Graphs Test. [AUTO-GENERATED]
@@ -242,3 +361,516 @@ UNIT_TEST(API_EcsRenderSystem, ColorPrePassMultiViewCountDoesNotOverflow, testin
         EXPECT_LE(renderCamera.multiViewCameraCount, RenderSceneDataConstants::MAX_MULTI_VIEW_LAYER_CAMERA_COUNT);
     }
 }
+
+/**
+ * @tc.name: FrameLatencyCommitsFrameData
+ * @tc.desc: With frameLatency 1 the ECS writes to separate data store instances and the frame is committed to the
+ *           registered data stores at the end of the render system update. The registered data stores must contain
+ *           the cameras, lights and meshes of the committed frame, and rendering must not block the next update.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsRenderSystem, FrameLatencyCommitsFrameData, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto graphicsContext = testContext->graphicsContext;
+    auto ecs = testContext->ecs;
+
+    auto* renderSystem = GetSystem<IRenderSystem>(*ecs);
+    ASSERT_NE(nullptr, renderSystem);
+    renderSystem->SetActive(true);
+    const FrameBufferingScene scene = CreateFrameBufferingScene(*ecs, *graphicsContext);
+    SetFrameLatency(*renderSystem, 1U);
+    const RegisteredDataStores stores = GetRegisteredDataStores(*renderSystem, *renderContext);
+    ASSERT_TRUE(stores.camera && stores.light && stores.material);
+
+    IRenderer& renderer = renderContext->GetRenderer();
+    constexpr uint32_t frameCount = 4U;
+    for (uint32_t frame = 0U; frame < frameCount; ++frame) {
+        const float x = static_cast<float>(frame);
+        SetPositionX(*ecs, scene.cube, x);
+        ecs->ProcessEvents();
+        ecs->Update(frame + 1U, 1U);
+
+        EXPECT_TRUE(ContainsId(stores.camera->GetCameras(), scene.camera.id));
+        EXPECT_TRUE(ContainsId(stores.light->GetLights(), scene.light.id));
+        const RenderMeshData* meshData = FindRenderMeshData(*stores.material, scene.cube);
+        ASSERT_NE(nullptr, meshData);
+        EXPECT_FLOAT_EQ(x, meshData->world.w.x);
+
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        // the rendered frame is released after rendering
+        EXPECT_TRUE(stores.camera->GetCameras().empty());
+    }
+
+    SetFrameLatency(*renderSystem, 0U);
+    DestroyFrameBufferingScene(*ecs, scene);
+}
+
+/**
+ * @tc.name: FrameLatencyUpdateWhileRendering
+ * @tc.desc: With frameLatency 1 the ECS update of the next frame runs on another thread while the previous frame is
+ *           rendered. This must not deadlock and the last committed frame must have the latest transforms.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsRenderSystem, FrameLatencyUpdateWhileRendering, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto graphicsContext = testContext->graphicsContext;
+    auto ecs = testContext->ecs;
+
+    auto* renderSystem = GetSystem<IRenderSystem>(*ecs);
+    ASSERT_NE(nullptr, renderSystem);
+    renderSystem->SetActive(true);
+    const FrameBufferingScene scene = CreateFrameBufferingScene(*ecs, *graphicsContext);
+    SetFrameLatency(*renderSystem, 1U);
+    const RegisteredDataStores stores = GetRegisteredDataStores(*renderSystem, *renderContext);
+    ASSERT_TRUE(stores.material);
+
+    IRenderer& renderer = renderContext->GetRenderer();
+    ecs->ProcessEvents();
+    ecs->Update(1U, 1U);
+    constexpr uint32_t frameCount = 8U;
+    for (uint32_t frame = 1U; frame < frameCount; ++frame) {
+        const auto renderNodeGraphs = graphicsContext->GetRenderNodeGraphs(*ecs);
+        const vector<RenderHandleReference> graphs(renderNodeGraphs.begin(), renderNodeGraphs.end());
+        SetPositionX(*ecs, scene.cube, static_cast<float>(frame));
+        std::thread update([&ecs, frame]() {
+            ecs->ProcessEvents();
+            ecs->Update(frame + 1U, 1U);
+        });
+        renderer.RenderFrame(graphs);
+        update.join();
+    }
+    // nothing renders now, the committed frame stays in the registered data store
+    SetPositionX(*ecs, scene.cube, static_cast<float>(frameCount));
+    ecs->ProcessEvents();
+    ecs->Update(frameCount + 1U, 1U);
+    const RenderMeshData* meshData = FindRenderMeshData(*stores.material, scene.cube);
+    ASSERT_NE(nullptr, meshData);
+    EXPECT_FLOAT_EQ(static_cast<float>(frameCount), meshData->world.w.x);
+    renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+    SetFrameLatency(*renderSystem, 0U);
+    DestroyFrameBufferingScene(*ecs, scene);
+}
+
+/**
+ * @tc.name: FrameLatencyCommitDuringPreRender
+ * @tc.desc: With frameLatency 1 a commit which happens after the renderer has begun reading some of the data stores
+ *           must wait until the frame has been rendered. Data stores whose PreRender is called after the commit
+ *           started must still contain the same ECS frame as the ones which had already begun.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsRenderSystem, FrameLatencyCommitDuringPreRender, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto graphicsContext = testContext->graphicsContext;
+    auto ecs = testContext->ecs;
+
+    auto* renderSystem = GetSystem<IRenderSystem>(*ecs);
+    ASSERT_NE(nullptr, renderSystem);
+    renderSystem->SetActive(true);
+    const FrameBufferingScene scene = CreateFrameBufferingScene(*ecs, *graphicsContext);
+    SetFrameLatency(*renderSystem, 1U);
+    const RegisteredDataStores stores = GetRegisteredDataStores(*renderSystem, *renderContext);
+    ASSERT_TRUE(stores.light && stores.material);
+
+    // the light and the cube are moved together, so the frame of each data store can be compared.
+    const auto setFrame = [&ecs, &scene](const uint32_t frame) {
+        SetPositionX(*ecs, scene.light, static_cast<float>(frame));
+        SetPositionX(*ecs, scene.cube, static_cast<float>(frame));
+    };
+    const auto lightX = [&stores, &scene]() {
+        for (const auto& light : stores.light->GetLights()) {
+            if (light.id == scene.light.id) {
+                return light.pos.x;
+            }
+        }
+        return -1.0f;
+    };
+    const auto cubeX = [&stores, &scene]() {
+        const RenderMeshData* meshData = FindRenderMeshData(*stores.material, scene.cube);
+        return meshData ? meshData->world.w.x : -1.0f;
+    };
+
+    setFrame(1U);
+    ecs->ProcessEvents();
+    ecs->Update(1U, 1U);
+
+    constexpr uint32_t frameCount = 4U;
+    for (uint32_t frame = 2U; frame < frameCount; ++frame) {
+        // the renderer has begun the frame with the light data store only.
+        stores.light->PreRender();
+        setFrame(frame);
+        std::atomic_bool committed{false};
+        std::thread update([&ecs, &committed, frame]() {
+            ecs->ProcessEvents();
+            ecs->Update(frame, 1U);
+            committed = true;
+        });
+        // give the commit time to run into the frame being read.
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(committed);
+        stores.material->PreRender();
+        EXPECT_FLOAT_EQ(static_cast<float>(frame - 1U), lightX());
+        EXPECT_FLOAT_EQ(static_cast<float>(frame - 1U), cubeX());
+        stores.material->PostRender();
+        stores.light->PostRender();
+        update.join();
+        EXPECT_TRUE(committed);
+
+        // the next frame reads the new commit from both.
+        EXPECT_FLOAT_EQ(static_cast<float>(frame), lightX());
+        EXPECT_FLOAT_EQ(static_cast<float>(frame), cubeX());
+    }
+    renderContext->GetRenderer().RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+    SetFrameLatency(*renderSystem, 0U);
+    DestroyFrameBufferingScene(*ecs, scene);
+}
+
+/**
+ * @tc.name: FrameLatencyToggle
+ * @tc.desc: Toggles frameLatency between 1 and 0. Without frame buffering the ECS writes directly to the registered
+ *           data stores again and the mesh and material data moved to the writer side is moved back.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsRenderSystem, FrameLatencyToggle, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto graphicsContext = testContext->graphicsContext;
+    auto ecs = testContext->ecs;
+
+    auto* renderSystem = GetSystem<IRenderSystem>(*ecs);
+    ASSERT_NE(nullptr, renderSystem);
+    renderSystem->SetActive(true);
+    const FrameBufferingScene scene = CreateFrameBufferingScene(*ecs, *graphicsContext);
+    const RegisteredDataStores stores = GetRegisteredDataStores(*renderSystem, *renderContext);
+    ASSERT_TRUE(stores.camera && stores.material);
+
+    IRenderer& renderer = renderContext->GetRenderer();
+    constexpr uint32_t frameLatencies[] = {0U, 1U, 1U, 0U, 0U, 1U};
+    for (uint32_t frame = 0U; frame < countof(frameLatencies); ++frame) {
+        SetFrameLatency(*renderSystem, frameLatencies[frame]);
+        const float x = static_cast<float>(frame);
+        SetPositionX(*ecs, scene.cube, x);
+        ecs->ProcessEvents();
+        ecs->Update(frame + 1U, 1U);
+
+        EXPECT_TRUE(ContainsId(stores.camera->GetCameras(), scene.camera.id));
+        const RenderMeshData* meshData = FindRenderMeshData(*stores.material, scene.cube);
+        ASSERT_NE(nullptr, meshData);
+        EXPECT_FLOAT_EQ(x, meshData->world.w.x);
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+    }
+
+    SetFrameLatency(*renderSystem, 0U);
+    DestroyFrameBufferingScene(*ecs, scene);
+}
+
+/**
+ * @tc.name: RetainedRenderMeshesUpdate
+ * @tc.desc: With retained render meshes the unchanged render meshes are kept in the material data store over frames.
+ *           A moved node, a disabled node and a changed render mesh batch must be updated to the submitted frame,
+ *           with and without frame buffering.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsRenderSystem, RetainedRenderMeshesUpdate, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto graphicsContext = testContext->graphicsContext;
+    auto ecs = testContext->ecs;
+
+    auto* renderSystem = GetSystem<IRenderSystem>(*ecs);
+    ASSERT_NE(nullptr, renderSystem);
+    renderSystem->SetActive(true);
+    auto nodeMgr = GetManager<INodeComponentManager>(*ecs);
+    auto renderMeshMgr = GetManager<IRenderMeshComponentManager>(*ecs);
+    auto renderMeshBatchMgr = GetManager<IRenderMeshBatchComponentManager>(*ecs);
+    ASSERT_TRUE(nodeMgr && renderMeshMgr && renderMeshBatchMgr);
+
+    IRenderer& renderer = renderContext->GetRenderer();
+    uint64_t time = 1U;
+    for (const uint32_t frameLatency : {0U, 1U}) {
+        const FrameBufferingScene scene = CreateFrameBufferingScene(*ecs, *graphicsContext);
+        SetRetainedRenderMeshes(*renderSystem, true);
+        SetFrameLatency(*renderSystem, frameLatency);
+        const RegisteredDataStores stores = GetRegisteredDataStores(*renderSystem, *renderContext);
+        ASSERT_TRUE(stores.material);
+        auto update = [&]() {
+            ecs->ProcessEvents();
+            ecs->Update(time++, 1U);
+        };
+
+        // unchanged frames reuse the kept data
+        for (uint32_t frame = 0U; frame < 3U; ++frame) {
+            update();
+            ASSERT_EQ(1U, CountRenderMeshData(*stores.material, scene.cube));
+            EXPECT_FLOAT_EQ(0.0f, FindRenderMeshData(*stores.material, scene.cube)->world.w.x);
+            renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        }
+
+        // moved node
+        for (uint32_t frame = 1U; frame < 4U; ++frame) {
+            SetPositionX(*ecs, scene.cube, static_cast<float>(frame));
+            update();
+            const RenderMeshData* meshData = FindRenderMeshData(*stores.material, scene.cube);
+            ASSERT_NE(nullptr, meshData);
+            EXPECT_FLOAT_EQ(static_cast<float>(frame), meshData->world.w.x);
+            renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        }
+
+        // disabled node
+        nodeMgr->Write(scene.cube)->enabled = false;
+        update();
+        EXPECT_EQ(0U, CountRenderMeshData(*stores.material, scene.cube));
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        update();
+        EXPECT_EQ(0U, CountRenderMeshData(*stores.material, scene.cube));
+        nodeMgr->Write(scene.cube)->enabled = true;
+        update();
+        EXPECT_EQ(1U, CountRenderMeshData(*stores.material, scene.cube));
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+        // render mesh batch with instance transforms
+        const Entity batch = ecs->GetEntityManager().Create();
+        renderMeshBatchMgr->Create(batch);
+        if (auto batchHandle = renderMeshBatchMgr->Write(batch); batchHandle) {
+            for (const float x : {0.0f, 1.0f, 2.0f}) {
+                batchHandle->instanceTransforms.push_back(Math::Translate(Math::IDENTITY_4X4, Math::Vec3(x, 0.f, 0.f)));
+            }
+        }
+        renderMeshMgr->Write(scene.cube)->renderMeshBatch = batch;
+        update();
+        EXPECT_EQ(3U, CountRenderMeshData(*stores.material, scene.cube));
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        renderMeshBatchMgr->Write(batch)->instanceTransforms.pop_back();
+        update();
+        EXPECT_EQ(2U, CountRenderMeshData(*stores.material, scene.cube));
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        update();
+        EXPECT_EQ(2U, CountRenderMeshData(*stores.material, scene.cube));
+        renderMeshMgr->Write(scene.cube)->renderMeshBatch = {};
+        update();
+        EXPECT_EQ(1U, CountRenderMeshData(*stores.material, scene.cube));
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+        ecs->GetEntityManager().Destroy(batch);
+        SetFrameLatency(*renderSystem, 0U);
+        SetRetainedRenderMeshes(*renderSystem, false);
+        DestroyFrameBufferingScene(*ecs, scene);
+    }
+}
+
+/**
+ * @tc.name: RetainedRenderMeshesDestroy
+ * @tc.desc: A destroyed render mesh entity must be removed from the kept retained render meshes, while the other
+ *           render meshes stay, with and without frame buffering.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsRenderSystem, RetainedRenderMeshesDestroy, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto graphicsContext = testContext->graphicsContext;
+    auto ecs = testContext->ecs;
+
+    auto* renderSystem = GetSystem<IRenderSystem>(*ecs);
+    ASSERT_NE(nullptr, renderSystem);
+    renderSystem->SetActive(true);
+
+    IRenderer& renderer = renderContext->GetRenderer();
+    uint64_t time = 1U;
+    for (const uint32_t frameLatency : {0U, 1U}) {
+        const FrameBufferingScene scene = CreateFrameBufferingScene(*ecs, *graphicsContext);
+        const Entity cube2 =
+            graphicsContext->GetMeshUtil().GenerateCube(*ecs, "retainedCube", Entity{}, 1.0f, 1.0f, 1.0f);
+        SetPositionX(*ecs, cube2, 2.0f);
+        SetRetainedRenderMeshes(*renderSystem, true);
+        SetFrameLatency(*renderSystem, frameLatency);
+        const RegisteredDataStores stores = GetRegisteredDataStores(*renderSystem, *renderContext);
+        ASSERT_TRUE(stores.material);
+
+        for (uint32_t frame = 0U; frame < 3U; ++frame) {
+            ecs->ProcessEvents();
+            ecs->Update(time++, 1U);
+            EXPECT_EQ(1U, CountRenderMeshData(*stores.material, scene.cube));
+            EXPECT_EQ(1U, CountRenderMeshData(*stores.material, cube2));
+            renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        }
+
+        ecs->GetEntityManager().Destroy(cube2);
+        for (uint32_t frame = 0U; frame < 3U; ++frame) {
+            ecs->ProcessEvents();
+            ecs->Update(time++, 1U);
+            EXPECT_EQ(1U, CountRenderMeshData(*stores.material, scene.cube));
+            EXPECT_EQ(0U, CountRenderMeshData(*stores.material, cube2));
+            renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        }
+
+        SetFrameLatency(*renderSystem, 0U);
+        SetRetainedRenderMeshes(*renderSystem, false);
+        DestroyFrameBufferingScene(*ecs, scene);
+    }
+}
+
+/**
+ * @tc.name: RetainedRenderMeshesParentAndDeactivate
+ * @tc.desc: Retained render meshes are updated from the changes only. A render mesh moved with its parent node must be
+ *           updated in the same frame, its previous world matrix must follow when the parent stops, and a deactivated
+ *           entity must be removed and added back when activated.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsRenderSystem, RetainedRenderMeshesParentAndDeactivate, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto graphicsContext = testContext->graphicsContext;
+    auto ecs = testContext->ecs;
+
+    auto* renderSystem = GetSystem<IRenderSystem>(*ecs);
+    ASSERT_NE(nullptr, renderSystem);
+    renderSystem->SetActive(true);
+    auto* nodeSystem = GetSystem<INodeSystem>(*ecs);
+    ASSERT_NE(nullptr, nodeSystem);
+
+    IRenderer& renderer = renderContext->GetRenderer();
+    uint64_t time = 1U;
+    const FrameBufferingScene scene = CreateFrameBufferingScene(*ecs, *graphicsContext);
+    ISceneNode* parent = nodeSystem->CreateNode();
+    ISceneNode* cubeNode = nodeSystem->GetNode(scene.cube);
+    ASSERT_TRUE(parent && cubeNode);
+    cubeNode->SetParent(*parent);
+    SetRetainedRenderMeshes(*renderSystem, true);
+    const RegisteredDataStores stores = GetRegisteredDataStores(*renderSystem, *renderContext);
+    ASSERT_TRUE(stores.material);
+    auto update = [&]() {
+        ecs->ProcessEvents();
+        ecs->Update(time++, 1U);
+    };
+    update();
+    renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+    // only the parent is changed, the world matrix of the cube is written by the node system during the update
+    for (uint32_t frame = 1U; frame < 4U; ++frame) {
+        SetPositionX(*ecs, parent->GetEntity(), static_cast<float>(frame));
+        update();
+        const RenderMeshData* meshData = FindRenderMeshData(*stores.material, scene.cube);
+        ASSERT_NE(nullptr, meshData);
+        EXPECT_FLOAT_EQ(static_cast<float>(frame), meshData->world.w.x);
+        EXPECT_FLOAT_EQ(static_cast<float>(frame - 1U), meshData->prevWorld.w.x);
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+    }
+    update();
+    {
+        const RenderMeshData* meshData = FindRenderMeshData(*stores.material, scene.cube);
+        ASSERT_NE(nullptr, meshData);
+        EXPECT_FLOAT_EQ(3.0f, meshData->world.w.x);
+        EXPECT_FLOAT_EQ(3.0f, meshData->prevWorld.w.x);
+    }
+    renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+    ecs->GetEntityManager().SetActive(scene.cube, false);
+    update();
+    EXPECT_EQ(0U, CountRenderMeshData(*stores.material, scene.cube));
+    renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+    ecs->GetEntityManager().SetActive(scene.cube, true);
+    update();
+    EXPECT_EQ(1U, CountRenderMeshData(*stores.material, scene.cube));
+    renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+    SetRetainedRenderMeshes(*renderSystem, false);
+    cubeNode->SetParent(nodeSystem->GetRootNode());
+    nodeSystem->DestroyNode(*parent);
+    DestroyFrameBufferingScene(*ecs, scene);
+}
+
+/**
+ * @tc.name: InstancedRenderMeshBatch
+ * @tc.desc: A render mesh batch with instance transforms submits one render mesh per transform, placed with the
+ *           world matrix of the render mesh, with and without frame buffering.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsRenderSystem, InstancedRenderMeshBatch, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto graphicsContext = testContext->graphicsContext;
+    auto ecs = testContext->ecs;
+
+    auto* renderSystem = GetSystem<IRenderSystem>(*ecs);
+    ASSERT_NE(nullptr, renderSystem);
+    renderSystem->SetActive(true);
+    auto renderMeshMgr = GetManager<IRenderMeshComponentManager>(*ecs);
+    auto renderMeshBatchMgr = GetManager<IRenderMeshBatchComponentManager>(*ecs);
+    ASSERT_TRUE(renderMeshMgr && renderMeshBatchMgr);
+
+    auto instancePositionsMatch = [](const IRenderDataStoreDefaultMaterial& dataStore, const Entity entity,
+                                      const array_view<const float> positions) {
+        uint32_t instance = 0U;
+        for (const auto& meshData : dataStore.GetMeshData()) {
+            if (meshData.id != entity.id) {
+                continue;
+            }
+            if ((instance >= positions.size()) || (meshData.world.w.x != positions[instance])) {
+                return false;
+            }
+            ++instance;
+        }
+        return instance == positions.size();
+    };
+
+    IRenderer& renderer = renderContext->GetRenderer();
+    uint64_t time = 1U;
+    for (const uint32_t frameLatency : {0U, 1U}) {
+        const FrameBufferingScene scene = CreateFrameBufferingScene(*ecs, *graphicsContext);
+        SetFrameLatency(*renderSystem, frameLatency);
+        const RegisteredDataStores stores = GetRegisteredDataStores(*renderSystem, *renderContext);
+        ASSERT_TRUE(stores.material);
+        SetPositionX(*ecs, scene.cube, 10.0f);
+
+        const Entity batch = ecs->GetEntityManager().Create();
+        renderMeshBatchMgr->Create(batch);
+        if (auto batchHandle = renderMeshBatchMgr->Write(batch); batchHandle) {
+            for (const float x : {0.0f, 1.0f, 2.0f}) {
+                batchHandle->instanceTransforms.push_back(Math::Translate(Math::IDENTITY_4X4, Math::Vec3(x, 0.f, 0.f)));
+            }
+        }
+        renderMeshMgr->Write(scene.cube)->renderMeshBatch = batch;
+        for (uint32_t frame = 0U; frame < 2U; ++frame) {
+            ecs->ProcessEvents();
+            ecs->Update(time++, 1U);
+            constexpr float positions[] = {10.0f, 11.0f, 12.0f};
+            EXPECT_TRUE(instancePositionsMatch(*stores.material, scene.cube, positions));
+            renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+        }
+
+        // the transforms are copied, so changing them between frames is safe
+        if (auto batchHandle = renderMeshBatchMgr->Write(batch); batchHandle) {
+            batchHandle->instanceTransforms.clear();
+            batchHandle->instanceTransforms.push_back(Math::Translate(Math::IDENTITY_4X4, Math::Vec3(5.f, 0.f, 0.f)));
+        }
+        ecs->ProcessEvents();
+        ecs->Update(time++, 1U);
+        {
+            constexpr float positions[] = {15.0f};
+            EXPECT_TRUE(instancePositionsMatch(*stores.material, scene.cube, positions));
+        }
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+        renderMeshMgr->Write(scene.cube)->renderMeshBatch = {};
+        ecs->GetEntityManager().Destroy(batch);
+        ecs->ProcessEvents();
+        ecs->Update(time++, 1U);
+        EXPECT_EQ(1U, CountRenderMeshData(*stores.material, scene.cube));
+        renderer.RenderFrame(graphicsContext->GetRenderNodeGraphs(*ecs));
+
+        SetFrameLatency(*renderSystem, 0U);
+        DestroyFrameBufferingScene(*ecs, scene);
+    }
+}
@@ -707,3 +707,190 @@ UNIT_TEST(API_RenderDataStoreDefaultMaterial, RenderSceneBoundingTest, testing::
     renderContext->GetRenderer().RenderFrame({});
     EXPECT_FALSE(dsManager.GetRenderDataStore(dataStoreName));
 }
+
+/**
+ * @tc.name: RetainedRenderMeshTest
+ * @tc.desc: Tests that retained render meshes are submitted every frame until destroyed.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_RenderDataStoreDefaultMaterial, RetainedRenderMeshTest, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+
+    auto& dsManager = renderContext->GetRenderDataStoreManager();
+
+    constexpr BASE_NS::string_view dataStoreName = "DataStoreDefaultMaterial0";
+    auto dataStore = dsManager.Create(IRenderDataStoreDefaultMaterial::UID, dataStoreName.data());
+    ASSERT_TRUE(dataStore);
+
+    auto dataStoreDefaultMaterial = static_cast<IRenderDataStoreDefaultMaterial*>(dataStore.get());
+
+    constexpr uint64_t materialId = 14;
+    {
+        RenderDataDefaultMaterial::InputMaterialUniforms uniforms;
+        RenderDataDefaultMaterial::MaterialData data;
+        dataStoreDefaultMaterial->UpdateMaterialData(materialId, uniforms, {}, data);
+    }
+    {
+        MeshDataWithHandleReference mesh;
+        mesh.meshId = 1ULL;
+        mesh.submeshes.resize(1U);
+        mesh.submeshes[0].materialId = materialId;
+        mesh.submeshes[0].aabbMin = {-0.25f, -0.25f, -0.25f};
+        mesh.submeshes[0].aabbMax = {0.75f, 0.75f, 0.75f};
+        dataStoreDefaultMaterial->UpdateMeshData(1ULL, mesh);
+    }
+    RenderMeshData rmd;
+    rmd.id = 9ULL;
+    rmd.meshId = 1ULL;
+    rmd.world = Math::IDENTITY_4X4;
+    dataStoreDefaultMaterial->SetRetainedRenderMeshData(rmd.id, {&rmd, 1U}, {});
+
+    // the first frames build the submission, the later ones reuse it
+    for (uint32_t frame = 0U; frame < 4U; ++frame) {
+        dataStoreDefaultMaterial->Clear();
+        dataStoreDefaultMaterial->SubmitFrameMeshData();
+        ASSERT_EQ(1U, dataStoreDefaultMaterial->GetMeshData().size());
+        ASSERT_EQ(1U, dataStoreDefaultMaterial->GetSubmeshes().size());
+        EXPECT_EQ(rmd.id, dataStoreDefaultMaterial->GetSubmeshes()[0].indices.id);
+        EXPECT_EQ(0.25f, dataStoreDefaultMaterial->GetRenderFrameObjectInfo().shadowCasterBoundingSphere.center.x);
+    }
+
+    // frame only render mesh data is added with the retained data
+    {
+        dataStoreDefaultMaterial->Clear();
+        RenderMeshData frameRmd = rmd;
+        frameRmd.id = 10ULL;
+        dataStoreDefaultMaterial->AddFrameRenderMeshData(frameRmd);
+        dataStoreDefaultMaterial->SubmitFrameMeshData();
+        EXPECT_EQ(2U, dataStoreDefaultMaterial->GetMeshData().size());
+    }
+    {
+        dataStoreDefaultMaterial->Clear();
+        dataStoreDefaultMaterial->SubmitFrameMeshData();
+        EXPECT_EQ(1U, dataStoreDefaultMaterial->GetMeshData().size());
+    }
+
+    // a changed transform is used in the next submission
+    rmd.world.w = {1.0f, 0.0f, 0.0f, 1.0f};
+    dataStoreDefaultMaterial->SetRetainedRenderMeshData(rmd.id, {&rmd, 1U}, {});
+    dataStoreDefaultMaterial->Clear();
+    dataStoreDefaultMaterial->SubmitFrameMeshData();
+    ASSERT_EQ(1U, dataStoreDefaultMaterial->GetMeshData().size());
+    EXPECT_EQ(1.25f, dataStoreDefaultMaterial->GetRenderFrameObjectInfo().shadowCasterBoundingSphere.center.x);
+
+    dataStoreDefaultMaterial->DestroyRetainedRenderMeshData(rmd.id);
+    dataStoreDefaultMaterial->Clear();
+    dataStoreDefaultMaterial->SubmitFrameMeshData();
+    EXPECT_EQ(0U, dataStoreDefaultMaterial->GetMeshData().size());
+    EXPECT_EQ(0U, dataStoreDefaultMaterial->GetSubmeshes().size());
+
+    // Destruction is deferred
+    dataStore.reset();
+    // Render with no render node graph just to trigger destruction
+    renderContext->GetRenderer().RenderFrame({});
+    EXPECT_FALSE(dsManager.GetRenderDataStore(dataStoreName));
+}
+
+/**
+ * @tc.name: RetainedRenderMeshPatchTest
+ * @tc.desc: Tests that moved retained render meshes are patched to the kept frame data. The submesh bounds and the
+ *           shadow caster bounds follow the moved render mesh and are the same as before when it is moved back.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_RenderDataStoreDefaultMaterial, RetainedRenderMeshPatchTest, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+
+    auto& dsManager = renderContext->GetRenderDataStoreManager();
+
+    constexpr BASE_NS::string_view dataStoreName = "DataStoreDefaultMaterial0";
+    auto dataStore = dsManager.Create(IRenderDataStoreDefaultMaterial::UID, dataStoreName.data());
+    ASSERT_TRUE(dataStore);
+
+    auto dataStoreDefaultMaterial = static_cast<IRenderDataStoreDefaultMaterial*>(dataStore.get());
+
+    constexpr uint64_t materialId = 14;
+    {
+        RenderDataDefaultMaterial::InputMaterialUniforms uniforms;
+        RenderDataDefaultMaterial::MaterialData data;
+        dataStoreDefaultMaterial->UpdateMaterialData(materialId, uniforms, {}, data);
+    }
+    {
+        MeshDataWithHandleReference mesh;
+        mesh.meshId = 1ULL;
+        mesh.submeshes.resize(1U);
+        mesh.submeshes[0].materialId = materialId;
+        mesh.submeshes[0].aabbMin = {-0.5f, -0.5f, -0.5f};
+        mesh.submeshes[0].aabbMax = {0.5f, 0.5f, 0.5f};
+        dataStoreDefaultMaterial->UpdateMeshData(1ULL, mesh);
+    }
+    RenderMeshData rmds[2U];
+    for (uint32_t idx = 0U; idx < countof(rmds); ++idx) {
+        rmds[idx].id = 9ULL + idx;
+        rmds[idx].meshId = 1ULL;
+        rmds[idx].world = Math::IDENTITY_4X4;
+        rmds[idx].world.w = {2.0f * static_cast<float>(idx), 0.0f, 0.0f, 1.0f};
+        dataStoreDefaultMaterial->SetRetainedRenderMeshData(rmds[idx].id, {&rmds[idx], 1U}, {});
+    }
+    auto submitFrame = [dataStoreDefaultMaterial]() {
+        dataStoreDefaultMaterial->Clear();
+        dataStoreDefaultMaterial->SubmitFrameMeshData();
+        return dataStoreDefaultMaterial->GetRenderFrameObjectInfo().shadowCasterBoundingSphere;
+    };
+    auto findSubmesh = [dataStoreDefaultMaterial](const uint64_t id) -> const RenderSubmesh* {
+        for (const auto& submesh : dataStoreDefaultMaterial->GetSubmeshes()) {
+            if (submesh.indices.id == id) {
+                return &submesh;
+            }
+        }
+        return nullptr;
+    };
+    submitFrame();
+    const RenderBoundingSphere sphere = submitFrame();
+    EXPECT_FLOAT_EQ(1.0f, sphere.center.x);
+    ASSERT_EQ(2U, dataStoreDefaultMaterial->GetMeshData().size());
+
+    // moving the second render mesh away updates its bounds and grows the shadow caster bounds
+    rmds[1U].world.w.x = 10.0f;
+    dataStoreDefaultMaterial->SetRetainedRenderMeshData(rmds[1U].id, {&rmds[1U], 1U}, {});
+    const RenderBoundingSphere movedSphere = submitFrame();
+    ASSERT_EQ(2U, dataStoreDefaultMaterial->GetMeshData().size());
+    ASSERT_EQ(2U, dataStoreDefaultMaterial->GetSubmeshes().size());
+    const RenderSubmesh* submesh = findSubmesh(rmds[1U].id);
+    ASSERT_NE(nullptr, submesh);
+    EXPECT_FLOAT_EQ(10.0f, submesh->bounds.worldCenter.x);
+    EXPECT_FLOAT_EQ(10.0f, dataStoreDefaultMaterial->GetMeshData()[submesh->indices.meshIndex].world.w.x);
+    EXPECT_FLOAT_EQ(5.0f, movedSphere.center.x);
+    EXPECT_GT(movedSphere.radius, sphere.radius);
+    submesh = findSubmesh(rmds[0U].id);
+    ASSERT_NE(nullptr, submesh);
+    EXPECT_FLOAT_EQ(0.0f, submesh->bounds.worldCenter.x);
+
+    // moving it back gives the original bounds
+    rmds[1U].world.w.x = 2.0f;
+    dataStoreDefaultMaterial->SetRetainedRenderMeshData(rmds[1U].id, {&rmds[1U], 1U}, {});
+    const RenderBoundingSphere restoredSphere = submitFrame();
+    EXPECT_FLOAT_EQ(sphere.center.x, restoredSphere.center.x);
+    EXPECT_FLOAT_EQ(sphere.radius, restoredSphere.radius);
+    submesh = findSubmesh(rmds[1U].id);
+    ASSERT_NE(nullptr, submesh);
+    EXPECT_FLOAT_EQ(2.0f, submesh->bounds.worldCenter.x);
+
+    // a changed layer mask is not patched but rebuilt
+    rmds[0U].layerMask = 2ULL;
+    dataStoreDefaultMaterial->SetRetainedRenderMeshData(rmds[0U].id, {&rmds[0U], 1U}, {});
+    submitFrame();
+    submesh = findSubmesh(rmds[0U].id);
+    ASSERT_NE(nullptr, submesh);
+    EXPECT_EQ(2ULL, submesh->layers.layerMask);
+    EXPECT_EQ(2U, dataStoreDefaultMaterial->GetSubmeshes().size());
+
+    // Destruction is deferred
+    dataStore.reset();
+    // Render with no render node graph just to trigger destruction
+    renderContext->GetRenderer().RenderFrame({});
+    EXPECT_FALSE(dsManager.GetRenderDataStore(dataStoreName));
+}
@@ -361,6 +361,79 @@ UNIT_TEST(API_UtilPicking, RayCastTest, testing::ext::TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: RayCastManyRenderMeshesTest
+ * @tc.desc: Tests ray casting a scene with enough render meshes to use the bounding volume hierarchy, also after moving
+ * and removing meshes.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_UtilPicking, RayCastManyRenderMeshesTest, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto ecs = testContext->ecs;
+
+    auto picking = GetInstance<IPicking>(*renderContext->GetInterface<IClassRegister>(), UID_PICKING);
+    ASSERT_NE(nullptr, picking);
+    auto nodeSystem = GetSystem<INodeSystem>(*ecs);
+    ASSERT_NE(nullptr, nodeSystem);
+    auto renderMeshManager = GetManager<IRenderMeshComponentManager>(*ecs);
+    ASSERT_NE(nullptr, renderMeshManager);
+
+    // A row of unit cubes far away from the other test objects.
+    constexpr uint32_t nodeCount = 200U;
+    constexpr float height = 1000.0f;
+    vector<ISceneNode*> nodes;
+    for (uint32_t i = 0U; i < nodeCount; ++i) {
+        ISceneNode* node = nodeSystem->CreateNode();
+        SetAabb(node->GetEntity(), *ecs, Math::Vec3{-1.0f, -1.0f, -1.0f}, Math::Vec3{1.0f, 1.0f, 1.0f});
+        SetWorldMatrixFromPosition(node->GetEntity(), *ecs, Math::Vec3{static_cast<float>(i) * 3.0f, height, 0.0f});
+        nodes.push_back(node);
+    }
+    const Math::Vec3 direction{0.0f, 0.0f, -1.0f};
+    const auto rayStart = [](uint32_t index) { return Math::Vec3{static_cast<float>(index) * 3.0f, height, 10.0f}; };
+
+    for (uint32_t i = 0U; i < nodeCount; i += 7U) {
+        auto result = picking->RayCast(*ecs, rayStart(i), direction);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ(nodes[i], result[0].node);
+        EXPECT_FLOAT_EQ(9.0f, result[0].distance);
+    }
+    {
+        // Along the row every cube is hit, nearest first.
+        auto result = picking->RayCast(*ecs, Math::Vec3{-10.0f, height, 0.0f}, Math::Vec3{1.0f, 0.0f, 0.0f});
+        ASSERT_EQ(nodeCount, result.size());
+        EXPECT_EQ(nodes[0], result[0].node);
+        EXPECT_EQ(nodes[nodeCount - 1U], result[nodeCount - 1U].node);
+    }
+
+    // Moved meshes are found from their new position.
+    SetWorldMatrixFromPosition(nodes[10]->GetEntity(), *ecs, Math::Vec3{30.0f, height + 5.0f, 0.0f});
+    {
+        auto result = picking->RayCast(*ecs, rayStart(10U), direction);
+        EXPECT_EQ(0, result.size());
+        result = picking->RayCast(*ecs, rayStart(10U) + Math::Vec3{0.0f, 5.0f, 0.0f}, direction);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ(nodes[10], result[0].node);
+    }
+
+    // Removed meshes are not found.
+    renderMeshManager->Destroy(nodes[20]->GetEntity());
+    ecs->ProcessEvents();
+    {
+        auto result = picking->RayCast(*ecs, rayStart(20U), direction);
+        EXPECT_EQ(0, result.size());
+        result = picking->RayCast(*ecs, rayStart(21U), direction);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ(nodes[21], result[0].node);
+    }
+
+    for (auto* node : nodes) {
+        nodeSystem->DestroyNode(*node);
+    }
+    ecs->ProcessEvents();
+}
+
 /**
  * @tc.name: RayTriangleCastTest
  * @tc.desc: Tests for Ray Triangle Cast Test. [AUTO-GENERATED]
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <limits>
+#include <random>
+#include <util/aabb_tree.h>
+
+#include <3d/util/intf_picking.h>
+#include <base/containers/vector.h>
+#include <base/math/mathf.h>
+#include <base/math/vector.h>
+
+CORE3D_BEGIN_NAMESPACE()
+namespace benchmarks {
+namespace {
+constexpr int RAY_COUNT = 256;
+
+struct Ray {
+    BASE_NS::Math::Vec3 start;
+    BASE_NS::Math::Vec3 invDirection;
+};
+
+// Same slab test as Picking uses for each render mesh.
+bool IntersectRay(const MinAndMax& bounds, const Ray& ray)
+{
+    using namespace BASE_NS;
+    const float tx1 = (bounds.minAABB.x - ray.start.x) * ray.invDirection.x;
+    const float tx2 = (bounds.maxAABB.x - ray.start.x) * ray.invDirection.x;
+    float tmin = Math::min(tx1, tx2);
+    float tmax = Math::max(tx1, tx2);
+    const float ty1 = (bounds.minAABB.y - ray.start.y) * ray.invDirection.y;
+    const float ty2 = (bounds.maxAABB.y - ray.start.y) * ray.invDirection.y;
+    tmin = Math::max(tmin, Math::min(ty1, ty2));
+    tmax = Math::min(tmax, Math::max(ty1, ty2));
+    const float tz1 = (bounds.minAABB.z - ray.start.z) * ray.invDirection.z;
+    const float tz2 = (bounds.maxAABB.z - ray.start.z) * ray.invDirection.z;
+    tmin = Math::max(tmin, Math::min(tz1, tz2));
+    tmax = Math::min(tmax, Math::max(tz1, tz2));
+    return tmax >= tmin && tmax > 0.0f;
+}
+
+// Small boxes scattered in a large volume, like the parts of a CAD model.
+BASE_NS::vector<MinAndMax> CreateBoxes(size_t count, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<float> size(0.5f, 5.0f);
+    BASE_NS::vector<MinAndMax> boxes(count);
+    for (auto& box : boxes) {
+        const BASE_NS::Math::Vec3 center(position(rng), position(rng), position(rng));
+        const BASE_NS::Math::Vec3 extents(size(rng), size(rng), size(rng));
+        box.minAABB = center - extents;
+        box.maxAABB = center + extents;
+    }
+    return boxes;
+}
+
+BASE_NS::vector<Ray> CreateRays(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+    BASE_NS::vector<Ray> rays(RAY_COUNT);
+    for (auto& ray : rays) {
+        ray.start = BASE_NS::Math::Vec3(position(rng), position(rng), position(rng));
+        const BASE_NS::Math::Vec3 direction(position(rng), position(rng), position(rng));
+        ray.invDirection = BASE_NS::Math::Vec3(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+    }
+    return rays;
+}
+}  // namespace
+
+// Baseline: test every box like Picking::RayCast did before the tree.
+void RayCastBruteForce(benchmark::State& state)
+{
+    std::mt19937 rng(1U);
+    const auto boxes = CreateBoxes(static_cast<size_t>(state.range(0)), rng);
+    const auto rays = CreateRays(rng);
+    for (auto _ : state) {
+        size_t hits = 0U;
+        for (const auto& ray : rays) {
+            for (const auto& box : boxes) {
+                hits += IntersectRay(box, ray) ? 1U : 0U;
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * RAY_COUNT);
+}
+
+void RayCastAabbTree(benchmark::State& state)
+{
+    std::mt19937 rng(1U);
+    const auto boxes = CreateBoxes(static_cast<size_t>(state.range(0)), rng);
+    const auto rays = CreateRays(rng);
+    AabbTree tree;
+    tree.Build(boxes);
+    for (auto _ : state) {
+        size_t hits = 0U;
+        for (const auto& ray : rays) {
+            tree.RayCast(ray.start, ray.invDirection,
+                [&](uint32_t item) { hits += IntersectRay(boxes[item], ray) ? 1U : 0U; });
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * RAY_COUNT);
+}
+
+// Cost of keeping the tree up to date when the objects move.
+void AabbTreeBuild(benchmark::State& state)
+{
+    std::mt19937 rng(1U);
+    const auto boxes = CreateBoxes(static_cast<size_t>(state.range(0)), rng);
+    AabbTree tree;
+    for (auto _ : state) {
+        tree.Build(boxes);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void AabbTreeRefit(benchmark::State& state)
+{
+    std::mt19937 rng(1U);
+    const auto boxes = CreateBoxes(static_cast<size_t>(state.range(0)), rng);
+    AabbTree tree;
+    tree.Build(boxes);
+    for (auto _ : state) {
+        tree.Refit(boxes);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Argument is the number of boxes (render meshes).
+BENCHMARK(RayCastBruteForce)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(RayCastAabbTree)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(AabbTreeBuild)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(AabbTreeRefit)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+}  // namespace benchmarks
+CORE3D_END_NAMESPACE()
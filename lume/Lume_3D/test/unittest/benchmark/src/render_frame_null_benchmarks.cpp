@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <chrono>
+
+#include <3d/ecs/components/light_component.h>
+#include <3d/ecs/components/transform_component.h>
+#include <3d/implementation_uids.h>
+#include <3d/intf_graphics_context.h>
+#include <3d/util/intf_mesh_util.h>
+#include <3d/util/intf_scene_util.h>
+#include <base/containers/string.h>
+#include <base/math/quaternion_util.h>
+#include <base/math/vector.h>
+#include <core/ecs/intf_ecs.h>
+#include <core/ecs/intf_system_graph_loader.h>
+#include <core/engine_info.h>
+#include <core/implementation_uids.h>
+#include <core/intf_engine.h>
+#include <core/os/platform_create_info.h>
+#include <core/perf/intf_performance_data_manager.h>
+#include <core/plugin/intf_plugin_register.h>
+#include <render/device/intf_device.h>
+#include <render/implementation_uids.h>
+#include <render/intf_render_context.h>
+#include <render/intf_renderer.h>
+#include <render/null/intf_device_null.h>
+
+// Renders a scene with the null backend to measure the CPU cost of a frame without any GPU work.
+#if RENDER_HAS_NULL_BACKEND
+CORE3D_BEGIN_NAMESPACE()
+namespace benchmarks {
+namespace {
+constexpr uint32_t WARM_UP_FRAMES = 3U;
+constexpr BASE_NS::Math::UVec2 RESOLUTION{1920U, 1080U};
+
+struct FrameContext {
+    CORE_NS::IEngine::Ptr engine;
+    RENDER_NS::IRenderContext::Ptr renderContext;
+    IGraphicsContext::Ptr graphicsContext;
+    CORE_NS::IEcs::Ptr ecs;
+
+    ~FrameContext()
+    {
+        ecs.reset();
+        graphicsContext.reset();
+        renderContext.reset();
+        engine.reset();
+    }
+};
+
+bool LoadPlugins()
+{
+    static const bool loaded = [] {
+        CORE_NS::CreatePluginRegistry(CORE_NS::PlatformCreateInfo{});
+        constexpr BASE_NS::Uid uids[] = {RENDER_NS::UID_RENDER_PLUGIN, UID_3D_PLUGIN};
+        return CORE_NS::GetPluginRegister().LoadPlugins(uids);
+    }();
+    return loaded;
+}
+
+bool CreateContext(FrameContext& context)
+{
+    const CORE_NS::EngineCreateInfo engineCreateInfo{CORE_NS::PlatformCreateInfo{}, {"benchmark", 0, 1, 0}, {}};
+    auto engineFactory = CORE_NS::GetInstance<CORE_NS::IEngineFactory>(CORE_NS::UID_ENGINE_FACTORY);
+    context.engine = engineFactory->Create(engineCreateInfo);
+    context.engine->Init();
+
+    context.renderContext = static_cast<RENDER_NS::IRenderContext::Ptr>(
+        context.engine->GetInterface<CORE_NS::IClassFactory>()->CreateInstance(RENDER_NS::UID_RENDER_CONTEXT));
+    RENDER_NS::DeviceCreateInfo deviceCreateInfo;
+    deviceCreateInfo.backendType = RENDER_NS::DeviceBackendType::NULL_BACKEND;
+    const RENDER_NS::RenderCreateInfo renderCreateInfo{{"benchmark", 1, 0, 0}, deviceCreateInfo};
+    if (context.renderContext->Init(renderCreateInfo) != RENDER_NS::RenderResultCode::RENDER_SUCCESS) {
+        return false;
+    }
+
+    context.graphicsContext = CORE_NS::CreateInstance<IGraphicsContext>(
+        *context.renderContext->GetInterface<CORE_NS::IClassFactory>(), UID_GRAPHICS_CONTEXT);
+    context.graphicsContext->Init();
+
+    context.ecs = context.engine->CreateEcs();
+    auto loaderFactory = CORE_NS::GetInstance<CORE_NS::ISystemGraphLoaderFactory>(CORE_NS::UID_SYSTEM_GRAPH_LOADER);
+    auto systemGraphLoader = loaderFactory->Create(context.engine->GetFileManager());
+    if (!systemGraphLoader->Load("rofs3D://systemGraph.json", *context.ecs).success) {
+        return false;
+    }
+    context.ecs->Initialize();
+    return true;
+}
+
+// A camera, a shadow casting light and a grid of cubes in front of the camera.
+void CreateScene(FrameContext& context, uint32_t cubeCount)
+{
+    using namespace BASE_NS::Math;
+    CORE_NS::IEcs& ecs = *context.ecs;
+    ISceneUtil& sceneUtil = context.graphicsContext->GetSceneUtil();
+    const CORE_NS::Entity camera = sceneUtil.CreateCamera(ecs, Vec3(0.f, 0.f, 60.f), {}, 0.1f, 200.f, 60.f);
+    sceneUtil.UpdateCameraViewport(ecs, camera, RESOLUTION);
+
+    LightComponent light;
+    light.type = LightComponent::Type::DIRECTIONAL;
+    light.shadowEnabled = true;
+    sceneUtil.CreateLight(ecs, light, Vec3(0.f, 50.f, 0.f), AngleAxis(-PI * 0.5f, Vec3(1.f, 0.f, 0.f)));
+
+    auto* transformManager = CORE_NS::GetManager<ITransformComponentManager>(ecs);
+    IMeshUtil& meshUtil = context.graphicsContext->GetMeshUtil();
+    constexpr uint32_t columns = 32U;
+    for (uint32_t idx = 0U; idx < cubeCount; ++idx) {
+        const CORE_NS::Entity cube = meshUtil.GenerateCube(ecs, "cube" + BASE_NS::to_string(idx), {}, 1.f, 1.f, 1.f);
+        if (auto handle = transformManager->Write(cube); handle) {
+            handle->position = Vec3(static_cast<float>(idx % columns) * 2.f - columns,
+                static_cast<float>(idx / columns) * 2.f - columns, 0.f);
+        }
+    }
+}
+
+// Per stage CPU times are read from the performance data which the renderer records only when the render plugin is
+// built with RENDER_PERF_ENABLED=1. Without it the stage counters are not reported.
+constexpr BASE_NS::string_view RENDER_PERF_CATEGORIES[] = {"RENDER", "RenderNode"};
+
+CORE_NS::IPerformanceDataManager* GetPerformanceData(BASE_NS::string_view category)
+{
+    auto* factory = CORE_NS::GetInstance<CORE_NS::IPerformanceDataManagerFactory>(CORE_NS::UID_PERFORMANCE_FACTORY);
+    return factory ? factory->Get(category) : nullptr;
+}
+
+void ResetStageTimes()
+{
+    for (const auto category : RENDER_PERF_CATEGORIES) {
+        if (auto* perfData = GetPerformanceData(category); perfData) {
+            perfData->ResetData();
+        }
+    }
+}
+
+// Adds the per frame average of a stage time recorded since ResetStageTimes. An empty subcategory sums the time over
+// all the subcategories, e.g. over the render nodes.
+void AddStageCounter(benchmark::State& state, BASE_NS::string_view category, BASE_NS::string_view subCategory,
+    BASE_NS::string_view name, const char* counter)
+{
+    const auto* perfData = GetPerformanceData(category);
+    if (!perfData) {
+        return;
+    }
+    int64_t totalMicros = 0;
+    bool found = false;
+    for (const auto& data : perfData->GetData()) {
+        if (!subCategory.empty() && (BASE_NS::string_view(data.subCategory) != subCategory)) {
+            continue;
+        }
+        for (const auto& timing : data.timings) {
+            if (BASE_NS::string_view(timing.first) == name) {
+                totalMicros += timing.second.totalTime;
+                found = true;
+            }
+        }
+    }
+    if (found) {
+        state.counters[counter] =
+            benchmark::Counter(static_cast<double>(totalMicros), benchmark::Counter::kAvgIterations);
+    }
+}
+
+// One application frame: ECS update followed by rendering. Returns the time of each part in microseconds.
+void RenderFrame(FrameContext& context, int64_t& updateMicros, int64_t& renderMicros)
+{
+    using Clock = std::chrono::steady_clock;
+    auto* ecs = context.ecs.get();
+    const auto start = Clock::now();
+    context.engine->TickFrame(BASE_NS::array_view(&ecs, 1));
+    const auto updated = Clock::now();
+    context.renderContext->GetRenderer().RenderFrame(context.graphicsContext->GetRenderNodeGraphs(*ecs));
+    const auto rendered = Clock::now();
+    updateMicros = std::chrono::duration_cast<std::chrono::microseconds>(updated - start).count();
+    renderMicros = std::chrono::duration_cast<std::chrono::microseconds>(rendered - updated).count();
+}
+}  // namespace
+
+// Argument is the number of cubes in the scene.
+void RenderFrameNull(benchmark::State& state)
+{
+    FrameContext context;
+    if (!LoadPlugins() || !CreateContext(context)) {
+        state.SkipWithError("failed to create the null backend context");
+        return;
+    }
+    CreateScene(context, static_cast<uint32_t>(state.range(0)));
+
+    int64_t updateMicros = 0;
+    int64_t renderMicros = 0;
+    // the first frames create the render node graphs, pipelines and resources
+    for (uint32_t idx = 0U; idx < WARM_UP_FRAMES; ++idx) {
+        RenderFrame(context, updateMicros, renderMicros);
+    }
+
+    int64_t totalUpdateMicros = 0;
+    int64_t totalRenderMicros = 0;
+    ResetStageTimes();
+    for (auto _ : state) {
+        RenderFrame(context, updateMicros, renderMicros);
+        totalUpdateMicros += updateMicros;
+        totalRenderMicros += renderMicros;
+    }
+
+    const auto& device =
+        static_cast<const RENDER_NS::ILowLevelDeviceNull&>(context.renderContext->GetDevice().GetLowLevelDevice());
+    const RENDER_NS::FrameStatisticsNull stats = device.GetFrameStatistics();
+    state.counters["update_us"] =
+        benchmark::Counter(static_cast<double>(totalUpdateMicros), benchmark::Counter::kAvgIterations);
+    state.counters["render_us"] =
+        benchmark::Counter(static_cast<double>(totalRenderMicros), benchmark::Counter::kAvgIterations);
+    AddStageCounter(state, "RENDER", "RenderBackend", "Full_Cpu", "backend_full_us");
+    AddStageCounter(state, "RENDER", "RenderBackend", "Execute_Cpu", "backend_execute_us");
+    AddStageCounter(state, "RENDER", "RenderBackend", "Submit_Cpu", "backend_submit_us");
+    AddStageCounter(state, "RenderNode", {}, "Backend_Cpu", "render_node_backend_us");
+    state.counters["command_lists"] = stats.commandListCount;
+    state.counters["commands"] = stats.commandCount;
+    state.counters["render_passes"] = stats.renderPassCount;
+    state.counters["draws"] = stats.drawCount + stats.drawIndirectCount;
+    state.counters["dispatches"] = stats.dispatchCount + stats.dispatchIndirectCount;
+    state.counters["pipeline_binds"] = stats.pipelineBindCount;
+    state.counters["descriptor_set_updates"] = stats.descriptorSetUpdateCount;
+    if (stats.validationErrorCount > 0U) {
+        state.SkipWithError("the null backend found invalid render commands");
+    }
+}
+
+BENCHMARK(RenderFrameNull)->Arg(1)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+}  // namespace benchmarks
+CORE3D_END_NAMESPACE()
+#endif  // RENDER_HAS_NULL_BACKEND
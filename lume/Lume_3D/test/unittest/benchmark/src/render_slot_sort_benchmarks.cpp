@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <render/render_node_scene_util.h>
+
+#include <3d/render/render_data_defines_3d.h>
+#include <base/containers/vector.h>
+#include <core/implementation_uids.h>
+#include <core/os/platform_create_info.h>
+#include <core/plugin/intf_class_register.h>
+#include <core/plugin/intf_plugin_register.h>
+#include <core/threading/intf_thread_pool.h>
+
+CORE3D_BEGIN_NAMESPACE()
+namespace benchmarks {
+namespace {
+// Sort keys like a depth sorted slot: a few sort layers and 32 bit depths with the render sort hash below them.
+BASE_NS::vector<SlotSubmeshIndex> CreateSubmeshes(size_t count)
+{
+    std::mt19937 rng(1U);
+    std::uniform_int_distribution<uint32_t> layer(0U, 3U);
+    std::uniform_int_distribution<uint32_t> value;
+    BASE_NS::vector<SlotSubmeshIndex> submeshes(count);
+    for (size_t idx = 0U; idx < count; ++idx) {
+        submeshes[idx].submeshIndex = static_cast<uint32_t>(idx);
+        submeshes[idx].sortLayerKey = layer(rng) << 8U;
+        submeshes[idx].sortKey = (static_cast<uint64_t>(value(rng)) << 32U) | value(rng);
+    }
+    return submeshes;
+}
+
+// Both variants copy the unsorted input back before each sort, the copy is part of the measured time.
+void SortSlotSubmeshes(benchmark::State& state, RenderNodeSceneUtil::RenderSlotSubmeshScratch* scratch)
+{
+    const auto input = CreateSubmeshes(static_cast<size_t>(state.range(0)));
+    BASE_NS::vector<SlotSubmeshIndex> submeshes(input.size());
+    for (auto _ : state) {
+        std::copy(input.cbegin(), input.cend(), submeshes.begin());
+        if (scratch) {
+            RenderNodeSceneUtil::SortSlotSubmeshes(submeshes, true, *scratch);
+        } else {
+            RenderNodeSceneUtil::SortSlotSubmeshes(submeshes, true);
+        }
+        benchmark::DoNotOptimize(submeshes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+// Allocates the sort buffers on every call like the public IRenderNodeSceneUtil wrapper.
+void SortSlotSubmeshesTemporary(benchmark::State& state)
+{
+    SortSlotSubmeshes(state, nullptr);
+}
+
+// Reuses the buffers like the render slot nodes do from frame to frame.
+void SortSlotSubmeshesScratch(benchmark::State& state)
+{
+    RenderNodeSceneUtil::RenderSlotSubmeshScratch scratch;
+    SortSlotSubmeshes(state, &scratch);
+}
+
+// Sorts large slots with a thread pool like the render slot nodes do when the renderer has one.
+void SortSlotSubmeshesParallel(benchmark::State& state)
+{
+    CORE_NS::CreatePluginRegistry(CORE_NS::PlatformCreateInfo{});
+    const auto factory = CORE_NS::GetInstance<CORE_NS::ITaskQueueFactory>(CORE_NS::UID_TASK_QUEUE_FACTORY);
+    const auto threadPool = factory->CreateThreadPool(4U);
+    RenderNodeSceneUtil::RenderSlotSubmeshScratch scratch;
+    scratch.threadPool = threadPool.get();
+    SortSlotSubmeshes(state, &scratch);
+}
+
+// Argument is the number of submeshes in the render slot.
+BENCHMARK(SortSlotSubmeshesTemporary)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(SortSlotSubmeshesScratch)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(SortSlotSubmeshesParallel)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+}  // namespace benchmarks
+CORE3D_END_NAMESPACE()
@@ -359,6 +359,42 @@ UNIT_TEST(SRC_GLTFLoaderTest, loadFromMemoryGlbFile, testing::ext::TestSize.Leve
     validateWaterBottle(data);
 }
 
+/**
+ * @tc.name: loadFromMemoryGlbFileBorrowsBuffers
+ * @tc.desc: Tests that the binary chunk of a GLB loaded from memory is used in place instead of being copied.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_GLTFLoaderTest, loadFromMemoryGlbFileBorrowsBuffers, testing::ext::TestSize.Level1)
+{
+    auto& files = UTest::GetTestContext()->engine->GetFileManager();
+
+    string_view filename = "test://gltf/WaterBottle/WaterBottle.glb";
+    Gltf2 g(files);
+
+    auto const file = files.OpenFile(filename);
+    auto const fileSize = file->GetLength();
+    auto fileBuffer = std::vector<uint8_t>(fileSize);
+    file->Read(fileBuffer.data(), fileBuffer.size());
+    auto igltf = g.LoadGLTF(array_view<uint8_t const>(fileBuffer.data(), fileBuffer.size()));
+
+    ASSERT_TRUE(igltf.success);
+    ASSERT_TRUE(igltf.data->LoadBuffers());
+    const auto& data = (GLTF2::Data&)(*igltf.data);
+    ASSERT_FALSE(data.buffers.empty());
+
+    const uint8_t* begin = fileBuffer.data();
+    const uint8_t* end = fileBuffer.data() + fileBuffer.size();
+    for (const auto& buffer : data.buffers) {
+        EXPECT_TRUE(buffer->data.empty());
+        EXPECT_GE(buffer->GetData().data(), begin);
+        EXPECT_LE(buffer->GetData().data() + buffer->GetData().size(), end);
+    }
+    for (const auto& view : data.bufferViews) {
+        EXPECT_GE(view->data, begin);
+        EXPECT_LE(view->data + view->byteLength, end);
+    }
+}
+
 /**
  * @tc.name: loadFromMemoryGltfWithBase64EncodedData
  * @tc.desc: Tests for Load From Memory Gltf With Base64Encoded Data. [AUTO-GENERATED]
@@ -718,6 +754,72 @@ UNIT_TEST(SRC_GLTFLoaderTest, InvalidAccessorTest, testing::ext::TestSize.Level1
     delete gltf2;
 }
 
+/**
+ * @tc.name: MeshGpuInstancingTest
+ * @tc.desc: Tests parsing and validation of the EXT_mesh_gpu_instancing node extension.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_GLTFLoaderTest, MeshGpuInstancingTest, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto engine = testContext->engine;
+    auto graphicsContext = testContext->graphicsContext;
+    auto gltf2 = new Gltf2(*graphicsContext);
+
+    const auto load = [&engine, gltf2](const string_view jsonStr) {
+        auto tmpFile = engine->GetFileManager().CreateFile("cache://tmp.gltf");
+        tmpFile->Write(jsonStr.data(), jsonStr.size());
+        tmpFile->Close();
+        auto gltf = gltf2->LoadGLTF("cache://tmp.gltf");
+        engine->GetFileManager().DeleteFile("cache://tmp.gltf");
+        return gltf;
+    };
+
+    {
+        constexpr const string_view jsonStr =
+            "{\"asset\": {\"version\": \"2.0\"}, \"extensionsUsed\": [\"EXT_mesh_gpu_instancing\"], \"accessors\": "
+            "[{\"componentType\": 5126, \"count\": 4, \"type\": \"VEC3\"}, {\"componentType\": 5126, \"count\": 4, "
+            "\"type\": \"VEC4\"}], \"nodes\": [{\"extensions\": {\"EXT_mesh_gpu_instancing\": {\"attributes\": "
+            "{\"TRANSLATION\": 0, \"ROTATION\": 1}}}}]}";
+        auto gltf = load(jsonStr);
+        ASSERT_TRUE(gltf.success);
+        const auto& data = (GLTF2::Data&)(*gltf.data);
+        ASSERT_EQ(data.nodes.size(), 1U);
+        const auto& instancing = data.nodes[0]->gpuInstancing;
+        EXPECT_EQ(instancing.translation, data.accessors[0].get());
+        EXPECT_EQ(instancing.rotation, data.accessors[1].get());
+        EXPECT_EQ(instancing.scale, nullptr);
+    }
+
+    {
+        // attribute counts differ.
+        constexpr const string_view jsonStr =
+            "{\"asset\": {\"version\": \"2.0\"}, \"accessors\": [{\"componentType\": 5126, \"count\": 4, \"type\": "
+            "\"VEC3\"}, {\"componentType\": 5126, \"count\": 3, \"type\": \"VEC3\"}], \"nodes\": [{\"extensions\": "
+            "{\"EXT_mesh_gpu_instancing\": {\"attributes\": {\"TRANSLATION\": 0, \"SCALE\": 1}}}}]}";
+        EXPECT_FALSE(load(jsonStr).success);
+    }
+
+    {
+        // translation must be VEC3.
+        constexpr const string_view jsonStr =
+            "{\"asset\": {\"version\": \"2.0\"}, \"accessors\": [{\"componentType\": 5126, \"count\": 4, \"type\": "
+            "\"VEC4\"}], \"nodes\": [{\"extensions\": {\"EXT_mesh_gpu_instancing\": {\"attributes\": "
+            "{\"TRANSLATION\": 0}}}}]}";
+        EXPECT_FALSE(load(jsonStr).success);
+    }
+
+    {
+        // accessor index out of range.
+        constexpr const string_view jsonStr =
+            "{\"asset\": {\"version\": \"2.0\"}, \"nodes\": [{\"extensions\": {\"EXT_mesh_gpu_instancing\": "
+            "{\"attributes\": {\"TRANSLATION\": 3}}}}]}";
+        EXPECT_FALSE(load(jsonStr).success);
+    }
+
+    delete gltf2;
+}
+
 /**
  * @tc.name: InvalidMeshTest
  * @tc.desc: Tests for Invalid Mesh Test. [AUTO-GENERATED]
@@ -27,11 +27,13 @@
 #include <base/math/matrix_util.h>
 #include <base/math/quaternion_util.h>
 #include <core/ecs/intf_ecs.h>
+#include <core/implementation_uids.h>
 #include <core/intf_engine.h>
 #include <core/io/intf_file_manager.h>
 #include <core/json/json.h>
 #include <core/os/intf_platform.h>
 #include <core/plugin/intf_plugin_register.h>
+#include <core/threading/intf_thread_pool.h>
 #include <render/render_data_structures.h>
 
 #include "gltf/data.h"
@@ -502,8 +504,15 @@ UNIT_TEST(SRC_GLTFUtilTest, GltfDataTest, testing::ext::TestSize.Level1)
     data.buffers.back()->data.clear();
     EXPECT_FALSE(data.LoadBuffers());
 
-    // Load buffer from memory file
-    data.memoryFile_ = fileManager.OpenFile("test://image/canine_512x512.png");
+    // Load buffer from memory
+    vector<uint8_t> memory;
+    {
+        auto file = fileManager.OpenFile("test://image/canine_512x512.png");
+        ASSERT_TRUE(file);
+        memory.resize(static_cast<size_t>(file->GetLength()));
+        file->Read(memory.data(), memory.size());
+    }
+    data.memoryData_ = memory;
     data.buffers.back()->byteLength = bigByteSize;
     data.buffers.back()->uri = "";
     data.defaultResources = "test://image/canine_512x512.png";
@@ -513,7 +522,7 @@ UNIT_TEST(SRC_GLTFUtilTest, GltfDataTest, testing::ext::TestSize.Level1)
     data.defaultResourcesOffset = 0;
     EXPECT_FALSE(data.LoadBuffers());
 
-    data.memoryFile_.reset();
+    data.memoryData_ = {};
     data.buffers.back()->byteLength = 4u;
     data.buffers.back()->uri = "nonExistingBuffer.bin";
     data.buffers.back()->data.clear();
@@ -530,6 +539,51 @@ UNIT_TEST(SRC_GLTFUtilTest, GltfDataTest, testing::ext::TestSize.Level1)
     EXPECT_EQ("", data.GetThumbnailImage(5).extension);
 }
 
+/**
+ * @tc.name: GltfDataParallelLoadTest
+ * @tc.desc: Tests loading buffers with a thread pool and that the error of the first failing buffer is reported.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_GLTFUtilTest, GltfDataParallelLoadTest, testing::ext::TestSize.Level1)
+{
+    auto& fileManager = UTest::GetTestContext()->engine->GetFileManager();
+    auto threadPool = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY)->CreateThreadPool(4U);
+    ASSERT_TRUE(threadPool);
+
+    constexpr size_t bufferCount = 16U;
+    GLTF2::Data data{fileManager};
+    data.filepath = "test://image";
+    for (size_t i = 0U; i < bufferCount; ++i) {
+        data.buffers.push_back(unique_ptr<GLTF2::Buffer>{new GLTF2::Buffer{}});
+        data.buffers.back()->byteLength = 4u;
+        data.buffers.back()->uri = "data:application/octet-stream;base64,TFVNRQ==";
+
+        data.bufferViews.push_back(unique_ptr<GLTF2::BufferView>{new GLTF2::BufferView{}});
+        data.bufferViews.back()->buffer = data.buffers.back().get();
+        data.bufferViews.back()->byteLength = 2u;
+        data.bufferViews.back()->byteOffset = 2u;
+    }
+    data.buffers[5U]->uri = "data:application/octet-stream;base64,";
+    data.buffers[11U]->uri = "nonExistingBuffer.bin";
+
+    for (int i = 0; i < 4; ++i) {
+        GLTF2::BufferLoadResult result = GLTF2::LoadBuffers(&data, fileManager, threadPool.get());
+        EXPECT_FALSE(result.success);
+        EXPECT_EQ("Failed to decode data uri: data:application/octet-stream;base64,\n", result.error);
+        data.ReleaseBuffers();
+    }
+
+    data.buffers[5U]->uri = "data:application/octet-stream;base64,TFVNRQ==";
+    data.buffers[11U]->uri = "data:application/octet-stream;base64,TFVNRQ==";
+    GLTF2::BufferLoadResult result = GLTF2::LoadBuffers(&data, fileManager, threadPool.get());
+    ASSERT_TRUE(result.success);
+    for (const auto& view : data.bufferViews) {
+        ASSERT_NE(nullptr, view->data);
+        EXPECT_EQ('M', view->data[0U]);
+        EXPECT_EQ('E', view->data[1U]);
+    }
+}
+
 /**
  * @tc.name: GltfDataSeekFailureTest
  * @tc.desc: Tests for Gltf Data Seek Failure Test.
@@ -540,27 +594,67 @@ UNIT_TEST(SRC_GLTFUtilTest, GltfDataSeekFailureTest, testing::ext::TestSize.Leve
     auto& fileManager = UTest::GetTestContext()->engine->GetFileManager();
 
     GLTF2::Data data{fileManager};
+    data.filepath = "memory:/";
     data.defaultResourcesOffset = 1;  // equal to file length below
-    data.defaultResources = "cache://seek_fail_buffer.bin";
+    data.defaultResources = "seek_fail_buffer.bin";
 
     data.buffers.push_back(unique_ptr<GLTF2::Buffer>{new GLTF2::Buffer{}});
     data.buffers.back()->byteLength = 1;
     data.buffers.back()->uri = "";
 
-    {
-        auto file = fileManager.CreateFile("cache://seek_fail_buffer.bin");
-        ASSERT_TRUE(file);
-        const uint8_t byte = 0u;
-        file->Write(&byte, 1u);
-        file->Close();
-        data.memoryFile_ = move(file);
-    }
+    // memory files exist only while a handle is open.
+    auto file = fileManager.CreateFile("memory://seek_fail_buffer.bin");
+    ASSERT_TRUE(file);
+    const uint8_t byte = 0u;
+    file->Write(&byte, 1u);
 
     GLTF2::BufferLoadResult seekFailedResult = GLTF2::LoadBuffers(&data, fileManager);
     EXPECT_FALSE(seekFailedResult.success);
     EXPECT_NE(seekFailedResult.error.find("Failed to seek buffer"), BASE_NS::string::npos);
 
-    fileManager.DeleteFile("cache://seek_fail_buffer.bin");
+    fileManager.DeleteFile("memory://seek_fail_buffer.bin");
+}
+
+/**
+ * @tc.name: GltfDataMemoryBufferTest
+ * @tc.desc: Tests that buffers of glTF data loaded from memory point into the memory and are bounds checked.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_GLTFUtilTest, GltfDataMemoryBufferTest, testing::ext::TestSize.Level1)
+{
+    auto& fileManager = UTest::GetTestContext()->engine->GetFileManager();
+
+    const uint8_t memory[] = {0u, 1u, 2u, 3u};
+    GLTF2::Data data{fileManager};
+    data.memoryData_ = memory;
+    data.defaultResourcesOffset = 1;
+    data.defaultResources = "memory://buffer.glb";
+
+    data.buffers.push_back(unique_ptr<GLTF2::Buffer>{new GLTF2::Buffer{}});
+    data.buffers.back()->byteLength = 3;
+    data.buffers.back()->uri = "";
+
+    data.bufferViews.push_back(unique_ptr<GLTF2::BufferView>{new GLTF2::BufferView{}});
+    data.bufferViews.back()->buffer = data.buffers[0].get();
+    data.bufferViews.back()->byteLength = 2u;
+    data.bufferViews.back()->byteOffset = 1u;
+
+    GLTF2::BufferLoadResult result = GLTF2::LoadBuffers(&data, fileManager);
+    ASSERT_TRUE(result.success);
+    EXPECT_TRUE(data.buffers[0]->data.empty());
+    EXPECT_EQ(memory + 1, data.buffers[0]->GetData().data());
+    EXPECT_EQ(3u, data.buffers[0]->GetData().size());
+    EXPECT_EQ(memory + 2, data.bufferViews[0]->data);
+
+    data.ReleaseBuffers();
+    EXPECT_TRUE(data.buffers[0]->GetData().empty());
+    EXPECT_EQ(nullptr, data.bufferViews[0]->data);
+
+    // the buffer would extend past the end of the memory.
+    data.defaultResourcesOffset = 2;
+    result = GLTF2::LoadBuffers(&data, fileManager);
+    EXPECT_FALSE(result.success);
+    EXPECT_NE(result.error.find("Buffer larger than data"), BASE_NS::string::npos);
 }
 
 /**
@@ -22,11 +22,14 @@
 #include <base/containers/unique_ptr.h>
 #include <base/math/vector_util.h>
 #include <core/ecs/intf_entity_manager.h>
+#include <core/implementation_uids.h>
 #include <core/intf_engine.h>
 #include <core/plugin/intf_plugin.h>
+#include <core/plugin/intf_plugin_register.h>
 #include <core/property/intf_property_api.h>
 #include <core/property/intf_property_handle.h>
 #include <core/property/property_types.h>
+#include <core/threading/intf_thread_pool.h>
 #include <render/datastore/intf_render_data_store.h>
 #include <render/datastore/intf_render_data_store_manager.h>
 #include <render/device/intf_device.h>
@@ -115,3 +118,51 @@ UNIT_TEST(SRC_RenderNodeSceneUtil, CustomCameraTargetsAttachmentIndexClamped, te
     // Without the clamp these write past the attachmentHandles array.
     util.UpdateRenderPassFromCamera(camera, *renderPass);
 }
+
+/**
+ * @tc.name: SortSlotSubmeshes
+ * @tc.desc: Large slots are radix sorted, with a thread pool the largest ones in parallel. The result must have the
+ *           same key order as the comparison sort used for small slots, ascending by sort layer and ascending or
+ *           descending by sort key.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_RenderNodeSceneUtil, SortSlotSubmeshes, testing::ext::TestSize.Level1)
+{
+    const auto threadPool = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY)->CreateThreadPool(4U);
+    ASSERT_TRUE(threadPool);
+    RenderNodeSceneUtil::RenderSlotSubmeshScratch scratch;
+    scratch.threadPool = threadPool.get();
+    for (const uint32_t count : {100U, 5000U, 50000U}) {
+        for (const bool descending : {false, true}) {
+            vector<SlotSubmeshIndex> submeshIndices;
+            uint32_t seed = 12345U;
+            for (uint32_t idx = 0U; idx < count; ++idx) {
+                seed = seed * 1664525U + 1013904223U;
+                SlotSubmeshIndex submesh;
+                submesh.submeshIndex = idx;
+                submesh.sortLayerKey = (seed >> 28U) << 8U;
+                submesh.sortKey = (static_cast<uint64_t>(seed & 0xFFFFU) << 32U) | (seed >> 16U);
+                submeshIndices.push_back(submesh);
+            }
+            vector<SlotSubmeshIndex> expected = submeshIndices;
+            std::sort(expected.begin(), expected.end(), [descending](const auto& lhs, const auto& rhs) {
+                if (lhs.sortLayerKey != rhs.sortLayerKey) {
+                    return lhs.sortLayerKey < rhs.sortLayerKey;
+                }
+                return descending ? (lhs.sortKey > rhs.sortKey) : (lhs.sortKey < rhs.sortKey);
+            });
+
+            vector<SlotSubmeshIndex> parallelSubmeshIndices = submeshIndices;
+            RenderNodeSceneUtil::SortSlotSubmeshes(submeshIndices, descending);
+            RenderNodeSceneUtil::SortSlotSubmeshes(parallelSubmeshIndices, descending, scratch);
+            ASSERT_EQ(expected.size(), submeshIndices.size());
+            ASSERT_EQ(expected.size(), parallelSubmeshIndices.size());
+            for (size_t idx = 0U; idx < expected.size(); ++idx) {
+                EXPECT_EQ(expected[idx].sortLayerKey, submeshIndices[idx].sortLayerKey);
+                EXPECT_EQ(expected[idx].sortKey, submeshIndices[idx].sortKey);
+                EXPECT_EQ(expected[idx].sortLayerKey, parallelSubmeshIndices[idx].sortLayerKey);
+                EXPECT_EQ(expected[idx].sortKey, parallelSubmeshIndices[idx].sortKey);
+            }
+        }
+    }
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <util/aabb_tree.h>
+
+#include <3d/util/intf_picking.h>
+#include <base/containers/vector.h>
+#include <base/math/mathf.h>
+#include <base/math/vector.h>
+
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace BASE_NS;
+using namespace CORE3D_NS;
+
+namespace {
+bool IntersectRay(const MinAndMax& bounds, const Math::Vec3& start, const Math::Vec3& invDir)
+{
+    const float tx1 = (bounds.minAABB.x - start.x) * invDir.x;
+    const float tx2 = (bounds.maxAABB.x - start.x) * invDir.x;
+    float tmin = Math::min(tx1, tx2);
+    float tmax = Math::max(tx1, tx2);
+    const float ty1 = (bounds.minAABB.y - start.y) * invDir.y;
+    const float ty2 = (bounds.maxAABB.y - start.y) * invDir.y;
+    tmin = Math::max(tmin, Math::min(ty1, ty2));
+    tmax = Math::min(tmax, Math::max(ty1, ty2));
+    const float tz1 = (bounds.minAABB.z - start.z) * invDir.z;
+    const float tz2 = (bounds.maxAABB.z - start.z) * invDir.z;
+    tmin = Math::max(tmin, Math::min(tz1, tz2));
+    tmax = Math::min(tmax, Math::max(tz1, tz2));
+    return tmax >= tmin && tmax > 0.0f;
+}
+
+Math::Vec3 Inverse(const Math::Vec3& direction)
+{
+    constexpr float maxValue = std::numeric_limits<float>::max();
+    return {(direction.x != 0.0f) ? (1.0f / direction.x) : maxValue,
+        (direction.y != 0.0f) ? (1.0f / direction.y) : maxValue,
+        (direction.z != 0.0f) ? (1.0f / direction.z) : maxValue};
+}
+
+vector<uint32_t> TreeHits(const AabbTree& tree, const vector<MinAndMax>& bounds, const Math::Vec3& start,
+    const Math::Vec3& invDir)
+{
+    vector<uint32_t> hits;
+    tree.RayCast(start, invDir, [&](uint32_t item) {
+        if (IntersectRay(bounds[item], start, invDir)) {
+            hits.push_back(item);
+        }
+    });
+    std::sort(hits.begin(), hits.end());
+    return hits;
+}
+
+vector<uint32_t> AllHits(const vector<MinAndMax>& bounds, const Math::Vec3& start, const Math::Vec3& invDir)
+{
+    vector<uint32_t> hits;
+    for (uint32_t i = 0U; i < bounds.size(); ++i) {
+        if (IntersectRay(bounds[i], start, invDir)) {
+            hits.push_back(i);
+        }
+    }
+    return hits;
+}
+}  // namespace
+
+/**
+ * @tc.name: BuildAndRayCastTest
+ * @tc.desc: Tests that ray casting the tree finds the same boxes as testing all of them, also after refitting.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_AabbTree, BuildAndRayCastTest, testing::ext::TestSize.Level1)
+{
+    std::mt19937 rng(7U);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> size(0.0f, 3.0f);
+
+    constexpr uint32_t boxCount = 2000U;
+    vector<MinAndMax> bounds(boxCount);
+    for (auto& box : bounds) {
+        const Math::Vec3 center(position(rng), position(rng), position(rng));
+        const Math::Vec3 extents(size(rng), size(rng), size(rng));
+        box.minAABB = center - extents;
+        box.maxAABB = center + extents;
+    }
+
+    AabbTree tree;
+    EXPECT_TRUE(tree.Empty());
+    tree.Build(bounds);
+    EXPECT_FALSE(tree.Empty());
+    EXPECT_EQ(boxCount, tree.GetItemCount());
+
+    for (uint32_t pass = 0U; pass < 2U; ++pass) {
+        for (uint32_t ray = 0U; ray < 100U; ++ray) {
+            const Math::Vec3 start(position(rng), position(rng), position(rng));
+            Math::Vec3 direction(position(rng), position(rng), position(rng));
+            if ((ray % 4U) == 0U) {
+                // axis aligned rays use the max float inverse.
+                direction.y = 0.0f;
+            }
+            const auto invDir = Inverse(direction);
+            const auto expected = AllHits(bounds, start, invDir);
+            const auto hits = TreeHits(tree, bounds, start, invDir);
+            ASSERT_EQ(expected.size(), hits.size());
+            EXPECT_TRUE(std::equal(expected.cbegin(), expected.cend(), hits.cbegin()));
+        }
+
+        // move the boxes and refit.
+        for (auto& box : bounds) {
+            const Math::Vec3 offset(position(rng) * 0.1f, position(rng) * 0.1f, position(rng) * 0.1f);
+            box.minAABB = box.minAABB + offset;
+            box.maxAABB = box.maxAABB + offset;
+        }
+        tree.Refit(bounds);
+    }
+
+    tree.Clear();
+    EXPECT_TRUE(tree.Empty());
+    size_t visited = 0U;
+    tree.RayCast(Math::Vec3(0.0f, 0.0f, 0.0f), Math::Vec3(1.0f, 1.0f, 1.0f), [&visited](uint32_t) { ++visited; });
+    EXPECT_EQ(0U, visited);
+}
+
+/**
+ * @tc.name: IdenticalBoxesTest
+ * @tc.desc: Tests that boxes with the same center end up in one leaf and are all found.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_AabbTree, IdenticalBoxesTest, testing::ext::TestSize.Level1)
+{
+    constexpr uint32_t boxCount = 100U;
+    vector<MinAndMax> bounds(boxCount, MinAndMax{Math::Vec3(-1.0f, -1.0f, -1.0f), Math::Vec3(1.0f, 1.0f, 1.0f)});
+
+    AabbTree tree;
+    tree.Build(bounds);
+
+    const auto invDir = Inverse(Math::Vec3(0.0f, 0.0f, -1.0f));
+    EXPECT_EQ(boxCount, TreeHits(tree, bounds, Math::Vec3(0.0f, 0.0f, 5.0f), invDir).size());
+    EXPECT_EQ(0U, TreeHits(tree, bounds, Math::Vec3(2.0f, 0.0f, 5.0f), invDir).size());
+}
+
+/**
+ * @tc.name: QueryAndNearestTest
+ * @tc.desc: Tests that point queries find the boxes containing the point and nearest searches the closest boxes.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_AabbTree, QueryAndNearestTest, testing::ext::TestSize.Level1)
+{
+    std::mt19937 rng(9U);
+    std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.0f, 5.0f);
+
+    constexpr uint32_t boxCount = 1000U;
+    vector<MinAndMax> bounds(boxCount);
+    for (auto& box : bounds) {
+        const Math::Vec3 center(position(rng), position(rng), position(rng));
+        const Math::Vec3 extents(size(rng), size(rng), size(rng));
+        box.minAABB = center - extents;
+        box.maxAABB = center + extents;
+    }
+    AabbTree tree;
+    tree.Build(bounds);
+
+    const auto distance2 = [&bounds](uint32_t item, const Math::Vec3& point) {
+        const auto& box = bounds[item];
+        const Math::Vec3 outside = Math::max(
+            Math::max(box.minAABB - point, point - box.maxAABB), Math::Vec3(0.0f, 0.0f, 0.0f));
+        return Math::SqrMagnitude(outside);
+    };
+    for (uint32_t query = 0U; query < 100U; ++query) {
+        const Math::Vec3 point(position(rng), position(rng), position(rng));
+
+        vector<uint32_t> expected;
+        uint32_t closest = 0U;
+        for (uint32_t i = 0U; i < boxCount; ++i) {
+            if (distance2(i, point) == 0.0f) {
+                expected.push_back(i);
+            }
+            if (distance2(i, point) < distance2(closest, point)) {
+                closest = i;
+            }
+        }
+        vector<uint32_t> hits;
+        tree.Query(point, [&](uint32_t item) {
+            if (distance2(item, point) == 0.0f) {
+                hits.push_back(item);
+            }
+            return false;
+        });
+        std::sort(hits.begin(), hits.end());
+        ASSERT_EQ(expected.size(), hits.size());
+        EXPECT_TRUE(std::equal(expected.cbegin(), expected.cend(), hits.cbegin()));
+
+        uint32_t nearest = 0U;
+        float nearestDistance2 = std::numeric_limits<float>::max();
+        tree.Nearest(point, [&](uint32_t item) {
+            if (distance2(item, point) < nearestDistance2) {
+                nearest = item;
+                nearestDistance2 = distance2(item, point);
+            }
+            return nearestDistance2;
+        });
+        EXPECT_EQ(distance2(closest, point), nearestDistance2);
+        EXPECT_EQ(distance2(closest, point), distance2(nearest, point));
+    }
+
+    // returning true stops the query.
+    uint32_t visited = 0U;
+    tree.Query(bounds[0U].minAABB, [&visited](uint32_t) {
+        ++visited;
+        return true;
+    });
+    EXPECT_EQ(1U, visited);
+}
@@ -13,13 +13,18 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
+#include <map>
 #include <util/bowyer_watson_delaunay_3d.h>
 
 #include <3d/ecs/components/light_probe_group_component.h>
 #include <3d/light_probe_types/light_probe.h>
 #include <3d/light_probe_types/light_probe_constants.h>
 #include <base/math/vector.h>
+#include <base/math/vector_util.h>
 
 #include "test_framework.h"
 #if defined(UNIT_TESTS_USE_HCPPTEST)
@@ -231,6 +236,178 @@ vector<LightProbeGroupComponent::LightProbe> CreateManyProbes(uint32_t count)
 
     return probes;
 }
+
+// Portable generator so that the points are the same with every standard library.
+class PointGenerator {
+public:
+    explicit PointGenerator(uint32_t seed) : state_(seed) {}
+
+    float Next(float minValue, float maxValue)
+    {
+        state_ = state_ * 1664525U + 1013904223U;
+        return minValue + (maxValue - minValue) * static_cast<float>(state_ >> 8U) / static_cast<float>(1U << 24U);
+    }
+
+private:
+    uint32_t state_;
+};
+
+vector<LightProbeGroupComponent::LightProbe> CreateRandomProbes(uint32_t count, uint32_t seed, float halfSize = 10.0f)
+{
+    PointGenerator generator(seed);
+    vector<LightProbeGroupComponent::LightProbe> probes(count);
+    for (auto& probe : probes) {
+        probe.position.x = generator.Next(-halfSize, halfSize);
+        probe.position.y = generator.Next(-halfSize, halfSize);
+        probe.position.z = generator.Next(-halfSize, halfSize);
+    }
+    return probes;
+}
+
+using Topology = vector<std::array<uint32_t, LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT>>;
+
+Topology GetTopology(const vector<Tetrahedron>& tetrahedrons)
+{
+    Topology topology;
+    for (const auto& tet : tetrahedrons) {
+        std::array<uint32_t, LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT> indices;
+        std::copy(std::begin(tet.indices), std::end(tet.indices), indices.begin());
+        std::sort(indices.begin(), indices.end());
+        topology.push_back(indices);
+    }
+    std::sort(topology.begin(), topology.end());
+    return topology;
+}
+
+struct ReferenceSphere {
+    std::array<long double, 3> center;
+    long double radiusSquared;
+};
+
+// Circumsphere in long double, so that the reference doesn't share the rounding of the tested predicates.
+ReferenceSphere ComputeReferenceSphere(const vector<Math::Vec3>& points,
+    const std::array<uint32_t, LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT>& indices)
+{
+    const Math::Vec3& a = points[indices[0U]];
+    std::array<std::array<long double, 3>, 3> v;
+    for (uint32_t i = 0; i < 3U; ++i) {
+        const Math::Vec3& p = points[indices[i + 1U]];
+        v[i] = {static_cast<long double>(p.x) - a.x, static_cast<long double>(p.y) - a.y,
+            static_cast<long double>(p.z) - a.z};
+    }
+    const auto cross = [](const std::array<long double, 3>& l, const std::array<long double, 3>& r) {
+        return std::array<long double, 3>{
+            l[1U] * r[2U] - l[2U] * r[1U], l[2U] * r[0U] - l[0U] * r[2U], l[0U] * r[1U] - l[1U] * r[0U]};
+    };
+    const auto dot = [](const std::array<long double, 3>& l, const std::array<long double, 3>& r) {
+        return l[0U] * r[0U] + l[1U] * r[1U] + l[2U] * r[2U];
+    };
+    const std::array<long double, 3> cd = cross(v[1U], v[2U]);
+    const std::array<long double, 3> db = cross(v[2U], v[0U]);
+    const std::array<long double, 3> bc = cross(v[0U], v[1U]);
+    const long double denominator = 2.0L * dot(v[0U], cd);
+    ReferenceSphere sphere;
+    std::array<long double, 3> offset;
+    for (uint32_t i = 0; i < 3U; ++i) {
+        offset[i] = (dot(v[0U], v[0U]) * cd[i] + dot(v[1U], v[1U]) * db[i] + dot(v[2U], v[2U]) * bc[i]) / denominator;
+    }
+    sphere.center = {a.x + offset[0U], a.y + offset[1U], a.z + offset[2U]};
+    sphere.radiusSquared = dot(offset, offset);
+    return sphere;
+}
+
+// Delaunay tetrahedralization which tests every tetrahedron for every point, with points inserted in input order and
+// the same super tetrahedron as the tested implementation. For points in general position the result is unique.
+Topology BuildReferenceTopology(const vector<LightProbeGroupComponent::LightProbe>& probes)
+{
+    const auto probeCount = static_cast<uint32_t>(probes.size());
+    vector<Math::Vec3> points;
+    Math::Vec3 minP(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::max());
+    Math::Vec3 maxP(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+        std::numeric_limits<float>::lowest());
+    for (const auto& probe : probes) {
+        points.push_back(probe.position);
+        minP = Math::min(minP, probe.position);
+        maxP = Math::max(maxP, probe.position);
+    }
+    const Math::Vec3 center = (minP + maxP) * 0.5f;
+    const float scale = std::max(std::max({maxP.x - minP.x, maxP.y - minP.y, maxP.z - minP.z}) * 2.0f, 1.0f);
+    points.push_back({center.x - scale, center.y - scale, center.z - scale});
+    points.push_back({center.x + scale * 3.0f, center.y - scale, center.z - scale});
+    points.push_back({center.x - scale, center.y + scale * 3.0f, center.z - scale});
+    points.push_back({center.x - scale, center.y - scale, center.z + scale * 3.0f});
+
+    Topology tetrahedrons{{probeCount, probeCount + 1U, probeCount + 2U, probeCount + 3U}};
+    vector<ReferenceSphere> spheres{ComputeReferenceSphere(points, tetrahedrons[0U])};
+    for (uint32_t pointIndex = 0; pointIndex < probeCount; ++pointIndex) {
+        const Math::Vec3& point = points[pointIndex];
+        Topology kept;
+        vector<ReferenceSphere> keptSpheres;
+        std::map<std::array<uint32_t, 3>, uint32_t> faces;
+        for (size_t i = 0; i < tetrahedrons.size(); ++i) {
+            const ReferenceSphere& sphere = spheres[i];
+            const long double dx = point.x - sphere.center[0U];
+            const long double dy = point.y - sphere.center[1U];
+            const long double dz = point.z - sphere.center[2U];
+            if (dx * dx + dy * dy + dz * dz >= sphere.radiusSquared) {
+                kept.push_back(tetrahedrons[i]);
+                keptSpheres.push_back(sphere);
+                continue;
+            }
+            for (uint32_t skip = 0; skip < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++skip) {
+                std::array<uint32_t, 3> key;
+                for (uint32_t j = 0, k = 0; j < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++j) {
+                    if (j != skip) {
+                        key[k++] = tetrahedrons[i][j];
+                    }
+                }
+                std::sort(key.begin(), key.end());
+                ++faces[key];
+            }
+        }
+        // the faces of the removed tetrahedra which are not shared are connected to the point.
+        for (const auto& face : faces) {
+            if (face.second == 1U) {
+                kept.push_back({face.first[0U], face.first[1U], face.first[2U], pointIndex});
+                keptSpheres.push_back(ComputeReferenceSphere(points, kept.back()));
+            }
+        }
+        tetrahedrons = BASE_NS::move(kept);
+        spheres = BASE_NS::move(keptSpheres);
+    }
+
+    Topology result;
+    for (auto& tet : tetrahedrons) {
+        if (std::all_of(tet.begin(), tet.end(), [probeCount](uint32_t index) { return index < probeCount; })) {
+            std::sort(tet.begin(), tet.end());
+            result.push_back(tet);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+// Each face may be shared by at most two tetrahedra, otherwise tetrahedra overlap.
+bool ValidateFaceSharing(const vector<Tetrahedron>& tetrahedrons)
+{
+    std::map<std::array<uint32_t, 3>, uint32_t> faces;
+    for (const auto& tet : tetrahedrons) {
+        for (uint32_t skip = 0; skip < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++skip) {
+            std::array<uint32_t, 3> key;
+            for (uint32_t i = 0, k = 0; i < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++i) {
+                if (i != skip) {
+                    key[k++] = tet.indices[i];
+                }
+            }
+            std::sort(key.begin(), key.end());
+            if (++faces[key] > 2U) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
 }  // namespace
 
 UNIT_TEST(SRC_BowyerWatsonDelaunay3D, BuildTetrahedralMesh_FourProbes, testing::ext::TestSize.Level1)
@@ -406,4 +583,119 @@ UNIT_TEST(SRC_BowyerWatsonDelaunay3D, TetrahedronVertexMatch, testing::ext::Test
     delaunay.BuildTetrahedralMesh(volume);
 
     EXPECT_TRUE(ValidateVertexMatch(tetrahedrons, probes));
-}
\ No newline at end of file
+}
+/**
+ * @tc.name: BuildTetrahedralMesh_MatchesReferenceTopology
+ * @tc.desc: Tests that the walk based insertion creates the same tetrahedra as a reference which tests every
+ * tetrahedron for every point, and that building again gives the same tetrahedra in the same order.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_BowyerWatsonDelaunay3D, BuildTetrahedralMesh_MatchesReferenceTopology, testing::ext::TestSize.Level1)
+{
+    for (uint32_t seed = 1U; seed <= 32U; ++seed) {
+        const vector<LightProbeGroupComponent::LightProbe> probes = CreateRandomProbes(100U, seed);
+        vector<Tetrahedron> tetrahedrons;
+
+        BowyerWatsonDelaunay3D delaunay;
+        BowyerWatsonDelaunay3D::LightProbeVolume volume{probes, tetrahedrons};
+        delaunay.BuildTetrahedralMesh(volume);
+
+        const Topology topology = GetTopology(tetrahedrons);
+        const Topology reference = BuildReferenceTopology(probes);
+        ASSERT_EQ(reference.size(), topology.size());
+        EXPECT_TRUE(std::equal(reference.cbegin(), reference.cend(), topology.cbegin()));
+        EXPECT_TRUE(ValidateVertexMatch(tetrahedrons, probes));
+
+        vector<Tetrahedron> rebuilt;
+        BowyerWatsonDelaunay3D::LightProbeVolume rebuiltVolume{probes, rebuilt};
+        delaunay.BuildTetrahedralMesh(rebuiltVolume);
+        ASSERT_EQ(tetrahedrons.size(), rebuilt.size());
+        for (size_t i = 0; i < tetrahedrons.size(); ++i) {
+            const auto& indices = tetrahedrons[i].indices;
+            EXPECT_TRUE(std::equal(std::begin(indices), std::end(indices), std::begin(rebuilt[i].indices)));
+        }
+    }
+}
+
+/**
+ * @tc.name: BuildTetrahedralMesh_RandomProbes
+ * @tc.desc: Tests that random probes inside a cube, together with the cube corners, give a Delaunay tetrahedralization
+ * which fills the cube exactly without degenerate or overlapping tetrahedra.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_BowyerWatsonDelaunay3D, BuildTetrahedralMesh_RandomProbes, testing::ext::TestSize.Level1)
+{
+    constexpr float halfSize = 10.0f;
+    constexpr double cubeVolume = 8.0 * halfSize * halfSize * halfSize;
+    for (uint32_t seed = 1U; seed <= 32U; ++seed) {
+        // probes close to the cube faces give tetrahedra with circumspheres reaching the super tetrahedron, which are
+        // removed with it. Keeping the random probes in the middle half makes the hull exactly the cube.
+        vector<LightProbeGroupComponent::LightProbe> probes = CreateRandomProbes(100U, seed, halfSize * 0.5f);
+        for (uint32_t corner = 0U; corner < 8U; ++corner) {
+            LightProbeGroupComponent::LightProbe probe;
+            probe.position = Math::Vec3((corner & 1U) ? halfSize : -halfSize, (corner & 2U) ? halfSize : -halfSize,
+                (corner & 4U) ? halfSize : -halfSize);
+            probes.push_back(probe);
+        }
+        vector<Tetrahedron> tetrahedrons;
+
+        BowyerWatsonDelaunay3D delaunay;
+        BowyerWatsonDelaunay3D::LightProbeVolume volume{probes, tetrahedrons};
+        delaunay.BuildTetrahedralMesh(volume);
+
+        EXPECT_TRUE(ValidateIndices(tetrahedrons, probes.size()));
+        EXPECT_TRUE(ValidateVertexMatch(tetrahedrons, probes));
+        EXPECT_TRUE(ValidateAllPointsCovered(tetrahedrons, probes.size()));
+        EXPECT_TRUE(ValidateEmptyCircumsphere(tetrahedrons, probes));
+        EXPECT_TRUE(ValidateFaceSharing(tetrahedrons));
+
+        double totalVolume = 0.0;
+        for (const auto& tet : tetrahedrons) {
+            EXPECT_TRUE(ValidateNonDegenerate(tet));
+            totalVolume += CalculateTetrahedronVolume(tet);
+        }
+        EXPECT_NEAR(totalVolume, cubeVolume, cubeVolume * 1e-5);
+    }
+}
+
+/**
+ * @tc.name: BuildTetrahedralMesh_Grid
+ * @tc.desc: Tests that a regular grid of probes, where many probes share a circumsphere, fills the grid volume without
+ * degenerate or overlapping tetrahedra.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_BowyerWatsonDelaunay3D, BuildTetrahedralMesh_Grid, testing::ext::TestSize.Level1)
+{
+    constexpr uint32_t gridSize = 6U;
+    const Math::Vec3 spacing(1.0f, 0.5f, 2.0f);
+    vector<LightProbeGroupComponent::LightProbe> probes;
+    for (uint32_t x = 0; x < gridSize; ++x) {
+        for (uint32_t y = 0; y < gridSize; ++y) {
+            for (uint32_t z = 0; z < gridSize; ++z) {
+                LightProbeGroupComponent::LightProbe probe;
+                probe.position = Math::Vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) *
+                                 spacing;
+                probes.push_back(probe);
+            }
+        }
+    }
+    vector<Tetrahedron> tetrahedrons;
+
+    BowyerWatsonDelaunay3D delaunay;
+    BowyerWatsonDelaunay3D::LightProbeVolume volume{probes, tetrahedrons};
+    delaunay.BuildTetrahedralMesh(volume);
+
+    // cospherical probes can be split in different ways, but the tetrahedra must be Delaunay and fill the grid.
+    constexpr uint32_t cellCount = (gridSize - 1U) * (gridSize - 1U) * (gridSize - 1U);
+    EXPECT_TRUE(ValidateIndices(tetrahedrons, probes.size()));
+    EXPECT_TRUE(ValidateAllPointsCovered(tetrahedrons, probes.size()));
+    EXPECT_TRUE(ValidateEmptyCircumsphere(tetrahedrons, probes));
+    EXPECT_TRUE(ValidateFaceSharing(tetrahedrons));
+
+    float totalVolume = 0.0f;
+    for (const auto& tet : tetrahedrons) {
+        EXPECT_TRUE(ValidateNonDegenerate(tet));
+        totalVolume += CalculateTetrahedronVolume(tet);
+    }
+    EXPECT_NEAR(totalVolume, static_cast<float>(cellCount) * spacing.x * spacing.y * spacing.z, 1e-3f);
+}
@@ -13,10 +13,13 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
 #include <util/bowyer_watson_delaunay_3d.h>
 #include <util/light_probe_util.h>
+#include <util/light_probe_volume_index.h>
 
 #include <3d/light_probe_types/light_probe.h>
 #include <3d/light_probe_types/light_probe_constants.h>
@@ -728,4 +731,158 @@ UNIT_TEST(SRC_LightProbeUtil, GetInterpolatedLightProbeData_ManyProbesLinearRepr
         const float expectedAo = q.x * 0.1f + q.y * 0.1f + q.z * 0.1f;
         EXPECT_NEAR(result.lightProbeInterpolatedData.bentNormalAo.w, expectedAo, 0.01f);
     }
-}
\ No newline at end of file
+}
+namespace {
+vector<LightProbeGroupComponent::LightProbe> CreateRandomLightProbes(uint32_t count, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> value(0.0f, 1.0f);
+    vector<LightProbeGroupComponent::LightProbe> probes(count);
+    for (auto& probe : probes) {
+        probe.position = Math::Vec3(position(rng), position(rng), position(rng));
+        for (auto& sh : probe.shCoefficients) {
+            sh = Math::Vec3(value(rng), value(rng), value(rng));
+        }
+        probe.bentNormal = Math::Vec3(0.0f, 1.0f, 0.0f);
+        probe.ao = value(rng);
+    }
+    return probes;
+}
+}  // namespace
+
+/**
+ * @tc.name: LightProbeVolumeIndex_Neighbors
+ * @tc.desc: Tests that neighboring tetrahedra share a face and point back to each other.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_LightProbeUtil, LightProbeVolumeIndex_Neighbors, testing::ext::TestSize.Level1)
+{
+    const auto probes = CreateRandomLightProbes(100U, 3U);
+    vector<Tetrahedron> tets;
+    BowyerWatsonDelaunay3D delaunay;
+    BowyerWatsonDelaunay3D::LightProbeVolume buildVolume{probes, tets};
+    delaunay.BuildTetrahedralMesh(buildVolume);
+    ASSERT_GT(tets.size(), 0U);
+
+    LightProbeVolume volume{probes, tets};
+    LightProbeVolumeIndex index;
+    index.Build(volume);
+    EXPECT_TRUE(index.IsValidFor(volume));
+
+    uint32_t hullFaces = 0U;
+    for (uint32_t tet = 0U; tet < tets.size(); ++tet) {
+        for (uint32_t face = 0U; face < 4U; ++face) {
+            const uint32_t neighbor = index.GetNeighbor(tet, face);
+            if (neighbor == LightProbeVolumeIndex::INVALID_INDEX) {
+                ++hullFaces;
+                continue;
+            }
+            ASSERT_LT(neighbor, tets.size());
+            // the neighbor has all but the opposite vertex of the face.
+            const auto& neighborIndices = tets[neighbor].indices;
+            uint32_t shared = 0U;
+            for (uint32_t i = 0U; i < 4U; ++i) {
+                if ((i != face) && (std::count(neighborIndices, neighborIndices + 4U, tets[tet].indices[i]) == 1)) {
+                    ++shared;
+                }
+            }
+            EXPECT_EQ(3U, shared);
+            bool pointsBack = false;
+            for (uint32_t i = 0U; i < 4U; ++i) {
+                pointsBack = pointsBack || (index.GetNeighbor(neighbor, i) == tet);
+            }
+            EXPECT_TRUE(pointsBack);
+        }
+    }
+    EXPECT_GT(hullFaces, 0U);
+
+    index.Clear();
+    EXPECT_FALSE(index.IsValidFor(volume));
+}
+
+/**
+ * @tc.name: LightProbeVolumeIndex_MatchesLinearSearch
+ * @tc.desc: Tests that lookups through the index, with the hint carried along a path, give the same results as
+ * searching all tetrahedra and probes.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_LightProbeUtil, LightProbeVolumeIndex_MatchesLinearSearch, testing::ext::TestSize.Level1)
+{
+    const auto probes = CreateRandomLightProbes(300U, 5U);
+    vector<Tetrahedron> tets;
+    BowyerWatsonDelaunay3D delaunay;
+    BowyerWatsonDelaunay3D::LightProbeVolume buildVolume{probes, tets};
+    delaunay.BuildTetrahedralMesh(buildVolume);
+    ASSERT_GT(tets.size(), 0U);
+
+    LightProbeVolume volume{probes, tets};
+    LightProbeVolumeIndex index;
+    index.Build(volume);
+
+    std::mt19937 rng(11U);
+    std::uniform_real_distribution<float> position(-12.0f, 12.0f);
+    std::uniform_real_distribution<float> step(-0.5f, 0.5f);
+    uint32_t hint = LightProbeVolumeIndex::INVALID_INDEX;
+    uint32_t inside = 0U;
+    Math::Vec3 point(0.0f, 0.0f, 0.0f);
+    for (uint32_t i = 0U; i < 1000U; ++i) {
+        // mostly small steps like a moving object, sometimes a jump.
+        if ((i % 100U) == 0U) {
+            point = Math::Vec3(position(rng), position(rng), position(rng));
+        } else {
+            point = point + Math::Vec3(step(rng), step(rng), step(rng));
+        }
+
+        const auto expectedTet = LightProbeUtil::FindContainingTetrahedron(point, volume);
+        const uint32_t tet = index.FindContainingTetrahedron(volume, point, hint);
+        ASSERT_EQ(static_cast<bool>(expectedTet), tet != LightProbeVolumeIndex::INVALID_INDEX);
+        if (expectedTet) {
+            ++inside;
+            EXPECT_TRUE(LightProbeUtil::IsInsideTetrahedron(
+                LightProbeUtil::CalculateBarycentricCoordinates(point, tets[tet])));
+        }
+
+        const auto expected = LightProbeUtil::GetInterpolatedLightProbeData(volume, point);
+        const auto result = LightProbeUtil::GetInterpolatedLightProbeData(volume, index, point, hint);
+        ASSERT_EQ(expected.valid, result.valid);
+        for (uint32_t j = 0U; j < LightProbeConstants::LIGHT_PROBE_SH_COEFFICIENT_COUNT; ++j) {
+            const auto& expectedSh = expected.lightProbeInterpolatedData.shCoefficients[j];
+            const auto& sh = result.lightProbeInterpolatedData.shCoefficients[j];
+            EXPECT_NEAR(expectedSh.x, sh.x, 0.001f);
+            EXPECT_NEAR(expectedSh.y, sh.y, 0.001f);
+            EXPECT_NEAR(expectedSh.z, sh.z, 0.001f);
+        }
+        EXPECT_NEAR(expected.lightProbeInterpolatedData.bentNormalAo.w,
+            result.lightProbeInterpolatedData.bentNormalAo.w, 0.001f);
+    }
+    // both the inside and the nearest probe paths are covered.
+    EXPECT_GT(inside, 100U);
+    EXPECT_LT(inside, 900U);
+}
+
+/**
+ * @tc.name: LightProbeVolumeIndex_StaleIndex
+ * @tc.desc: Tests that an index built for another volume is not used.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_LightProbeUtil, LightProbeVolumeIndex_StaleIndex, testing::ext::TestSize.Level1)
+{
+    vector<LightProbeGroupComponent::LightProbe> probes = CreateTestLightProbes();
+    vector<Tetrahedron> tets = CreateTestTetrahedrons(probes);
+    LightProbeVolume volume{probes, tets};
+
+    LightProbeVolumeIndex index;
+    uint32_t hint = LightProbeVolumeIndex::INVALID_INDEX;
+    const Math::Vec3 position(0.1f, 0.1f, 0.1f);
+    const auto expected = LightProbeUtil::GetInterpolatedLightProbeData(volume, position);
+    const auto result = LightProbeUtil::GetInterpolatedLightProbeData(volume, index, position, hint);
+    ASSERT_TRUE(result.valid);
+    EXPECT_EQ(LightProbeVolumeIndex::INVALID_INDEX, hint);
+    EXPECT_FLOAT_EQ(expected.lightProbeInterpolatedData.shCoefficients[0].x,
+        result.lightProbeInterpolatedData.shCoefficients[0].x);
+
+    index.Build(volume);
+    LightProbeUtil::GetInterpolatedLightProbeData(volume, index, position, hint);
+    EXPECT_EQ(0U, hint);
+}